@@ -58,6 +58,9 @@ public class PlanetaryCreationEditor : ModuleRules
             PublicDefinitions.Add("PLANETARYCREATION_DISABLE_STAGEB_GPU=0");
         }
 
+        // MeshOptimizer sources bundled with RealtimeMeshComponent (compiled in Private/Utilities/MeshOptimizerSources.cpp).
+        PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "../../Plugins/RealtimeMeshComponent/Source/ThirdParty"));
+
         ConfigureStripack(Target);
         ConfigureGeogram(Target);
 
@@ -4,6 +4,87 @@
 #include "Utilities/PlanetaryCreationLogging.h"
 #include "Simulation/TectonicSimulationService.h"
 #include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    /** Spherical excess (Girard's theorem) of the triangle spanned by three directions; 0 for degenerate triangles. */
+    double ComputeSphericalTriangleArea(const FVector3d& V0, const FVector3d& V1, const FVector3d& V2)
+    {
+        // Normalize vertices (should already be normalized, but ensure it)
+        const FVector3d N0 = V0.GetSafeNormal();
+        const FVector3d N1 = V1.GetSafeNormal();
+        const FVector3d N2 = V2.GetSafeNormal();
+
+        // Calculate angles using dot products (clamped to avoid NaN from acos)
+        const double CosA = FMath::Clamp(FVector3d::DotProduct(N1, N2), -1.0, 1.0);
+        const double CosB = FMath::Clamp(FVector3d::DotProduct(N2, N0), -1.0, 1.0);
+        const double CosC = FMath::Clamp(FVector3d::DotProduct(N0, N1), -1.0, 1.0);
+
+        // Arc lengths (sides of spherical triangle)
+        const double a = FMath::Acos(CosA);
+        const double b = FMath::Acos(CosB);
+        const double c = FMath::Acos(CosC);
+
+        // Skip degenerate triangles
+        if (a < SMALL_NUMBER || b < SMALL_NUMBER || c < SMALL_NUMBER)
+        {
+            return 0.0;
+        }
+
+        // Compute spherical angles at vertices using spherical law of cosines
+        const double CosAlpha = (FMath::Cos(a) - FMath::Cos(b) * FMath::Cos(c)) / (FMath::Sin(b) * FMath::Sin(c));
+        const double CosBeta = (FMath::Cos(b) - FMath::Cos(c) * FMath::Cos(a)) / (FMath::Sin(c) * FMath::Sin(a));
+        const double CosGamma = (FMath::Cos(c) - FMath::Cos(a) * FMath::Cos(b)) / (FMath::Sin(a) * FMath::Sin(b));
+
+        const double Alpha = FMath::Acos(FMath::Clamp(CosAlpha, -1.0, 1.0));
+        const double Beta = FMath::Acos(FMath::Clamp(CosBeta, -1.0, 1.0));
+        const double Gamma = FMath::Acos(FMath::Clamp(CosGamma, -1.0, 1.0));
+
+        // Area equals excess for unit sphere
+        return Alpha + Beta + Gamma - PI;
+    }
+
+    /** Smallest interior angle (degrees) of the chord triangle ABC; 0 when an edge is degenerate. */
+    double ComputeTriangleMinAngleDegrees(const FVector3d& VertexA, const FVector3d& VertexB, const FVector3d& VertexC)
+    {
+        const FVector3d EdgeAB = VertexB - VertexA;
+        const FVector3d EdgeAC = VertexC - VertexA;
+        const FVector3d EdgeBC = VertexC - VertexB;
+
+        const double LengthAB = EdgeAB.Length();
+        const double LengthAC = EdgeAC.Length();
+        const double LengthBC = EdgeBC.Length();
+
+        if (LengthAB < KINDA_SMALL_NUMBER ||
+            LengthAC < KINDA_SMALL_NUMBER ||
+            LengthBC < KINDA_SMALL_NUMBER)
+        {
+            return 0.0;
+        }
+
+        const FVector3d NormalizedAB = EdgeAB / LengthAB;
+        const FVector3d NormalizedAC = EdgeAC / LengthAC;
+        const FVector3d NormalizedBA = -NormalizedAB;
+        const FVector3d NormalizedBC = EdgeBC / LengthBC;
+        const FVector3d NormalizedCA = -NormalizedAC;
+        const FVector3d NormalizedCB = -NormalizedBC;
+
+        const double AngleA = FMath::Acos(FMath::Clamp(FVector3d::DotProduct(NormalizedAB, NormalizedAC), -1.0, 1.0));
+        const double AngleB = FMath::Acos(FMath::Clamp(FVector3d::DotProduct(NormalizedBA, NormalizedBC), -1.0, 1.0));
+        const double AngleC = FMath::Acos(FMath::Clamp(FVector3d::DotProduct(NormalizedCA, NormalizedCB), -1.0, 1.0));
+
+        return FMath::RadiansToDegrees(FMath::Min3(AngleA, AngleB, AngleC));
+    }
+
+    /** Counter-clockwise seen from outside the sphere. */
+    bool IsOutwardFacing(const FVector3d& A, const FVector3d& B, const FVector3d& C)
+    {
+        return FVector3d::DotProduct(FVector3d::CrossProduct(B - A, C - A), A + B + C) > 0.0;
+    }
+}
 
 // Milestone 4 Task 1.1: Snapshot/Restore/Validate functions
 
@@ -33,12 +114,14 @@ void UTectonicSimulationService::RestoreRetessellationSnapshot(const FRetessella
     RenderTriangles = Snapshot.RenderTriangles;
     VertexPlateAssignments = Snapshot.VertexPlateAssignments;
     Boundaries = Snapshot.Boundaries;
+    InvalidatePlateMetadata();
 
     // Milestone 5: Restore erosion state on rollback
     VertexElevationValues = Snapshot.VertexElevationValues;
     VertexErosionRates = Snapshot.VertexErosionRates;
     VertexSedimentThickness = Snapshot.VertexSedimentThickness;
     VertexCrustAge = Snapshot.VertexCrustAge;
+    RenderVertexColumns.MarkAllColumnsChanged();
 
     UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Re-tessellation] Rolled back to timestamp %.2f My"), Snapshot.TimestampMy);
 }
@@ -102,47 +185,7 @@ bool UTectonicSimulationService::ValidateRetessellation(const FRetessellationSna
             RenderVertices.IsValidIndex(V1Idx) &&
             RenderVertices.IsValidIndex(V2Idx))
         {
-            const FVector3d& V0 = RenderVertices[V0Idx];
-            const FVector3d& V1 = RenderVertices[V1Idx];
-            const FVector3d& V2 = RenderVertices[V2Idx];
-
-            // Spherical triangle area using Girard's theorem: E = α + β + γ - π
-            // where α, β, γ are the angles at each vertex of the spherical triangle
-            // For unit sphere, Area = E (spherical excess in steradians)
-
-            // Normalize vertices (should already be normalized, but ensure it)
-            const FVector3d N0 = V0.GetSafeNormal();
-            const FVector3d N1 = V1.GetSafeNormal();
-            const FVector3d N2 = V2.GetSafeNormal();
-
-            // Calculate angles using dot products (clamped to avoid NaN from acos)
-            const double CosA = FMath::Clamp(FVector3d::DotProduct(N1, N2), -1.0, 1.0);
-            const double CosB = FMath::Clamp(FVector3d::DotProduct(N2, N0), -1.0, 1.0);
-            const double CosC = FMath::Clamp(FVector3d::DotProduct(N0, N1), -1.0, 1.0);
-
-            // Arc lengths (sides of spherical triangle)
-            const double a = FMath::Acos(CosA);
-            const double b = FMath::Acos(CosB);
-            const double c = FMath::Acos(CosC);
-
-            // Skip degenerate triangles
-            if (a < SMALL_NUMBER || b < SMALL_NUMBER || c < SMALL_NUMBER)
-                continue;
-
-            // Compute spherical angles at vertices using spherical law of cosines
-            const double CosAlpha = (FMath::Cos(a) - FMath::Cos(b) * FMath::Cos(c)) / (FMath::Sin(b) * FMath::Sin(c));
-            const double CosBeta = (FMath::Cos(b) - FMath::Cos(c) * FMath::Cos(a)) / (FMath::Sin(c) * FMath::Sin(a));
-            const double CosGamma = (FMath::Cos(c) - FMath::Cos(a) * FMath::Cos(b)) / (FMath::Sin(a) * FMath::Sin(b));
-
-            const double Alpha = FMath::Acos(FMath::Clamp(CosAlpha, -1.0, 1.0));
-            const double Beta = FMath::Acos(FMath::Clamp(CosBeta, -1.0, 1.0));
-            const double Gamma = FMath::Acos(FMath::Clamp(CosGamma, -1.0, 1.0));
-
-            // Spherical excess (Girard's theorem)
-            const double SphericalExcess = Alpha + Beta + Gamma - PI;
-
-            // Area equals excess for unit sphere
-            TotalMeshArea += SphericalExcess;
+            TotalMeshArea += ComputeSphericalTriangleArea(RenderVertices[V0Idx], RenderVertices[V1Idx], RenderVertices[V2Idx]);
         }
     }
 
@@ -172,8 +215,380 @@ bool UTectonicSimulationService::ValidateRetessellation(const FRetessellationSna
     return true;
 }
 
+// Incremental re-tessellation: undo journal, local validation and boundary edge flips
+
+void UTectonicSimulationService::FRetessellationJournal::RecordTriangle(const TArray<int32>& InRenderTriangles, int32 TriangleIndex)
+{
+    bool bAlreadyJournaled = false;
+    JournaledTriangles.Add(TriangleIndex, &bAlreadyJournaled);
+    if (bAlreadyJournaled)
+    {
+        return;
+    }
+
+    FTriangleEntry& Entry = Triangles.AddDefaulted_GetRef();
+    Entry.TriangleIndex = TriangleIndex;
+    for (int32 Corner = 0; Corner < 3; ++Corner)
+    {
+        Entry.Corners[Corner] = InRenderTriangles[TriangleIndex * 3 + Corner];
+    }
+}
+
+void UTectonicSimulationService::JournalRetessellationVertex(FRetessellationJournal& Journal, int32 VertexIdx) const
+{
+    bool bAlreadyJournaled = false;
+    Journal.JournaledVertices.Add(VertexIdx, &bAlreadyJournaled);
+    if (bAlreadyJournaled)
+    {
+        return;
+    }
+
+    FRetessellationJournal::FVertexEntry& Entry = Journal.Vertices.AddDefaulted_GetRef();
+    Entry.VertexIndex = VertexIdx;
+    Entry.PlateAssignment = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
+    Entry.Elevation = VertexElevationValues.IsValidIndex(VertexIdx) ? VertexElevationValues[VertexIdx] : 0.0;
+    Entry.AmplifiedElevation = VertexAmplifiedElevation.IsValidIndex(VertexIdx) ? VertexAmplifiedElevation[VertexIdx] : 0.0;
+    Entry.ErosionRate = VertexErosionRates.IsValidIndex(VertexIdx) ? VertexErosionRates[VertexIdx] : 0.0;
+    Entry.SedimentThickness = VertexSedimentThickness.IsValidIndex(VertexIdx) ? VertexSedimentThickness[VertexIdx] : 0.0;
+    Entry.CrustAge = VertexCrustAge.IsValidIndex(VertexIdx) ? VertexCrustAge[VertexIdx] : 0.0;
+}
+
+void UTectonicSimulationService::RollbackRetessellationJournal(const FRetessellationJournal& Journal)
+{
+    for (const FRetessellationJournal::FTriangleEntry& Entry : Journal.Triangles)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            RenderTriangles[Entry.TriangleIndex * 3 + Corner] = Entry.Corners[Corner];
+        }
+    }
+
+    for (const FRetessellationJournal::FVertexEntry& Entry : Journal.Vertices)
+    {
+        const int32 VertexIdx = Entry.VertexIndex;
+        if (VertexPlateAssignments.IsValidIndex(VertexIdx)) VertexPlateAssignments[VertexIdx] = Entry.PlateAssignment;
+        if (VertexElevationValues.IsValidIndex(VertexIdx)) VertexElevationValues[VertexIdx] = Entry.Elevation;
+        if (VertexAmplifiedElevation.IsValidIndex(VertexIdx)) VertexAmplifiedElevation[VertexIdx] = Entry.AmplifiedElevation;
+        if (VertexErosionRates.IsValidIndex(VertexIdx)) VertexErosionRates[VertexIdx] = Entry.ErosionRate;
+        if (VertexSedimentThickness.IsValidIndex(VertexIdx)) VertexSedimentThickness[VertexIdx] = Entry.SedimentThickness;
+        if (VertexCrustAge.IsValidIndex(VertexIdx)) VertexCrustAge[VertexIdx] = Entry.CrustAge;
+    }
+
+    if (Journal.Triangles.Num() > 0)
+    {
+        BuildRenderVertexAdjacency();
+    }
+    if (Journal.Triangles.Num() > 0 || Journal.Vertices.Num() > 0)
+    {
+        CachedVoronoiAssignments = VertexPlateAssignments;
+        BuildRenderVertexBoundaryCache();
+    }
+    InvalidatePlateMetadata();
+    RenderVertexColumns.MarkAllColumnsChanged();
+
+    UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Re-tessellation] Rolled back %d triangle(s) and %d vertex record(s) to timestamp %.2f My"),
+        Journal.Triangles.Num(), Journal.Vertices.Num(), Journal.TimestampMy);
+}
+
+bool UTectonicSimulationService::ValidateRetessellationJournal(const FRetessellationJournal& Journal) const
+{
+    // Flips never add or remove vertices, edges or faces (the new diagonal is checked to be unique before flipping),
+    // so the Euler characteristic holds by construction; only the rewritten region is checked here.
+    double AreaBefore = 0.0;
+    double AreaAfter = 0.0;
+    for (const FRetessellationJournal::FTriangleEntry& Entry : Journal.Triangles)
+    {
+        const int32* Corners = &RenderTriangles[Entry.TriangleIndex * 3];
+        if (!RenderVertices.IsValidIndex(Corners[0]) || !RenderVertices.IsValidIndex(Corners[1]) || !RenderVertices.IsValidIndex(Corners[2]) ||
+            Corners[0] == Corners[1] || Corners[1] == Corners[2] || Corners[2] == Corners[0])
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("[Re-tessellation] Validation failed: triangle %d has invalid corners"), Entry.TriangleIndex);
+            return false;
+        }
+
+        const FVector3d& V0 = RenderVertices[Corners[0]];
+        const FVector3d& V1 = RenderVertices[Corners[1]];
+        const FVector3d& V2 = RenderVertices[Corners[2]];
+        if (!IsOutwardFacing(V0, V1, V2))
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("[Re-tessellation] Validation failed: triangle %d is inverted"), Entry.TriangleIndex);
+            return false;
+        }
+
+        AreaAfter += ComputeSphericalTriangleArea(V0, V1, V2);
+        AreaBefore += ComputeSphericalTriangleArea(
+            RenderVertices[Entry.Corners[0]], RenderVertices[Entry.Corners[1]], RenderVertices[Entry.Corners[2]]);
+    }
+
+    // A flip re-triangulates a convex quad, so the region's area is unchanged up to rounding.
+    const double AreaVariance = AreaBefore > 0.0 ? FMath::Abs((AreaAfter - AreaBefore) / AreaBefore) : 0.0;
+    if (AreaVariance > 0.01) // >1% variance
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Re-tessellation] Validation warning: Region area %.6f sr (was %.6f sr, variance %.2f%%)"),
+            AreaAfter, AreaBefore, AreaVariance * 100.0);
+        // Don't fail on this - just warn
+    }
+
+    for (const FRetessellationJournal::FVertexEntry& Entry : Journal.Vertices)
+    {
+        const int32 Assignment = VertexPlateAssignments.IsValidIndex(Entry.VertexIndex) ? VertexPlateAssignments[Entry.VertexIndex] : INDEX_NONE;
+        if (Assignment == INDEX_NONE)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("[Re-tessellation] Validation failed: Vertex %d with INDEX_NONE assignment"), Entry.VertexIndex);
+            return false;
+        }
+    }
+
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[Re-tessellation] Validation passed: %d triangle(s), %d vertex record(s), RegionAreaVariance=%.4f%%"),
+        Journal.Triangles.Num(), Journal.Vertices.Num(), AreaVariance * 100.0);
+
+    return true;
+}
+
+int32 UTectonicSimulationService::RefineDriftedPlateBoundaries(const TArray<int32>& DriftedPlateIDs, FRetessellationJournal& Journal)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefineDriftedPlateBoundaries);
+
+    const int32 VertexCount = RenderVertices.Num();
+    const int32 TriangleCount = RenderTriangles.Num() / 3;
+    if (TriangleCount == 0 || DriftedPlateIDs.Num() == 0)
+    {
+        return 0;
+    }
+
+    const TSet<int32> DriftedPlates(DriftedPlateIDs);
+    auto GetPlateID = [this](int32 VertexIdx)
+    {
+        return VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
+    };
+
+    // Seed: triangles straddling a plate boundary with at least one corner on a drifted plate.
+    TArray<int32> Queue;
+    for (int32 TriangleIdx = 0; TriangleIdx < TriangleCount; ++TriangleIdx)
+    {
+        const int32 PlateA = GetPlateID(RenderTriangles[TriangleIdx * 3]);
+        const int32 PlateB = GetPlateID(RenderTriangles[TriangleIdx * 3 + 1]);
+        const int32 PlateC = GetPlateID(RenderTriangles[TriangleIdx * 3 + 2]);
+        if (PlateA == PlateB && PlateB == PlateC)
+        {
+            continue;
+        }
+        if (DriftedPlates.Contains(PlateA) || DriftedPlates.Contains(PlateB) || DriftedPlates.Contains(PlateC))
+        {
+            Queue.Add(TriangleIdx);
+        }
+    }
+
+    Journal.TrianglesTouched = Queue.Num();
+    if (Queue.Num() == 0)
+    {
+        return 0;
+    }
+
+    if (RenderVertexTriangleIncidenceTopologyVersion != TopologyVersion ||
+        RenderVertexTriangleOffsets.Num() != VertexCount + 1 ||
+        RenderVertexTriangles.Num() != RenderTriangles.Num())
+    {
+        BuildRenderVertexTriangleIncidence();
+    }
+
+    // Patch vertices of in-flight terranes stay put: reattachment finds the cap triangles by their corners.
+    TBitArray<> LockedVertices(false, VertexCount);
+    for (const FContinentalTerrane& Terrane : Terranes)
+    {
+        for (int32 VertexIdx : Terrane.PatchVertexIndices)
+        {
+            if (VertexIdx >= 0 && VertexIdx < VertexCount)
+            {
+                LockedVertices[VertexIdx] = true;
+            }
+        }
+    }
+
+    // Incidence for vertices whose fan changed during this pass; everything else reads the CSR index.
+    TMap<int32, TArray<int32>> IncidenceOverlay;
+    auto GetIncidence = [&](int32 VertexIdx) -> TArray<int32>&
+    {
+        if (TArray<int32>* Existing = IncidenceOverlay.Find(VertexIdx))
+        {
+            return *Existing;
+        }
+        TArray<int32>& Fan = IncidenceOverlay.Add(VertexIdx);
+        for (int32 Offset = RenderVertexTriangleOffsets[VertexIdx]; Offset < RenderVertexTriangleOffsets[VertexIdx + 1]; ++Offset)
+        {
+            Fan.Add(RenderVertexTriangles[Offset]);
+        }
+        return Fan;
+    };
+
+    // Corner following the directed edge From -> To in TriangleIdx, or INDEX_NONE if the triangle lacks that edge.
+    auto FindApex = [this](int32 TriangleIdx, int32 From, int32 To)
+    {
+        const int32* Corners = &RenderTriangles[TriangleIdx * 3];
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            if (Corners[Corner] == From && Corners[(Corner + 1) % 3] == To)
+            {
+                return Corners[(Corner + 2) % 3];
+            }
+        }
+        return static_cast<int32>(INDEX_NONE);
+    };
+
+    auto MinAngle = [this](int32 A, int32 B, int32 C)
+    {
+        return ComputeTriangleMinAngleDegrees(RenderVertices[A], RenderVertices[B], RenderVertices[C]);
+    };
+
+    const double MinAngleThreshold = Parameters.RetessellationMinTriangleAngleDegrees;
+    const int32 MaxFlips = Queue.Num() * 4;
+    TSet<int32> Touched(Queue);
+    int32 Flips = 0;
+
+    for (int32 Head = 0; Head < Queue.Num() && Flips < MaxFlips; ++Head)
+    {
+        const int32 T1 = Queue[Head];
+        const int32 Corners[3] = {RenderTriangles[T1 * 3], RenderTriangles[T1 * 3 + 1], RenderTriangles[T1 * 3 + 2]};
+        if (LockedVertices[Corners[0]] || LockedVertices[Corners[1]] || LockedVertices[Corners[2]] ||
+            MinAngle(Corners[0], Corners[1], Corners[2]) >= MinAngleThreshold)
+        {
+            continue;
+        }
+
+        // Longest edge first: it faces the widest angle, whose flip removes the sliver.
+        int32 EdgeOrder[3] = {0, 1, 2};
+        auto EdgeLengthSq = [&](int32 Edge)
+        {
+            return FVector3d::DistSquared(RenderVertices[Corners[Edge]], RenderVertices[Corners[(Edge + 1) % 3]]);
+        };
+        Algo::Sort(EdgeOrder, [&](int32 Lhs, int32 Rhs) { return EdgeLengthSq(Lhs) > EdgeLengthSq(Rhs); });
+
+        for (int32 Edge : EdgeOrder)
+        {
+            const int32 A = Corners[Edge];
+            const int32 B = Corners[(Edge + 1) % 3];
+            const int32 C = Corners[(Edge + 2) % 3];
+
+            // T1 = (A, B, C); the neighbor across AB is (B, A, D).
+            int32 T2 = INDEX_NONE;
+            int32 D = INDEX_NONE;
+            for (int32 Candidate : GetIncidence(A))
+            {
+                if (Candidate != T1)
+                {
+                    D = FindApex(Candidate, B, A);
+                    if (D != INDEX_NONE)
+                    {
+                        T2 = Candidate;
+                        break;
+                    }
+                }
+            }
+            if (T2 == INDEX_NONE || D == C || LockedVertices[D])
+            {
+                continue;
+            }
+
+            // The new diagonal CD must not already exist, or the flip would create a duplicate edge.
+            bool bDiagonalExists = false;
+            for (int32 Candidate : GetIncidence(C))
+            {
+                const int32* Other = &RenderTriangles[Candidate * 3];
+                bDiagonalExists |= Other[0] == D || Other[1] == D || Other[2] == D;
+            }
+            if (bDiagonalExists)
+            {
+                continue;
+            }
+
+            // Both new triangles must face outward (the quad ADBC is convex).
+            const FVector3d& PA = RenderVertices[A];
+            const FVector3d& PB = RenderVertices[B];
+            const FVector3d& PC = RenderVertices[C];
+            const FVector3d& PD = RenderVertices[D];
+            if (!IsOutwardFacing(PA, PD, PC) || !IsOutwardFacing(PD, PB, PC))
+            {
+                continue;
+            }
+
+            const double Before = FMath::Min(MinAngle(A, B, C), MinAngle(B, A, D));
+            const double After = FMath::Min(MinAngle(A, D, C), MinAngle(D, B, C));
+            if (After <= Before)
+            {
+                continue;
+            }
+
+            Journal.RecordTriangle(RenderTriangles, T1);
+            Journal.RecordTriangle(RenderTriangles, T2);
+
+            // (A, B, C) + (B, A, D) -> (A, D, C) + (D, B, C)
+            RenderTriangles[T1 * 3] = A; RenderTriangles[T1 * 3 + 1] = D; RenderTriangles[T1 * 3 + 2] = C;
+            RenderTriangles[T2 * 3] = D; RenderTriangles[T2 * 3 + 1] = B; RenderTriangles[T2 * 3 + 2] = C;
+
+            GetIncidence(A).Remove(T2);
+            GetIncidence(B).Remove(T1);
+            GetIncidence(C).Add(T2);
+            GetIncidence(D).Add(T1);
+
+            ++Flips;
+            Touched.Add(T2);
+            Queue.Add(T1);
+            Queue.Add(T2);
+            break;
+        }
+    }
+
+    Journal.TrianglesTouched = Touched.Num();
+    Journal.EdgeFlips = Flips;
+
+    if (Flips > 0)
+    {
+        // Only the flipped quads' corners gained or lost neighbors; every other CSR list carries over.
+        TMap<int32, TArray<int32>> DirtyNeighbors;
+        for (const TPair<int32, TArray<int32>>& Pair : IncidenceOverlay)
+        {
+            TArray<int32>& Neighbors = DirtyNeighbors.Add(Pair.Key);
+            for (int32 TriangleIdx : Pair.Value)
+            {
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const int32 Neighbor = RenderTriangles[TriangleIdx * 3 + Corner];
+                    if (Neighbor != Pair.Key)
+                    {
+                        Neighbors.AddUnique(Neighbor);
+                    }
+                }
+            }
+            Neighbors.Sort();
+        }
+
+        TArray<int32> Identity;
+        Identity.SetNumUninitialized(VertexCount);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            Identity[VertexIdx] = VertexIdx;
+        }
+        PatchRenderVertexAdjacency(Identity, DirtyNeighbors);
+
+        RenderVertexTriangleOffsets.Reset();
+        RenderVertexTriangles.Reset();
+        RenderVertexTriangleIncidenceTopologyVersion = INDEX_NONE;
+
+        TArray<int32> FlippedTriangles;
+        FlippedTriangles.Reserve(Journal.Triangles.Num());
+        for (const FRetessellationJournal::FTriangleEntry& Entry : Journal.Triangles)
+        {
+            FlippedTriangles.Add(Entry.TriangleIndex);
+        }
+        UpdateTriangleQualityCache(FlippedTriangles);
+    }
+
+    return Flips;
+}
+
 UTectonicSimulationService::FRetessellationAnalysis UTectonicSimulationService::ComputeRetessellationAnalysis() const
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(ComputeRetessellationAnalysis);
     FRetessellationAnalysis Analysis;
 
     if (Plates.Num() == 0 || RenderTriangles.Num() < 3)
@@ -186,7 +601,8 @@ UTectonicSimulationService::FRetessellationAnalysis UTectonicSimulationService::
         return Analysis;
     }
 
-    double MaxDriftRadians = 0.0;
+    // Largest drift is the smallest dot product; a single acos converts the winner.
+    double MinDriftDot = 1.0;
     int32 MaxDriftPlateID = INDEX_NONE;
 
     for (int32 PlateIndex = 0; PlateIndex < Plates.Num(); ++PlateIndex)
@@ -195,20 +611,16 @@ UTectonicSimulationService::FRetessellationAnalysis UTectonicSimulationService::
         const FVector3d& CurrentCentroid = Plates[PlateIndex].Centroid;
 
         const double DotProduct = FMath::Clamp(FVector3d::DotProduct(InitialCentroid, CurrentCentroid), -1.0, 1.0);
-        const double AngularDistance = FMath::Acos(DotProduct);
-
-        if (AngularDistance > MaxDriftRadians)
+        if (DotProduct < MinDriftDot)
         {
-            MaxDriftRadians = AngularDistance;
+            MinDriftDot = DotProduct;
             MaxDriftPlateID = Plates[PlateIndex].PlateID;
         }
     }
 
-    Analysis.MaxDriftDegrees = FMath::RadiansToDegrees(MaxDriftRadians);
+    Analysis.MaxDriftDegrees = FMath::RadiansToDegrees(FMath::Acos(MinDriftDot));
     Analysis.MaxDriftPlateID = MaxDriftPlateID;
 
-    const double MinimumAngleThreshold = Parameters.RetessellationMinTriangleAngleDegrees;
-
     const int32 TriangleCount = RenderTriangles.Num() / 3;
     Analysis.TotalTriangleCount = TriangleCount;
 
@@ -217,77 +629,118 @@ UTectonicSimulationService::FRetessellationAnalysis UTectonicSimulationService::
         return Analysis;
     }
 
-    int32 BadTriangleCount = 0;
+    RefreshTriangleQualityCache();
+
+    Analysis.BadTriangleCount = TriangleQualityCache.BadCount;
+    Analysis.BadTriangleRatio = static_cast<double>(Analysis.BadTriangleCount) / static_cast<double>(TriangleCount);
 
-    for (int32 TriangleIndex = 0; TriangleIndex < RenderTriangles.Num(); TriangleIndex += 3)
+    return Analysis;
+}
+
+namespace
+{
+    /** Cached quality of one render triangle: its minimum angle, or -1 when a corner is out of range. */
+    float ComputeRenderTriangleQuality(const TArray<FVector3d>& Vertices, const TArray<int32>& Triangles, int32 TriangleIdx)
     {
-        const int32 IndexA = RenderTriangles[TriangleIndex];
-        const int32 IndexB = RenderTriangles[TriangleIndex + 1];
-        const int32 IndexC = RenderTriangles[TriangleIndex + 2];
+        const int32 IndexA = Triangles[TriangleIdx * 3];
+        const int32 IndexB = Triangles[TriangleIdx * 3 + 1];
+        const int32 IndexC = Triangles[TriangleIdx * 3 + 2];
 
-        if (!RenderVertices.IsValidIndex(IndexA) ||
-            !RenderVertices.IsValidIndex(IndexB) ||
-            !RenderVertices.IsValidIndex(IndexC))
+        if (!Vertices.IsValidIndex(IndexA) ||
+            !Vertices.IsValidIndex(IndexB) ||
+            !Vertices.IsValidIndex(IndexC))
         {
-            ++BadTriangleCount;
-            continue;
+            return -1.0f;
         }
 
-        const FVector3d& VertexA = RenderVertices[IndexA];
-        const FVector3d& VertexB = RenderVertices[IndexB];
-        const FVector3d& VertexC = RenderVertices[IndexC];
-
-        const FVector3d EdgeAB = VertexB - VertexA;
-        const FVector3d EdgeAC = VertexC - VertexA;
-        const FVector3d EdgeBC = VertexC - VertexB;
-
-        const double LengthAB = EdgeAB.Length();
-        const double LengthAC = EdgeAC.Length();
-        const double LengthBC = EdgeBC.Length();
+        return static_cast<float>(ComputeTriangleMinAngleDegrees(Vertices[IndexA], Vertices[IndexB], Vertices[IndexC]));
+    }
+}
 
-        if (LengthAB < KINDA_SMALL_NUMBER ||
-            LengthAC < KINDA_SMALL_NUMBER ||
-            LengthBC < KINDA_SMALL_NUMBER)
-        {
-            ++BadTriangleCount;
-            continue;
-        }
+void UTectonicSimulationService::RefreshTriangleQualityCache() const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefreshTriangleQualityCache);
 
-        const FVector3d NormalizedAB = EdgeAB / LengthAB;
-        const FVector3d NormalizedAC = EdgeAC / LengthAC;
-        const FVector3d NormalizedBA = -NormalizedAB;
-        const FVector3d NormalizedBC = EdgeBC / LengthBC;
-        const FVector3d NormalizedCA = -NormalizedAC;
-        const FVector3d NormalizedCB = -NormalizedBC;
+    FTriangleQualityCache& Cache = TriangleQualityCache;
+    const int32 TriangleCount = RenderTriangles.Num() / 3;
+    const uint64 PositionVersion = RenderPositionColumn != INDEX_NONE ? RenderVertexColumns.GetColumnVersion(RenderPositionColumn) : 0;
+    const double Threshold = Parameters.RetessellationMinTriangleAngleDegrees;
+
+    Cache.LastUpdatedCount = 0;
+    const bool bEntriesCurrent = Cache.CachedTopologyVersion == TopologyVersion &&
+        Cache.CachedPositionVersion == PositionVersion &&
+        Cache.MinAngleDegrees.Num() == TriangleCount;
+    if (bEntriesCurrent && Cache.BadThresholdDegrees == Threshold)
+    {
+        return;
+    }
 
-        const double AngleA = FMath::Acos(FMath::Clamp(FVector3d::DotProduct(NormalizedAB, NormalizedAC), -1.0, 1.0));
-        const double AngleB = FMath::Acos(FMath::Clamp(FVector3d::DotProduct(NormalizedBA, NormalizedBC), -1.0, 1.0));
-        const double AngleC = FMath::Acos(FMath::Clamp(FVector3d::DotProduct(NormalizedCA, NormalizedCB), -1.0, 1.0));
+    if (!bEntriesCurrent)
+    {
+        Cache.MinAngleDegrees.SetNumUninitialized(TriangleCount);
+        Cache.LastUpdatedCount = TriangleCount;
+    }
 
-        const double MinimumAngleDegrees = FMath::RadiansToDegrees(FMath::Min3(AngleA, AngleB, AngleC));
+    // Fixed chunks with per-chunk bad counts summed in chunk order.
+    constexpr int32 ChunkSize = 4096;
+    const int32 ChunkCount = FMath::DivideAndRoundUp(TriangleCount, ChunkSize);
+    TArray<int32> ChunkBadCounts;
+    ChunkBadCounts.Init(0, ChunkCount);
 
-        if (MinimumAngleDegrees < MinimumAngleThreshold)
+    ParallelFor(ChunkCount, [&](int32 ChunkIdx)
+    {
+        const int32 Begin = ChunkIdx * ChunkSize;
+        const int32 End = FMath::Min(Begin + ChunkSize, TriangleCount);
+        int32 BadCount = 0;
+        for (int32 TriangleIdx = Begin; TriangleIdx < End; ++TriangleIdx)
         {
-            ++BadTriangleCount;
+            if (!bEntriesCurrent)
+            {
+                Cache.MinAngleDegrees[TriangleIdx] = ComputeRenderTriangleQuality(RenderVertices, RenderTriangles, TriangleIdx);
+            }
+            BadCount += static_cast<double>(Cache.MinAngleDegrees[TriangleIdx]) < Threshold ? 1 : 0;
         }
+        ChunkBadCounts[ChunkIdx] = BadCount;
+    }, ChunkCount <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    Cache.BadCount = 0;
+    for (int32 ChunkBadCount : ChunkBadCounts)
+    {
+        Cache.BadCount += ChunkBadCount;
     }
+    Cache.BadThresholdDegrees = Threshold;
+    Cache.CachedTopologyVersion = TopologyVersion;
+    Cache.CachedPositionVersion = PositionVersion;
+}
 
-    Analysis.BadTriangleCount = BadTriangleCount;
-    Analysis.BadTriangleRatio = (TriangleCount > 0)
-        ? static_cast<double>(BadTriangleCount) / static_cast<double>(TriangleCount)
-        : 0.0;
+void UTectonicSimulationService::UpdateTriangleQualityCache(TConstArrayView<int32> TriangleIndices)
+{
+    FTriangleQualityCache& Cache = TriangleQualityCache;
+    const uint64 PositionVersion = RenderPositionColumn != INDEX_NONE ? RenderVertexColumns.GetColumnVersion(RenderPositionColumn) : 0;
+    if (Cache.CachedTopologyVersion != TopologyVersion ||
+        Cache.CachedPositionVersion != PositionVersion ||
+        Cache.MinAngleDegrees.Num() != RenderTriangles.Num() / 3)
+    {
+        return;
+    }
 
-    return Analysis;
+    const double Threshold = Cache.BadThresholdDegrees;
+    for (int32 TriangleIdx : TriangleIndices)
+    {
+        const float Quality = ComputeRenderTriangleQuality(RenderVertices, RenderTriangles, TriangleIdx);
+        Cache.BadCount += (static_cast<double>(Quality) < Threshold ? 1 : 0) -
+            (static_cast<double>(Cache.MinAngleDegrees[TriangleIdx]) < Threshold ? 1 : 0);
+        Cache.MinAngleDegrees[TriangleIdx] = Quality;
+    }
+    Cache.LastUpdatedCount = TriangleIndices.Num();
 }
 
 bool UTectonicSimulationService::PerformRetessellation()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(PerformRetessellation);
     const double StartTime = FPlatformTime::Seconds();
 
-    // Step 1: Create snapshot for rollback
-    const FRetessellationSnapshot Snapshot = CaptureRetessellationSnapshot();
-
-    // Step 2: Detect drifted plates using real drift calculation
+    // Step 1: Detect drifted plates using real drift calculation
     TArray<int32> DriftedPlateIDs;
 
     // Convert threshold from degrees to radians
@@ -324,13 +777,15 @@ bool UTectonicSimulationService::PerformRetessellation()
         return true; // No rebuild needed
     }
 
-    // Step 3: Phase 2 - Full mesh rebuild for drifted plates
-    // TODO Phase 2c: Replace with incremental boundary fan split
-    UE_LOG(LogPlanetaryCreation, Log, TEXT("[Re-tessellation] Rebuilding mesh for %d drifted plate(s) (full rebuild)"), DriftedPlateIDs.Num());
+    // Step 2: Incremental re-tessellation. The render mesh keeps its vertices; plate cells are re-derived and the
+    // triangles along drifted plate boundaries are refined by edge flips. Every write goes through the journal so a
+    // failed pass rolls back only what it touched.
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[Re-tessellation] Refining boundaries of %d drifted plate(s) (incremental)"), DriftedPlateIDs.Num());
 
-    // Trigger full mesh regeneration
-    GenerateRenderMesh(TEXT("Retessellation"));
-    BuildVoronoiMapping();
+    FRetessellationJournal Journal;
+    Journal.TimestampMy = CurrentTimeMy;
+
+    BuildVoronoiMapping(&Journal);
 
     // Milestone 6 Fix: Refresh elevation baselines to match new plate assignments after retessellation
     // When Voronoi remaps vertices to different plates, elevation must update to reflect new crust type
@@ -353,6 +808,8 @@ bool UTectonicSimulationService::PerformRetessellation()
                 (VertexElevationValues[VertexIdx] >= PaperElevationConstants::SeaLevel_m - 500.0); // Allow some erosion below sea level
             if (!bElevationMatchesType)
             {
+                JournalRetessellationVertex(Journal, VertexIdx);
+
                 // Use paper-compliant baselines
                 VertexElevationValues[VertexIdx] = bIsOceanic ?
                     PaperElevationConstants::AbyssalPlainDepth_m :
@@ -366,19 +823,26 @@ bool UTectonicSimulationService::PerformRetessellation()
         }
     }
 
+    const int32 EdgeFlips = RefineDriftedPlateBoundaries(DriftedPlateIDs, Journal);
+    if (EdgeFlips > 0)
+    {
+        // Flipped edges changed adjacency; boundary distances follow the patched CSR.
+        BuildRenderVertexBoundaryCache();
+    }
+
     // Refresh derived fields (velocity, stress) after Voronoi rebuild
     ComputeVelocityField();
     InterpolateStressToVertices();
 
-    // Step 4: Validate result
-    if (!ValidateRetessellation(Snapshot))
+    // Step 3: Validate the rewritten region
+    if (!ValidateRetessellationJournal(Journal))
     {
         UE_LOG(LogPlanetaryCreation, Error, TEXT("[Re-tessellation] Validation failed! Rolling back..."));
-        RestoreRetessellationSnapshot(Snapshot);
+        RollbackRetessellationJournal(Journal);
         return false;
     }
 
-    // Step 5: Reset initial centroids for drifted plates (prevent accumulation)
+    // Step 4: Reset initial centroids for drifted plates (prevent accumulation)
     // CRITICAL: After successful rebuild, update reference positions so next drift check is relative to NEW positions
     for (int32 PlateID : DriftedPlateIDs)
     {
@@ -392,16 +856,27 @@ bool UTectonicSimulationService::PerformRetessellation()
         }
     }
 
-    // Step 6: Update tracking
+    // Step 5: Update tracking
     const double EndTime = FPlatformTime::Seconds();
     LastRetessellationTimeMs = (EndTime - StartTime) * 1000.0;
     RetessellationCount++;
 
-    UE_LOG(LogPlanetaryCreation, Log, TEXT("[Re-tessellation] Completed in %.2f ms (count: %d, plates rebuilt: %d)"),
-        LastRetessellationTimeMs, RetessellationCount, DriftedPlateIDs.Num());
+    RetessellationCadenceStats.LastRetessellationMs = LastRetessellationTimeMs;
+    RetessellationCadenceStats.TotalRetessellationMs += LastRetessellationTimeMs;
+    RetessellationCadenceStats.LastTrianglesTouched = Journal.TrianglesTouched;
+    RetessellationCadenceStats.TotalTrianglesTouched += Journal.TrianglesTouched;
+
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[Re-tessellation] Completed in %.2f ms (count: %d, plates: %d, triangles touched: %d, flips: %d, vertices journaled: %d)"),
+        LastRetessellationTimeMs, RetessellationCount, DriftedPlateIDs.Num(), Journal.TrianglesTouched, EdgeFlips, Journal.Vertices.Num());
 
     // Milestone 4 Phase 4.2: Increment topology version (topology changed)
+    // The quality cache already holds the flipped triangles, so it stays current across the bump.
+    const bool bTriangleQualityCurrent = TriangleQualityCache.CachedTopologyVersion == TopologyVersion;
     TopologyVersion++;
+    if (bTriangleQualityCurrent)
+    {
+        TriangleQualityCache.CachedTopologyVersion = TopologyVersion;
+    }
     UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[LOD Cache] Topology version incremented: %d"), TopologyVersion);
     MarkAllRidgeDirectionsDirty();
 
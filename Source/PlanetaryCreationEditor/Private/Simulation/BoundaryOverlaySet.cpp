@@ -0,0 +1,282 @@
+#include "Simulation/BoundaryOverlaySet.h"
+
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+    uint64 MakePlatePairKey(int32 PlateA, int32 PlateB)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(FMath::Min(PlateA, PlateB))) << 32) |
+            static_cast<uint64>(static_cast<uint32>(FMath::Max(PlateA, PlateB)));
+    }
+
+    /** CSR neighbor lists from a triangle list (fallback when the service adjacency is stale or missing). */
+    void BuildAdjacencyFromTriangles(const TArray<int32>& RenderTriangles, int32 VertexCount,
+        TArray<int32>& OutOffsets, TArray<int32>& OutAdjacency)
+    {
+        TArray<uint64> DirectedEdges;
+        DirectedEdges.Reserve(RenderTriangles.Num() * 2);
+        for (int32 TriIdx = 0; TriIdx + 2 < RenderTriangles.Num(); TriIdx += 3)
+        {
+            const int32 Corners[3] = { RenderTriangles[TriIdx], RenderTriangles[TriIdx + 1], RenderTriangles[TriIdx + 2] };
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32 A = Corners[Corner];
+                const int32 B = Corners[(Corner + 1) % 3];
+                if (A < 0 || B < 0 || A >= VertexCount || B >= VertexCount || A == B)
+                {
+                    continue;
+                }
+                DirectedEdges.Add((static_cast<uint64>(A) << 32) | static_cast<uint64>(B));
+                DirectedEdges.Add((static_cast<uint64>(B) << 32) | static_cast<uint64>(A));
+            }
+        }
+
+        DirectedEdges.Sort();
+
+        OutOffsets.SetNumZeroed(VertexCount + 1);
+        OutAdjacency.Reset(DirectedEdges.Num());
+        for (int32 Index = 0; Index < DirectedEdges.Num(); ++Index)
+        {
+            if (Index > 0 && DirectedEdges[Index] == DirectedEdges[Index - 1])
+            {
+                continue;
+            }
+            const int32 From = static_cast<int32>(DirectedEdges[Index] >> 32);
+            OutAdjacency.Add(static_cast<int32>(DirectedEdges[Index] & 0xFFFFFFFFull));
+            ++OutOffsets[From + 1];
+        }
+
+        for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+        {
+            OutOffsets[Vertex + 1] += OutOffsets[Vertex];
+        }
+    }
+
+    /** Chains (from degree-1 ends) and loops over one group's edges; a vertex of degree > 2 aborts tracing. */
+    void TraceGroupPolylines(const TArray<FBoundaryOverlayEdge>& Edges, FBoundaryOverlayGroup& Group)
+    {
+        TMap<int32, int32> LocalIds;
+        LocalIds.Reserve(Group.NumEdges + 1);
+        TArray<int32> LocalVertices;
+        TArray<FIntPoint> LocalEdges;
+        LocalEdges.Reserve(Group.NumEdges);
+
+        auto GetLocalId = [&](int32 Vertex)
+        {
+            if (const int32* Existing = LocalIds.Find(Vertex))
+            {
+                return *Existing;
+            }
+            const int32 LocalId = LocalVertices.Add(Vertex);
+            LocalIds.Add(Vertex, LocalId);
+            return LocalId;
+        };
+
+        for (int32 EdgeIdx = Group.FirstEdge; EdgeIdx < Group.FirstEdge + Group.NumEdges; ++EdgeIdx)
+        {
+            LocalEdges.Add(FIntPoint(GetLocalId(Edges[EdgeIdx].V0), GetLocalId(Edges[EdgeIdx].V1)));
+        }
+
+        // Seam edges are unique, so incident edge count is the neighbor count.
+        TArray<FIntPoint> Incident;
+        Incident.Init(FIntPoint(INDEX_NONE, INDEX_NONE), LocalVertices.Num());
+        TArray<int32> Degree;
+        Degree.SetNumZeroed(LocalVertices.Num());
+        for (int32 LocalEdge = 0; LocalEdge < LocalEdges.Num(); ++LocalEdge)
+        {
+            for (const int32 LocalVertex : { LocalEdges[LocalEdge].X, LocalEdges[LocalEdge].Y })
+            {
+                const int32 Slot = Degree[LocalVertex]++;
+                if (Slot == 0)
+                {
+                    Incident[LocalVertex].X = LocalEdge;
+                }
+                else if (Slot == 1)
+                {
+                    Incident[LocalVertex].Y = LocalEdge;
+                }
+            }
+        }
+
+        for (int32 LocalVertex = 0; LocalVertex < LocalVertices.Num(); ++LocalVertex)
+        {
+            if (Degree[LocalVertex] > 2)
+            {
+                Group.BranchVertex = LocalVertices[LocalVertex];
+                Group.BranchDegree = Degree[LocalVertex];
+                return;
+            }
+        }
+
+        TBitArray<> UsedEdges(false, LocalEdges.Num());
+        auto Walk = [&](int32 StartVertex, int32 StartEdge)
+        {
+            FBoundaryOverlayPolyline Polyline;
+            Polyline.Vertices.Add(LocalVertices[StartVertex]);
+
+            int32 Current = StartVertex;
+            int32 Edge = StartEdge;
+            while (Edge != INDEX_NONE && !UsedEdges[Edge])
+            {
+                UsedEdges[Edge] = true;
+                Current = LocalEdges[Edge].X == Current ? LocalEdges[Edge].Y : LocalEdges[Edge].X;
+                Polyline.Vertices.Add(LocalVertices[Current]);
+
+                const FIntPoint& Next = Incident[Current];
+                Edge = (Next.X != INDEX_NONE && !UsedEdges[Next.X]) ? Next.X : Next.Y;
+            }
+
+            Polyline.bClosed = Polyline.Vertices.Num() > 2 && Current == StartVertex;
+            Group.Polylines.Add(MoveTemp(Polyline));
+        };
+
+        for (int32 LocalVertex = 0; LocalVertex < LocalVertices.Num(); ++LocalVertex)
+        {
+            if (Degree[LocalVertex] == 1 && !UsedEdges[Incident[LocalVertex].X])
+            {
+                Walk(LocalVertex, Incident[LocalVertex].X);
+            }
+        }
+
+        for (int32 LocalEdge = 0; LocalEdge < LocalEdges.Num(); ++LocalEdge)
+        {
+            if (!UsedEdges[LocalEdge])
+            {
+                Walk(LocalEdges[LocalEdge].X, LocalEdge);
+            }
+        }
+    }
+}
+
+void FBoundaryOverlaySet::Reset()
+{
+    TopologyVersion = INDEX_NONE;
+    VertexCount = 0;
+    TriangleCount = 0;
+    AssignmentHash = 0;
+    Edges.Empty();
+    Groups.Empty();
+}
+
+uint64 FBoundaryOverlaySet::HashAssignments(const TArray<int32>& VertexPlateAssignments)
+{
+    return CityHash64WithSeed(reinterpret_cast<const char*>(VertexPlateAssignments.GetData()),
+        VertexPlateAssignments.Num() * sizeof(int32), static_cast<uint64>(VertexPlateAssignments.Num()));
+}
+
+void FBoundaryOverlaySet::Build(int32 InTopologyVersion, const TArray<int32>& AdjacencyOffsets, const TArray<int32>& Adjacency,
+    const TArray<int32>& RenderTriangles, const TArray<int32>& VertexPlateAssignments, uint64 InAssignmentHash)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(BoundaryOverlaySet_Build);
+
+    Reset();
+    TopologyVersion = InTopologyVersion;
+    VertexCount = VertexPlateAssignments.Num();
+    TriangleCount = RenderTriangles.Num() / 3;
+    AssignmentHash = InAssignmentHash;
+
+    if (VertexCount == 0)
+    {
+        return;
+    }
+
+    TArray<int32> LocalOffsets;
+    TArray<int32> LocalAdjacency;
+    const bool bUseServiceAdjacency = AdjacencyOffsets.Num() == VertexCount + 1 && AdjacencyOffsets[VertexCount] == Adjacency.Num();
+    if (!bUseServiceAdjacency)
+    {
+        BuildAdjacencyFromTriangles(RenderTriangles, VertexCount, LocalOffsets, LocalAdjacency);
+    }
+    const TArray<int32>& Offsets = bUseServiceAdjacency ? AdjacencyOffsets : LocalOffsets;
+    const TArray<int32>& Neighbors = bUseServiceAdjacency ? Adjacency : LocalAdjacency;
+
+    auto IsSeam = [&](int32 Vertex, int32 Neighbor)
+    {
+        if (Neighbor <= Vertex || Neighbor >= VertexCount)
+        {
+            return false;
+        }
+        const int32 PlateA = VertexPlateAssignments[Vertex];
+        const int32 PlateB = VertexPlateAssignments[Neighbor];
+        return PlateA != PlateB && PlateA != INDEX_NONE && PlateB != INDEX_NONE;
+    };
+
+    const EParallelForFlags Flags = VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+    // Each undirected edge is owned by its lower vertex: count, scan, then fill in vertex order (deterministic).
+    TArray<int32> EdgeStarts;
+    EdgeStarts.SetNumZeroed(VertexCount + 1);
+    ParallelFor(VertexCount, [&](int32 Vertex)
+    {
+        int32 Count = 0;
+        for (int32 Slot = Offsets[Vertex]; Slot < Offsets[Vertex + 1]; ++Slot)
+        {
+            Count += IsSeam(Vertex, Neighbors[Slot]) ? 1 : 0;
+        }
+        EdgeStarts[Vertex + 1] = Count;
+    }, Flags);
+
+    for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+    {
+        EdgeStarts[Vertex + 1] += EdgeStarts[Vertex];
+    }
+
+    const int32 EdgeCount = EdgeStarts[VertexCount];
+    if (EdgeCount == 0)
+    {
+        return;
+    }
+
+    TArray<FBoundaryOverlayEdge> RawEdges;
+    TArray<uint64> RawKeys;
+    RawEdges.SetNumUninitialized(EdgeCount);
+    RawKeys.SetNumUninitialized(EdgeCount);
+    ParallelFor(VertexCount, [&](int32 Vertex)
+    {
+        int32 Write = EdgeStarts[Vertex];
+        for (int32 Slot = Offsets[Vertex]; Slot < Offsets[Vertex + 1]; ++Slot)
+        {
+            const int32 Neighbor = Neighbors[Slot];
+            if (IsSeam(Vertex, Neighbor))
+            {
+                RawEdges[Write] = { Vertex, Neighbor };
+                RawKeys[Write] = MakePlatePairKey(VertexPlateAssignments[Vertex], VertexPlateAssignments[Neighbor]);
+                ++Write;
+            }
+        }
+    }, Flags);
+
+    TArray<int32> Order;
+    Order.SetNumUninitialized(EdgeCount);
+    for (int32 Index = 0; Index < EdgeCount; ++Index)
+    {
+        Order[Index] = Index;
+    }
+    Order.Sort([&RawKeys](int32 A, int32 B)
+    {
+        return RawKeys[A] != RawKeys[B] ? RawKeys[A] < RawKeys[B] : A < B;
+    });
+
+    Edges.SetNumUninitialized(EdgeCount);
+    for (int32 Index = 0; Index < EdgeCount; ++Index)
+    {
+        Edges[Index] = RawEdges[Order[Index]];
+
+        const uint64 Key = RawKeys[Order[Index]];
+        if (Index == 0 || Key != RawKeys[Order[Index - 1]])
+        {
+            FBoundaryOverlayGroup& Group = Groups.AddDefaulted_GetRef();
+            Group.PlateKey = TPair<int32, int32>(static_cast<int32>(Key >> 32), static_cast<int32>(Key & 0xFFFFFFFFull));
+            Group.FirstEdge = Index;
+        }
+        ++Groups.Last().NumEdges;
+    }
+
+    ParallelFor(Groups.Num(), [this](int32 GroupIdx)
+    {
+        TraceGroupPolylines(Edges, Groups[GroupIdx]);
+    }, EdgeCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
@@ -2,6 +2,7 @@
 
 #include "Simulation/PaperConstants.h"
 #include "Simulation/PaperProfiling.h"
+#include "Async/ParallelFor.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
@@ -18,12 +19,6 @@ namespace Collision
         return FVector3d::CrossProduct(Omega_rad_per_My, P) * PlanetRadius_km;
     }
 
-    static inline double AngularDistance(const FVector3d& A, const FVector3d& B)
-    {
-        const double dot = FMath::Clamp(A.Dot(B), -1.0, 1.0);
-        return FMath::Acos(dot);
-    }
-
     bool DetectCollisions(
         const TArray<FVector3d>& Points,
         const TArray<int32>& PlateIdPerVertex,
@@ -62,24 +57,30 @@ namespace Collision
             Candidates.Add({Q, a, b, pa, pb, A_km2});
         }
 
-        // Merge near-duplicates within 0.5 degrees if they refer to the same plate pair (sorted ids)
-        const double MergeThresh = 0.5 * PI / 180.0; // radians
+        // Merge near-duplicates within 0.5 degrees if they refer to the same plate pair (sorted ids). Events are
+        // bucketed by plate pair so each candidate only compares against events of its own pair, in creation order.
+        const double MergeCos = FMath::Cos(0.5 * PI / 180.0);
+        TMap<uint64, TArray<int32>> EventsByPair;
+        TArray<TArray<int32>> SeedCandidates; // edge endpoints merged into each event
         for (const TmpEvent& C : Candidates)
         {
             const int32 lo = FMath::Min(C.Pa, C.Pb);
             const int32 hi = FMath::Max(C.Pa, C.Pb);
+            const uint64 PairKey = (uint64(uint32(lo)) << 32) | uint64(uint32(hi));
+            TArray<int32>& PairEvents = EventsByPair.FindOrAdd(PairKey);
 
             bool Merged = false;
-            for (FCollisionEvent& E : OutEvents)
+            for (int32 ei : PairEvents)
             {
-                if (!((E.CarrierPlateId == lo) && (E.TargetPlateId == hi))) continue;
-                const double dang = AngularDistance(E.CenterUnit, C.Q);
-                if (dang <= MergeThresh)
+                FCollisionEvent& E = OutEvents[ei];
+                if (FMath::Clamp(E.CenterUnit.Dot(C.Q), -1.0, 1.0) >= MergeCos)
                 {
                     // Average centers deterministically then renormalize; average area
                     const FVector3d Avg = (E.CenterUnit + C.Q).GetSafeNormal();
                     E.CenterUnit = Avg;
                     E.TerraneArea_km2 = 0.5 * (E.TerraneArea_km2 + C.A_km2);
+                    SeedCandidates[ei].Add(C.A);
+                    SeedCandidates[ei].Add(C.B);
                     Merged = true;
                     break;
                 }
@@ -92,8 +93,35 @@ namespace Collision
                 E.CarrierPlateId = lo;
                 E.TargetPlateId = hi;
                 E.PeakGuardrail_m = 0.0; // service may override
-                OutEvents.Add(E);
+                PairEvents.Add(OutEvents.Add(E));
+                SeedCandidates.Add({C.A, C.B});
+            }
+        }
+
+        // Surge radius r = rc * sqrt(v / v0) * sqrt(A / A0), capped at rc, and the affected region grown from the
+        // merged edge endpoint closest to the final center.
+        for (int32 ei = 0; ei < OutEvents.Num(); ++ei)
+        {
+            FCollisionEvent& E = OutEvents[ei];
+            const FVector3d Q = E.CenterUnit.GetSafeNormal();
+            const int32 i = E.CarrierPlateId;
+            const int32 j = E.TargetPlateId;
+            const FVector3d Si = OmegaPerPlate.IsValidIndex(i) ? SurfaceVelocityKmPerMy(OmegaPerPlate[i], Q) : FVector3d::ZeroVector;
+            const FVector3d Sj = OmegaPerPlate.IsValidIndex(j) ? SurfaceVelocityKmPerMy(OmegaPerPlate[j], Q) : FVector3d::ZeroVector;
+            const double v = (Sj - Si).Size();
+            const double r_km = (v > 0.0 && E.TerraneArea_km2 > 0.0)
+                ? (CollisionDistance_km * FMath::Sqrt(v / MaxPlateSpeed_km_per_My) * FMath::Sqrt(E.TerraneArea_km2 / ReferencePlateArea_km2))
+                : 0.0;
+            E.RadiusRad = KmToGeodesicRadians(FMath::Min(r_km, CollisionDistance_km));
+
+            int32 Seed = INDEX_NONE;
+            double SeedDot = -2.0;
+            for (int32 vi : SeedCandidates[ei])
+            {
+                const double dot = Points[vi].Dot(Q);
+                if (dot > SeedDot) { SeedDot = dot; Seed = vi; }
             }
+            BuildAffectedRegion(Points, CSR_Offsets, CSR_Adj, Seed, E);
         }
 
         return OutEvents.Num() > 0;
@@ -104,9 +132,61 @@ namespace Collision
         return V - (V.Dot(P)) * P;
     }
 
-    FCollisionMetrics ApplyCollisionSurge(
+    void BuildAffectedRegion(
+        const TArray<FVector3d>& Points,
+        const TArray<int32>& CSR_Offsets,
+        const TArray<int32>& CSR_Adj,
+        int32 SeedVertex,
+        FCollisionEvent& InOutEvent)
+    {
+        InOutEvent.AffectedVertexIndices.Reset();
+        InOutEvent.AffectedMinDot = 1.0;
+        if (InOutEvent.RadiusRad <= 0.0 || !Points.IsValidIndex(SeedVertex) || CSR_Offsets.Num() != Points.Num() + 1)
+        {
+            return;
+        }
+
+        const FVector3d Q = InOutEvent.CenterUnit.GetSafeNormal();
+        const double CosThresh = FMath::Cos(InOutEvent.RadiusRad);
+        if (FMath::Clamp(Points[SeedVertex].Dot(Q), -1.0, 1.0) < CosThresh)
+        {
+            return;
+        }
+
+        // Breadth-first over vertices inside the cap; the cap is the only bound, so cost scales with the region.
+        TSet<int32> Visited;
+        TArray<int32>& Region = InOutEvent.AffectedVertexIndices;
+        Visited.Add(SeedVertex);
+        Region.Add(SeedVertex);
+        double MinDot = 1.0;
+        for (int32 head = 0; head < Region.Num(); ++head)
+        {
+            const int32 v = Region[head];
+            MinDot = FMath::Min(MinDot, FMath::Clamp(Points[v].Dot(Q), -1.0, 1.0));
+            for (int32 k = CSR_Offsets[v]; k < CSR_Offsets[v + 1]; ++k)
+            {
+                const int32 nb = CSR_Adj[k];
+                if (!Points.IsValidIndex(nb)) continue;
+                bool bAlreadyVisited = false;
+                Visited.Add(nb, &bAlreadyVisited);
+                if (bAlreadyVisited) continue;
+                if (FMath::Clamp(Points[nb].Dot(Q), -1.0, 1.0) >= CosThresh)
+                {
+                    Region.Add(nb);
+                }
+            }
+        }
+
+        Region.Sort();
+        InOutEvent.AffectedMinDot = MinDot;
+    }
+
+    // Quartic falloff over the cap whose rim is at dot(P, Q) = MinDot, parameterized by squared chord length
+    // (|P - Q|^2 = 2 * (1 - dot)) so no acos is needed: t^2 = (1 - dot) / (1 - MinDot), w = (1 - t^2)^2.
+    static FCollisionMetrics ApplySurgeToRegion(
         const TArray<FVector3d>& Points,
         const TArray<int32>& AffectedVertexIndices,
+        double MinDot,
         const FCollisionEvent& Event,
         TArray<double>& InOutElevation_m,
         TArray<FVector3d>* InOutFoldVectorsOrNull)
@@ -114,23 +194,13 @@ namespace Collision
         const double t0 = FPlatformTime::Seconds();
         FCollisionMetrics M;
 
-        if (Event.TerraneArea_km2 <= 0.0 || AffectedVertexIndices.Num() == 0)
+        const double RimChordSq = 1.0 - MinDot;
+        if (Event.TerraneArea_km2 <= 0.0 || AffectedVertexIndices.Num() == 0 || RimChordSq <= 0.0)
         {
             return M;
         }
 
-        // Derive r_ang from affected set for quartic shape
         const FVector3d Q = Event.CenterUnit.GetSafeNormal();
-        double r_ang = 0.0;
-        for (int32 idx : AffectedVertexIndices)
-        {
-            if (!Points.IsValidIndex(idx)) continue;
-            r_ang = FMath::Max(r_ang, AngularDistance(Points[idx], Q));
-        }
-        if (r_ang <= 0.0)
-        {
-            return M;
-        }
 
         // Peak height in meters: Δz_peak = Δc[km^-1] * A[km^2] * 1000
         double Peak_m = CollisionCoefficient_per_km * Event.TerraneArea_km2 * 1000.0;
@@ -141,37 +211,61 @@ namespace Collision
         M.CollisionCount = 1;
         M.MaxPeak_m = Peak_m;
 
-        // Apply quartic falloff
-        for (int32 idx : AffectedVertexIndices)
+        // Uplift and fold in one pass; each affected vertex is written by exactly one iteration.
+        const double InvRimChordSq = 1.0 / RimChordSq;
+        ParallelFor(AffectedVertexIndices.Num(), [&](int32 k)
         {
-            if (!Points.IsValidIndex(idx) || !InOutElevation_m.IsValidIndex(idx)) continue;
+            const int32 idx = AffectedVertexIndices[k];
+            if (!Points.IsValidIndex(idx) || !InOutElevation_m.IsValidIndex(idx)) return;
             const FVector3d& P = Points[idx];
-            const double d = AngularDistance(P, Q);
-            if (d > r_ang) continue;
-            const double t = d / r_ang;
-            const double w = FMath::Square(1.0 - FMath::Square(t)); // (1 - t^2)^2
-            const double dz = Peak_m * w;
-            InOutElevation_m[idx] += dz;
-
-            if (InOutFoldVectorsOrNull)
+            const double dot = FMath::Clamp(P.Dot(Q), -1.0, 1.0);
+            if (dot < MinDot) return;
+            const double t2 = (1.0 - dot) * InvRimChordSq;
+            const double w = FMath::Square(1.0 - t2); // (1 - t^2)^2
+            InOutElevation_m[idx] += Peak_m * w;
+
+            if (InOutFoldVectorsOrNull && InOutFoldVectorsOrNull->IsValidIndex(idx))
             {
-                TArray<FVector3d>& Folds = *InOutFoldVectorsOrNull;
-                if (Folds.IsValidIndex(idx))
+                const FVector3d Rad = ProjectToTangent(P - Q, P);
+                const double len = Rad.Size();
+                if (len > 0.0)
                 {
-                    FVector3d Rad = ProjectToTangent(P - Q, P);
-                    const double len = Rad.Size();
-                    if (len > 0.0)
-                    {
-                        Folds[idx] = Rad / len;
-                    }
+                    (*InOutFoldVectorsOrNull)[idx] = Rad / len;
                 }
             }
-        }
+        }, AffectedVertexIndices.Num() < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
         M.ApplyMs = (FPlatformTime::Seconds() - t0) * 1000.0;
         return M;
     }
 
+    FCollisionMetrics ApplyCollisionSurge(
+        const TArray<FVector3d>& Points,
+        const FCollisionEvent& Event,
+        TArray<double>& InOutElevation_m,
+        TArray<FVector3d>* InOutFoldVectorsOrNull)
+    {
+        return ApplySurgeToRegion(Points, Event.AffectedVertexIndices, Event.AffectedMinDot, Event, InOutElevation_m, InOutFoldVectorsOrNull);
+    }
+
+    FCollisionMetrics ApplyCollisionSurge(
+        const TArray<FVector3d>& Points,
+        const TArray<int32>& AffectedVertexIndices,
+        const FCollisionEvent& Event,
+        TArray<double>& InOutElevation_m,
+        TArray<FVector3d>* InOutFoldVectorsOrNull)
+    {
+        // Derive the rim from the affected set for quartic shape
+        const FVector3d Q = Event.CenterUnit.GetSafeNormal();
+        double MinDot = 1.0;
+        for (int32 idx : AffectedVertexIndices)
+        {
+            if (!Points.IsValidIndex(idx)) continue;
+            MinDot = FMath::Min(MinDot, FMath::Clamp(Points[idx].Dot(Q), -1.0, 1.0));
+        }
+        return ApplySurgeToRegion(Points, AffectedVertexIndices, MinDot, Event, InOutElevation_m, InOutFoldVectorsOrNull);
+    }
+
     FString WritePhase4MetricsJson(
         const FString& BackendName,
         int32 SampleCount,
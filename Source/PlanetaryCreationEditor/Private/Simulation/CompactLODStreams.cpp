@@ -0,0 +1,270 @@
+#include "Simulation/CompactLODStreams.h"
+
+#include "Utilities/PlanetaryCreationLogging.h"
+
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "MeshOptimizer/meshoptimizer.h"
+
+namespace
+{
+    constexpr float OctahedralScale = 32767.0f;
+
+    FORCEINLINE float SignNotZero(float Value)
+    {
+        return Value >= 0.0f ? 1.0f : -1.0f;
+    }
+
+    void EncodeOctahedral(const FVector3f& Vector, int16 (&Out)[2])
+    {
+        const float L1 = FMath::Abs(Vector.X) + FMath::Abs(Vector.Y) + FMath::Abs(Vector.Z);
+        float X = L1 > UE_SMALL_NUMBER ? Vector.X / L1 : 0.0f;
+        float Y = L1 > UE_SMALL_NUMBER ? Vector.Y / L1 : 0.0f;
+        if (Vector.Z < 0.0f)
+        {
+            const float FoldedX = (1.0f - FMath::Abs(Y)) * SignNotZero(X);
+            Y = (1.0f - FMath::Abs(X)) * SignNotZero(Y);
+            X = FoldedX;
+        }
+
+        Out[0] = static_cast<int16>(FMath::RoundToInt(FMath::Clamp(X, -1.0f, 1.0f) * OctahedralScale));
+        Out[1] = static_cast<int16>(FMath::RoundToInt(FMath::Clamp(Y, -1.0f, 1.0f) * OctahedralScale));
+    }
+
+    FVector3f DecodeOctahedral(const int16 (&In)[2])
+    {
+        float X = In[0] / OctahedralScale;
+        float Y = In[1] / OctahedralScale;
+        const float Z = 1.0f - FMath::Abs(X) - FMath::Abs(Y);
+        if (Z < 0.0f)
+        {
+            const float UnfoldedX = (1.0f - FMath::Abs(Y)) * SignNotZero(X);
+            Y = (1.0f - FMath::Abs(X)) * SignNotZero(Y);
+            X = UnfoldedX;
+        }
+        return FVector3f(X, Y, Z).GetSafeNormal();
+    }
+}
+
+void FCompactLODStreams::Reset()
+{
+    VertexCount = 0;
+    IndexCount = 0;
+    BaseRadius = 0.0f;
+    HeightUnit = 1.0f;
+    Vertices.Empty();
+    Indices16.Empty();
+    Indices32.Empty();
+    IdentitySourceCount = 0;
+    SeamSourceIndices.Empty();
+    EncodedVertices.Empty();
+    EncodedIndices.Empty();
+}
+
+SIZE_T FCompactLODStreams::GetAllocatedSize() const
+{
+    return Vertices.GetAllocatedSize() + Indices16.GetAllocatedSize() + Indices32.GetAllocatedSize() +
+        SeamSourceIndices.GetAllocatedSize() + EncodedVertices.GetAllocatedSize() + EncodedIndices.GetAllocatedSize();
+}
+
+bool FCompactLODStreams::Quantize(float InBaseRadius, float InHeightUnit,
+    const TArray<float>& PositionX, const TArray<float>& PositionY, const TArray<float>& PositionZ,
+    const TArray<float>& NormalX, const TArray<float>& NormalY, const TArray<float>& NormalZ,
+    const TArray<float>& TangentX, const TArray<float>& TangentY, const TArray<float>& TangentZ,
+    const TArray<FColor>& Colors, const TArray<FVector2f>& UVs, const TArray<float>& AmplifiedHeights,
+    const TArray<uint32>& Indices, const TArray<int32>& SourceIndices)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(CompactLODStreams_Quantize);
+
+    Reset();
+
+    const int32 Count = PositionX.Num();
+    const bool bValidSizes = Count > 0 &&
+        PositionY.Num() == Count && PositionZ.Num() == Count &&
+        NormalX.Num() == Count && NormalY.Num() == Count && NormalZ.Num() == Count &&
+        TangentX.Num() == Count && TangentY.Num() == Count && TangentZ.Num() == Count &&
+        Colors.Num() == Count && UVs.Num() == Count && AmplifiedHeights.Num() == Count &&
+        SourceIndices.Num() == Count && Indices.Num() % 3 == 0;
+    if (!bValidSizes)
+    {
+        return false;
+    }
+
+    VertexCount = Count;
+    IndexCount = Indices.Num();
+    BaseRadius = InBaseRadius;
+    HeightUnit = InHeightUnit > 0.0f ? InHeightUnit : 1.0f;
+
+    Vertices.SetNumUninitialized(Count);
+    const EParallelForFlags Flags = Count < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+    ParallelFor(Count, [&](int32 Index)
+    {
+        FCompactLODVertex& Vertex = Vertices[Index];
+
+        const FVector3f Position(PositionX[Index], PositionY[Index], PositionZ[Index]);
+        const float Radius = Position.Length();
+        EncodeOctahedral(Radius > UE_SMALL_NUMBER ? Position / Radius : FVector3f::ZAxisVector, Vertex.Direction);
+        EncodeOctahedral(FVector3f(NormalX[Index], NormalY[Index], NormalZ[Index]), Vertex.Normal);
+        EncodeOctahedral(FVector3f(TangentX[Index], TangentY[Index], TangentZ[Index]), Vertex.Tangent);
+
+        Vertex.RadialOffset = meshopt_quantizeHalf((Radius - BaseRadius) / HeightUnit);
+        Vertex.AmplifiedHeight = meshopt_quantizeHalf(AmplifiedHeights[Index]);
+        Vertex.UV[0] = meshopt_quantizeHalf(UVs[Index].X);
+        Vertex.UV[1] = meshopt_quantizeHalf(UVs[Index].Y);
+        Vertex.Color = Colors[Index];
+    }, Flags);
+
+    if (Count <= TNumericLimits<uint16>::Max() + 1)
+    {
+        Indices16.SetNumUninitialized(IndexCount);
+        for (int32 Index = 0; Index < IndexCount; ++Index)
+        {
+            Indices16[Index] = static_cast<uint16>(Indices[Index]);
+        }
+    }
+    else
+    {
+        Indices32 = Indices;
+    }
+
+    IdentitySourceCount = 0;
+    while (IdentitySourceCount < Count && SourceIndices[IdentitySourceCount] == IdentitySourceCount)
+    {
+        ++IdentitySourceCount;
+    }
+    SeamSourceIndices.Append(SourceIndices.GetData() + IdentitySourceCount, Count - IdentitySourceCount);
+
+    return true;
+}
+
+bool FCompactLODStreams::Encode()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(CompactLODStreams_Encode);
+
+    if (!IsValid() || IsEncoded() || IndexCount == 0)
+    {
+        return IsEncoded();
+    }
+
+    EncodedVertices.SetNumUninitialized(meshopt_encodeVertexBufferBound(VertexCount, sizeof(FCompactLODVertex)));
+    const size_t VertexBytes = meshopt_encodeVertexBuffer(EncodedVertices.GetData(), EncodedVertices.Num(),
+        Vertices.GetData(), VertexCount, sizeof(FCompactLODVertex));
+
+    EncodedIndices.SetNumUninitialized(meshopt_encodeIndexBufferBound(IndexCount, VertexCount));
+    size_t IndexBytes = 0;
+    if (Indices16.Num() == IndexCount)
+    {
+        IndexBytes = meshopt_encodeIndexBuffer(EncodedIndices.GetData(), EncodedIndices.Num(), Indices16.GetData(), IndexCount);
+    }
+    else
+    {
+        IndexBytes = meshopt_encodeIndexBuffer(EncodedIndices.GetData(), EncodedIndices.Num(), Indices32.GetData(), IndexCount);
+    }
+
+    if (VertexBytes == 0 || IndexBytes == 0)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[LOD Cache] MeshOptimizer encode failed (verts=%d, indices=%d); keeping quantized streams"),
+            VertexCount, IndexCount);
+        EncodedVertices.Empty();
+        EncodedIndices.Empty();
+        return false;
+    }
+
+    EncodedVertices.SetNum(static_cast<int32>(VertexBytes), EAllowShrinking::Yes);
+    EncodedIndices.SetNum(static_cast<int32>(IndexBytes), EAllowShrinking::Yes);
+    Vertices.Empty();
+    Indices16.Empty();
+    Indices32.Empty();
+    return true;
+}
+
+bool FCompactLODStreams::Dequantize(
+    TArray<float>& PositionX, TArray<float>& PositionY, TArray<float>& PositionZ,
+    TArray<float>& NormalX, TArray<float>& NormalY, TArray<float>& NormalZ,
+    TArray<float>& TangentX, TArray<float>& TangentY, TArray<float>& TangentZ,
+    TArray<FColor>& Colors, TArray<FVector2f>& UVs, TArray<float>& AmplifiedHeights,
+    TArray<uint32>& Indices, TArray<int32>& SourceIndices) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(CompactLODStreams_Dequantize);
+
+    if (!IsValid())
+    {
+        return false;
+    }
+
+    TArray<FCompactLODVertex> DecodedVertices;
+    const TArray<FCompactLODVertex>* SourceVertices = &Vertices;
+    Indices.SetNumUninitialized(IndexCount);
+
+    if (IsEncoded())
+    {
+        DecodedVertices.SetNumUninitialized(VertexCount);
+        const int32 VertexResult = meshopt_decodeVertexBuffer(DecodedVertices.GetData(), VertexCount, sizeof(FCompactLODVertex),
+            EncodedVertices.GetData(), EncodedVertices.Num());
+        const int32 IndexResult = meshopt_decodeIndexBuffer(Indices.GetData(), IndexCount, EncodedIndices.GetData(), EncodedIndices.Num());
+        if (VertexResult != 0 || IndexResult != 0)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("[LOD Cache] MeshOptimizer decode failed (vertex=%d, index=%d)"), VertexResult, IndexResult);
+            return false;
+        }
+        SourceVertices = &DecodedVertices;
+    }
+    else if (Indices16.Num() == IndexCount)
+    {
+        for (int32 Index = 0; Index < IndexCount; ++Index)
+        {
+            Indices[Index] = Indices16[Index];
+        }
+    }
+    else
+    {
+        Indices = Indices32;
+    }
+
+    PositionX.SetNumUninitialized(VertexCount);
+    PositionY.SetNumUninitialized(VertexCount);
+    PositionZ.SetNumUninitialized(VertexCount);
+    NormalX.SetNumUninitialized(VertexCount);
+    NormalY.SetNumUninitialized(VertexCount);
+    NormalZ.SetNumUninitialized(VertexCount);
+    TangentX.SetNumUninitialized(VertexCount);
+    TangentY.SetNumUninitialized(VertexCount);
+    TangentZ.SetNumUninitialized(VertexCount);
+    Colors.SetNumUninitialized(VertexCount);
+    UVs.SetNumUninitialized(VertexCount);
+    AmplifiedHeights.SetNumUninitialized(VertexCount);
+
+    const TArray<FCompactLODVertex>& Source = *SourceVertices;
+    const EParallelForFlags Flags = VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+    ParallelFor(VertexCount, [&](int32 Index)
+    {
+        const FCompactLODVertex& Vertex = Source[Index];
+
+        const float Radius = BaseRadius + meshopt_dequantizeHalf(Vertex.RadialOffset) * HeightUnit;
+        const FVector3f Position = DecodeOctahedral(Vertex.Direction) * Radius;
+        const FVector3f Normal = DecodeOctahedral(Vertex.Normal);
+        const FVector3f Tangent = DecodeOctahedral(Vertex.Tangent);
+
+        PositionX[Index] = Position.X;
+        PositionY[Index] = Position.Y;
+        PositionZ[Index] = Position.Z;
+        NormalX[Index] = Normal.X;
+        NormalY[Index] = Normal.Y;
+        NormalZ[Index] = Normal.Z;
+        TangentX[Index] = Tangent.X;
+        TangentY[Index] = Tangent.Y;
+        TangentZ[Index] = Tangent.Z;
+        Colors[Index] = Vertex.Color;
+        UVs[Index] = FVector2f(meshopt_dequantizeHalf(Vertex.UV[0]), meshopt_dequantizeHalf(Vertex.UV[1]));
+        AmplifiedHeights[Index] = meshopt_dequantizeHalf(Vertex.AmplifiedHeight);
+    }, Flags);
+
+    SourceIndices.SetNumUninitialized(VertexCount);
+    for (int32 Index = 0; Index < IdentitySourceCount; ++Index)
+    {
+        SourceIndices[Index] = Index;
+    }
+    FMemory::Memcpy(SourceIndices.GetData() + IdentitySourceCount, SeamSourceIndices.GetData(), SeamSourceIndices.Num() * sizeof(int32));
+
+    return true;
+}
@@ -4,352 +4,256 @@
 #include "Utilities/PlanetaryCreationLogging.h"
 #include "Simulation/TectonicSimulationService.h"
 #include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
-// Milestone 4 Task 1.2: Detect and execute plate splits (rift-driven)
-void UTectonicSimulationService::DetectAndExecutePlateSplits()
+const FPlateMetadataTable& UTectonicSimulationService::GetPlateMetadata() const
 {
-    if (!Parameters.bEnablePlateTopologyChanges)
-        return;
-
-    // Iterate boundaries to find sustained divergent boundaries
-    struct FSplitCandidate
+    FPlateMetadataTable& Table = PlateMetadata;
+    if (Table.CachedSerial == PlateMetadataSerial && Table.CachedPlateCount == Plates.Num())
     {
-        int32 PlateToSplit = INDEX_NONE;
-        int32 NeighborPlate = INDEX_NONE;
-        TPair<int32, int32> BoundaryKey;
-        double PrimaryMetric = 0.0;   // Rift width (rift mode) or divergent duration (legacy)
-        double SecondaryMetric = 0.0; // Relative velocity or fallback tie-breaker
-    };
-
-    TMap<int32, FSplitCandidate> BestSplitByPlate;
+        return Table;
+    }
 
-    for (auto& BoundaryPair : Boundaries)
+    Table.IndexByPlateID.Reset();
+    Table.IndexByPlateID.Reserve(Plates.Num());
+    Table.AreaSteradians.SetNumUninitialized(Plates.Num());
+    Table.CrustTypes.SetNumUninitialized(Plates.Num());
+    for (int32 PlateIdx = 0; PlateIdx < Plates.Num(); ++PlateIdx)
     {
-        const TPair<int32, int32>& PlateIDs = BoundaryPair.Key;
-        FPlateBoundary& Boundary = BoundaryPair.Value;
-
-        // Check if divergent boundary meets split criteria
-        // Two paths: (1) rift-based (if rift propagation enabled), (2) duration-based (legacy)
-        bool bMeetsSplitCriteria = false;
-
-        if (Parameters.bEnableRiftPropagation && Boundary.BoundaryState == EBoundaryState::Rifting)
-        {
-            // Rift-based split: check if rift width exceeds threshold
-            bMeetsSplitCriteria = (Boundary.RiftWidthMeters > Parameters.RiftSplitThresholdMeters);
-        }
-        else
-        {
-            // Legacy duration-based split: sustained divergence
-            bMeetsSplitCriteria = (Boundary.BoundaryType == EBoundaryType::Divergent &&
-                                   Boundary.RelativeVelocity > Parameters.SplitVelocityThreshold &&
-                                   Boundary.DivergentDurationMy > Parameters.SplitDurationThreshold);
-        }
-
-        if (bMeetsSplitCriteria)
-        {
-            // Candidate for split - pick one of the two plates (deterministic: always choose lower PlateID)
-            const int32 PlateToSplit = FMath::Min(PlateIDs.Key, PlateIDs.Value);
-
-            const int32 NeighborPlate = (PlateIDs.Key == PlateToSplit) ? PlateIDs.Value : PlateIDs.Key;
-            const double PrimaryMetric = (Parameters.bEnableRiftPropagation && Boundary.BoundaryState == EBoundaryState::Rifting)
-                ? Boundary.RiftWidthMeters
-                : Boundary.DivergentDurationMy;
-            const double SecondaryMetric = Boundary.RelativeVelocity;
-            const TPair<int32, int32> BoundaryKey = PlateToSplit < NeighborPlate
-                ? TPair<int32, int32>(PlateToSplit, NeighborPlate)
-                : TPair<int32, int32>(NeighborPlate, PlateToSplit);
-
-            FSplitCandidate NewCandidate;
-            NewCandidate.PlateToSplit = PlateToSplit;
-            NewCandidate.NeighborPlate = NeighborPlate;
-            NewCandidate.BoundaryKey = BoundaryKey;
-            NewCandidate.PrimaryMetric = PrimaryMetric;
-            NewCandidate.SecondaryMetric = SecondaryMetric;
-
-            auto IsBetterCandidate = [](const FSplitCandidate& A, const FSplitCandidate& B)
-            {
-                if (!FMath::IsNearlyEqual(A.PrimaryMetric, B.PrimaryMetric))
-                {
-                    return A.PrimaryMetric > B.PrimaryMetric;
-                }
-
-                if (!FMath::IsNearlyEqual(A.SecondaryMetric, B.SecondaryMetric))
-                {
-                    return A.SecondaryMetric > B.SecondaryMetric;
-                }
+        const FTectonicPlate& Plate = Plates[PlateIdx];
+        Table.IndexByPlateID.Add(Plate.PlateID, PlateIdx);
+        Table.AreaSteradians[PlateIdx] = ComputePlateArea(Plate);
+        Table.CrustTypes[PlateIdx] = Plate.CrustType;
+    }
 
-                if (A.PlateToSplit != B.PlateToSplit)
-                {
-                    return A.PlateToSplit < B.PlateToSplit;
-                }
+    Table.CachedSerial = PlateMetadataSerial;
+    Table.CachedPlateCount = Plates.Num();
+    return Table;
+}
 
-                if (A.NeighborPlate != B.NeighborPlate)
-                {
-                    return A.NeighborPlate < B.NeighborPlate;
-                }
+void UTectonicSimulationService::RefreshPlateTopologyCandidates()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefreshPlateTopologyCandidates);
 
-                if (A.BoundaryKey.Key != B.BoundaryKey.Key)
-                {
-                    return A.BoundaryKey.Key < B.BoundaryKey.Key;
-                }
+    FPlateTopologyCandidateTracker& Tracker = PlateTopologyCandidates;
+    const FPlateMetadataTable& Metadata = GetPlateMetadata();
 
-                return A.BoundaryKey.Value < B.BoundaryKey.Value;
-            };
+    const TArray<double> Thresholds = {
+        Parameters.bEnableRiftPropagation ? 1.0 : 0.0,
+        Parameters.RiftSplitThresholdMeters,
+        Parameters.SplitVelocityThreshold,
+        Parameters.SplitDurationThreshold,
+        Parameters.MergeStressThreshold,
+        Parameters.MergeAreaRatioThreshold};
 
-            bool bShouldRecordCandidate = false;
-            if (FSplitCandidate* Existing = BestSplitByPlate.Find(PlateToSplit))
-            {
-                if (IsBetterCandidate(NewCandidate, *Existing))
-                {
-                    bShouldRecordCandidate = true;
-                    *Existing = NewCandidate;
-                }
-            }
-            else
-            {
-                bShouldRecordCandidate = true;
-                BestSplitByPlate.Add(PlateToSplit, NewCandidate);
-            }
+    // A new plate set (split/merge/reset/undo) or new thresholds invalidate every stored candidate.
+    if (Tracker.CachedPlateMetadataSerial != Metadata.CachedSerial || Tracker.CachedThresholds != Thresholds)
+    {
+        Tracker.Signatures.Reset();
+        Tracker.Splits.Reset();
+        Tracker.Merges.Reset();
+        Tracker.CachedPlateMetadataSerial = Metadata.CachedSerial;
+        Tracker.CachedThresholds = Thresholds;
+    }
 
-            if (bShouldRecordCandidate)
+    // Boundaries that disappeared without a plate change (e.g. a rolled-back retessellation) drop out here.
+    if (Tracker.Signatures.Num() > Boundaries.Num())
+    {
+        for (auto It = Tracker.Signatures.CreateIterator(); It; ++It)
+        {
+            if (!Boundaries.Contains(It.Key()))
             {
-                if (Parameters.bEnableRiftPropagation && Boundary.BoundaryState == EBoundaryState::Rifting)
-                {
-                    UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Split Detection] Plate %d candidate for rift-based split along boundary with Plate %d (rift width=%.0f m > %.0f m, velocity=%.4f rad/My)"),
-                        PlateToSplit, NeighborPlate,
-                        Boundary.RiftWidthMeters, Parameters.RiftSplitThresholdMeters, Boundary.RelativeVelocity);
-                }
-                else
-                {
-                    UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Split Detection] Plate %d candidate for duration-based split along boundary with Plate %d (velocity=%.4f rad/My, duration=%.1f My)"),
-                        PlateToSplit, NeighborPlate,
-                        Boundary.RelativeVelocity, Boundary.DivergentDurationMy);
-                }
+                Tracker.Splits.Remove(It.Key());
+                Tracker.Merges.Remove(It.Key());
+                It.RemoveCurrent();
             }
         }
     }
 
-    TArray<FSplitCandidate> CandidateSplits;
-    BestSplitByPlate.GenerateValueArray(CandidateSplits);
-
-    CandidateSplits.Sort([](const FSplitCandidate& A, const FSplitCandidate& B)
+    int32 EvaluatedBoundaries = 0;
+    for (const auto& BoundaryPair : Boundaries)
     {
-        if (!FMath::IsNearlyEqual(A.PrimaryMetric, B.PrimaryMetric))
-        {
-            return A.PrimaryMetric > B.PrimaryMetric;
-        }
+        const TPair<int32, int32>& PlateIDs = BoundaryPair.Key;
+        const FPlateBoundary& Boundary = BoundaryPair.Value;
 
-        if (!FMath::IsNearlyEqual(A.SecondaryMetric, B.SecondaryMetric))
-        {
-            return A.SecondaryMetric > B.SecondaryMetric;
-        }
+        FPlateTopologyCandidateTracker::FBoundarySignature Signature;
+        Signature.BoundaryType = Boundary.BoundaryType;
+        Signature.BoundaryState = Boundary.BoundaryState;
+        Signature.RelativeVelocity = Boundary.RelativeVelocity;
+        Signature.AccumulatedStress = Boundary.AccumulatedStress;
+        Signature.DivergentDurationMy = Boundary.DivergentDurationMy;
+        Signature.RiftWidthMeters = Boundary.RiftWidthMeters;
 
-        if (A.PlateToSplit != B.PlateToSplit)
+        FPlateTopologyCandidateTracker::FBoundarySignature* Previous = Tracker.Signatures.Find(PlateIDs);
+        if (Previous && *Previous == Signature)
         {
-            return A.PlateToSplit < B.PlateToSplit;
+            continue;
         }
 
-        if (A.NeighborPlate != B.NeighborPlate)
+        if (Previous)
         {
-            return A.NeighborPlate < B.NeighborPlate;
+            *Previous = Signature;
         }
-
-        if (A.BoundaryKey.Key != B.BoundaryKey.Key)
+        else
         {
-            return A.BoundaryKey.Key < B.BoundaryKey.Key;
+            Tracker.Signatures.Add(PlateIDs, Signature);
         }
+        ++EvaluatedBoundaries;
 
-        return A.BoundaryKey.Value < B.BoundaryKey.Value;
-    });
+        const TPair<int32, int32> BoundaryKey = PlateIDs.Key < PlateIDs.Value
+            ? PlateIDs
+            : TPair<int32, int32>(PlateIDs.Value, PlateIDs.Key);
 
-    // Execute splits (limit to 1 per step to avoid cascading instability)
-    if (CandidateSplits.Num() > 0)
-    {
-        const FSplitCandidate& SplitCandidate = CandidateSplits[0];
-        const int32 PlateToSplit = SplitCandidate.PlateToSplit;
-        const TPair<int32, int32> BoundaryKey = SplitCandidate.BoundaryKey;
+        // Split: two paths, (1) rift-based (if rift propagation enabled), (2) duration-based (legacy)
+        const bool bRiftSplit = Parameters.bEnableRiftPropagation && Boundary.BoundaryState == EBoundaryState::Rifting;
+        const bool bMeetsSplitCriteria = bRiftSplit
+            ? Boundary.RiftWidthMeters > Parameters.RiftSplitThresholdMeters
+            : (Boundary.BoundaryType == EBoundaryType::Divergent &&
+               Boundary.RelativeVelocity > Parameters.SplitVelocityThreshold &&
+               Boundary.DivergentDurationMy > Parameters.SplitDurationThreshold);
 
-        if (FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey))
+        if (bMeetsSplitCriteria)
         {
-            const bool Success = SplitPlate(PlateToSplit, BoundaryKey, *Boundary);
-            if (Success)
+            // Deterministic: always split the lower PlateID
+            FPlateTopologyCandidate Candidate;
+            Candidate.PlateA = FMath::Min(PlateIDs.Key, PlateIDs.Value);
+            Candidate.PlateB = FMath::Max(PlateIDs.Key, PlateIDs.Value);
+            Candidate.BoundaryKey = BoundaryKey;
+            Candidate.PrimaryMetric = bRiftSplit ? Boundary.RiftWidthMeters : Boundary.DivergentDurationMy;
+            Candidate.SecondaryMetric = Boundary.RelativeVelocity;
+            Candidate.Generation = Tracker.NextGeneration++;
+            Tracker.Splits.Set(Candidate);
+
+            if (bRiftSplit)
             {
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("[Split] Successfully split Plate %d → new plate count: %d"), PlateToSplit, Plates.Num());
+                UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Split Detection] Plate %d candidate for rift-based split along boundary with Plate %d (rift width=%.0f m > %.0f m, velocity=%.4f rad/My)"),
+                    Candidate.PlateA, Candidate.PlateB,
+                    Boundary.RiftWidthMeters, Parameters.RiftSplitThresholdMeters, Boundary.RelativeVelocity);
             }
             else
             {
-                UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Split] Failed to split Plate %d (validation failed)"), PlateToSplit);
+                UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Split Detection] Plate %d candidate for duration-based split along boundary with Plate %d (velocity=%.4f rad/My, duration=%.1f My)"),
+                    Candidate.PlateA, Candidate.PlateB,
+                    Boundary.RelativeVelocity, Boundary.DivergentDurationMy);
             }
         }
-    }
-}
-
-// Milestone 4 Task 1.2: Detect and execute plate merges (subduction-driven)
-void UTectonicSimulationService::DetectAndExecutePlateMerges()
-{
-    if (!Parameters.bEnablePlateTopologyChanges)
-        return;
-
-    // Iterate boundaries to find sustained convergent boundaries with small plates
-    struct FMergeCandidate
-    {
-        int32 ConsumedID = INDEX_NONE;
-        int32 SurvivorID = INDEX_NONE;
-        TPair<int32, int32> BoundaryKey;
-        double PrimaryMetric = 0.0;   // Accumulated stress
-        double SecondaryMetric = 0.0; // Inverted area ratio (prefer smaller consumed plate)
-    };
-
-    TMap<int32, FMergeCandidate> BestMergeByConsumed;
-
-    for (const auto& BoundaryPair : Boundaries)
-    {
-        const TPair<int32, int32>& PlateIDs = BoundaryPair.Key;
-        const FPlateBoundary& Boundary = BoundaryPair.Value;
+        else
+        {
+            Tracker.Splits.Remove(BoundaryKey);
+        }
 
-        // Check if convergent boundary meets merge criteria
+        // Merge: sustained convergence with a small plate (smaller plate < MergeAreaRatioThreshold of larger)
+        bool bMergeCandidate = false;
         if (Boundary.BoundaryType == EBoundaryType::Convergent &&
             Boundary.AccumulatedStress > Parameters.MergeStressThreshold)
         {
-            // Find the two plates
-            const FTectonicPlate* PlateA = Plates.FindByPredicate([ID = PlateIDs.Key](const FTectonicPlate& P) { return P.PlateID == ID; });
-            const FTectonicPlate* PlateB = Plates.FindByPredicate([ID = PlateIDs.Value](const FTectonicPlate& P) { return P.PlateID == ID; });
-
-            if (!PlateA || !PlateB)
-                continue;
-
-            // Calculate plate areas
-            const double AreaA = ComputePlateArea(*PlateA);
-            const double AreaB = ComputePlateArea(*PlateB);
-
-            // Check if area ratio meets threshold (smaller plate < 25% of larger)
-            const double AreaRatio = FMath::Min(AreaA, AreaB) / FMath::Max(AreaA, AreaB);
-
-            if (AreaRatio < Parameters.MergeAreaRatioThreshold)
+            const int32 IndexA = Metadata.FindIndex(PlateIDs.Key);
+            const int32 IndexB = Metadata.FindIndex(PlateIDs.Value);
+            if (IndexA != INDEX_NONE && IndexB != INDEX_NONE)
             {
-                // Determine consumed vs survivor (smaller gets consumed)
-                const int32 ConsumedID = (AreaA < AreaB) ? PlateIDs.Key : PlateIDs.Value;
-                const int32 SurvivorID = (AreaA < AreaB) ? PlateIDs.Value : PlateIDs.Key;
-                const double PrimaryMetric = Boundary.AccumulatedStress;
-                const double SecondaryMetric = 1.0 - AreaRatio; // Larger value => smaller consumed plate
-
-                FMergeCandidate NewCandidate;
-                NewCandidate.ConsumedID = ConsumedID;
-                NewCandidate.SurvivorID = SurvivorID;
-                NewCandidate.BoundaryKey = (PlateIDs.Key < PlateIDs.Value)
-                    ? PlateIDs
-                    : TPair<int32, int32>(PlateIDs.Value, PlateIDs.Key);
-                NewCandidate.PrimaryMetric = PrimaryMetric;
-                NewCandidate.SecondaryMetric = SecondaryMetric;
-
-                auto IsBetterCandidate = [](const FMergeCandidate& A, const FMergeCandidate& B)
-                {
-                    if (!FMath::IsNearlyEqual(A.PrimaryMetric, B.PrimaryMetric))
-                    {
-                        return A.PrimaryMetric > B.PrimaryMetric;
-                    }
-
-                    if (!FMath::IsNearlyEqual(A.SecondaryMetric, B.SecondaryMetric))
-                    {
-                        return A.SecondaryMetric > B.SecondaryMetric;
-                    }
-
-                    if (A.ConsumedID != B.ConsumedID)
-                    {
-                        return A.ConsumedID < B.ConsumedID;
-                    }
-
-                    if (A.SurvivorID != B.SurvivorID)
-                    {
-                        return A.SurvivorID < B.SurvivorID;
-                    }
-
-                    if (A.BoundaryKey.Key != B.BoundaryKey.Key)
-                    {
-                        return A.BoundaryKey.Key < B.BoundaryKey.Key;
-                    }
-
-                    return A.BoundaryKey.Value < B.BoundaryKey.Value;
-                };
-
-                bool bShouldRecordCandidate = false;
-                if (FMergeCandidate* Existing = BestMergeByConsumed.Find(ConsumedID))
-                {
-                    if (IsBetterCandidate(NewCandidate, *Existing))
-                    {
-                        bShouldRecordCandidate = true;
-                        *Existing = NewCandidate;
-                    }
-                }
-                else
-                {
-                    bShouldRecordCandidate = true;
-                    BestMergeByConsumed.Add(ConsumedID, NewCandidate);
-                }
+                const double AreaA = Metadata.AreaSteradians[IndexA];
+                const double AreaB = Metadata.AreaSteradians[IndexB];
+                const double AreaRatio = FMath::Min(AreaA, AreaB) / FMath::Max(AreaA, AreaB);
 
-                if (bShouldRecordCandidate)
+                if (AreaRatio < Parameters.MergeAreaRatioThreshold)
                 {
+                    // Smaller plate gets consumed
+                    FPlateTopologyCandidate Candidate;
+                    Candidate.PlateA = (AreaA < AreaB) ? PlateIDs.Key : PlateIDs.Value;
+                    Candidate.PlateB = (AreaA < AreaB) ? PlateIDs.Value : PlateIDs.Key;
+                    Candidate.BoundaryKey = BoundaryKey;
+                    Candidate.PrimaryMetric = Boundary.AccumulatedStress;
+                    Candidate.SecondaryMetric = 1.0 - AreaRatio; // Larger value => smaller consumed plate
+                    Candidate.Generation = Tracker.NextGeneration++;
+                    Tracker.Merges.Set(Candidate);
+                    bMergeCandidate = true;
+
                     UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Merge Detection] Plate %d candidate for merge into Plate %d (stress=%.1f MPa, area ratio=%.2f%%)"),
-                        ConsumedID, SurvivorID, Boundary.AccumulatedStress, AreaRatio * 100.0);
+                        Candidate.PlateA, Candidate.PlateB, Boundary.AccumulatedStress, AreaRatio * 100.0);
                 }
             }
         }
+
+        if (!bMergeCandidate)
+        {
+            Tracker.Merges.Remove(BoundaryKey);
+        }
     }
 
-    TArray<FMergeCandidate> CandidateMerges;
-    BestMergeByConsumed.GenerateValueArray(CandidateMerges);
+    Tracker.Splits.Prune();
+    Tracker.Merges.Prune();
+    Tracker.LastEvaluatedBoundaries = EvaluatedBoundaries;
+    Tracker.LastTrackedBoundaries = Tracker.Signatures.Num();
+
+    UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[Topology Candidates] Re-evaluated %d of %d boundaries (%d split, %d merge candidates)"),
+        EvaluatedBoundaries, Tracker.Signatures.Num(), Tracker.Splits.LiveGenerations.Num(), Tracker.Merges.LiveGenerations.Num());
+}
 
-    CandidateMerges.Sort([](const FMergeCandidate& A, const FMergeCandidate& B)
+// Milestone 4 Task 1.2: Detect and execute plate splits (rift-driven)
+void UTectonicSimulationService::DetectAndExecutePlateSplits()
+{
+    if (!Parameters.bEnablePlateTopologyChanges)
+        return;
+
+    // Sustained divergent boundaries are tracked incrementally; only changed boundaries were re-evaluated
+    RefreshPlateTopologyCandidates();
+
+    // Execute splits (limit to 1 per step to avoid cascading instability)
+    const FPlateTopologyCandidate* SplitCandidate = PlateTopologyCandidates.Splits.Peek();
+    if (!SplitCandidate)
     {
-        if (!FMath::IsNearlyEqual(A.PrimaryMetric, B.PrimaryMetric))
-        {
-            return A.PrimaryMetric > B.PrimaryMetric;
-        }
+        return;
+    }
 
-        if (!FMath::IsNearlyEqual(A.SecondaryMetric, B.SecondaryMetric))
-        {
-            return A.SecondaryMetric > B.SecondaryMetric;
-        }
+    const int32 PlateToSplit = SplitCandidate->PlateA;
+    const TPair<int32, int32> BoundaryKey = SplitCandidate->BoundaryKey;
 
-        if (A.ConsumedID != B.ConsumedID)
+    if (FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey))
+    {
+        const bool Success = SplitPlate(PlateToSplit, BoundaryKey, *Boundary);
+        if (Success)
         {
-            return A.ConsumedID < B.ConsumedID;
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("[Split] Successfully split Plate %d → new plate count: %d"), PlateToSplit, Plates.Num());
         }
-
-        if (A.SurvivorID != B.SurvivorID)
+        else
         {
-            return A.SurvivorID < B.SurvivorID;
+            UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Split] Failed to split Plate %d (validation failed)"), PlateToSplit);
         }
+    }
+}
 
-        if (A.BoundaryKey.Key != B.BoundaryKey.Key)
-        {
-            return A.BoundaryKey.Key < B.BoundaryKey.Key;
-        }
+// Milestone 4 Task 1.2: Detect and execute plate merges (subduction-driven)
+void UTectonicSimulationService::DetectAndExecutePlateMerges()
+{
+    if (!Parameters.bEnablePlateTopologyChanges)
+        return;
 
-        return A.BoundaryKey.Value < B.BoundaryKey.Value;
-    });
+    // Sustained convergent boundaries with small plates are tracked incrementally (areas come from plate metadata)
+    RefreshPlateTopologyCandidates();
 
     // Execute merges (limit to 1 per step to avoid cascading instability)
-    if (CandidateMerges.Num() > 0)
+    const FPlateTopologyCandidate* MergeCandidate = PlateTopologyCandidates.Merges.Peek();
+    if (!MergeCandidate)
     {
-        const FMergeCandidate& MergeCandidate = CandidateMerges[0];
-        const int32 ConsumedID = MergeCandidate.ConsumedID;
-        const int32 SurvivorID = MergeCandidate.SurvivorID;
-        const TPair<int32, int32>& BoundaryKey = MergeCandidate.BoundaryKey;
+        return;
+    }
 
-        if (const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey))
+    const int32 ConsumedID = MergeCandidate->PlateA;
+    const int32 SurvivorID = MergeCandidate->PlateB;
+    const TPair<int32, int32> BoundaryKey = MergeCandidate->BoundaryKey;
+
+    if (const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey))
+    {
+        const bool Success = MergePlates(ConsumedID, SurvivorID, BoundaryKey, *Boundary);
+        if (Success)
         {
-            const bool Success = MergePlates(ConsumedID, SurvivorID, BoundaryKey, *Boundary);
-            if (Success)
-            {
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("[Merge] Successfully merged Plate %d into Plate %d → new plate count: %d"),
-                    ConsumedID, SurvivorID, Plates.Num());
-            }
-            else
-            {
-                UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Merge] Failed to merge Plate %d into Plate %d (validation failed)"),
-                    ConsumedID, SurvivorID);
-            }
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("[Merge] Successfully merged Plate %d into Plate %d → new plate count: %d"),
+                ConsumedID, SurvivorID, Plates.Num());
+        }
+        else
+        {
+            UE_LOG(LogPlanetaryCreation, Warning, TEXT("[Merge] Failed to merge Plate %d into Plate %d (validation failed)"),
+                ConsumedID, SurvivorID);
         }
     }
 }
@@ -675,6 +579,11 @@ double UTectonicSimulationService::ComputePlateArea(const FTectonicPlate& Plate)
 
 // Milestone 4 Task 1.3: Update boundary lifecycle states
 void UTectonicSimulationService::UpdateBoundaryStates(double DeltaTimeMy)
+{
+    SweepBoundaries(FPlateBoundaryTable::StageStates, DeltaTimeMy);
+}
+
+bool UTectonicSimulationService::AdvanceBoundaryState(FPlateBoundary& Boundary, double DeltaTimeMy) const
 {
     // State transition rules (paper Section 4.1):
     // - Nascent → Active: velocity > threshold for sustained duration
@@ -684,69 +593,56 @@ void UTectonicSimulationService::UpdateBoundaryStates(double DeltaTimeMy)
     constexpr double ActiveVelocityThreshold = 0.02; // rad/My (~1-2 cm/yr)
     constexpr double ActiveDurationThreshold = 10.0; // My (sustained activity required)
 
-    for (auto& BoundaryPair : Boundaries)
+    // Track divergent/convergent duration
+    if (Boundary.BoundaryType == EBoundaryType::Divergent)
+    {
+        Boundary.DivergentDurationMy += DeltaTimeMy;
+        Boundary.ConvergentDurationMy = 0.0; // Reset other counter
+    }
+    else if (Boundary.BoundaryType == EBoundaryType::Convergent)
     {
-        FPlateBoundary& Boundary = BoundaryPair.Value;
+        Boundary.ConvergentDurationMy += DeltaTimeMy;
+        Boundary.DivergentDurationMy = 0.0; // Reset other counter
+    }
+    else // Transform
+    {
+        Boundary.DivergentDurationMy = 0.0;
+        Boundary.ConvergentDurationMy = 0.0;
+    }
 
-        // Track divergent/convergent duration
-        if (Boundary.BoundaryType == EBoundaryType::Divergent)
-        {
-            Boundary.DivergentDurationMy += DeltaTimeMy;
-            Boundary.ConvergentDurationMy = 0.0; // Reset other counter
-        }
-        else if (Boundary.BoundaryType == EBoundaryType::Convergent)
-        {
-            Boundary.ConvergentDurationMy += DeltaTimeMy;
-            Boundary.DivergentDurationMy = 0.0; // Reset other counter
-        }
-        else // Transform
+    // State transitions
+    const EBoundaryState OldState = Boundary.BoundaryState;
+
+    switch (Boundary.BoundaryState)
+    {
+    case EBoundaryState::Nascent:
+        // Nascent → Active: sustained high velocity
+        if (Boundary.RelativeVelocity > ActiveVelocityThreshold &&
+            (Boundary.DivergentDurationMy > ActiveDurationThreshold || Boundary.ConvergentDurationMy > ActiveDurationThreshold))
         {
-            Boundary.DivergentDurationMy = 0.0;
-            Boundary.ConvergentDurationMy = 0.0;
+            Boundary.BoundaryState = EBoundaryState::Active;
+            Boundary.StateTransitionTimeMy = CurrentTimeMy;
         }
+        break;
 
-        // State transitions
-        EBoundaryState OldState = Boundary.BoundaryState;
-
-        switch (Boundary.BoundaryState)
+    case EBoundaryState::Active:
+        // Active → Dormant: velocity drops
+        if (Boundary.RelativeVelocity < ActiveVelocityThreshold)
         {
-        case EBoundaryState::Nascent:
-            // Nascent → Active: sustained high velocity
-            if (Boundary.RelativeVelocity > ActiveVelocityThreshold &&
-                (Boundary.DivergentDurationMy > ActiveDurationThreshold || Boundary.ConvergentDurationMy > ActiveDurationThreshold))
-            {
-                Boundary.BoundaryState = EBoundaryState::Active;
-                Boundary.StateTransitionTimeMy = CurrentTimeMy;
-            }
-            break;
-
-        case EBoundaryState::Active:
-            // Active → Dormant: velocity drops
-            if (Boundary.RelativeVelocity < ActiveVelocityThreshold)
-            {
-                Boundary.BoundaryState = EBoundaryState::Dormant;
-                Boundary.StateTransitionTimeMy = CurrentTimeMy;
-            }
-            break;
-
-        case EBoundaryState::Dormant:
-            // Dormant → Active: velocity rises again
-            if (Boundary.RelativeVelocity > ActiveVelocityThreshold)
-            {
-                Boundary.BoundaryState = EBoundaryState::Active;
-                Boundary.StateTransitionTimeMy = CurrentTimeMy;
-            }
-            break;
+            Boundary.BoundaryState = EBoundaryState::Dormant;
+            Boundary.StateTransitionTimeMy = CurrentTimeMy;
         }
+        break;
 
-        // Log state transitions
-        if (Boundary.BoundaryState != OldState)
+    case EBoundaryState::Dormant:
+        // Dormant → Active: velocity rises again
+        if (Boundary.RelativeVelocity > ActiveVelocityThreshold)
         {
-            UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[Boundary State] Plate %d <-> %d: %s → %s at %.2f My (velocity=%.4f rad/My)"),
-                BoundaryPair.Key.Key, BoundaryPair.Key.Value,
-                OldState == EBoundaryState::Nascent ? TEXT("Nascent") : (OldState == EBoundaryState::Active ? TEXT("Active") : TEXT("Dormant")),
-                Boundary.BoundaryState == EBoundaryState::Nascent ? TEXT("Nascent") : (Boundary.BoundaryState == EBoundaryState::Active ? TEXT("Active") : TEXT("Dormant")),
-                CurrentTimeMy, Boundary.RelativeVelocity);
+            Boundary.BoundaryState = EBoundaryState::Active;
+            Boundary.StateTransitionTimeMy = CurrentTimeMy;
         }
+        break;
     }
+
+    return Boundary.BoundaryState != OldState;
 }
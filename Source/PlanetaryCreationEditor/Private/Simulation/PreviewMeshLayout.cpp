@@ -0,0 +1,95 @@
+#include "Simulation/PreviewMeshLayout.h"
+
+#include "Utilities/PlanetaryCreationLogging.h"
+
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "MeshOptimizer/meshoptimizer.h"
+
+namespace
+{
+    /** Post-transform cache size used for optimization and analysis (typical FIFO size on desktop GPUs). */
+    constexpr int32 PreviewVertexCacheSize = 16;
+}
+
+void FPreviewMeshLayout::Reset()
+{
+    SourceVertexCount = 0;
+    VertexCount = 0;
+    Indices.Empty();
+    NewToBuild.Empty();
+    BaselineMetrics = FPreviewIndexMetrics();
+    OptimizedMetrics = FPreviewIndexMetrics();
+}
+
+void FPreviewMeshLayout::Build(const TArray<uint32>& BuildOrderIndices, int32 InSourceVertexCount, int32 InVertexCount)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(PreviewMeshLayout_Build);
+
+    Reset();
+    const int32 IndexCount = BuildOrderIndices.Num();
+    if (InVertexCount <= 0 || IndexCount == 0 || IndexCount % 3 != 0)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    BaselineMetrics = Analyze(BuildOrderIndices, InVertexCount);
+
+    // Triangle order for the post-transform cache.
+    TArray<uint32> Optimized;
+    Optimized.SetNumUninitialized(IndexCount);
+    meshopt_optimizeVertexCache(Optimized.GetData(), BuildOrderIndices.GetData(), IndexCount, InVertexCount);
+
+    // Vertex order by first use. Unreferenced vertices (none expected) keep their relative order at the tail.
+    TArray<uint32> BuildToNew;
+    BuildToNew.SetNumUninitialized(InVertexCount);
+    size_t NextVertex = meshopt_optimizeVertexFetchRemap(BuildToNew.GetData(), Optimized.GetData(), IndexCount, InVertexCount);
+    for (int32 BuildIndex = 0; BuildIndex < InVertexCount; ++BuildIndex)
+    {
+        if (BuildToNew[BuildIndex] == ~0u)
+        {
+            BuildToNew[BuildIndex] = static_cast<uint32>(NextVertex++);
+        }
+    }
+    check(NextVertex == static_cast<size_t>(InVertexCount));
+
+    meshopt_remapIndexBuffer(Optimized.GetData(), Optimized.GetData(), IndexCount, BuildToNew.GetData());
+
+    NewToBuild.SetNumUninitialized(InVertexCount);
+    for (int32 BuildIndex = 0; BuildIndex < InVertexCount; ++BuildIndex)
+    {
+        NewToBuild[BuildToNew[BuildIndex]] = BuildIndex;
+    }
+
+    Indices = MoveTemp(Optimized);
+    SourceVertexCount = InSourceVertexCount;
+    VertexCount = InVertexCount;
+    OptimizedMetrics = Analyze(Indices, VertexCount);
+
+    UE_LOG(LogPlanetaryCreation, Log,
+        TEXT("[MeshLayout] Optimized %d verts / %d tris in %.2f ms: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, overfetch %.3f -> %.3f"),
+        VertexCount, IndexCount / 3, (FPlatformTime::Seconds() - StartTime) * 1000.0,
+        BaselineMetrics.ACMR, OptimizedMetrics.ACMR,
+        BaselineMetrics.ATVR, OptimizedMetrics.ATVR,
+        BaselineMetrics.Overfetch, OptimizedMetrics.Overfetch);
+}
+
+FPreviewIndexMetrics FPreviewMeshLayout::Analyze(TConstArrayView<uint32> InIndices, int32 InVertexCount)
+{
+    FPreviewIndexMetrics Metrics;
+    if (InIndices.Num() == 0 || InVertexCount <= 0)
+    {
+        return Metrics;
+    }
+
+    const meshopt_VertexCacheStatistics CacheStats = meshopt_analyzeVertexCache(
+        InIndices.GetData(), InIndices.Num(), InVertexCount, PreviewVertexCacheSize, 0, 0);
+    const meshopt_VertexFetchStatistics FetchStats = meshopt_analyzeVertexFetch(
+        InIndices.GetData(), InIndices.Num(), InVertexCount, GPUVertexStride);
+
+    Metrics.ACMR = CacheStats.acmr;
+    Metrics.ATVR = CacheStats.atvr;
+    Metrics.Overfetch = FetchStats.overfetch;
+    return Metrics;
+}
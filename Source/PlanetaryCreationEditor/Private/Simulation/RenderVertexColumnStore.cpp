@@ -0,0 +1,230 @@
+#include "Simulation/RenderVertexColumnStore.h"
+
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+SIZE_T FRenderVertexColumnSnapshot::GetAllocatedSize() const
+{
+    SIZE_T Size = Columns.GetAllocatedSize();
+    for (const FColumnBlob& Blob : Columns)
+    {
+        Size += Blob.Bytes.GetAllocatedSize();
+    }
+    return Size;
+}
+
+int32 FRenderVertexColumnStore::Num() const
+{
+    if (!Columns.IsValidIndex(PrimaryColumn))
+    {
+        return 0;
+    }
+
+    const FColumn& Primary = Columns[PrimaryColumn];
+    return Primary.Ops->Num(Primary.Array);
+}
+
+void FRenderVertexColumnStore::MarkAllColumnsChanged()
+{
+    for (FColumn& Column : Columns)
+    {
+        Column.Version = ++VersionCounter;
+    }
+}
+
+int32 FRenderVertexColumnStore::Compact(const TBitArray<>& RemovalMask, TArray<int32>& OutOldToNew)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RenderVertexColumnStore_Compact);
+
+    const int32 OriginalCount = Num();
+    OutOldToNew.SetNumUninitialized(OriginalCount);
+
+    TArray<int32> KeptOldIndices;
+    KeptOldIndices.Reserve(OriginalCount);
+    for (int32 Index = 0; Index < OriginalCount; ++Index)
+    {
+        if (RemovalMask.IsValidIndex(Index) && RemovalMask[Index])
+        {
+            OutOldToNew[Index] = INDEX_NONE;
+            continue;
+        }
+
+        OutOldToNew[Index] = KeptOldIndices.Num();
+        KeptOldIndices.Add(Index);
+    }
+
+    const int32 NewCount = KeptOldIndices.Num();
+    if (NewCount == OriginalCount)
+    {
+        return NewCount;
+    }
+
+    // Kept vertices only move toward lower indices, so each column compacts in place. Columns run in parallel.
+    ParallelFor(Columns.Num(), [&](int32 ColumnIdx)
+    {
+        FColumn& Column = Columns[ColumnIdx];
+        if (!EnumHasAnyFlags(Column.Flags, ERenderVertexColumnFlags::Topology))
+        {
+            return;
+        }
+
+        if (Column.Ops->Num(Column.Array) != OriginalCount)
+        {
+            if (EnumHasAnyFlags(Column.Flags, ERenderVertexColumnFlags::KeepSized))
+            {
+                Column.Ops->SetNumZeroed(Column.Array, NewCount);
+            }
+            else
+            {
+                Column.Ops->Reset(Column.Array);
+            }
+            return;
+        }
+
+        uint8* Data = Column.Ops->Data(Column.Array);
+        const int32 ElementSize = Column.ElementSize;
+        for (int32 NewIndex = 0; NewIndex < NewCount; ++NewIndex)
+        {
+            const int32 OldIndex = KeptOldIndices[NewIndex];
+            if (OldIndex != NewIndex)
+            {
+                FMemory::Memcpy(Data + static_cast<SIZE_T>(NewIndex) * ElementSize, Data + static_cast<SIZE_T>(OldIndex) * ElementSize, ElementSize);
+            }
+        }
+        Column.Ops->SetNumUninitialized(Column.Array, NewCount);
+    });
+
+    for (FColumn& Column : Columns)
+    {
+        if (EnumHasAnyFlags(Column.Flags, ERenderVertexColumnFlags::Topology))
+        {
+            Column.Version = ++VersionCounter;
+        }
+    }
+
+    return NewCount;
+}
+
+void FRenderVertexColumnStore::Permute(TConstArrayView<int32> NewToOld)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RenderVertexColumnStore_Permute);
+
+    const int32 VertexCount = Num();
+    if (NewToOld.Num() != VertexCount || VertexCount == 0)
+    {
+        return;
+    }
+
+    ParallelFor(Columns.Num(), [&](int32 ColumnIdx)
+    {
+        FColumn& Column = Columns[ColumnIdx];
+        if (!EnumHasAnyFlags(Column.Flags, ERenderVertexColumnFlags::Topology) || Column.Ops->Num(Column.Array) != VertexCount)
+        {
+            return;
+        }
+
+        const int32 ElementSize = Column.ElementSize;
+        const SIZE_T ByteCount = static_cast<SIZE_T>(VertexCount) * ElementSize;
+
+        TArray<uint8, TAlignedHeapAllocator<64>> Scratch;
+        Scratch.SetNumUninitialized(ByteCount);
+
+        uint8* Data = Column.Ops->Data(Column.Array);
+        for (int32 NewIndex = 0; NewIndex < VertexCount; ++NewIndex)
+        {
+            FMemory::Memcpy(Scratch.GetData() + static_cast<SIZE_T>(NewIndex) * ElementSize,
+                Data + static_cast<SIZE_T>(NewToOld[NewIndex]) * ElementSize, ElementSize);
+        }
+        FMemory::Memcpy(Data, Scratch.GetData(), ByteCount);
+    });
+
+    for (FColumn& Column : Columns)
+    {
+        if (EnumHasAnyFlags(Column.Flags, ERenderVertexColumnFlags::Topology))
+        {
+            Column.Version = ++VersionCounter;
+        }
+    }
+}
+
+void FRenderVertexColumnStore::CaptureSnapshot(FRenderVertexColumnSnapshot& OutSnapshot, ERenderVertexColumnFlags RequiredFlags) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RenderVertexColumnStore_Capture);
+
+    TArray<int32> SelectedColumns;
+    SelectedColumns.Reserve(Columns.Num());
+    for (int32 ColumnIdx = 0; ColumnIdx < Columns.Num(); ++ColumnIdx)
+    {
+        if (EnumHasAllFlags(Columns[ColumnIdx].Flags, RequiredFlags))
+        {
+            SelectedColumns.Add(ColumnIdx);
+        }
+    }
+
+    OutSnapshot.VertexCount = Num();
+    OutSnapshot.Columns.SetNum(SelectedColumns.Num());
+
+    ParallelFor(SelectedColumns.Num(), [&](int32 SlotIdx)
+    {
+        const FColumn& Column = Columns[SelectedColumns[SlotIdx]];
+        FRenderVertexColumnSnapshot::FColumnBlob& Blob = OutSnapshot.Columns[SlotIdx];
+
+        const int32 ColumnNum = Column.Ops->Num(Column.Array);
+        const SIZE_T ByteCount = static_cast<SIZE_T>(ColumnNum) * Column.ElementSize;
+
+        Blob.Name = Column.Name;
+        Blob.Num = ColumnNum;
+        Blob.ElementSize = Column.ElementSize;
+        Blob.Bytes.SetNumUninitialized(ByteCount);
+        if (ByteCount > 0)
+        {
+            FMemory::Memcpy(Blob.Bytes.GetData(), Column.Ops->Data(Column.Array), ByteCount);
+        }
+    });
+}
+
+void FRenderVertexColumnStore::RestoreSnapshot(const FRenderVertexColumnSnapshot& Snapshot)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RenderVertexColumnStore_Restore);
+
+    TArray<int32> TargetColumns;
+    TargetColumns.Init(INDEX_NONE, Snapshot.Columns.Num());
+    for (int32 BlobIdx = 0; BlobIdx < Snapshot.Columns.Num(); ++BlobIdx)
+    {
+        const FRenderVertexColumnSnapshot::FColumnBlob& Blob = Snapshot.Columns[BlobIdx];
+        for (int32 ColumnIdx = 0; ColumnIdx < Columns.Num(); ++ColumnIdx)
+        {
+            if (Columns[ColumnIdx].Name == Blob.Name && Columns[ColumnIdx].ElementSize == Blob.ElementSize)
+            {
+                TargetColumns[BlobIdx] = ColumnIdx;
+                break;
+            }
+        }
+        ensureMsgf(TargetColumns[BlobIdx] != INDEX_NONE, TEXT("Render vertex column %s is not registered"), *Blob.Name.ToString());
+    }
+
+    ParallelFor(Snapshot.Columns.Num(), [&](int32 BlobIdx)
+    {
+        if (TargetColumns[BlobIdx] == INDEX_NONE)
+        {
+            return;
+        }
+
+        const FRenderVertexColumnSnapshot::FColumnBlob& Blob = Snapshot.Columns[BlobIdx];
+        const FColumn& Column = Columns[TargetColumns[BlobIdx]];
+
+        Column.Ops->SetNumUninitialized(Column.Array, Blob.Num);
+        if (Blob.Num > 0)
+        {
+            FMemory::Memcpy(Column.Ops->Data(Column.Array), Blob.Bytes.GetData(), static_cast<SIZE_T>(Blob.Num) * Blob.ElementSize);
+        }
+    });
+
+    for (int32 ColumnIdx : TargetColumns)
+    {
+        if (ColumnIdx != INDEX_NONE)
+        {
+            Columns[ColumnIdx].Version = ++VersionCounter;
+        }
+    }
+}
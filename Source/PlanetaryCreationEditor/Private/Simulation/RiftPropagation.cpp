@@ -8,73 +8,97 @@ void UTectonicSimulationService::UpdateRiftProgression(double DeltaTimeMy)
     if (!Parameters.bEnableRiftPropagation)
         return;
 
-    for (auto& BoundaryPair : Boundaries)
-    {
-        FPlateBoundary& Boundary = BoundaryPair.Value;
+    SweepBoundaries(FPlateBoundaryTable::StageRift, DeltaTimeMy);
+}
+
+uint8 UTectonicSimulationService::AdvanceRiftProgression(FPlateBoundary& Boundary, double DeltaTimeMy) const
+{
+    // Runs inside the parallel boundary sweep: no logging here, events are logged by LogRiftProgression afterwards.
+    uint8 Events = 0;
 
-        // Only process divergent boundaries
-        if (Boundary.BoundaryType != EBoundaryType::Divergent)
+    // Only process divergent boundaries
+    if (Boundary.BoundaryType != EBoundaryType::Divergent)
+    {
+        // Reset rift parameters for non-divergent boundaries
+        if (Boundary.BoundaryState == EBoundaryState::Rifting)
         {
-            // Reset rift parameters for non-divergent boundaries
-            if (Boundary.BoundaryState == EBoundaryState::Rifting)
-            {
-                Boundary.BoundaryState = EBoundaryState::Nascent;
-                Boundary.RiftWidthMeters = 0.0;
-                Boundary.RiftFormationTimeMy = 0.0;
-            }
-            continue;
+            Boundary.BoundaryState = EBoundaryState::Nascent;
+            Boundary.RiftWidthMeters = 0.0;
+            Boundary.RiftFormationTimeMy = 0.0;
         }
+        return Events;
+    }
 
-        // Check if boundary should enter rifting state
-        // Criteria: Divergent + sustained high velocity (from split threshold)
-        if (Boundary.BoundaryState != EBoundaryState::Rifting)
+    // Check if boundary should enter rifting state
+    // Criteria: Divergent + sustained high velocity (from split threshold)
+    if (Boundary.BoundaryState != EBoundaryState::Rifting)
+    {
+        // Transition to rifting if divergent velocity sustained above threshold
+        if (Boundary.RelativeVelocity > Parameters.SplitVelocityThreshold &&
+            Boundary.DivergentDurationMy > Parameters.SplitDurationThreshold * 0.5) // Trigger rift earlier than split
         {
-            // Transition to rifting if divergent velocity sustained above threshold
-            if (Boundary.RelativeVelocity > Parameters.SplitVelocityThreshold &&
-                Boundary.DivergentDurationMy > Parameters.SplitDurationThreshold * 0.5) // Trigger rift earlier than split
-            {
-                Boundary.BoundaryState = EBoundaryState::Rifting;
-                Boundary.RiftFormationTimeMy = CurrentTimeMy;
-                Boundary.StateTransitionTimeMy = CurrentTimeMy;
+            Boundary.BoundaryState = EBoundaryState::Rifting;
+            Boundary.RiftFormationTimeMy = CurrentTimeMy;
+            Boundary.StateTransitionTimeMy = CurrentTimeMy;
+            Events |= FPlateBoundaryTable::EventRiftEntered;
+        }
+    }
 
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rift] Boundary [%d-%d] entered rifting state at %.2f My (velocity=%.4f rad/My)"),
-                    BoundaryPair.Key.Key, BoundaryPair.Key.Value, CurrentTimeMy, Boundary.RelativeVelocity);
-            }
+    // Update rift width for active rifts
+    if (Boundary.BoundaryState == EBoundaryState::Rifting)
+    {
+        // Rift widening: width increases based on divergent velocity
+        // Formula: Δwidth = RiftProgressionRate * RelativeVelocity * ΔTime
+        // Units: meters = (m/My)/(rad/My) * (rad/My) * My = m
+        const double WidthIncrement = Parameters.RiftProgressionRate * Boundary.RelativeVelocity * DeltaTimeMy;
+        Boundary.RiftWidthMeters += WidthIncrement;
+        Events |= FPlateBoundaryTable::EventRiftWidened;
+
+        // Check if rift has reached split threshold
+        // Note: Actual split will be triggered by DetectAndExecutePlateSplits()
+        // This just tracks the rift maturity for visualization/analytics
+        if (Boundary.RiftWidthMeters > Parameters.RiftSplitThresholdMeters)
+        {
+            Events |= FPlateBoundaryTable::EventRiftSplitReady;
         }
 
-        // Update rift width for active rifts
-        if (Boundary.BoundaryState == EBoundaryState::Rifting)
+        // Transition back to Active if velocity drops below threshold (rift dormancy)
+        if (Boundary.RelativeVelocity < Parameters.SplitVelocityThreshold * 0.5) // Hysteresis
         {
-            // Rift widening: width increases based on divergent velocity
-            // Formula: Δwidth = RiftProgressionRate * RelativeVelocity * ΔTime
-            // Units: meters = (m/My)/(rad/My) * (rad/My) * My = m
-            const double WidthIncrement = Parameters.RiftProgressionRate * Boundary.RelativeVelocity * DeltaTimeMy;
-            Boundary.RiftWidthMeters += WidthIncrement;
+            Boundary.BoundaryState = EBoundaryState::Active;
+            // Preserve rift width for potential resumption
+            Events |= FPlateBoundaryTable::EventRiftDormant;
+        }
+    }
 
-            const double RiftAgeMy = CurrentTimeMy - Boundary.RiftFormationTimeMy;
+    return Events;
+}
 
-            UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[Rift] Boundary [%d-%d]: width=%.0f m, age=%.2f My, velocity=%.4f rad/My"),
-                BoundaryPair.Key.Key, BoundaryPair.Key.Value, Boundary.RiftWidthMeters, RiftAgeMy, Boundary.RelativeVelocity);
+void UTectonicSimulationService::LogRiftProgression(const TPair<int32, int32>& PlateIDs, const FPlateBoundary& Boundary, uint8 Events) const
+{
+    if (Events & FPlateBoundaryTable::EventRiftEntered)
+    {
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rift] Boundary [%d-%d] entered rifting state at %.2f My (velocity=%.4f rad/My)"),
+            PlateIDs.Key, PlateIDs.Value, CurrentTimeMy, Boundary.RelativeVelocity);
+    }
 
-            // Check if rift has reached split threshold
-            if (Boundary.RiftWidthMeters > Parameters.RiftSplitThresholdMeters)
-            {
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rift] Boundary [%d-%d] exceeded split threshold (width=%.0f m > %.0f m) at %.2f My"),
-                    BoundaryPair.Key.Key, BoundaryPair.Key.Value, Boundary.RiftWidthMeters, Parameters.RiftSplitThresholdMeters, CurrentTimeMy);
+    if (Events & FPlateBoundaryTable::EventRiftWidened)
+    {
+        const double RiftAgeMy = CurrentTimeMy - Boundary.RiftFormationTimeMy;
 
-                // Note: Actual split will be triggered by DetectAndExecutePlateSplits()
-                // This just tracks the rift maturity for visualization/analytics
-            }
+        UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[Rift] Boundary [%d-%d]: width=%.0f m, age=%.2f My, velocity=%.4f rad/My"),
+            PlateIDs.Key, PlateIDs.Value, Boundary.RiftWidthMeters, RiftAgeMy, Boundary.RelativeVelocity);
+    }
 
-            // Transition back to Active if velocity drops below threshold (rift dormancy)
-            if (Boundary.RelativeVelocity < Parameters.SplitVelocityThreshold * 0.5) // Hysteresis
-            {
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rift] Boundary [%d-%d] became dormant (velocity dropped to %.4f rad/My)"),
-                    BoundaryPair.Key.Key, BoundaryPair.Key.Value, Boundary.RelativeVelocity);
+    if (Events & FPlateBoundaryTable::EventRiftSplitReady)
+    {
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rift] Boundary [%d-%d] exceeded split threshold (width=%.0f m > %.0f m) at %.2f My"),
+            PlateIDs.Key, PlateIDs.Value, Boundary.RiftWidthMeters, Parameters.RiftSplitThresholdMeters, CurrentTimeMy);
+    }
 
-                Boundary.BoundaryState = EBoundaryState::Active;
-                // Preserve rift width for potential resumption
-            }
-        }
+    if (Events & FPlateBoundaryTable::EventRiftDormant)
+    {
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rift] Boundary [%d-%d] became dormant (velocity dropped to %.4f rad/My)"),
+            PlateIDs.Key, PlateIDs.Value, Boundary.RelativeVelocity);
     }
 }
@@ -2,6 +2,7 @@
 
 #include "Simulation/PaperConstants.h"
 #include "Simulation/PaperProfiling.h"
+#include "Async/ParallelFor.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/Paths.h"
@@ -67,14 +68,25 @@ namespace Rifting
         return (len > 0.0) ? (T / len) : FVector3d::UnitY();
     }
 
+    void FPlateVertexMembership::Build(const TArray<int32>& PlateIdPerVertex)
+    {
+        VerticesByPlate.Reset();
+        MaxPlateId = INDEX_NONE;
+        for (int32 v = 0; v < PlateIdPerVertex.Num(); ++v)
+        {
+            const int32 PlateId = PlateIdPerVertex[v];
+            VerticesByPlate.FindOrAdd(PlateId).Add(v);
+            MaxPlateId = FMath::Max(MaxPlateId, PlateId);
+        }
+    }
+
     bool PerformRifting(
         const FRiftingEvent& Event,
         const TArray<FVector3d>& Points,
-        const TArray<int32>& CSR_Offsets,
-        const TArray<int32>& CSR_Adj,
-        const TArray<int32>& PlateIdPerVertexIn,
-        TArray<int32>& PlateIdPerVertexOut,
+        FPlateVertexMembership& InOutMembership,
+        TArray<int32>& InOutPlateIdPerVertex,
         TArray<FVector3d>& OutFragmentDriftDirections,
+        TArray<FVector3d>& OutFragmentCentroids,
         FRiftingMetrics& InOutMetrics,
         TArray<TPair<int32,double>>* OutFragmentPlateRatiosOrNull)
     {
@@ -85,92 +97,117 @@ namespace Rifting
             return false;
         }
 
-        PlateIdPerVertexOut = PlateIdPerVertexIn;
-
-        // Collect vertices belonging to the plate
-        TArray<int32> PlateVerts;
-        PlateVerts.Reserve(N / 4);
-        for (int32 i = 0; i < N; ++i)
-        {
-            if (PlateIdPerVertexIn.IsValidIndex(i) && PlateIdPerVertexIn[i] == Event.PlateId)
-            {
-                PlateVerts.Add(i);
-            }
-        }
-        if (PlateVerts.Num() < Event.FragmentCount)
+        // Vertices belonging to the plate, ascending (same order the seed picks have always indexed)
+        const TArray<int32>* PlateVertsPtr = InOutMembership.Find(Event.PlateId);
+        if (!PlateVertsPtr || PlateVertsPtr->Num() < Event.FragmentCount)
         {
             return false;
         }
+        // The parent's list is replaced by fragment 0 below, so take it over rather than copying it.
+        const TArray<int32> PlateVerts = MoveTemp(*InOutMembership.VerticesByPlate.Find(Event.PlateId));
+        const int32 Pn = PlateVerts.Num();
+        const int32 FragmentCount = Event.FragmentCount;
 
         // Seed fragment centroids deterministically from plate vertex set
         FRandomStream Rng(Event.Seed);
-        TArray<int32> SeedIdx;
-        SeedIdx.SetNum(Event.FragmentCount);
-        const int32 Pn = PlateVerts.Num();
-        for (int32 k = 0; k < Event.FragmentCount; ++k)
+        TArray<FVector3d> SeedPoints;
+        SeedPoints.SetNum(FragmentCount);
+        for (int32 k = 0; k < FragmentCount; ++k)
         {
-            const int32 pick = (Pn > 0) ? PlateVerts[Rng.RandRange(0, Pn - 1)] : 0;
-            SeedIdx[k] = pick;
+            SeedPoints[k] = Points[PlateVerts[Rng.RandRange(0, Pn - 1)]];
         }
 
-        // Assign by nearest seed (geodesic)
-        TArray<int32> FragIdPerVertex;
-        FragIdPerVertex.Init(-1, N);
-        for (int32 idx : PlateVerts)
+        // Assign by nearest seed (geodesic: largest clamped dot, first seed wins ties) and accumulate fragment sums in
+        // the same pass. Chunks are fixed-size and reduced in chunk order, so the result does not depend on threading.
+        constexpr int32 ChunkSize = 4096;
+        const int32 ChunkCount = FMath::DivideAndRoundUp(Pn, ChunkSize);
+        TArray<int32> FragIdPerMember;
+        FragIdPerMember.SetNumUninitialized(Pn);
+        TArray<FVector3d> ChunkSums;
+        ChunkSums.Init(FVector3d::ZeroVector, ChunkCount * FragmentCount);
+        TArray<int32> ChunkCounts;
+        ChunkCounts.Init(0, ChunkCount * FragmentCount);
+
+        ParallelFor(ChunkCount, [&](int32 ChunkIdx)
         {
-            const FVector3d& P = Points[idx];
-            int32 best = 0; double bestAngle = TNumericLimits<double>::Max();
-            for (int32 k = 0; k < Event.FragmentCount; ++k)
+            FVector3d* Sums = ChunkSums.GetData() + ChunkIdx * FragmentCount;
+            int32* Counts = ChunkCounts.GetData() + ChunkIdx * FragmentCount;
+            const int32 Begin = ChunkIdx * ChunkSize;
+            const int32 End = FMath::Min(Begin + ChunkSize, Pn);
+            for (int32 m = Begin; m < End; ++m)
             {
-                const FVector3d& S = Points[SeedIdx[k]];
-                const double dot = FMath::Clamp(P.Dot(S), -1.0, 1.0);
-                const double ang = FMath::Acos(dot);
-                if (ang < bestAngle) { bestAngle = ang; best = k; }
+                const FVector3d& P = Points[PlateVerts[m]];
+                int32 best = 0; double bestDot = -TNumericLimits<double>::Max();
+                for (int32 k = 0; k < FragmentCount; ++k)
+                {
+                    const double dot = FMath::Clamp(P.Dot(SeedPoints[k]), -1.0, 1.0);
+                    if (dot > bestDot) { bestDot = dot; best = k; }
+                }
+                FragIdPerMember[m] = best;
+                Sums[best] += P;
+                ++Counts[best];
             }
-            FragIdPerVertex[idx] = best;
-        }
+        }, ChunkCount <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
         // Assign new plate ids for fragments [1..n-1]; keep fragment 0 as original plate id
-        int32 maxPlateId = -1;
-        for (int32 v = 0; v < N; ++v)
-        {
-            maxPlateId = FMath::Max(maxPlateId, PlateIdPerVertexIn.IsValidIndex(v) ? PlateIdPerVertexIn[v] : -1);
-        }
+        int32 maxPlateId = InOutMembership.MaxPlateId;
         TArray<int32> NewPlateIdForFrag;
-        NewPlateIdForFrag.SetNum(Event.FragmentCount);
+        NewPlateIdForFrag.SetNum(FragmentCount);
         NewPlateIdForFrag[0] = Event.PlateId;
-        for (int32 k = 1; k < Event.FragmentCount; ++k)
+        for (int32 k = 1; k < FragmentCount; ++k)
         {
             NewPlateIdForFrag[k] = ++maxPlateId;
         }
 
-        for (int32 idx : PlateVerts)
+        // Rewrite assignments and split the plate's membership list (member order stays ascending per fragment)
+        TArray<TArray<int32>> FragmentVerts;
+        FragmentVerts.SetNum(FragmentCount);
+        for (int32 k = 0; k < FragmentCount; ++k)
         {
-            const int32 f = FragIdPerVertex[idx];
-            if (f >= 0)
+            int32 Count = 0;
+            for (int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ++ChunkIdx)
             {
-                PlateIdPerVertexOut[idx] = NewPlateIdForFrag[f];
+                Count += ChunkCounts[ChunkIdx * FragmentCount + k];
             }
+            FragmentVerts[k].Reserve(Count);
         }
+        for (int32 m = 0; m < Pn; ++m)
+        {
+            const int32 idx = PlateVerts[m];
+            const int32 f = FragIdPerMember[m];
+            InOutPlateIdPerVertex[idx] = NewPlateIdForFrag[f];
+            FragmentVerts[f].Add(idx);
+        }
+        for (int32 k = 0; k < FragmentCount; ++k)
+        {
+            InOutMembership.VerticesByPlate.Add(NewPlateIdForFrag[k], MoveTemp(FragmentVerts[k]));
+        }
+        InOutMembership.MaxPlateId = FMath::Max(InOutMembership.MaxPlateId, maxPlateId);
 
         // Propagate continental ratio to fragments via mapping (service will apply to metadata)
         if (OutFragmentPlateRatiosOrNull)
         {
             OutFragmentPlateRatiosOrNull->Reset();
-            OutFragmentPlateRatiosOrNull->Reserve(Event.FragmentCount);
-            for (int32 k = 0; k < Event.FragmentCount; ++k)
+            OutFragmentPlateRatiosOrNull->Reserve(FragmentCount);
+            for (int32 k = 0; k < FragmentCount; ++k)
             {
                 OutFragmentPlateRatiosOrNull->Add(TPair<int32,double>(NewPlateIdForFrag[k], Event.ContinentalRatio));
             }
         }
 
         // Compute simple drift directions per fragment (unit tangent at fragment centroid)
-        OutFragmentDriftDirections.SetNum(Event.FragmentCount);
-        for (int32 k = 0; k < Event.FragmentCount; ++k)
+        OutFragmentDriftDirections.SetNum(FragmentCount);
+        OutFragmentCentroids.SetNum(FragmentCount);
+        for (int32 k = 0; k < FragmentCount; ++k)
         {
             FVector3d Sum = FVector3d::ZeroVector; int32 Count = 0;
-            for (int32 idx : PlateVerts) { if (FragIdPerVertex[idx] == k) { Sum += Points[idx]; ++Count; } }
-            FVector3d Centroid = (Count > 0) ? (Sum / (double)Count).GetSafeNormal() : Points[SeedIdx[k]].GetSafeNormal();
+            for (int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ++ChunkIdx)
+            {
+                Sum += ChunkSums[ChunkIdx * FragmentCount + k];
+                Count += ChunkCounts[ChunkIdx * FragmentCount + k];
+            }
+            OutFragmentCentroids[k] = (Count > 0) ? (Sum / (double)Count).GetSafeNormal() : FVector3d::ZeroVector;
+            FVector3d Centroid = (Count > 0) ? OutFragmentCentroids[k] : SeedPoints[k].GetSafeNormal();
             FVector3d T = AnyTangent(Centroid);
             // Small deterministic rotation from RNG for variety
             const double ang = (Rng.GetFraction() * 2.0 - 1.0) * 0.25 * PI; // ±45°
@@ -181,11 +218,31 @@ namespace Rifting
 
         // Metrics
         InOutMetrics.RiftingCount += 1;
-        InOutMetrics.MeanFragments = ((InOutMetrics.MeanFragments * (InOutMetrics.RiftingCount - 1)) + Event.FragmentCount) / (double)InOutMetrics.RiftingCount;
+        InOutMetrics.MeanFragments = ((InOutMetrics.MeanFragments * (InOutMetrics.RiftingCount - 1)) + FragmentCount) / (double)InOutMetrics.RiftingCount;
         InOutMetrics.ApplyMs += (FPlatformTime::Seconds() - t0) * 1000.0;
         return true;
     }
 
+    bool PerformRifting(
+        const FRiftingEvent& Event,
+        const TArray<FVector3d>& Points,
+        const TArray<int32>& CSR_Offsets,
+        const TArray<int32>& CSR_Adj,
+        const TArray<int32>& PlateIdPerVertexIn,
+        TArray<int32>& PlateIdPerVertexOut,
+        TArray<FVector3d>& OutFragmentDriftDirections,
+        FRiftingMetrics& InOutMetrics,
+        TArray<TPair<int32,double>>* OutFragmentPlateRatiosOrNull)
+    {
+        FPlateVertexMembership Membership;
+        Membership.Build(PlateIdPerVertexIn);
+
+        PlateIdPerVertexOut = PlateIdPerVertexIn;
+        TArray<FVector3d> FragmentCentroids;
+        return PerformRifting(Event, Points, Membership, PlateIdPerVertexOut, OutFragmentDriftDirections, FragmentCentroids,
+            InOutMetrics, OutFragmentPlateRatiosOrNull);
+    }
+
     FString WritePhase4MetricsJsonAppendRifting(
         const FString& ExistingPhase4JsonPath,
         const FRiftingMetrics& Metrics)
@@ -0,0 +1,273 @@
+#include "Simulation/StaticLODData.h"
+
+#include "Utilities/PlanetaryCreationLogging.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/Archive.h"
+
+namespace
+{
+    constexpr uint32 StaticLODCacheMagic = 0x444F4C53; // 'SLOD'
+    constexpr uint32 StaticLODCacheVersion = 1;
+
+    /** Base vertices an in-order match may skip (vertices removed by compaction). */
+    constexpr int32 InOrderScanWindow = 1024;
+
+    /** Unmatched vertices tolerated before the set is treated as reordered and matched through a hash lookup. */
+    constexpr int32 MaxInOrderMisses = 256;
+
+    void EvaluateStaticVertex(const FVector3d& Vertex, const FVector3f* SoANormal,
+        FVector3f& OutUnitNormal, FVector2f& OutUV, FVector3f& OutTangent)
+    {
+        FVector3f UnitNormal = SoANormal ? *SoANormal : FVector3f(Vertex.GetSafeNormal());
+        if (UnitNormal.IsNearlyZero())
+        {
+            const FVector3f SafeNormal = FVector3f(Vertex.GetSafeNormal());
+            UnitNormal = SafeNormal.IsNearlyZero() ? FVector3f::ZAxisVector : SafeNormal;
+        }
+        OutUnitNormal = UnitNormal;
+
+        const double UAngle = FMath::Atan2(static_cast<double>(UnitNormal.Y), static_cast<double>(UnitNormal.X));
+        const double VAngle = FMath::Asin(FMath::Clamp(static_cast<double>(UnitNormal.Z), -1.0, 1.0));
+        const float U = 0.5f + static_cast<float>(UAngle / (2.0 * PI));
+        const float V = 0.5f - static_cast<float>(VAngle / PI);
+        OutUV = FVector2f(U, V);
+
+        const FVector3f UpVector = (FMath::Abs(UnitNormal.Z) > 0.99f) ? FVector3f(1.0f, 0.0f, 0.0f) : FVector3f(0.0f, 0.0f, 1.0f);
+        FVector3f Tangent = FVector3f::CrossProduct(UnitNormal, UpVector).GetSafeNormal();
+        if (Tangent.IsNearlyZero())
+        {
+            Tangent = FVector3f(1.0f, 0.0f, 0.0f);
+        }
+        OutTangent = Tangent;
+    }
+}
+
+void FStaticLODVertexData::HashVertexSet(const TArray<FVector3d>& RenderVertices, TArray<uint64>& OutVertexHashes, uint64& OutVertexSetHash)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(StaticLODData_HashVertexSet);
+
+    const int32 VertexCount = RenderVertices.Num();
+    OutVertexHashes.SetNumUninitialized(VertexCount);
+    ParallelFor(VertexCount, [&](int32 Index)
+    {
+        OutVertexHashes[Index] = CityHash64(reinterpret_cast<const char*>(&RenderVertices[Index]), sizeof(FVector3d));
+    }, VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    OutVertexSetHash = CityHash64WithSeed(reinterpret_cast<const char*>(OutVertexHashes.GetData()),
+        OutVertexHashes.Num() * sizeof(uint64), static_cast<uint64>(VertexCount));
+}
+
+int32 FStaticLODVertexData::GetIcosphereVertexCount(int32 LODLevel)
+{
+    return LODLevel >= 0 && LODLevel <= 12 ? 10 * (1 << (2 * LODLevel)) + 2 : INDEX_NONE;
+}
+
+int32 FStaticLODVertexData::Build(const TArray<FVector3d>& RenderVertices, TArray<uint64>&& InVertexHashes, uint64 InVertexSetHash,
+    const FStaticLODVertexData* Base,
+    const TArray<float>* SoANormalX, const TArray<float>* SoANormalY, const TArray<float>* SoANormalZ)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(StaticLODData_Build);
+
+    const int32 VertexCount = RenderVertices.Num();
+    check(InVertexHashes.Num() == VertexCount);
+
+    VertexHashes = MoveTemp(InVertexHashes);
+    VertexSetHash = InVertexSetHash;
+    UnitNormals.SetNumUninitialized(VertexCount);
+    UVs.SetNumUninitialized(VertexCount);
+    TangentX.SetNumUninitialized(VertexCount);
+
+    const bool bUseSoANormals = SoANormalX && SoANormalY && SoANormalZ &&
+        SoANormalX->Num() == VertexCount && SoANormalY->Num() == VertexCount && SoANormalZ->Num() == VertexCount;
+
+    // Match against the base set. Compaction keeps surviving vertices in order and appends go to the tail, so a
+    // windowed in-order scan finds almost everything; a reordered set falls back to a hash lookup.
+    TArray<int32> ToEvaluate;
+    int32 Reused = 0;
+    const bool bPatchFromBase = Base && Base->Num() > 0 && Base->VertexHashes.Num() == Base->Num();
+    if (bPatchFromBase)
+    {
+        const TArray<uint64>& BaseHashes = Base->VertexHashes;
+        const int32 BaseCount = BaseHashes.Num();
+        int32 BaseCursor = 0;
+        int32 InOrderMisses = 0;
+        TMap<uint64, int32> BaseLookup;
+        bool bUseLookup = false;
+
+        auto CopyFromBase = [&](int32 Index, int32 BaseIndex)
+        {
+            UnitNormals[Index] = Base->UnitNormals[BaseIndex];
+            UVs[Index] = Base->UVs[BaseIndex];
+            TangentX[Index] = Base->TangentX[BaseIndex];
+            ++Reused;
+        };
+
+        for (int32 Index = 0; Index < VertexCount; ++Index)
+        {
+            const uint64 Hash = VertexHashes[Index];
+            int32 Match = INDEX_NONE;
+
+            if (!bUseLookup)
+            {
+                const int32 ScanEnd = FMath::Min(BaseCursor + InOrderScanWindow, BaseCount);
+                int32 Scan = BaseCursor;
+                while (Scan < ScanEnd && BaseHashes[Scan] != Hash)
+                {
+                    ++Scan;
+                }
+
+                if (Scan < ScanEnd)
+                {
+                    Match = Scan;
+                    BaseCursor = Scan + 1;
+                }
+                else if (++InOrderMisses > MaxInOrderMisses)
+                {
+                    bUseLookup = true;
+                    BaseLookup.Reserve(BaseCount);
+                    for (int32 BaseIndex = 0; BaseIndex < BaseCount; ++BaseIndex)
+                    {
+                        BaseLookup.Add(BaseHashes[BaseIndex], BaseIndex);
+                    }
+
+                    // Earlier misses may just have been out of order.
+                    TArray<int32> StillMissing;
+                    for (const int32 MissedIndex : ToEvaluate)
+                    {
+                        if (const int32* Found = BaseLookup.Find(VertexHashes[MissedIndex]))
+                        {
+                            CopyFromBase(MissedIndex, *Found);
+                        }
+                        else
+                        {
+                            StillMissing.Add(MissedIndex);
+                        }
+                    }
+                    ToEvaluate = MoveTemp(StillMissing);
+                }
+            }
+
+            if (Match == INDEX_NONE && bUseLookup)
+            {
+                if (const int32* Found = BaseLookup.Find(Hash))
+                {
+                    Match = *Found;
+                }
+            }
+
+            if (Match != INDEX_NONE)
+            {
+                CopyFromBase(Index, Match);
+            }
+            else
+            {
+                ToEvaluate.Add(Index);
+            }
+        }
+    }
+
+    const int32 EvaluateCount = bPatchFromBase ? ToEvaluate.Num() : VertexCount;
+    ParallelFor(EvaluateCount, [&](int32 Item)
+    {
+        const int32 Index = bPatchFromBase ? ToEvaluate[Item] : Item;
+        FVector3f SoANormal;
+        if (bUseSoANormals)
+        {
+            SoANormal = FVector3f((*SoANormalX)[Index], (*SoANormalY)[Index], (*SoANormalZ)[Index]);
+        }
+        EvaluateStaticVertex(RenderVertices[Index], bUseSoANormals ? &SoANormal : nullptr,
+            UnitNormals[Index], UVs[Index], TangentX[Index]);
+    }, EvaluateCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    return Reused;
+}
+
+FString FStaticLODVertexData::GetDiskCachePath(int32 LODLevel, uint64 InVertexSetHash)
+{
+    return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PlanetaryCreation"), TEXT("StaticLODCache"),
+        FString::Printf(TEXT("L%d_%016llx.bin"), LODLevel, InVertexSetHash)));
+}
+
+bool FStaticLODVertexData::LoadFromDisk(int32 LODLevel, uint64 ExpectedVertexSetHash, int32 ExpectedVertexCount)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(StaticLODData_LoadFromDisk);
+
+    const FString CachePath = GetDiskCachePath(LODLevel, ExpectedVertexSetHash);
+    if (!FPaths::FileExists(CachePath))
+    {
+        return false;
+    }
+
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*CachePath));
+    if (!Reader)
+    {
+        return false;
+    }
+
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int32 FileLODLevel = INDEX_NONE;
+    int32 FileVertexCount = 0;
+    uint64 FileVertexSetHash = 0;
+    *Reader << Magic << Version << FileLODLevel << FileVertexCount << FileVertexSetHash;
+
+    if (Magic != StaticLODCacheMagic || Version != StaticLODCacheVersion || FileLODLevel != LODLevel ||
+        FileVertexCount != ExpectedVertexCount || FileVertexSetHash != ExpectedVertexSetHash)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[StaticLOD] Ignoring stale disk cache %s"), *CachePath);
+        return false;
+    }
+
+    TArray<FVector3f> LoadedNormals;
+    TArray<FVector2f> LoadedUVs;
+    TArray<FVector3f> LoadedTangents;
+    *Reader << LoadedNormals << LoadedUVs << LoadedTangents;
+
+    if (Reader->IsError() || LoadedNormals.Num() != ExpectedVertexCount || LoadedUVs.Num() != ExpectedVertexCount ||
+        LoadedTangents.Num() != ExpectedVertexCount)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[StaticLOD] Failed to read disk cache %s"), *CachePath);
+        return false;
+    }
+
+    UnitNormals = MoveTemp(LoadedNormals);
+    UVs = MoveTemp(LoadedUVs);
+    TangentX = MoveTemp(LoadedTangents);
+    VertexSetHash = ExpectedVertexSetHash;
+    return true;
+}
+
+bool FStaticLODVertexData::SaveToDisk(int32 LODLevel) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(StaticLODData_SaveToDisk);
+
+    const FString CachePath = GetDiskCachePath(LODLevel, VertexSetHash);
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(CachePath), true);
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*CachePath));
+    if (!Writer)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[StaticLOD] Failed to open disk cache for writing: %s"), *CachePath);
+        return false;
+    }
+
+    uint32 Magic = StaticLODCacheMagic;
+    uint32 Version = StaticLODCacheVersion;
+    int32 FileLODLevel = LODLevel;
+    int32 FileVertexCount = Num();
+    uint64 FileVertexSetHash = VertexSetHash;
+    *Writer << Magic << Version << FileLODLevel << FileVertexCount << FileVertexSetHash;
+    *Writer << const_cast<TArray<FVector3f>&>(UnitNormals) << const_cast<TArray<FVector2f>&>(UVs) << const_cast<TArray<FVector3f>&>(TangentX);
+
+    const bool bOk = Writer->Close();
+    if (!bOk)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[StaticLOD] Failed to write disk cache %s"), *CachePath);
+    }
+    return bOk;
+}
@@ -123,9 +123,18 @@ bool FTectonicPlaybackController::TickPlayback(float DeltaTime)
 	// Calculate step interval
 	float StepInterval = 1.0f / StepsPerSecond;
 
+	const TSharedPtr<FTectonicSimulationController> Controller = SimulationController.Pin();
+
 	// Execute steps based on accumulated time
 	while (AccumulatedTime >= StepInterval)
 	{
+		// Worker mode: keep one batch in flight and one queued; meshing of step N overlaps simulation of N+1.
+		if (Controller.IsValid() && Controller->HasPendingSimulationSteps())
+		{
+			AccumulatedTime = FMath::Min(AccumulatedTime, StepInterval);
+			break;
+		}
+
 		ExecuteStep();
 		AccumulatedTime -= StepInterval;
 	}
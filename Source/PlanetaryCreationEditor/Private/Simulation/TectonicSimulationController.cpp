@@ -28,6 +28,7 @@
 #include "Materials/MaterialExpressionVertexNormalWS.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Simulation/TectonicSimulationService.h"
+#include "Simulation/TectonicSimulationWorker.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Components/LineBatchComponent.h"
 #include "Math/Quat.h"
@@ -35,6 +36,7 @@
 #include "Editor/UnrealEdEngine.h"
 #include "EditorViewportClient.h"
 #include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
 #include "Export/HeightmapColorPalette.h"
 #include "Engine/Texture2D.h"
 #include "HAL/IConsoleManager.h"
@@ -124,6 +126,36 @@ static TAutoConsoleVariable<int32> CVarPlanetaryCreationUsePBRShading(
     TEXT("Enable PBR shading for the tectonic preview mesh (0 = flat shading [default], 1 = PBR)."),
     FConsoleVariableDelegate::CreateStatic(&HandleUsePBRShadingChanged));
 
+static TAutoConsoleVariable<int32> CVarPlanetaryCreationSimulationWorker(
+    TEXT("r.PlanetaryCreation.SimulationWorker"),
+    0,
+    TEXT("Run simulation steps on a background worker thread and mesh published frames (0 = game thread [default], 1 = worker).\n")
+    TEXT("Ignored while GPU amplification or GPU preview is active."));
+
+static TAutoConsoleVariable<int32> CVarPlanetaryCreationLODCacheCompaction(
+    TEXT("r.PlanetaryCreation.LODCacheCompaction"),
+    2,
+    TEXT("Storage for LOD cache entries that are not on screen (0 = float streams, 1 = quantized, 2 = quantized + MeshOptimizer codec [default])."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPlanetaryCreationLODCacheBudgetMB(
+    TEXT("r.PlanetaryCreation.LODCacheBudgetMB"),
+    256.0f,
+    TEXT("Memory budget for cached LOD meshes in MB (streams + snapshots). Least recently used entries outside the active LOD and its neighbors are evicted first (0 = unlimited)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPlanetaryCreationStaticLODDiskCache(
+    TEXT("r.PlanetaryCreation.StaticLODDiskCache"),
+    1,
+    TEXT("Persist static LOD data (normals/UVs/tangents) of pure icosphere render levels under Saved/PlanetaryCreation/StaticLODCache (0 = off)."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPlanetaryCreationOptimizePreviewIndices(
+    TEXT("r.PlanetaryCreation.OptimizePreviewIndices"),
+    1,
+    TEXT("Reorder preview mesh triangles and vertices for the post-transform cache and vertex fetch (MeshOptimizer); the layout is cached per LOD and topology version."),
+    ECVF_Default);
+
 namespace
 {
     static FLinearColor SampleAmplificationGradient(double Normalized)
@@ -331,6 +363,7 @@ void FTectonicSimulationController::Initialize()
 void FTectonicSimulationController::Shutdown()
 {
     bShutdownRequested.store(true, std::memory_order_relaxed);
+    ShutdownSimulationWorker();
 
     const double WaitStart = FPlatformTime::Seconds();
     while (ActiveAsyncTasks.load(std::memory_order_relaxed) > 0)
@@ -372,6 +405,18 @@ void FTectonicSimulationController::Shutdown()
 
 void FTectonicSimulationController::StepSimulation(int32 Steps)
 {
+    if (EnsureSimulationWorker())
+    {
+        // LOD changes touch service state; defer them to the worker tick while a batch is in flight.
+        if (!SimulationWorker->IsBusy())
+        {
+            UpdateLOD();
+        }
+
+        SimulationWorker->RequestSteps(Steps, CurrentElevationMode);
+        return;
+    }
+
     if (UTectonicSimulationService* Service = GetService())
     {
         // Milestone 4 Phase 4.1: Update LOD before stepping (camera may have moved)
@@ -388,6 +433,13 @@ void FTectonicSimulationController::StepSimulation(int32 Steps)
 
 void FTectonicSimulationController::RebuildPreview()
 {
+    // The preview is rebuilt from live service state, so let any queued worker steps land first.
+    if (SimulationWorker.IsValid())
+    {
+        SimulationWorker->WaitUntilIdle();
+        PendingSimulationFrame.Reset();
+    }
+
     // Milestone 4 Phase 4.1: Update LOD before rebuilding
     UpdateLOD();
 
@@ -396,7 +448,7 @@ void FTectonicSimulationController::RebuildPreview()
 
 bool FTectonicSimulationController::RefreshPreviewColors()
 {
-    if (bAsyncMeshBuildInProgress.load(std::memory_order_relaxed))
+    if (bAsyncMeshBuildInProgress.load(std::memory_order_relaxed) || IsSimulationWorkerBusy())
     {
         return false;
     }
@@ -448,37 +500,42 @@ bool FTectonicSimulationController::RefreshPreviewColors()
     return true;
 }
 
+void FTectonicSimulationController::CaptureMeshBuildSnapshot(const UTectonicSimulationService& Service, FMeshBuildSnapshot& Snapshot)
+{
+    // Deep-copy render state from service (thread-safe snapshot)
+    Snapshot.RenderVertices = Service.GetRenderVertices();
+    Snapshot.RenderTriangles = Service.GetRenderTriangles();
+    Snapshot.VertexPlateAssignments = Service.GetVertexPlateAssignments();
+    Snapshot.VertexVelocities = Service.GetVertexVelocities();
+    Snapshot.VertexStressValues = Service.GetVertexStressValues();
+    Snapshot.VertexElevationValues = Service.GetVertexElevationValues(); // M5 Phase 3.7: Use actual elevations from erosion
+    Snapshot.VertexAmplifiedElevation = Service.GetVertexAmplifiedElevation(); // M6 Task 2.1: Stage B amplified elevation
+    const FTectonicSimulationParameters Parameters = Service.GetParameters();
+    const bool bStageBReady = Service.IsStageBAmplificationReady();
+    const EStageBAmplificationReadyReason ReadyReason = Service.GetStageBAmplificationNotReadyReason();
+    const bool bAmplificationEnabled =
+        (Parameters.bEnableOceanicAmplification || Parameters.bEnableContinentalAmplification) &&
+        Parameters.RenderSubdivisionLevel >= Parameters.MinAmplificationLOD;
+
+    LogStageBPreviewFallback(bStageBReady, bAmplificationEnabled, ReadyReason);
+    Snapshot.ElevationScale = Parameters.ElevationScale;
+    Snapshot.PlanetRadius = Parameters.PlanetRadius; // M5 Phase 3: For unit conversion
+
+    // M6 Task 2.3: Enable amplified elevation if EITHER oceanic OR continental amplification is active
+    Snapshot.bUseAmplifiedElevation = bStageBReady && bAmplificationEnabled;
+    Snapshot.Parameters = Parameters; // M6 Task 2.3: For heightmap visualization mode
+    Snapshot.VisualizationMode = Parameters.VisualizationMode;
+    Snapshot.bHighlightSeaLevel = Service.IsHighlightSeaLevelEnabled();
+    Snapshot.StageBProfile = Service.GetLatestStageBProfile();
+}
+
 FMeshBuildSnapshot FTectonicSimulationController::CreateMeshBuildSnapshot() const
 {
     FMeshBuildSnapshot Snapshot;
 
-    if (UTectonicSimulationService* Service = GetService())
+    if (const UTectonicSimulationService* Service = GetService())
     {
-        // Deep-copy render state from service (thread-safe snapshot)
-        Snapshot.RenderVertices = Service->GetRenderVertices();
-        Snapshot.RenderTriangles = Service->GetRenderTriangles();
-        Snapshot.VertexPlateAssignments = Service->GetVertexPlateAssignments();
-        Snapshot.VertexVelocities = Service->GetVertexVelocities();
-        Snapshot.VertexStressValues = Service->GetVertexStressValues();
-        Snapshot.VertexElevationValues = Service->GetVertexElevationValues(); // M5 Phase 3.7: Use actual elevations from erosion
-        Snapshot.VertexAmplifiedElevation = Service->GetVertexAmplifiedElevation(); // M6 Task 2.1: Stage B amplified elevation
-        const FTectonicSimulationParameters Parameters = Service->GetParameters();
-        const bool bStageBReady = Service->IsStageBAmplificationReady();
-        const EStageBAmplificationReadyReason ReadyReason = Service->GetStageBAmplificationNotReadyReason();
-        const bool bAmplificationEnabled =
-            (Parameters.bEnableOceanicAmplification || Parameters.bEnableContinentalAmplification) &&
-            Parameters.RenderSubdivisionLevel >= Parameters.MinAmplificationLOD;
-
-        LogStageBPreviewFallback(bStageBReady, bAmplificationEnabled, ReadyReason);
-        Snapshot.ElevationScale = Parameters.ElevationScale;
-        Snapshot.PlanetRadius = Parameters.PlanetRadius; // M5 Phase 3: For unit conversion
-
-        // M6 Task 2.3: Enable amplified elevation if EITHER oceanic OR continental amplification is active
-        Snapshot.bUseAmplifiedElevation = bStageBReady && bAmplificationEnabled;
-        Snapshot.Parameters = Parameters; // M6 Task 2.3: For heightmap visualization mode
-        Snapshot.VisualizationMode = Parameters.VisualizationMode;
-        Snapshot.bHighlightSeaLevel = Service->IsHighlightSeaLevelEnabled();
-        Snapshot.StageBProfile = Service->GetLatestStageBProfile();
+        CaptureMeshBuildSnapshot(*Service, Snapshot);
     }
 
     // Capture visualization state from controller
@@ -510,6 +567,7 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
 
     if (CachedMesh)
     {
+        ++LODCacheHits;
         UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Using cached L%d: %d verts, %d tris (cache hit)"),
             RenderLevel, CachedMesh->VertexCount, CachedMesh->TriangleCount);
 
@@ -544,6 +602,7 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
     {
         if (TryFastSurfaceRefresh(*MutableCachedMesh, *Service, CurrentSurfaceVersion))
         {
+            ++LODCacheHits;
             UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Fast surface refresh applied to L%d (Surface %d)"),
                 RenderLevel, CurrentSurfaceVersion);
             PreWarmNeighboringLODs();
@@ -553,6 +612,7 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
         FMeshBuildSnapshot Snapshot = CreateMeshBuildSnapshot();
         if (UpdateCachedMeshFromSnapshot(*MutableCachedMesh, Snapshot, CurrentSurfaceVersion))
         {
+            ++LODCacheHits;
             UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Updated cached L%d from snapshot (Surface %d)"), RenderLevel, CurrentSurfaceVersion);
             if (!TryUpdatePreviewMeshInPlace(*MutableCachedMesh))
             {
@@ -585,9 +645,15 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
         return;
     }
 
+    ++LODCacheMisses;
     UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] L%d not cached, building... (Topo:%d, Surface:%d)"),
         RenderLevel, CurrentTopologyVersion, CurrentSurfaceVersion);
 
+    DispatchMeshBuild(RenderLevel, CurrentTopologyVersion, CurrentSurfaceVersion, CreateMeshBuildSnapshot());
+}
+
+void FTectonicSimulationController::DispatchMeshBuild(int32 RenderLevel, int32 CurrentTopologyVersion, int32 CurrentSurfaceVersion, FMeshBuildSnapshot&& Snapshot)
+{
     // Milestone 3 Task 4.3: Threshold check - async only for level 3+ (1280+ triangles)
     // Level 0-2 use synchronous path (fast enough, not worth threading overhead)
     if (RenderLevel <= 2)
@@ -596,7 +662,6 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
         const uint32 ThreadID = FPlatformTLS::GetCurrentThreadId();
         const double StartTime = FPlatformTime::Seconds();
 
-        FMeshBuildSnapshot Snapshot = CreateMeshBuildSnapshot();
         RealtimeMesh::FRealtimeMeshStreamSet StreamSet;
         int32 VertexCount = 0;
         int32 TriangleCount = 0;
@@ -646,12 +711,10 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
         bAsyncMeshBuildInProgress.store(true);
         const double StartTime = FPlatformTime::Seconds();
 
-        // Create snapshot on game thread (captures current simulation state)
-        FMeshBuildSnapshot Snapshot = CreateMeshBuildSnapshot();
         ActiveAsyncTasks.fetch_add(1, std::memory_order_relaxed);
 
         // Kick off async mesh build on background thread
-        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Snapshot, StartTime, CurrentTopologyVersion, CurrentSurfaceVersion, RenderLevel]() mutable
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Snapshot = MoveTemp(Snapshot), StartTime, CurrentTopologyVersion, CurrentSurfaceVersion, RenderLevel]() mutable
         {
             // Register thread for Unreal Insights profiling
             TRACE_CPUPROFILER_EVENT_SCOPE(TectonicMeshBuildAsync);
@@ -697,7 +760,7 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
                 TangentX = MoveTemp(TangentX), TangentY = MoveTemp(TangentY), TangentZ = MoveTemp(TangentZ),
                 Colors = MoveTemp(Colors), UVs = MoveTemp(UVs), AmplifiedHeights = MoveTemp(AmplifiedHeights),
                 Indices = MoveTemp(Indices), SourceVertexIndices = MoveTemp(SourceVertexIndices),
-                VertexCount, TriangleCount, BuildTimeMs, BackgroundThreadID, Snapshot, CurrentTopologyVersion, CurrentSurfaceVersion, RenderLevel]() mutable
+                VertexCount, TriangleCount, BuildTimeMs, BackgroundThreadID, Snapshot = MoveTemp(Snapshot), CurrentTopologyVersion, CurrentSurfaceVersion, RenderLevel]() mutable
             {
                 const uint32 GameThreadID = FPlatformTLS::GetCurrentThreadId();
 
@@ -744,6 +807,11 @@ void FTectonicSimulationController::BuildAndUpdateMesh()
 
 double FTectonicSimulationController::GetCurrentTimeMy() const
 {
+    if (IsSimulationWorkerBusy() && LatestSimulationFrame.IsValid())
+    {
+        return LatestSimulationFrame->CurrentTimeMy;
+    }
+
     if (const UTectonicSimulationService* Service = GetService())
     {
         return Service->GetCurrentTimeMy();
@@ -751,34 +819,267 @@ double FTectonicSimulationController::GetCurrentTimeMy() const
     return 0.0;
 }
 
-UTectonicSimulationService* FTectonicSimulationController::GetSimulationService() const
+bool FTectonicSimulationController::IsSimulationWorkerBusy() const
 {
-    return GetService();
+    return SimulationWorker.IsValid() && SimulationWorker->IsBusy();
+}
+
+bool FTectonicSimulationController::HasPendingSimulationSteps() const
+{
+    return SimulationWorker.IsValid() && SimulationWorker->HasPendingSteps();
+}
+
+bool FTectonicSimulationController::ApplySimulationMutation(TUniqueFunction<bool(UTectonicSimulationService&)>&& Mutation, bool bRebuildPreview)
+{
+    UTectonicSimulationService* Service = GetService();
+    if (!Service || !Mutation)
+    {
+        return false;
+    }
+
+    if (IsSimulationWorkerBusy())
+    {
+        // The worker runs the edit between batches; TickSimulationWorker meshes the frame it publishes.
+        SimulationWorker->EnqueueMutation(MoveTemp(Mutation), CurrentElevationMode);
+        return false;
+    }
+
+    bool bChanged = false;
+    {
+        FScopeLock StateLock(&Service->GetSimulationStateLock());
+        bChanged = Mutation(*Service);
+    }
+
+    if (bChanged && bRebuildPreview)
+    {
+        RebuildPreview();
+    }
+    return true;
+}
+
+bool FTectonicSimulationController::GetSimulationUIState(FTectonicSimulationUIState& OutState) const
+{
+    if (IsSimulationWorkerBusy())
+    {
+        if (!LatestSimulationFrame.IsValid())
+        {
+            return false;
+        }
+
+        OutState = LatestSimulationFrame->UIState;
+        return true;
+    }
+
+    if (const UTectonicSimulationService* Service = GetService())
+    {
+        OutState.Capture(*Service);
+        return true;
+    }
+    return false;
+}
+
+bool FTectonicSimulationController::EnsureSimulationWorker()
+{
+    if (CVarPlanetaryCreationSimulationWorker.GetValueOnGameThread() == 0)
+    {
+        if (SimulationWorker.IsValid())
+        {
+            ShutdownSimulationWorker();
+        }
+        return false;
+    }
+
+    UTectonicSimulationService* Service = GetService();
+    if (!Service)
+    {
+        return false;
+    }
+
+    // GPU amplification flushes rendering commands from inside the step, which must happen on the game thread.
+    if (bUseGPUPreviewMode || Service->ShouldUseGPUAmplification())
+    {
+        if (!bLoggedSimulationWorkerFallback)
+        {
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("[SimWorker] GPU amplification/preview active; stepping on the game thread"));
+            bLoggedSimulationWorkerFallback = true;
+        }
+
+        if (SimulationWorker.IsValid())
+        {
+            ShutdownSimulationWorker();
+        }
+        return false;
+    }
+    bLoggedSimulationWorkerFallback = false;
+
+    if (!SimulationWorker.IsValid())
+    {
+        SimulationWorker = MakeUnique<FTectonicSimulationWorker>(*Service);
+        if (!SimulationWorker->Start())
+        {
+            SimulationWorker.Reset();
+            return false;
+        }
+
+        SimulationWorkerTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FTectonicSimulationController::TickSimulationWorker));
+    }
+
+    return true;
 }
 
-uint64 FTectonicSimulationController::MakeLODCacheKey(int32 LODLevel, int32 TopologyVersion) const
+void FTectonicSimulationController::ShutdownSimulationWorker()
 {
-    return (static_cast<uint64>(TopologyVersion) << 32) | static_cast<uint32>(LODLevel);
+    if (SimulationWorkerTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SimulationWorkerTickerHandle);
+        SimulationWorkerTickerHandle.Reset();
+    }
+
+    if (SimulationWorker.IsValid())
+    {
+        SimulationWorker->WaitUntilIdle();
+        SimulationWorker.Reset();
+    }
+
+    LatestSimulationFrame.Reset();
+    PendingSimulationFrame.Reset();
+    bOverlaysDeferred = false;
 }
 
-const FTectonicSimulationController::FStaticLODData& FTectonicSimulationController::GetOrBuildStaticLODData(int32 LODLevel, int32 TopologyVersion, const TArray<FVector3d>& RenderVertices) const
+bool FTectonicSimulationController::TickSimulationWorker(float DeltaTime)
 {
-    const uint64 CacheKey = MakeLODCacheKey(LODLevel, TopologyVersion);
-    TUniquePtr<FStaticLODData>& DataPtr = StaticLODDataCache.FindOrAdd(CacheKey);
+    TRACE_CPUPROFILER_EVENT_SCOPE(TectonicSimulationWorkerTick);
+
+    if (!SimulationWorker.IsValid() || bShutdownRequested.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
 
-    if (!DataPtr.IsValid())
+    // A newer frame supersedes one that has not been meshed yet.
+    FTectonicSimulationFramePtr Frame;
+    if (SimulationWorker->ConsumeLatestFrame(Frame))
     {
-        DataPtr = MakeUnique<FStaticLODData>();
+        LatestSimulationFrame = Frame;
+        PendingSimulationFrame = Frame;
     }
 
-    FStaticLODData& Data = *DataPtr;
-    if (Data.UVs.Num() != RenderVertices.Num())
+    if (PendingSimulationFrame.IsValid() && !bAsyncMeshBuildInProgress.load())
     {
-        const int32 VertexCount = RenderVertices.Num();
-        Data.UnitNormals.SetNum(VertexCount);
-        Data.UVs.SetNum(VertexCount);
-        Data.TangentX.SetNum(VertexCount);
+        if (!SimulationWorker->IsBusy())
+        {
+            // Deferred from StepSimulation; a LOD change rebuilds from live state, which already includes the frame.
+            const int32 PreviousLODLevel = CurrentLODLevel;
+            UpdateLOD();
+            if (CurrentLODLevel != PreviousLODLevel)
+            {
+                PendingSimulationFrame.Reset();
+            }
+        }
 
+        if (PendingSimulationFrame.IsValid())
+        {
+            const FTectonicSimulationFramePtr ApplyFrame = MoveTemp(PendingSimulationFrame);
+            ApplySimulationFrame(*ApplyFrame);
+        }
+    }
+
+    if (bOverlaysDeferred && !SimulationWorker->IsBusy())
+    {
+        bOverlaysDeferred = false;
+        DrawHighResolutionBoundaryOverlay();
+        DrawVelocityVectorField();
+    }
+
+    return true;
+}
+
+void FTectonicSimulationController::ApplySimulationFrame(FTectonicSimulationFrame& Frame)
+{
+    EnsurePreviewActor();
+
+    const int32 RenderLevel = Frame.RenderLevel;
+    FCachedLODMesh* MutableCachedMesh = GetMutableCachedLOD(RenderLevel);
+    const bool bTopologyMatches = MutableCachedMesh && MutableCachedMesh->TopologyVersion == Frame.TopologyVersion;
+
+    if (bTopologyMatches && MutableCachedMesh->SurfaceDataVersion == Frame.SurfaceDataVersion)
+    {
+        RealtimeMesh::FRealtimeMeshStreamSet StreamSet;
+        int32 VertexCount = 0;
+        int32 TriangleCount = 0;
+        BuildMeshFromCache(*MutableCachedMesh, StreamSet, VertexCount, TriangleCount);
+        UpdatePreviewMesh(MoveTemp(StreamSet), VertexCount, TriangleCount);
+        return;
+    }
+
+    if (bTopologyMatches && UpdateCachedMeshFromSnapshot(*MutableCachedMesh, Frame.Snapshot, Frame.SurfaceDataVersion))
+    {
+        UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[SimWorker] Frame %d updated cached L%d (Surface %d)"),
+            Frame.FrameSerial, RenderLevel, Frame.SurfaceDataVersion);
+        if (!TryUpdatePreviewMeshInPlace(*MutableCachedMesh))
+        {
+            ApplyCachedMeshToPreview(*MutableCachedMesh);
+        }
+        return;
+    }
+
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[SimWorker] Frame %d: L%d not cached, building... (Topo:%d, Surface:%d)"),
+        Frame.FrameSerial, RenderLevel, Frame.TopologyVersion, Frame.SurfaceDataVersion);
+    DispatchMeshBuild(RenderLevel, Frame.TopologyVersion, Frame.SurfaceDataVersion, MoveTemp(Frame.Snapshot));
+}
+
+UTectonicSimulationService* FTectonicSimulationController::GetSimulationService() const
+{
+    return GetService();
+}
+
+/** Vertex sets kept per LOD: the current one plus its predecessor (undo / rollback lands back on it). */
+static constexpr int32 MaxStaticVertexSetsPerLOD = 2;
+
+FTectonicSimulationController::FStaticLODDataRef FTectonicSimulationController::GetOrBuildStaticLODData(int32 LODLevel, const TArray<FVector3d>& RenderVertices,
+    bool bReadServiceSoA) const
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(GetOrBuildStaticLODData);
+
+    TArray<uint64> VertexHashes;
+    uint64 VertexSetHash = 0;
+    FStaticLODVertexData::HashVertexSet(RenderVertices, VertexHashes, VertexSetHash);
+    const FStaticLODKey CacheKey(LODLevel, VertexSetHash);
+
+    TSharedPtr<FStaticLODData, ESPMode::ThreadSafe> Base;
+    {
+        FScopeLock CacheLock(&StaticLODDataLock);
+        if (const TSharedPtr<FStaticLODData, ESPMode::ThreadSafe>* Existing = StaticLODDataCache.Find(CacheKey))
+        {
+            (*Existing)->LastUsedTime = FPlatformTime::Seconds();
+            return Existing->ToSharedRef();
+        }
+
+        for (const TPair<FStaticLODKey, TSharedPtr<FStaticLODData, ESPMode::ThreadSafe>>& Entry : StaticLODDataCache)
+        {
+            if (Entry.Key.Key == LODLevel && (!Base.IsValid() || Entry.Value->LastUsedTime > Base->LastUsedTime))
+            {
+                Base = Entry.Value;
+            }
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const int32 VertexCount = RenderVertices.Num();
+    FStaticLODDataRef Data = MakeShared<FStaticLODData, ESPMode::ThreadSafe>();
+
+    const bool bIcosphere = VertexCount == FStaticLODVertexData::GetIcosphereVertexCount(LODLevel);
+    const bool bUseDiskCache = bIcosphere && CVarPlanetaryCreationStaticLODDiskCache.GetValueOnAnyThread() != 0;
+
+    const TCHAR* Source = TEXT("built");
+    int32 Reused = 0;
+    if (bUseDiskCache && Data->LoadFromDisk(LODLevel, VertexSetHash, VertexCount))
+    {
+        Data->VertexHashes = MoveTemp(VertexHashes);
+        Source = TEXT("loaded from disk");
+    }
+    else
+    {
         const TArray<float>* CachedPosX = nullptr;
         const TArray<float>* CachedPosY = nullptr;
         const TArray<float>* CachedPosZ = nullptr;
@@ -789,72 +1090,98 @@ const FTectonicSimulationController::FStaticLODData& FTectonicSimulationControll
         const TArray<float>* CachedTangentYSoA = nullptr;
         const TArray<float>* CachedTangentZSoA = nullptr;
 
-        if (const UTectonicSimulationService* Service = GetService())
+        const UTectonicSimulationService* Service = bReadServiceSoA ? GetService() : nullptr;
+        if (Service)
         {
             Service->GetRenderVertexFloatSoA(CachedPosX, CachedPosY, CachedPosZ,
                 CachedNormalX, CachedNormalY, CachedNormalZ,
                 CachedTangentXSoA, CachedTangentYSoA, CachedTangentZSoA);
         }
 
-        const bool bUseCachedNormals = CachedNormalX && CachedNormalY && CachedNormalZ &&
-            CachedNormalX->Num() == VertexCount &&
-            CachedNormalY->Num() == VertexCount &&
-            CachedNormalZ->Num() == VertexCount;
-        const bool bUseCachedTangents = CachedTangentXSoA && CachedTangentYSoA && CachedTangentZSoA &&
-            CachedTangentXSoA->Num() == VertexCount &&
-            CachedTangentYSoA->Num() == VertexCount &&
-            CachedTangentZSoA->Num() == VertexCount;
+        Reused = Data->Build(RenderVertices, MoveTemp(VertexHashes), VertexSetHash, Base.Get(),
+            CachedNormalX, CachedNormalY, CachedNormalZ);
+        if (Base.IsValid())
+        {
+            Source = TEXT("patched");
+        }
 
-        for (int32 Index = 0; Index < VertexCount; ++Index)
+        if (bUseDiskCache)
         {
-            const FVector3d& Vertex = RenderVertices[Index];
-            FVector3f UnitNormal;
-            if (bUseCachedNormals && CachedNormalX->IsValidIndex(Index) && CachedNormalY->IsValidIndex(Index) && CachedNormalZ->IsValidIndex(Index))
-            {
-                UnitNormal = FVector3f((*CachedNormalX)[Index], (*CachedNormalY)[Index], (*CachedNormalZ)[Index]);
-            }
-            else
-            {
-                UnitNormal = FVector3f(Vertex.GetSafeNormal());
-            }
+            Data->SaveToDisk(LODLevel);
+        }
+    }
 
-            if (UnitNormal.IsNearlyZero())
-            {
-                const FVector3f SafeNormal = FVector3f(Vertex.GetSafeNormal());
-                UnitNormal = SafeNormal.IsNearlyZero() ? FVector3f::ZAxisVector : SafeNormal;
-            }
+    UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[StaticLOD] L%d vertex set %016llx %s: %d verts (%d reused) in %.2f ms"),
+        LODLevel, VertexSetHash, Source, VertexCount, Reused, (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
-            Data.UnitNormals[Index] = UnitNormal;
+    FScopeLock CacheLock(&StaticLODDataLock);
+    if (const TSharedPtr<FStaticLODData, ESPMode::ThreadSafe>* Existing = StaticLODDataCache.Find(CacheKey))
+    {
+        // Another build raced us to the same vertex set.
+        (*Existing)->LastUsedTime = FPlatformTime::Seconds();
+        return Existing->ToSharedRef();
+    }
 
-            const double UAngle = FMath::Atan2(static_cast<double>(UnitNormal.Y), static_cast<double>(UnitNormal.X));
-            const double VAngle = FMath::Asin(FMath::Clamp(static_cast<double>(UnitNormal.Z), -1.0, 1.0));
-            const float U = 0.5f + static_cast<float>(UAngle / (2.0 * PI));
-            const float V = 0.5f - static_cast<float>(VAngle / PI);
-            Data.UVs[Index] = FVector2f(U, V);
+    Data->LastUsedTime = FPlatformTime::Seconds();
+    StaticLODDataCache.Add(CacheKey, Data);
 
-            const FVector3f UpVector = (FMath::Abs(UnitNormal.Z) > 0.99f) ? FVector3f(1.0f, 0.0f, 0.0f) : FVector3f(0.0f, 0.0f, 1.0f);
-            FVector3f Tangent = FVector3f::CrossProduct(UnitNormal, UpVector).GetSafeNormal();
-            if (Tangent.IsNearlyZero())
-            {
-                Tangent = FVector3f(1.0f, 0.0f, 0.0f);
-            }
-            Data.TangentX[Index] = Tangent;
+    // Stale vertex sets of this LOD: keep only the most recently used few. In-flight builds hold their own reference.
+    TArray<TPair<double, FStaticLODKey>, TInlineAllocator<4>> SameLOD;
+    for (const TPair<FStaticLODKey, TSharedPtr<FStaticLODData, ESPMode::ThreadSafe>>& Entry : StaticLODDataCache)
+    {
+        if (Entry.Key.Key == LODLevel)
+        {
+            SameLOD.Emplace(Entry.Value->LastUsedTime, Entry.Key);
+        }
+    }
+
+    if (SameLOD.Num() > MaxStaticVertexSetsPerLOD)
+    {
+        SameLOD.Sort([](const TPair<double, FStaticLODKey>& A, const TPair<double, FStaticLODKey>& B)
+        {
+            return A.Key > B.Key;
+        });
+        for (int32 Index = MaxStaticVertexSetsPerLOD; Index < SameLOD.Num(); ++Index)
+        {
+            StaticLODDataCache.Remove(SameLOD[Index].Value);
         }
     }
 
     return Data;
 }
 
+void FTectonicSimulationController::EvictStaticLODData(int32 LODLevel) const
+{
+    FScopeLock CacheLock(&StaticLODDataLock);
+    for (auto It = StaticLODDataCache.CreateIterator(); It; ++It)
+    {
+        if (It.Key().Key == LODLevel)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
 void FTectonicSimulationController::SetVisualizationMode(ETectonicVisualizationMode Mode)
 {
     if (UTectonicSimulationService* Service = GetService())
     {
-        const ETectonicVisualizationMode CurrentMode = Service->GetVisualizationMode();
-        if (CurrentMode == Mode)
+        if (GetVisualizationMode() == Mode)
         {
             return;
         }
 
+        if (IsSimulationWorkerBusy())
+        {
+            // The mode bumps the surface version, so the frame published for it remeshes with the new colors.
+            ApplySimulationMutation([Mode](UTectonicSimulationService& QueuedService)
+            {
+                QueuedService.SetVisualizationMode(Mode);
+                return true;
+            });
+            return;
+        }
+
         Service->SetVisualizationMode(Mode);
 
         if (!RefreshPreviewColors())
@@ -869,6 +1196,11 @@ void FTectonicSimulationController::SetVisualizationMode(ETectonicVisualizationM
 
 ETectonicVisualizationMode FTectonicSimulationController::GetVisualizationMode() const
 {
+    if (IsSimulationWorkerBusy() && LatestSimulationFrame.IsValid())
+    {
+        return LatestSimulationFrame->UIState.Parameters.VisualizationMode;
+    }
+
     if (const UTectonicSimulationService* Service = GetService())
     {
         return Service->GetVisualizationMode();
@@ -881,6 +1213,14 @@ void FTectonicSimulationController::SetElevationMode(EElevationMode Mode)
     if (CurrentElevationMode != Mode)
     {
         CurrentElevationMode = Mode;
+
+        if (IsSimulationWorkerBusy())
+        {
+            // Republish after the batch in flight; the frame carries the new elevation mode.
+            ApplySimulationMutation([](UTectonicSimulationService&) { return true; });
+            return;
+        }
+
         RebuildPreview(); // Refresh mesh with new elevation mode
     }
 }
@@ -971,6 +1311,12 @@ void FTectonicSimulationController::SetGPUPreviewMode(bool bEnabled)
 {
     if (bUseGPUPreviewMode != bEnabled)
     {
+        // GPU preview steps on the game thread (see EnsureSimulationWorker), so hand the service back before touching it.
+        if (bEnabled && SimulationWorker.IsValid())
+        {
+            ShutdownSimulationWorker();
+        }
+
         bUseGPUPreviewMode = bEnabled;
 
         if (UTectonicSimulationService* Service = GetService())
@@ -1408,6 +1754,8 @@ void FTectonicSimulationController::EnsurePreviewActor() const
 
             PreviewMesh = Mesh;
             bPreviewInitialized = false;
+            bBoundaryOverlayInitialized = false;
+            BoundaryOverlayGeometryHash = 0;
 
             const_cast<FTectonicSimulationController*>(this)->ApplyPreviewMaterialMode();
         }
@@ -1509,16 +1857,19 @@ void FTectonicSimulationController::DrawBoundaryLines()
         }
     };
 
-    auto RotateVertex = [](const FVector3d& Vertex, const FVector3d& Axis, double AngleRadians) -> FVector3d
+    // One rotation per plate, looked up by plate ID (instead of a search and quaternion build per endpoint)
+    TMap<int32, int32> PlateIndexById;
+    PlateIndexById.Reserve(Plates.Num());
+    TArray<UE::Math::TQuat<double>> PlateRotations;
+    PlateRotations.Reserve(Plates.Num());
+    for (int32 PlateIdx = 0; PlateIdx < Plates.Num(); ++PlateIdx)
     {
-        if (Axis.IsNearlyZero())
-        {
-            return Vertex;
-        }
-
-        const UE::Math::TQuat<double> Rotation(Axis.GetSafeNormal(), AngleRadians);
-        return Rotation.RotateVector(Vertex);
-    };
+        const FTectonicPlate& Plate = Plates[PlateIdx];
+        PlateIndexById.Add(Plate.PlateID, PlateIdx);
+        PlateRotations.Add(Plate.EulerPoleAxis.IsNearlyZero()
+            ? UE::Math::TQuat<double>::Identity
+            : UE::Math::TQuat<double>(Plate.EulerPoleAxis.GetSafeNormal(), Plate.AngularVelocity * CurrentTimeMy));
+    }
 
     for (const auto& BoundaryPair : Boundaries)
     {
@@ -1537,25 +1888,27 @@ void FTectonicSimulationController::DrawBoundaryLines()
             continue;
         }
 
-        const FTectonicPlate* PlateA = Plates.FindByPredicate([&Key](const FTectonicPlate& P) { return P.PlateID == Key.Key; });
-        const FTectonicPlate* PlateB = Plates.FindByPredicate([&Key](const FTectonicPlate& P) { return P.PlateID == Key.Value; });
-        if (!PlateA || !PlateB)
+        const int32* PlateAIndex = PlateIndexById.Find(Key.Key);
+        const int32* PlateBIndex = PlateIndexById.Find(Key.Value);
+        if (!PlateAIndex || !PlateBIndex)
         {
             continue;
         }
+        const FTectonicPlate* PlateA = &Plates[*PlateAIndex];
+        const FTectonicPlate* PlateB = &Plates[*PlateBIndex];
 
         // Milestone 3 Task 3.2: Draw boundary as centroid→midpoint→centroid segments
         // (per plan: "Draw line segment from PlateA centroid → midpoint → PlateB centroid")
         const FVector3d& V0Original = SharedVertices[V0Index];
         const FVector3d& V1Original = SharedVertices[V1Index];
 
-        const double RotationAngleA = PlateA->AngularVelocity * CurrentTimeMy;
-        const double RotationAngleB = PlateB->AngularVelocity * CurrentTimeMy;
+        const UE::Math::TQuat<double>& RotationA = PlateRotations[*PlateAIndex];
+        const UE::Math::TQuat<double>& RotationB = PlateRotations[*PlateBIndex];
 
-        const FVector3d V0FromA = RotateVertex(V0Original, PlateA->EulerPoleAxis, RotationAngleA);
-        const FVector3d V1FromA = RotateVertex(V1Original, PlateA->EulerPoleAxis, RotationAngleA);
-        const FVector3d V0FromB = RotateVertex(V0Original, PlateB->EulerPoleAxis, RotationAngleB);
-        const FVector3d V1FromB = RotateVertex(V1Original, PlateB->EulerPoleAxis, RotationAngleB);
+        const FVector3d V0FromA = RotationA.RotateVector(V0Original);
+        const FVector3d V1FromA = RotationA.RotateVector(V1Original);
+        const FVector3d V0FromB = RotationB.RotateVector(V0Original);
+        const FVector3d V1FromB = RotationB.RotateVector(V1Original);
 
         // Average both plate rotations so the overlay sits between them.
         const FVector3d V0Current = ((V0FromA + V0FromB) * 0.5).GetSafeNormal();
@@ -1598,6 +1951,7 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
     TArray<int32>& OutSourceIndices)
 {
     using namespace RealtimeMesh;
+    TRACE_CPUPROFILER_EVENT_SCOPE(TectonicBuildMeshFromSnapshot);
 
     OutVertexCount = 0;
     OutTriangleCount = 0;
@@ -1635,7 +1989,8 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
     Builder.EnableColors();
 
     const float RadiusUE = MetersToUE(Snapshot.PlanetRadius);
-    const FStaticLODData& StaticData = GetOrBuildStaticLODData(LODLevel, TopologyVersion, RenderVertices);
+    const FStaticLODDataRef StaticDataRef = GetOrBuildStaticLODData(LODLevel, RenderVertices, Snapshot.bAllowServiceSoA);
+    FStaticLODData& StaticData = *StaticDataRef;
     const TArray<FVector2f>& CachedUVs = StaticData.UVs;
     const TArray<FVector3f>& CachedTangents = StaticData.TangentX;
     const TArray<FVector3f>& CachedNormals = StaticData.UnitNormals;
@@ -1683,22 +2038,6 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
 
     constexpr double MaxDisplacementMeters = 10000.0;
 
-    struct FPreviewMeshVertex
-    {
-        FVector3f Position = FVector3f::ZeroVector;
-        FVector3f Normal = FVector3f::ZAxisVector;
-        FVector3f TangentX = FVector3f::XAxisVector;
-        FColor Color = FColor::Black;
-        FVector2f UV = FVector2f::ZeroVector;
-        float ElevationMeters = 0.0f;
-        int32 PrimaryIndex = INDEX_NONE;
-        int32 SeamWrappedIndex = INDEX_NONE;
-        int32 SourceIndex = INDEX_NONE;
-    };
-
-    TArray<FPreviewMeshVertex> PreviewVertices;
-    PreviewVertices.SetNum(SourceVertexCount);
-
     const ETectonicVisualizationMode VisualizationMode = Snapshot.VisualizationMode;
     const bool bShowVelocity = VisualizationMode == ETectonicVisualizationMode::Velocity;
     const bool bStressColor = VisualizationMode == ETectonicVisualizationMode::Stress;
@@ -1756,7 +2095,8 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
     const TArray<float>* SoATangentY = nullptr;
     const TArray<float>* SoATangentZ = nullptr;
 
-    if (const UTectonicSimulationService* Service = GetService())
+    const UTectonicSimulationService* Service = Snapshot.bAllowServiceSoA ? GetService() : nullptr;
+    if (Service)
     {
         const TArray<float>* DummyPosX = nullptr;
         const TArray<float>* DummyPosY = nullptr;
@@ -1775,14 +2115,209 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
         SoATangentY->Num() == SourceVertexCount &&
         SoATangentZ->Num() == SourceVertexCount;
 
-    ParallelFor(SourceVertexCount, [&](int32 Index)
+    const double BuildStartTime = FPlatformTime::Seconds();
+    const int32 TriangleCount = RenderTriangles.Num() / 3;
+    const int32 CornerCount = TriangleCount * 3;
+    const EParallelForFlags MeshParallelFlags = SourceVertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+    constexpr float UVSeamWrapThreshold = 0.5f;
+    constexpr float UVSeamSplitReference = 0.5f;
+
+    auto GetSourceUV = [&CachedUVs](int32 Index) -> FVector2f
+    {
+        return CachedUVs.IsValidIndex(Index) ? CachedUVs[Index] : FVector2f::ZeroVector;
+    };
+
+    // Pass 1: seam detection. A vertex gets one seam duplicate, numbered in the order its first seam-crossing corner
+    // appears in the index buffer (matches the previous lazy serial allocation, so cached buffers stay bit-identical).
+    TArray<uint8> TriangleCrossesSeam;
+    TriangleCrossesSeam.SetNumUninitialized(TriangleCount);
+    TArray<int32> FirstSeamCorner;
+    FirstSeamCorner.Init(MAX_int32, SourceVertexCount);
+
+    ParallelFor(TriangleCount, [&](int32 TriangleIdx)
+    {
+        const int32 Base = TriangleIdx * 3;
+        const float U0 = GetSourceUV(RenderTriangles[Base]).X;
+        const float U1 = GetSourceUV(RenderTriangles[Base + 1]).X;
+        const float U2 = GetSourceUV(RenderTriangles[Base + 2]).X;
+        const bool bCrossesSeam = (FMath::Max3(U0, U1, U2) - FMath::Min3(U0, U1, U2)) > UVSeamWrapThreshold;
+        TriangleCrossesSeam[TriangleIdx] = bCrossesSeam ? 1 : 0;
+        if (!bCrossesSeam)
+        {
+            return;
+        }
+
+        const float CornerU[3] = { U0, U1, U2 };
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            if (CornerU[Corner] >= UVSeamSplitReference)
+            {
+                continue;
+            }
+
+            // Atomic min: the earliest corner referencing this vertex owns its duplicate.
+            volatile int32* Slot = &FirstSeamCorner[RenderTriangles[Base + Corner]];
+            const int32 CornerKey = Base + Corner;
+            int32 Observed = *Slot;
+            while (CornerKey < Observed)
+            {
+                const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(Slot, CornerKey, Observed);
+                if (Previous == Observed)
+                {
+                    break;
+                }
+                Observed = Previous;
+            }
+        }
+    }, MeshParallelFlags);
+
+    // Pass 2: exclusive prefix sum over owning corners assigns seam slots [SourceVertexCount, VertexCount).
+    constexpr int32 CornerChunkSize = 16384;
+    const int32 CornerChunkCount = FMath::DivideAndRoundUp(CornerCount, CornerChunkSize);
+    TArray<int32> ChunkSeamOffsets;
+    ChunkSeamOffsets.SetNumZeroed(CornerChunkCount + 1);
+
+    auto IsOwningSeamCorner = [&](int32 CornerKey)
+    {
+        return TriangleCrossesSeam[CornerKey / 3] != 0 && FirstSeamCorner[RenderTriangles[CornerKey]] == CornerKey;
+    };
+
+    ParallelFor(CornerChunkCount, [&](int32 ChunkIdx)
+    {
+        const int32 Begin = ChunkIdx * CornerChunkSize;
+        const int32 End = FMath::Min(Begin + CornerChunkSize, CornerCount);
+        int32 Count = 0;
+        for (int32 CornerKey = Begin; CornerKey < End; ++CornerKey)
+        {
+            Count += IsOwningSeamCorner(CornerKey) ? 1 : 0;
+        }
+        ChunkSeamOffsets[ChunkIdx + 1] = Count;
+    }, MeshParallelFlags);
+
+    for (int32 ChunkIdx = 0; ChunkIdx < CornerChunkCount; ++ChunkIdx)
+    {
+        ChunkSeamOffsets[ChunkIdx + 1] += ChunkSeamOffsets[ChunkIdx];
+    }
+
+    const int32 SeamDuplicateCount = ChunkSeamOffsets[CornerChunkCount];
+    const int32 VertexCount = SourceVertexCount + SeamDuplicateCount;
+
+    // Seam vertex index per source vertex (INDEX_NONE when it has none) and source index per seam duplicate.
+    TArray<int32> SeamVertexIndex;
+    SeamVertexIndex.Init(INDEX_NONE, SourceVertexCount);
+    TArray<int32> SeamSourceIndex;
+    SeamSourceIndex.SetNumUninitialized(SeamDuplicateCount);
+
+    ParallelFor(CornerChunkCount, [&](int32 ChunkIdx)
+    {
+        const int32 Begin = ChunkIdx * CornerChunkSize;
+        const int32 End = FMath::Min(Begin + CornerChunkSize, CornerCount);
+        int32 NextSeamVertex = SourceVertexCount + ChunkSeamOffsets[ChunkIdx];
+        for (int32 CornerKey = Begin; CornerKey < End; ++CornerKey)
+        {
+            if (IsOwningSeamCorner(CornerKey))
+            {
+                const int32 SourceIndex = RenderTriangles[CornerKey];
+                SeamVertexIndex[SourceIndex] = NextSeamVertex;
+                SeamSourceIndex[NextSeamVertex - SourceVertexCount] = SourceIndex;
+                ++NextSeamVertex;
+            }
+        }
+    }, MeshParallelFlags);
+
+    // Index buffer in build order. Winding is flipped (V0, V2, V1) for the outward-facing sphere.
+    auto EmitBuildOrderIndices = [&](uint32* OutBuildIndices)
+    {
+        ParallelFor(TriangleCount, [&](int32 TriangleIdx)
+        {
+            const int32 Base = TriangleIdx * 3;
+            const bool bCrossesSeam = TriangleCrossesSeam[TriangleIdx] != 0;
+
+            auto ResolveCorner = [&](int32 SourceIndex) -> uint32
+            {
+                if (bCrossesSeam && GetSourceUV(SourceIndex).X < UVSeamSplitReference)
+                {
+                    return static_cast<uint32>(SeamVertexIndex[SourceIndex]);
+                }
+                return static_cast<uint32>(SourceIndex);
+            };
+
+            OutBuildIndices[Base] = ResolveCorner(RenderTriangles[Base]);
+            OutBuildIndices[Base + 1] = ResolveCorner(RenderTriangles[Base + 2]);
+            OutBuildIndices[Base + 2] = ResolveCorner(RenderTriangles[Base + 1]);
+        }, MeshParallelFlags);
+    };
+
+    const double SeamEndTime = FPlatformTime::Seconds();
+
+    // Vertex-cache/fetch optimized layout, built once per LOD and topology version and reused by every later build.
+    // The static entry outlives topology changes that keep the vertex set, so the layout is tagged with its topology.
+    TSharedPtr<const FPreviewMeshLayout, ESPMode::ThreadSafe> LayoutRef;
+    bool bLayoutReused = false;
+    if (CVarPlanetaryCreationOptimizePreviewIndices.GetValueOnAnyThread() != 0)
     {
-        FPreviewMeshVertex& VertexOut = PreviewVertices[Index];
-        VertexOut.PrimaryIndex = INDEX_NONE;
-        VertexOut.SeamWrappedIndex = INDEX_NONE;
+        FScopeLock LayoutLock(&StaticData.LayoutLock);
+        if (StaticData.MeshLayout.IsValid() && StaticData.LayoutTopologyVersion == TopologyVersion &&
+            StaticData.MeshLayout->Matches(SourceVertexCount, VertexCount, CornerCount))
+        {
+            bLayoutReused = true;
+        }
+        else
+        {
+            TArray<uint32> BuildOrderIndices;
+            BuildOrderIndices.SetNumUninitialized(CornerCount);
+            EmitBuildOrderIndices(BuildOrderIndices.GetData());
+
+            TSharedRef<FPreviewMeshLayout, ESPMode::ThreadSafe> NewLayout = MakeShared<FPreviewMeshLayout, ESPMode::ThreadSafe>();
+            NewLayout->Build(BuildOrderIndices, SourceVertexCount, VertexCount);
+            StaticData.MeshLayout = NewLayout;
+            StaticData.LayoutTopologyVersion = TopologyVersion;
+        }
+
+        if (StaticData.MeshLayout->Matches(SourceVertexCount, VertexCount, CornerCount))
+        {
+            LayoutRef = StaticData.MeshLayout;
+        }
+    }
+    const FPreviewMeshLayout* Layout = LayoutRef.Get();
+
+    const double LayoutEndTime = FPlatformTime::Seconds();
+
+    // Pass 3: size every stream once, then evaluate and write vertex attributes in parallel. The builder's vertex
+    // streams are linked, so SetNumVertices sizes positions, tangents, UVs and colors together.
+    Builder.SetNumVertices(VertexCount);
+    Builder.SetNumTriangles(TriangleCount);
+
+    OutPositionX.SetNumUninitialized(VertexCount);
+    OutPositionY.SetNumUninitialized(VertexCount);
+    OutPositionZ.SetNumUninitialized(VertexCount);
+    OutNormalX.SetNumUninitialized(VertexCount);
+    OutNormalY.SetNumUninitialized(VertexCount);
+    OutNormalZ.SetNumUninitialized(VertexCount);
+    OutTangentX.SetNumUninitialized(VertexCount);
+    OutTangentY.SetNumUninitialized(VertexCount);
+    OutTangentZ.SetNumUninitialized(VertexCount);
+    OutColors.SetNumUninitialized(VertexCount);
+    OutUVs.SetNumUninitialized(VertexCount);
+    OutAmplifiedHeights.SetNumUninitialized(VertexCount);
+    OutIndices.SetNumUninitialized(CornerCount);
+    OutSourceIndices.SetNumUninitialized(VertexCount);
+
+    FRealtimeMeshStream& StageBStream = OutStreamSet.AddStream(
+        PlanetaryCreation::MeshStreams::StageBHeight, GetRealtimeMeshBufferLayout<float>());
+    TRealtimeMeshStreamBuilder<float> StageBBuilder(StageBStream);
+    StageBBuilder.SetNumUninitialized(VertexCount);
+
+    ParallelFor(VertexCount, [&](int32 OutIndex)
+    {
+        const int32 BuildIndex = Layout ? Layout->NewToBuild[OutIndex] : OutIndex;
+        const bool bSeamDuplicate = BuildIndex >= SourceVertexCount;
+        const int32 Index = bSeamDuplicate ? SeamSourceIndex[BuildIndex - SourceVertexCount] : BuildIndex;
+        OutSourceIndices[OutIndex] = Index;
 
         FVector3f UnitNormal;
-        if (bUseSoANormals && SoANormalX->IsValidIndex(Index) && SoANormalY->IsValidIndex(Index) && SoANormalZ->IsValidIndex(Index))
+        if (bUseSoANormals)
         {
             UnitNormal = FVector3f((*SoANormalX)[Index], (*SoANormalY)[Index], (*SoANormalZ)[Index]);
         }
@@ -1802,9 +2337,14 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
         FVector3f Position = UnitNormal * RadiusUE;
         FVector3f Normal = UnitNormal;
 
-        const FVector2f UV = CachedUVs.IsValidIndex(Index) ? CachedUVs[Index] : FVector2f::ZeroVector;
+        FVector2f UV = GetSourceUV(Index);
+        if (bSeamDuplicate)
+        {
+            UV.X += 1.0f;
+        }
+
         FVector3f Tangent;
-        if (bUseSoATangents && SoATangentX->IsValidIndex(Index) && SoATangentY->IsValidIndex(Index) && SoATangentZ->IsValidIndex(Index))
+        if (bUseSoATangents)
         {
             Tangent = FVector3f((*SoATangentX)[Index], (*SoATangentY)[Index], (*SoATangentZ)[Index]);
         }
@@ -1872,126 +2412,63 @@ void FTectonicSimulationController::BuildMeshFromSnapshot(int32 LODLevel, int32
             VertexColor = PlateColor;
         }
 
-        VertexOut.Position = Position;
-        VertexOut.Normal = Normal;
-        VertexOut.TangentX = Tangent;
-        VertexOut.Color = VertexColor;
-        VertexOut.UV = UV;
-        VertexOut.ElevationMeters = static_cast<float>(ElevationMeters);
-        VertexOut.SourceIndex = Index;
-    });
+        Builder.SetPosition(OutIndex, Position);
+        Builder.SetNormalAndTangent(OutIndex, Normal, Tangent);
+        Builder.SetTexCoord(OutIndex, 0, UV);
+        Builder.SetColor(OutIndex, VertexColor);
+        StageBBuilder[OutIndex] = static_cast<float>(ElevationMeters);
 
-    const int32 EstimatedVertexCapacity = SourceVertexCount * 2;
-    OutPositionX.Reserve(EstimatedVertexCapacity);
-    OutPositionY.Reserve(EstimatedVertexCapacity);
-    OutPositionZ.Reserve(EstimatedVertexCapacity);
-    OutNormalX.Reserve(EstimatedVertexCapacity);
-    OutNormalY.Reserve(EstimatedVertexCapacity);
-    OutNormalZ.Reserve(EstimatedVertexCapacity);
-    OutTangentX.Reserve(EstimatedVertexCapacity);
-    OutTangentY.Reserve(EstimatedVertexCapacity);
-    OutTangentZ.Reserve(EstimatedVertexCapacity);
-    OutColors.Reserve(EstimatedVertexCapacity);
-    OutUVs.Reserve(EstimatedVertexCapacity);
-    OutAmplifiedHeights.Reserve(EstimatedVertexCapacity);
-    OutIndices.Reserve(RenderTriangles.Num());
-
-    auto EmitVertex = [&](FPreviewMeshVertex& VertexData) -> int32
-    {
-        const int32 VertexId = Builder.AddVertex(VertexData.Position)
-            .SetNormalAndTangent(VertexData.Normal, VertexData.TangentX)
-            .SetColor(VertexData.Color)
-            .SetTexCoord(VertexData.UV);
-
-        OutPositionX.Add(VertexData.Position.X);
-        OutPositionY.Add(VertexData.Position.Y);
-        OutPositionZ.Add(VertexData.Position.Z);
-
-        OutNormalX.Add(VertexData.Normal.X);
-        OutNormalY.Add(VertexData.Normal.Y);
-        OutNormalZ.Add(VertexData.Normal.Z);
-
-        OutTangentX.Add(VertexData.TangentX.X);
-        OutTangentY.Add(VertexData.TangentX.Y);
-        OutTangentZ.Add(VertexData.TangentX.Z);
-
-        OutColors.Add(VertexData.Color);
-        OutUVs.Add(VertexData.UV);
-        OutAmplifiedHeights.Add(VertexData.ElevationMeters);
-        OutSourceIndices.Add(VertexData.SourceIndex);
+        OutPositionX[OutIndex] = Position.X;
+        OutPositionY[OutIndex] = Position.Y;
+        OutPositionZ[OutIndex] = Position.Z;
+        OutNormalX[OutIndex] = Normal.X;
+        OutNormalY[OutIndex] = Normal.Y;
+        OutNormalZ[OutIndex] = Normal.Z;
+        OutTangentX[OutIndex] = Tangent.X;
+        OutTangentY[OutIndex] = Tangent.Y;
+        OutTangentZ[OutIndex] = Tangent.Z;
+        OutColors[OutIndex] = VertexColor;
+        OutUVs[OutIndex] = UV;
+        OutAmplifiedHeights[OutIndex] = static_cast<float>(ElevationMeters);
+    }, MeshParallelFlags);
 
-        OutVertexCount++;
-        return VertexId;
-    };
+    const double VertexEndTime = FPlatformTime::Seconds();
 
-    for (int32 Index = 0; Index < SourceVertexCount; ++Index)
+    // Pass 4: index emission.
+    if (Layout)
     {
-        FPreviewMeshVertex& VertexData = PreviewVertices[Index];
-        VertexData.PrimaryIndex = EmitVertex(VertexData);
+        FMemory::Memcpy(OutIndices.GetData(), Layout->Indices.GetData(), CornerCount * sizeof(uint32));
     }
-
-    constexpr float UVSeamWrapThreshold = 0.5f;
-    constexpr float UVSeamSplitReference = 0.5f;
-
-    auto ResolveSeamVertexIndex = [&](FPreviewMeshVertex& VertexData) -> int32
+    else
     {
-        if (VertexData.SeamWrappedIndex != INDEX_NONE)
-        {
-            return VertexData.SeamWrappedIndex;
-        }
-
-        FPreviewMeshVertex WrappedVertex = VertexData;
-        WrappedVertex.UV.X += 1.0f;
-        VertexData.SeamWrappedIndex = EmitVertex(WrappedVertex);
-        return VertexData.SeamWrappedIndex;
-    };
+        EmitBuildOrderIndices(OutIndices.GetData());
+    }
 
-    for (int32 TriangleIdx = 0; TriangleIdx < RenderTriangles.Num(); TriangleIdx += 3)
+    ParallelFor(TriangleCount, [&](int32 TriangleIdx)
     {
-        const int32 SourceIndex0 = RenderTriangles[TriangleIdx];
-        const int32 SourceIndex1 = RenderTriangles[TriangleIdx + 1];
-        const int32 SourceIndex2 = RenderTriangles[TriangleIdx + 2];
-
-        FPreviewMeshVertex& Vertex0 = PreviewVertices[SourceIndex0];
-        FPreviewMeshVertex& Vertex1 = PreviewVertices[SourceIndex1];
-        FPreviewMeshVertex& Vertex2 = PreviewVertices[SourceIndex2];
-
-        const float MaxU = FMath::Max3(Vertex0.UV.X, Vertex1.UV.X, Vertex2.UV.X);
-        const float MinU = FMath::Min3(Vertex0.UV.X, Vertex1.UV.X, Vertex2.UV.X);
-        const bool bCrossesSeam = (MaxU - MinU) > UVSeamWrapThreshold;
-
-        auto GetTriangleVertexIndex = [&](FPreviewMeshVertex& VertexData) -> int32
-        {
-            if (!bCrossesSeam || VertexData.UV.X >= UVSeamSplitReference)
-            {
-                return VertexData.PrimaryIndex;
-            }
-
-            return ResolveSeamVertexIndex(VertexData);
-        };
-
-        const int32 V0 = GetTriangleVertexIndex(Vertex0);
-        const int32 V1 = GetTriangleVertexIndex(Vertex1);
-        const int32 V2 = GetTriangleVertexIndex(Vertex2);
+        const int32 Base = TriangleIdx * 3;
+        Builder.SetTriangle(TriangleIdx, OutIndices[Base], OutIndices[Base + 1], OutIndices[Base + 2]);
+    }, MeshParallelFlags);
 
-        Builder.AddTriangle(V0, V2, V1);
-        OutIndices.Add(static_cast<uint32>(V0));
-        OutIndices.Add(static_cast<uint32>(V2));
-        OutIndices.Add(static_cast<uint32>(V1));
-        OutTriangleCount++;
-    }
+    OutVertexCount = VertexCount;
+    OutTriangleCount = TriangleCount;
 
-    if (OutVertexCount > 0)
+    const double BuildEndTime = FPlatformTime::Seconds();
     {
-        FRealtimeMeshStream& StageBStream = OutStreamSet.AddStream(
-            PlanetaryCreation::MeshStreams::StageBHeight, GetRealtimeMeshBufferLayout<float>());
-        TRealtimeMeshStreamBuilder<float> StageBBuilder(StageBStream);
-        StageBBuilder.SetNumUninitialized(OutVertexCount);
-        for (int32 Index = 0; Index < OutVertexCount; ++Index)
-        {
-            const float HeightValue = OutAmplifiedHeights.IsValidIndex(Index) ? OutAmplifiedHeights[Index] : 0.0f;
-            StageBBuilder[Index] = HeightValue;
-        }
+        FScopeLock StatsLock(&MeshBuildStatsLock);
+        LastMeshBuildStats.SeamAllocationMs = (SeamEndTime - BuildStartTime) * 1000.0;
+        LastMeshBuildStats.LayoutMs = (LayoutEndTime - SeamEndTime) * 1000.0;
+        LastMeshBuildStats.VertexStreamMs = (VertexEndTime - LayoutEndTime) * 1000.0;
+        LastMeshBuildStats.IndexStreamMs = (BuildEndTime - VertexEndTime) * 1000.0;
+        LastMeshBuildStats.TotalMs = (BuildEndTime - BuildStartTime) * 1000.0;
+        LastMeshBuildStats.VertexCount = VertexCount;
+        LastMeshBuildStats.TriangleCount = TriangleCount;
+        LastMeshBuildStats.SeamDuplicateCount = SeamDuplicateCount;
+        LastMeshBuildStats.LODLevel = LODLevel;
+        LastMeshBuildStats.bOptimizedLayout = Layout != nullptr;
+        LastMeshBuildStats.bLayoutReused = bLayoutReused;
+        LastMeshBuildStats.BaselineIndexMetrics = Layout ? Layout->BaselineMetrics : FPreviewIndexMetrics();
+        LastMeshBuildStats.OptimizedIndexMetrics = Layout ? Layout->OptimizedMetrics : FPreviewIndexMetrics();
     }
 }
 
@@ -2078,6 +2555,7 @@ void FTectonicSimulationController::UpdateLOD()
 
         if (bApplyChange)
         {
+            CancelStalePrewarm(NewTargetLOD);
             TargetLODLevel = NewTargetLOD;
             UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD] Target LOD changed: L%d (d/R=%.2f, distance=%.0f km)"),
                 TargetLODLevel, dOverR, CameraDistance);
@@ -2120,17 +2598,134 @@ const FCachedLODMesh* FTectonicSimulationController::GetCachedLOD(int32 LODLevel
         return nullptr;
     }
 
-    const TUniquePtr<FCachedLODMesh>* CachedMesh = LODCache.Find(LODLevel);
-    return CachedMesh ? CachedMesh->Get() : nullptr;
+    return AcquireCachedLOD(LODLevel);
 }
 
 FCachedLODMesh* FTectonicSimulationController::GetMutableCachedLOD(int32 LODLevel)
 {
-    if (TUniquePtr<FCachedLODMesh>* CachedMesh = LODCache.Find(LODLevel))
+    return AcquireCachedLOD(LODLevel);
+}
+
+FCachedLODMesh* FTectonicSimulationController::AcquireCachedLOD(int32 LODLevel) const
+{
+    const TUniquePtr<FCachedLODMesh>* CachedMesh = LODCache.Find(LODLevel);
+    if (!CachedMesh || !CachedMesh->IsValid())
     {
-        return CachedMesh->Get();
+        return nullptr;
     }
-    return nullptr;
+
+    FCachedLODMesh& Entry = **CachedMesh;
+    if (Entry.IsCompact())
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        if (!Entry.ExpandFloatStreams())
+        {
+            // Corrupt payload: drop the entry so the caller rebuilds.
+            LODCache.Remove(LODLevel);
+            return nullptr;
+        }
+        UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[LOD Cache] Expanded L%d (%d verts) in %.2f ms"),
+            LODLevel, Entry.VertexCount, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+
+    Entry.CacheTimestamp = FPlatformTime::Seconds();
+    CompactColdLODEntries(LODLevel);
+    return &Entry;
+}
+
+void FTectonicSimulationController::CompactColdLODEntries(int32 ActiveLODLevel) const
+{
+    const int32 CompactionMode = CVarPlanetaryCreationLODCacheCompaction.GetValueOnGameThread();
+    if (CompactionMode <= 0)
+    {
+        return;
+    }
+
+    for (const TPair<int32, TUniquePtr<FCachedLODMesh>>& CachePair : LODCache)
+    {
+        if (CachePair.Key == ActiveLODLevel || !CachePair.Value.IsValid() || CachePair.Value->IsCompact())
+        {
+            continue;
+        }
+
+        FCachedLODMesh& Entry = *CachePair.Value;
+        const SIZE_T ExpandedBytes = Entry.GetStreamAllocatedSize();
+        const double StartTime = FPlatformTime::Seconds();
+        if (Entry.CompactFloatStreams(CompactionMode >= 2))
+        {
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Compacted L%d: %.2f MB -> %.2f MB%s (%.2f ms)"),
+                CachePair.Key,
+                ExpandedBytes / (1024.0 * 1024.0),
+                Entry.GetStreamAllocatedSize() / (1024.0 * 1024.0),
+                Entry.CompactStreams.IsEncoded() ? TEXT(" (encoded)") : TEXT(""),
+                (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        }
+    }
+}
+
+bool FCachedLODMesh::CompactFloatStreams(bool bEncode)
+{
+    if (IsCompact())
+    {
+        return true;
+    }
+
+    if (!CompactStreams.Quantize(MetersToUE(Snapshot.PlanetRadius), MetersToUE(1.0),
+        PositionX, PositionY, PositionZ, NormalX, NormalY, NormalZ, TangentX, TangentY, TangentZ,
+        VertexColors, UVs, AmplifiedHeights, Indices, SourceVertexIndices))
+    {
+        return false;
+    }
+
+    if (bEncode)
+    {
+        CompactStreams.Encode();
+    }
+
+    PositionX.Empty();
+    PositionY.Empty();
+    PositionZ.Empty();
+    NormalX.Empty();
+    NormalY.Empty();
+    NormalZ.Empty();
+    TangentX.Empty();
+    TangentY.Empty();
+    TangentZ.Empty();
+    VertexColors.Empty();
+    UVs.Empty();
+    AmplifiedHeights.Empty();
+    Indices.Empty();
+    SourceVertexIndices.Empty();
+    return true;
+}
+
+bool FCachedLODMesh::ExpandFloatStreams()
+{
+    if (!IsCompact())
+    {
+        return true;
+    }
+
+    const bool bExpanded = CompactStreams.Dequantize(PositionX, PositionY, PositionZ, NormalX, NormalY, NormalZ,
+        TangentX, TangentY, TangentZ, VertexColors, UVs, AmplifiedHeights, Indices, SourceVertexIndices);
+    CompactStreams.Reset();
+    return bExpanded;
+}
+
+SIZE_T FCachedLODMesh::GetStreamAllocatedSize() const
+{
+    return PositionX.GetAllocatedSize() + PositionY.GetAllocatedSize() + PositionZ.GetAllocatedSize() +
+        NormalX.GetAllocatedSize() + NormalY.GetAllocatedSize() + NormalZ.GetAllocatedSize() +
+        TangentX.GetAllocatedSize() + TangentY.GetAllocatedSize() + TangentZ.GetAllocatedSize() +
+        VertexColors.GetAllocatedSize() + UVs.GetAllocatedSize() + AmplifiedHeights.GetAllocatedSize() +
+        Indices.GetAllocatedSize() + SourceVertexIndices.GetAllocatedSize() +
+        CompactStreams.GetAllocatedSize();
+}
+
+SIZE_T FCachedLODMesh::GetExpandedStreamSize() const
+{
+    constexpr SIZE_T BytesPerVertex = sizeof(float) * 10 + sizeof(FColor) + sizeof(FVector2f) + sizeof(int32);
+    return static_cast<SIZE_T>(VertexCount) * BytesPerVertex + static_cast<SIZE_T>(TriangleCount) * 3 * sizeof(uint32);
 }
 
 void FTectonicSimulationController::CacheLODMesh(int32 LODLevel, int32 TopologyVersion, int32 SurfaceDataVersion,
@@ -2201,6 +2796,114 @@ void FTectonicSimulationController::CacheLODMesh(int32 LODLevel, int32 TopologyV
 
     UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Cached L%d: %d verts, %d tris (Topo:%d, Surface:%d)"),
         LODLevel, VertexCount, TriangleCount, TopologyVersion, SurfaceDataVersion);
+
+    // Pre-warmed neighbors are not on screen; keep them quantized until the camera selects them.
+    const UTectonicSimulationService* Service = GetService();
+    const int32 ActiveLODLevel = Service ? Service->GetParameters().RenderSubdivisionLevel : CurrentLODLevel;
+    CompactColdLODEntries(ActiveLODLevel);
+    EnforceLODCacheBudget(ActiveLODLevel);
+}
+
+void FTectonicSimulationController::GetNeighborLODLevels(int32 LODLevel, TArray<int32, TInlineAllocator<2>>& OutNeighbors)
+{
+    OutNeighbors.Reset();
+    switch (LODLevel)
+    {
+    case 4:
+        OutNeighbors.Add(5);
+        break;
+    case 5:
+        OutNeighbors.Add(4);
+        OutNeighbors.Add(7);
+        break;
+    case 7:
+        OutNeighbors.Add(5);
+        break;
+    default:
+        if (LODLevel > 0)
+        {
+            OutNeighbors.Add(LODLevel - 1);
+        }
+        OutNeighbors.Add(LODLevel + 1);
+        break;
+    }
+}
+
+bool FTectonicSimulationController::IsLODPinned(int32 LODLevel, int32 ActiveLODLevel)
+{
+    if (LODLevel == ActiveLODLevel)
+    {
+        return true;
+    }
+
+    TArray<int32, TInlineAllocator<2>> Neighbors;
+    GetNeighborLODLevels(ActiveLODLevel, Neighbors);
+    return Neighbors.Contains(LODLevel);
+}
+
+void FTectonicSimulationController::EnforceLODCacheBudget(int32 ActiveLODLevel)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(LODCache_EnforceBudget);
+
+    const double BudgetMB = CVarPlanetaryCreationLODCacheBudgetMB.GetValueOnGameThread();
+    if (BudgetMB <= 0.0)
+    {
+        return;
+    }
+
+    const int64 BudgetBytes = static_cast<int64>(BudgetMB * 1024.0 * 1024.0);
+    int64 CacheBytes = 0;
+    TArray<TPair<double, int32>, TInlineAllocator<8>> EvictionCandidates;
+    for (const TPair<int32, TUniquePtr<FCachedLODMesh>>& CachePair : LODCache)
+    {
+        if (!CachePair.Value.IsValid())
+        {
+            continue;
+        }
+
+        CacheBytes += static_cast<int64>(CachePair.Value->GetBudgetedSize());
+        if (!IsLODPinned(CachePair.Key, ActiveLODLevel))
+        {
+            EvictionCandidates.Emplace(CachePair.Value->CacheTimestamp, CachePair.Key);
+        }
+    }
+
+    if (CacheBytes <= BudgetBytes)
+    {
+        return;
+    }
+
+    // Oldest first.
+    EvictionCandidates.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B)
+    {
+        return A.Key < B.Key;
+    });
+
+    for (const TPair<double, int32>& Candidate : EvictionCandidates)
+    {
+        if (CacheBytes <= BudgetBytes)
+        {
+            break;
+        }
+
+        const int32 LODLevel = Candidate.Value;
+        const int64 EntryBytes = static_cast<int64>(LODCache.FindChecked(LODLevel)->GetBudgetedSize());
+        LODCache.Remove(LODLevel);
+        CacheBytes -= EntryBytes;
+        ++LODCacheEvictions;
+
+        // Static UV/layout tables for the level go too (in-flight builds keep their own reference).
+        EvictStaticLODData(LODLevel);
+
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Evicted L%d (%.2f MB, idle %.1f s) to fit %.1f MB budget"),
+            LODLevel, EntryBytes / (1024.0 * 1024.0), FPlatformTime::Seconds() - Candidate.Key, BudgetMB);
+    }
+
+    if (CacheBytes > BudgetBytes)
+    {
+        UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[LOD Cache] Pinned L%d neighborhood (%.2f MB) exceeds %.1f MB budget"),
+            ActiveLODLevel, CacheBytes / (1024.0 * 1024.0), BudgetMB);
+    }
 }
 
 void FTectonicSimulationController::BuildMeshFromCache(const FCachedLODMesh& CachedMesh,
@@ -2560,9 +3263,12 @@ bool FTectonicSimulationController::UpdateCachedMeshFromSnapshot(FCachedLODMesh&
     const TArray<float>* DummyPosX = nullptr;
     const TArray<float>* DummyPosY = nullptr;
     const TArray<float>* DummyPosZ = nullptr;
-    Service->GetRenderVertexFloatSoA(DummyPosX, DummyPosY, DummyPosZ,
-        SoANormalX, SoANormalY, SoANormalZ,
-        SoATangentX, SoATangentY, SoATangentZ);
+    if (Snapshot.bAllowServiceSoA)
+    {
+        Service->GetRenderVertexFloatSoA(DummyPosX, DummyPosY, DummyPosZ,
+            SoANormalX, SoANormalY, SoANormalZ,
+            SoATangentX, SoATangentY, SoATangentZ);
+    }
 
     const bool bUseSoANormals = SoANormalX && SoANormalY && SoANormalZ &&
         SoANormalX->Num() == SourceVertexCount &&
@@ -2625,6 +3331,18 @@ bool FTectonicSimulationController::UpdateCachedMeshFromSnapshot(FCachedLODMesh&
 
     const bool bDisplaced = Snapshot.ElevationMode == EElevationMode::Displaced;
 
+    // Without the service SoA (worker frames), take tangents from the static LOD data.
+    const TArray<FVector3f>* StaticTangents = nullptr;
+    TSharedPtr<FStaticLODData, ESPMode::ThreadSafe> StaticData;
+    if (!Snapshot.bAllowServiceSoA)
+    {
+        StaticData = GetOrBuildStaticLODData(Snapshot.Parameters.RenderSubdivisionLevel, RenderVertices, false);
+        if (StaticData->TangentX.Num() == SourceVertexCount)
+        {
+            StaticTangents = &StaticData->TangentX;
+        }
+    }
+
     ParallelFor(SourceVertexCount, [&](int32 Index)
     {
         FVector3f UnitNormal;
@@ -2646,6 +3364,10 @@ bool FTectonicSimulationController::UpdateCachedMeshFromSnapshot(FCachedLODMesh&
         {
             Tangent = FVector3f((*SoATangentX)[Index], (*SoATangentY)[Index], (*SoATangentZ)[Index]);
         }
+        else if (StaticTangents)
+        {
+            Tangent = (*StaticTangents)[Index];
+        }
         else
         {
             Tangent = FVector3f::XAxisVector;
@@ -2975,7 +3697,14 @@ void FTectonicSimulationController::FinalizePreviewMeshUpdate(int32 VertexCount,
     const FRealtimeMeshStreamRange Range(0, ClampedVertices, 0, ClampedTriangles * 3);
     Mesh->UpdateSectionRange(SectionKey, Range);
 
-    DrawHighResolutionBoundaryOverlay();
+    // Overlays read live plate/boundary state; while the worker is stepping, draw them once it goes idle.
+    const bool bDeferOverlays = IsSimulationWorkerBusy();
+    bOverlaysDeferred |= bDeferOverlays;
+
+    if (!bDeferOverlays)
+    {
+        DrawHighResolutionBoundaryOverlay();
+    }
 
     if (bUseGPUPreviewMode)
     {
@@ -3026,14 +3755,20 @@ void FTectonicSimulationController::FinalizePreviewMeshUpdate(int32 VertexCount,
     }
 
     // Milestone 4 Task 3.2: Refresh velocity vector field after mesh update
-    DrawVelocityVectorField();
+    if (!bDeferOverlays)
+    {
+        DrawVelocityVectorField();
+    }
 }
 
 void FTectonicSimulationController::InvalidateLODCache()
 {
     const int32 NumCached = LODCache.Num();
     LODCache.Empty();
-    StaticLODDataCache.Empty();
+    {
+        FScopeLock CacheLock(&StaticLODDataLock);
+        StaticLODDataCache.Empty();
+    }
 
     UE_LOG(LogPlanetaryCreation, Warning, TEXT("[LOD Cache] Invalidated %d cached LOD meshes (topology changed)"), NumCached);
 }
@@ -3041,7 +3776,7 @@ void FTectonicSimulationController::InvalidateLODCache()
 void FTectonicSimulationController::PreWarmNeighboringLODs()
 {
     UTectonicSimulationService* Service = GetService();
-    if (!Service)
+    if (!Service || IsSimulationWorkerBusy())
     {
         return;
     }
@@ -3049,24 +3784,11 @@ void FTectonicSimulationController::PreWarmNeighboringLODs()
     const int32 CurrentTopologyVersion = Service->GetTopologyVersion();
     const int32 CurrentSurfaceVersion = Service->GetSurfaceDataVersion();
 
-    // Determine which LODs to pre-warm based on current target
-    TArray<int32> LODsToPreWarm;
-
-    if (TargetLODLevel == 4)
+    // Pre-warm along the automatic LOD ladder: L4 (far) <-> L5 (medium) <-> L7 (close)
+    TArray<int32, TInlineAllocator<2>> LODsToPreWarm;
+    if (TargetLODLevel == 4 || TargetLODLevel == 5 || TargetLODLevel == 7)
     {
-        // At L4 (far), pre-warm L5 (medium)
-        LODsToPreWarm.Add(5);
-    }
-    else if (TargetLODLevel == 5)
-    {
-        // At L5 (medium), pre-warm both L4 (far) and L7 (close)
-        LODsToPreWarm.Add(4);
-        LODsToPreWarm.Add(7);
-    }
-    else if (TargetLODLevel == 7)
-    {
-        // At L7 (close), pre-warm L5 (medium)
-        LODsToPreWarm.Add(5);
+        GetNeighborLODLevels(TargetLODLevel, LODsToPreWarm);
     }
 
     // Build any uncached neighboring LODs asynchronously
@@ -3096,10 +3818,12 @@ void FTectonicSimulationController::PreWarmNeighboringLODs()
         // Restore previous render level
         Service->SetRenderSubdivisionLevel(PreviousRenderLevel);
 
-        // Kick off async build
+        // Kick off async build; CancelStalePrewarm bumps the generation if the camera moves on first.
+        const uint32 Generation = PrewarmGeneration.load(std::memory_order_relaxed);
+        PendingPrewarmLOD = LODLevel;
         bAsyncMeshBuildInProgress.store(true);
         ActiveAsyncTasks.fetch_add(1, std::memory_order_relaxed);
-        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Snapshot, LODLevel, CurrentTopologyVersion, CurrentSurfaceVersion]() mutable
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Snapshot, LODLevel, CurrentTopologyVersion, CurrentSurfaceVersion, Generation]() mutable
         {
             // Register thread for Unreal Insights profiling
             TRACE_CPUPROFILER_EVENT_SCOPE(TectonicLODPrebuildAsync);
@@ -3124,14 +3848,18 @@ void FTectonicSimulationController::PreWarmNeighboringLODs()
             TArray<uint32> Indices;
             TArray<int32> SourceVertexIndices;
 
-            BuildMeshFromSnapshot(LODLevel, CurrentTopologyVersion, Snapshot, StreamSet, VertexCount, TriangleCount,
-                PositionX, PositionY, PositionZ,
-                NormalX, NormalY, NormalZ,
-                TangentX, TangentY, TangentZ,
-                Colors, UVs, AmplifiedHeights, Indices, SourceVertexIndices);
+            // Cancelled while queued: skip the build and release the async slot for the LOD the camera moved to.
+            if (PrewarmGeneration.load(std::memory_order_relaxed) == Generation)
+            {
+                BuildMeshFromSnapshot(LODLevel, CurrentTopologyVersion, Snapshot, StreamSet, VertexCount, TriangleCount,
+                    PositionX, PositionY, PositionZ,
+                    NormalX, NormalY, NormalZ,
+                    TangentX, TangentY, TangentZ,
+                    Colors, UVs, AmplifiedHeights, Indices, SourceVertexIndices);
+            }
 
             // Return to game thread to cache result
-            AsyncTask(ENamedThreads::GameThread, [this, Snapshot, VertexCount, TriangleCount, LODLevel, CurrentTopologyVersion, CurrentSurfaceVersion,
+            AsyncTask(ENamedThreads::GameThread, [this, Snapshot, VertexCount, TriangleCount, LODLevel, CurrentTopologyVersion, CurrentSurfaceVersion, Generation,
                 PositionX = MoveTemp(PositionX), PositionY = MoveTemp(PositionY), PositionZ = MoveTemp(PositionZ),
                 NormalX = MoveTemp(NormalX), NormalY = MoveTemp(NormalY), NormalZ = MoveTemp(NormalZ),
                 TangentX = MoveTemp(TangentX), TangentY = MoveTemp(TangentY), TangentZ = MoveTemp(TangentZ),
@@ -3145,7 +3873,9 @@ void FTectonicSimulationController::PreWarmNeighboringLODs()
                     return;
                 }
 
-                if (!bShutdownRequested.load(std::memory_order_relaxed))
+                PendingPrewarmLOD = INDEX_NONE;
+                const bool bCancelled = PrewarmGeneration.load(std::memory_order_relaxed) != Generation;
+                if (!bCancelled)
                 {
                     CacheLODMesh(LODLevel, CurrentTopologyVersion, CurrentSurfaceVersion, Snapshot, VertexCount, TriangleCount,
                         MoveTemp(PositionX), MoveTemp(PositionY), MoveTemp(PositionZ),
@@ -3153,9 +3883,25 @@ void FTectonicSimulationController::PreWarmNeighboringLODs()
                         MoveTemp(TangentX), MoveTemp(TangentY), MoveTemp(TangentZ),
                         MoveTemp(Colors), MoveTemp(UVs), MoveTemp(AmplifiedHeights), MoveTemp(Indices), MoveTemp(SourceVertexIndices));
                 }
+                else
+                {
+                    UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[LOD Cache] Discarded cancelled pre-warm of L%d"), LODLevel);
+                }
 
                 bAsyncMeshBuildInProgress.store(false);
                 ActiveAsyncTasks.fetch_sub(1, std::memory_order_relaxed);
+
+                // The pre-warm held the async slot, so a rebuild for the LOD the camera moved to may have been skipped.
+                if (bCancelled && !IsSimulationWorkerBusy())
+                {
+                    if (const UTectonicSimulationService* Service = GetService())
+                    {
+                        if (!IsLODCached(Service->GetParameters().RenderSubdivisionLevel, Service->GetTopologyVersion(), Service->GetSurfaceDataVersion()))
+                        {
+                            BuildAndUpdateMesh();
+                        }
+                    }
+                }
             });
         });
 
@@ -3164,33 +3910,56 @@ void FTectonicSimulationController::PreWarmNeighboringLODs()
     }
 }
 
+void FTectonicSimulationController::CancelStalePrewarm(int32 NewTargetLODLevel)
+{
+    if (PendingPrewarmLOD == INDEX_NONE || IsLODPinned(PendingPrewarmLOD, NewTargetLODLevel))
+    {
+        return;
+    }
+
+    PrewarmGeneration.fetch_add(1, std::memory_order_relaxed);
+    ++CancelledPrewarms;
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[LOD Cache] Cancelled pre-warm of L%d (camera moved to L%d)"),
+        PendingPrewarmLOD, NewTargetLODLevel);
+    PendingPrewarmLOD = INDEX_NONE;
+}
+
 void FTectonicSimulationController::GetCacheStats(int32& OutCachedLODs, int32& OutTotalCacheSize) const
 {
-    OutCachedLODs = LODCache.Num();
-    OutTotalCacheSize = 0;
+    FLODCacheMemoryStats Stats;
+    GetCacheStats(Stats);
+    OutCachedLODs = Stats.CachedLODs;
+    OutTotalCacheSize = static_cast<int32>(FMath::Min<int64>(Stats.ResidentBytes, MAX_int32));
+}
+
+void FTectonicSimulationController::GetCacheStats(FLODCacheMemoryStats& OutStats) const
+{
+    OutStats = FLODCacheMemoryStats();
+    OutStats.CachedLODs = LODCache.Num();
 
     for (const auto& CachePair : LODCache)
     {
         if (CachePair.Value.IsValid())
         {
             const FCachedLODMesh& CachedMesh = *CachePair.Value;
-            size_t AccumulatedBytes = 0;
-            AccumulatedBytes += CachedMesh.PositionX.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.PositionY.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.PositionZ.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.NormalX.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.NormalY.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.NormalZ.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.TangentX.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.TangentY.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.TangentZ.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.VertexColors.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.UVs.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.AmplifiedHeights.GetAllocatedSize();
-            AccumulatedBytes += CachedMesh.Indices.GetAllocatedSize();
-            OutTotalCacheSize += static_cast<int32>(AccumulatedBytes);
+            OutStats.CompactLODs += CachedMesh.IsCompact() ? 1 : 0;
+            OutStats.ResidentBytes += static_cast<int64>(CachedMesh.GetStreamAllocatedSize());
+            OutStats.ExpandedBytes += static_cast<int64>(CachedMesh.GetExpandedStreamSize());
+            OutStats.SnapshotBytes += static_cast<int64>(CachedMesh.Snapshot.GetAllocatedSize());
         }
     }
+
+    OutStats.BudgetBytes = static_cast<int64>(FMath::Max(0.0f, CVarPlanetaryCreationLODCacheBudgetMB.GetValueOnAnyThread()) * 1024.0 * 1024.0);
+    OutStats.Hits = LODCacheHits;
+    OutStats.Misses = LODCacheMisses;
+    OutStats.Evictions = LODCacheEvictions;
+    OutStats.CancelledPrewarms = CancelledPrewarms;
+}
+
+FMeshBuildStats FTectonicSimulationController::GetLastMeshBuildStats() const
+{
+    FScopeLock StatsLock(&MeshBuildStatsLock);
+    return LastMeshBuildStats;
 }
 
 // ============================================================================
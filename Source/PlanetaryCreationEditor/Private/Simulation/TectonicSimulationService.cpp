@@ -2,6 +2,7 @@
 
 #include "Utilities/PlanetaryCreationLogging.h"
 #include "Simulation/TectonicSimulationController.h"
+#include "Async/Async.h"
 #include "Async/ParallelFor.h"
 
 // =====================================================================================
@@ -28,6 +29,7 @@ DEFINE_LOG_CATEGORY(LogPlanetaryCreation);
 #include "HAL/PlatformMisc.h"
 #include "HAL/PlatformFileManager.h"
 #include "Math/RandomStream.h"
+#include "Algo/Count.h"
 #include "Algo/Sort.h"
 #include "Misc/Crc.h"
 #include "Misc/FileHelper.h"
@@ -51,7 +53,6 @@ DEFINE_LOG_CATEGORY(LogPlanetaryCreation);
 #include "Simulation/OceanicProcessor.h"
 #include "Simulation/ErosionProcessor.h"
 #include "Simulation/RiftingProcessor.h"
-#include <queue>
 #include <atomic>
 #if WITH_EDITOR
 #include "Editor.h"
@@ -245,6 +246,18 @@ static TAutoConsoleVariable<float> CVarPaperRiftingMinPlateAreaKm2(
     TEXT("Minimum plate area (km^2) eligible for rifting."),
     ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarPlanetaryCreationSpatialVertexOrder(
+    TEXT("r.PlanetaryCreation.SpatialVertexOrder"),
+    0,
+    TEXT("Renumber render vertices along a Hilbert curve on the cube-sphere when the render mesh is generated, so CSR neighbors sit close in memory. 0 = subdivision order (default), 1 = Hilbert order. Takes effect on the next mesh rebuild."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPlanetaryCreationTerraneSurgeryFullValidation(
+    TEXT("r.PlanetaryCreation.TerraneSurgeryFullValidation"),
+    0,
+    TEXT("Also run the whole-mesh ValidateTopology before and after terrane extraction (the surgery always validates the region it touches). Debug only: costs O(planet) per extraction."),
+    ECVF_Default);
+
 static void ApplyStageBProfilingCommandLineOverride()
 {
     const TCHAR* CmdLine = FCommandLine::Get();
@@ -754,9 +767,39 @@ void UTectonicSimulationService::LogPlateElevationMismatches(const TCHAR* Contex
 void UTectonicSimulationService::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+    RegisterRenderVertexColumns();
     ResetSimulation();
 }
 
+void UTectonicSimulationService::RegisterRenderVertexColumns()
+{
+    using EFlags = ERenderVertexColumnFlags;
+    const EFlags TopologyHistory = EFlags::Topology | EFlags::History;
+
+    FRenderVertexColumnStore& Store = RenderVertexColumns;
+    Store.Reset();
+
+    RenderPositionColumn = Store.RegisterColumn(TEXT("RenderVertices"), RenderVertices, TopologyHistory);
+    Store.SetPrimaryColumn(RenderPositionColumn);
+
+    // Plate assignments stay vertex-sized through compaction (INDEX_NONE-filled by the caller if they were stale).
+    Store.RegisterColumn(TEXT("VertexPlateAssignments"), VertexPlateAssignments, TopologyHistory | EFlags::KeepSized);
+    Store.RegisterColumn(TEXT("VertexVelocities"), VertexVelocities, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexStressValues"), VertexStressValues, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexTemperatureValues"), VertexTemperatureValues, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexElevationValues"), VertexElevationValues, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexErosionRates"), VertexErosionRates, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexSedimentThickness"), VertexSedimentThickness, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexCrustAge"), VertexCrustAge, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexRidgeDirections"), VertexRidgeDirections, TopologyHistory);
+    Store.RegisterColumn(TEXT("VertexAmplifiedElevation"), VertexAmplifiedElevation, EFlags::Topology);
+
+    // Derived caches: rebuilt after topology edits, but restored verbatim by undo/redo.
+    Store.RegisterColumn(TEXT("VertexFoldDirection"), VertexFoldDirection, EFlags::History);
+    Store.RegisterColumn(TEXT("VertexOrogenyClass"), VertexOrogenyClass, EFlags::History);
+    Store.RegisterColumn(TEXT("RenderVertexBoundaryCache"), RenderVertexBoundaryCache, EFlags::History);
+}
+
 void UTectonicSimulationService::Deinitialize()
 {
     // Milestone 6 GPU: Cleanup GPU resources before shutdown
@@ -772,6 +815,7 @@ void UTectonicSimulationService::Deinitialize()
     VertexVelocities.Reset();
     VertexStressValues.Reset();
     RenderVertexBoundaryCache.Reset();
+    ++RenderVertexBoundaryCacheSerial;
     SetStageBAmplificationReady(false, EStageBAmplificationReadyReason::ExternalReset, TEXT("Deinitialize"));
     Super::Deinitialize();
 }
@@ -798,7 +842,21 @@ void UTectonicSimulationService::SetStageBAmplificationReady(bool bReady, EStage
         PlanetaryCreation::StageB::GetReadyReasonDescription(Reason),
         Context);
 
-    StageBReadyChangedDelegate.Broadcast(bStageBAmplificationReady, StageBReadyReason);
+    if (IsInGameThread())
+    {
+        StageBReadyChangedDelegate.Broadcast(bStageBAmplificationReady, StageBReadyReason);
+        return;
+    }
+
+    // Background simulation steps: listeners are Slate widgets, so notify them on the game thread.
+    TWeakObjectPtr<UTectonicSimulationService> WeakService(this);
+    AsyncTask(ENamedThreads::GameThread, [WeakService, bReady, Reason]()
+    {
+        if (UTectonicSimulationService* Service = WeakService.Get())
+        {
+            Service->StageBReadyChangedDelegate.Broadcast(bReady, Reason);
+        }
+    });
 }
 
 bool UTectonicSimulationService::IsStageBAmplificationReady() const
@@ -1136,6 +1194,7 @@ void UTectonicSimulationService::ResetCrustAgeForSeeds(int32 RingDepth)
 
 void UTectonicSimulationService::ResetSimulation()
 {
+    FScopeLock StateLock(&SimulationStateLock);
     CurrentTimeMy = 0.0;
     TotalStepsSimulated = 0;
     RetessellationCadenceStats.Reset();
@@ -1157,6 +1216,7 @@ void UTectonicSimulationService::ResetSimulation()
     VertexSedimentThickness.Empty();
     VertexCrustAge.Empty();
     RenderVertexBoundaryCache.Empty();
+    ++RenderVertexBoundaryCacheSerial;
 
     // Milestone 6: Clear amplification arrays
     VertexRidgeDirections.Empty();
@@ -1169,10 +1229,17 @@ void UTectonicSimulationService::ResetSimulation()
     HydraulicDownstreamDepositBuffer.Reset();
     HydraulicUpstreamCount.Reset();
     HydraulicProcessingQueue.Reset();
+    HydraulicDonorOffsets.Reset();
+    HydraulicDonors.Reset();
+    HydraulicLevelOffsets.Reset();
+    LastHydraulicFlowLevelCount = 0;
     LastHydraulicTotalEroded = 0.0;
     LastHydraulicTotalDeposited = 0.0;
     LastHydraulicLostToOcean = 0.0;
     HydraulicGPUInputs = FHydraulicErosionGPUInputs();
+    SedimentTransportScratch.Reset();
+    SurfaceProcessScratch.Reset();
+    LastSurfaceProcessTimings = FSurfaceProcessTimings();
 
     InvalidateRidgeDirectionCache();
     PendingCrustAgeResetSeeds.Reset();
@@ -1369,6 +1436,7 @@ void UTectonicSimulationService::ResetSimulation()
 
 void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
 {
+    FScopeLock StateLock(&SimulationStateLock);
     if (StepCount <= 0)
     {
         return;
@@ -1406,6 +1474,9 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
         double CacheInvalidationSeconds = 0.0;
         bool bSurfaceDataChanged = false;
         bContinentalGPUResultWasApplied = false;
+        StepBoundaryCacheBuildMs = 0.0;
+        StepTerraneReattachments = 0;
+        StepTerraneTopologyRebuilds = 0;
         bool bPendingOceanicGPUReadback = false;
 
 #if WITH_EDITOR
@@ -1468,28 +1539,20 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
         // Milestone 6 Task 1.2: Update terrane positions (migrate with carrier plates)
         UpdateTerranePositions(StepDurationMy);
 
-        // Phase 2 Task 5: Update boundary classifications based on relative velocities
-        UpdateBoundaryClassifications();
+        // Phase 2 Task 5 / Milestone 3 Task 2.3 / Milestone 4 Tasks 1.3, 2.2: classification (relative velocities),
+        // cosmetic stress, lifecycle states and rift progression fused into one sweep over the boundary table.
+        SweepBoundaries(FPlateBoundaryTable::AllStages, StepDurationMy);
 
 #if UE_BUILD_DEVELOPMENT
         LogBoundaryCacheState(TEXT("AfterUpdateBoundaryClassifications"));
 #endif
 
-        // Milestone 6 Task 1.2: Detect terrane collisions (after boundary updates)
+        // Milestone 6 Task 1.2: Detect terrane collisions (after boundary updates; reads boundary types only)
         DetectTerraneCollisions();
 
         // Milestone 6 Task 1.3: Automatically reattach colliding terranes (after collision detection)
         ProcessTerraneReattachments();
 
-        // Milestone 3 Task 2.3: Update stress at boundaries (cosmetic visualization)
-        UpdateBoundaryStress(StepDurationMy);
-
-        // Milestone 4 Task 1.3: Update boundary lifecycle states (Nascent/Active/Dormant)
-        UpdateBoundaryStates(StepDurationMy);
-
-        // Milestone 4 Task 2.2: Update rift progression for divergent boundaries
-        UpdateRiftProgression(StepDurationMy);
-
         // Milestone 4 Task 2.1: Update hotspot drift in mantle frame
         UpdateHotspotDrift(StepDurationMy);
 
@@ -1707,32 +1770,9 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                 const double Guardrail = FMath::Max(0.0f, CVarPaperCollisionPeakGuardrailMeters.GetValueOnAnyThread());
                 for (Collision::FCollisionEvent& Evt : Events)
                 {
+                    // Radius and affected region were precomputed by DetectCollisions.
                     Evt.PeakGuardrail_m = Guardrail;
-                    const FVector3d Q = Evt.CenterUnit.GetSafeNormal();
-                    const int32 i = Evt.CarrierPlateId;
-                    const int32 j = Evt.TargetPlateId;
-                    FVector3d Si = FVector3d::ZeroVector;
-                    FVector3d Sj = FVector3d::ZeroVector;
-                    if (OmegaPerPlate.IsValidIndex(i)) Si = FVector3d::CrossProduct(OmegaPerPlate[i], Q) * PaperConstants::PlanetRadius_km;
-                    if (OmegaPerPlate.IsValidIndex(j)) Sj = FVector3d::CrossProduct(OmegaPerPlate[j], Q) * PaperConstants::PlanetRadius_km;
-                    const double v = (Sj - Si).Size();
-                    const double v0 = PaperConstants::MaxPlateSpeed_km_per_My;
-                    const double A0 = PaperConstants::ReferencePlateArea_km2;
-                    const double rc = PaperConstants::CollisionDistance_km;
-                    const double r_km = (v > 0.0 && Evt.TerraneArea_km2 > 0.0) ? (rc * FMath::Sqrt(v / v0) * FMath::Sqrt(Evt.TerraneArea_km2 / A0)) : 0.0;
-                    const double r_ang = PaperConstants::KmToGeodesicRadians(r_km);
-
-                    // Collect affected vertices deterministically
-                    TArray<int32> Affected;
-                    Affected.Reserve(VertexCount / 100);
-                    const double CosThresh = FMath::Cos(r_ang);
-                    for (int32 vi = 0; vi < VertexCount; ++vi)
-                    {
-                        const double dot = FMath::Clamp(RenderVertices[vi].Dot(Q), -1.0, 1.0);
-                        if (dot >= CosThresh) Affected.Add(vi);
-                    }
-
-                    Collision::FCollisionMetrics M = Collision::ApplyCollisionSurge(RenderVertices, Affected, Evt, VertexElevationValues, &FoldD4);
+                    Collision::FCollisionMetrics M = Collision::ApplyCollisionSurge(RenderVertices, Evt, VertexElevationValues, &FoldD4);
                     TotalM.CollisionCount += M.CollisionCount;
                     TotalM.MaxPeak_m = FMath::Max(TotalM.MaxPeak_m, M.MaxPeak_m);
                     TotalM.ApplyMs += M.ApplyMs;
@@ -1762,22 +1802,19 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                         const double MinArea = FMath::Max(0.0f, CVarPaperRiftingMinPlateAreaKm2.GetValueOnAnyThread());
                         const double LambdaBase = FMath::Max(0.0f, CVarPaperRiftingLambdaBase.GetValueOnAnyThread());
 
-                        // Approximate per-plate areas using vertex counts scaled to sphere surface area
-                        TMap<int32, int32> PlateCounts;
-                        PlateCounts.Reserve(Plates.Num());
-                        for (int32 v = 0; v < VertexCount; ++v)
-                        {
-                            PlateCounts.FindOrAdd(VertexPlateAssignments[v])++;
-                        }
+                        // Approximate per-plate areas using vertex counts scaled to sphere surface area; the membership
+                        // index is built once here and split in place by each rift, so rifting only touches plate members.
+                        Rifting::FPlateVertexMembership Membership;
+                        Membership.Build(VertexPlateAssignments);
                         const double SphereArea_km2 = 4.0 * PI * FMath::Square(PaperConstants::PlanetRadius_km);
                         const double A0_km2 = PaperConstants::ReferencePlateArea_km2;
 
-                        TArray<int32> UniquePlates; PlateCounts.GetKeys(UniquePlates);
+                        TArray<int32> UniquePlates; Membership.VerticesByPlate.GetKeys(UniquePlates);
                         UniquePlates.Sort();
 
                         for (int32 pid : UniquePlates)
                         {
-                            const int32 count = PlateCounts[pid];
+                            const int32 count = Membership.Num(pid);
                             const double area = (VertexCount > 0) ? (SphereArea_km2 * (double)count / (double)VertexCount) : 0.0;
                             if (area < MinArea) continue;
                             const double contRatio = (Plates.IsValidIndex(pid)) ? Plates[pid].ContinentalRatio : 1.0;
@@ -1785,26 +1822,15 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                             if (Rifting::EvaluateRiftingProbability(pid, area, contRatio, LambdaBase, A0_km2, REvt))
                             {
                                 TArray<FVector3d> DriftDirs;
-                                TArray<int32> NewAssign;
+                                TArray<FVector3d> FragCentroids;
                                 TArray<TPair<int32,double>> FragRatios;
-                                if (Rifting::PerformRifting(REvt, RenderVertices, RenderVertexAdjacencyOffsets, RenderVertexAdjacency, VertexPlateAssignments, NewAssign, DriftDirs, RiftMetrics, &FragRatios))
+                                if (Rifting::PerformRifting(REvt, RenderVertices, Membership, VertexPlateAssignments, DriftDirs, FragCentroids, RiftMetrics, &FragRatios))
                                 {
-                                    VertexPlateAssignments = NewAssign;
                                     // Materialize fragment plates (IDs + metadata) deterministically
                                     // Build ordered fragment id list aligned with DriftDirs
                                     TArray<int32> FragIds; FragIds.Reserve(FragRatios.Num());
                                     for (const TPair<int32,double>& pr : FragRatios) FragIds.Add(pr.Key);
 
-                                    auto ComputeCentroid = [&](int32 plateId) -> FVector3d
-                                    {
-                                        FVector3d sum = FVector3d::ZeroVector; int32 c = 0;
-                                        for (int32 v = 0; v < VertexCount; ++v)
-                                        {
-                                            if (VertexPlateAssignments[v] == plateId) { sum += RenderVertices[v]; ++c; }
-                                        }
-                                        return (c > 0) ? (sum / (double)c).GetSafeNormal() : FVector3d::ZeroVector;
-                                    };
-
                                     // Parent crust type as inheritance baseline
                                     const ECrustType ParentCrust = Plates.IsValidIndex(REvt.PlateId) ? Plates[REvt.PlateId].CrustType : ECrustType::Oceanic;
 
@@ -1812,7 +1838,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                                     {
                                         const int32 newPid = FragIds[k];
                                         const double ratio = FragRatios.IsValidIndex(k) ? FragRatios[k].Value : contRatio;
-                                        const FVector3d centroid = ComputeCentroid(newPid);
+                                        const FVector3d centroid = FragCentroids.IsValidIndex(k) ? FragCentroids[k] : FVector3d::ZeroVector;
                                         FVector3d dir = DriftDirs.IsValidIndex(k) ? DriftDirs[k] : FVector3d::ZeroVector;
                                         if (dir.IsNearlyZero())
                                         {
@@ -1856,6 +1882,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                                             NP.AngularVelocity = omegaMag;
                                         }
                                     }
+                                    InvalidatePlateMetadata();
 
                                     if (bProfile)
                                     {
@@ -1864,7 +1891,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                                         for (int32 k = 0; k < FragIds.Num(); ++k)
                                         {
                                             const int32 fid = FragIds[k];
-                                            int32 cnt = 0; for (int32 v = 0; v < VertexCount; ++v) if (VertexPlateAssignments[v] == fid) ++cnt;
+                                            const int32 cnt = Membership.Num(fid);
                                             MapStr += FString::Printf(TEXT("%s%d(v=%d,cr=%.2f)"), k==0?TEXT(""):TEXT(","), fid, cnt, FragRatios[k].Value);
                                         }
                                         UE_LOG(LogPlanetaryCreation, Log, TEXT("[Rifting] Materialized parent %d -> [%s]"), REvt.PlateId, *MapStr);
@@ -2008,50 +2035,70 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
         // Milestone 4 Task 2.1: Apply hotspot thermal contribution to stress field
         ApplyHotspotThermalContribution();
 
-        // Milestone 5 Task 2.1: Apply continental erosion
+        if (Parameters.bEnableFusedSurfaceProcesses)
         {
-            TRACE_CPUPROFILER_EVENT_SCOPE(ContinentalErosion);
-            const double BlockStart = FPlatformTime::Seconds();
-            ApplyContinentalErosion(StepDurationMy);
-            ErosionTime += FPlatformTime::Seconds() - BlockStart;
+            // Erosion, sediment and dampening in one pass; sub-phase times are attributed to the matching buckets.
+            TRACE_CPUPROFILER_EVENT_SCOPE(FusedSurfaceProcesses);
+            ApplyFusedSurfaceProcesses(StepDurationMy);
+            const FSurfaceProcessTimings& SurfaceTimings = LastSurfaceProcessTimings;
+            ErosionTime += (SurfaceTimings.ReductionMs + SurfaceTimings.ErosionMs) / 1000.0;
+            SedimentTime += (SurfaceTimings.SourceSweepMs + SurfaceTimings.SedimentMs) / 1000.0;
+            DampeningTime += SurfaceTimings.CommitMs / 1000.0;
             bSurfaceDataChanged = true;
-        }
 #if UE_BUILD_DEVELOPMENT
-        {
-            const FString Label = FString::Printf(TEXT("Step%d-AfterContinentalErosion"), AbsoluteStep);
+            const FString Label = FString::Printf(TEXT("Step%d-AfterFusedSurfaceProcesses"), AbsoluteStep);
             LogPlateElevationMismatches(*Label);
+#endif
         }
+        else
+        {
+            LastSurfaceProcessTimings = FSurfaceProcessTimings();
+
+            // Milestone 5 Task 2.1: Apply continental erosion
+            {
+                TRACE_CPUPROFILER_EVENT_SCOPE(ContinentalErosion);
+                const double BlockStart = FPlatformTime::Seconds();
+                ApplyContinentalErosion(StepDurationMy);
+                ErosionTime += FPlatformTime::Seconds() - BlockStart;
+                bSurfaceDataChanged = true;
+            }
+#if UE_BUILD_DEVELOPMENT
+            {
+                const FString Label = FString::Printf(TEXT("Step%d-AfterContinentalErosion"), AbsoluteStep);
+                LogPlateElevationMismatches(*Label);
+            }
 #endif
 
-        // Milestone 5 Task 2.2: Redistribute eroded sediment
-        {
-            TRACE_CPUPROFILER_EVENT_SCOPE(SedimentTransport);
-            const double BlockStart = FPlatformTime::Seconds();
-            ApplySedimentTransport(StepDurationMy);
-            SedimentTime += FPlatformTime::Seconds() - BlockStart;
-            bSurfaceDataChanged = true;
-        }
+            // Milestone 5 Task 2.2: Redistribute eroded sediment
+            {
+                TRACE_CPUPROFILER_EVENT_SCOPE(SedimentTransport);
+                const double BlockStart = FPlatformTime::Seconds();
+                ApplySedimentTransport(StepDurationMy);
+                SedimentTime += FPlatformTime::Seconds() - BlockStart;
+                bSurfaceDataChanged = true;
+            }
 #if UE_BUILD_DEVELOPMENT
-        {
-            const FString Label = FString::Printf(TEXT("Step%d-AfterSedimentTransport"), AbsoluteStep);
-            LogPlateElevationMismatches(*Label);
-        }
+            {
+                const FString Label = FString::Printf(TEXT("Step%d-AfterSedimentTransport"), AbsoluteStep);
+                LogPlateElevationMismatches(*Label);
+            }
 #endif
 
-        // Milestone 5 Task 2.3: Apply oceanic dampening
-        {
-            TRACE_CPUPROFILER_EVENT_SCOPE(OceanicDampening);
-            const double BlockStart = FPlatformTime::Seconds();
-            ApplyOceanicDampening(StepDurationMy);
-            DampeningTime += FPlatformTime::Seconds() - BlockStart;
-            bSurfaceDataChanged = true;
-        }
+            // Milestone 5 Task 2.3: Apply oceanic dampening
+            {
+                TRACE_CPUPROFILER_EVENT_SCOPE(OceanicDampening);
+                const double BlockStart = FPlatformTime::Seconds();
+                ApplyOceanicDampening(StepDurationMy);
+                DampeningTime += FPlatformTime::Seconds() - BlockStart;
+                bSurfaceDataChanged = true;
+            }
 #if UE_BUILD_DEVELOPMENT
-        {
-            const FString Label = FString::Printf(TEXT("Step%d-AfterOceanicDampening"), AbsoluteStep);
-            LogPlateElevationMismatches(*Label);
-        }
+            {
+                const FString Label = FString::Printf(TEXT("Step%d-AfterOceanicDampening"), AbsoluteStep);
+                LogPlateElevationMismatches(*Label);
+            }
 #endif
+        }
 
         // Ensure amplified elevation starts from current base elevation before Stage B passes run (or remain disabled).
         {
@@ -2424,6 +2471,17 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
             SedimentTime * 1000.0,
             DampeningTime * 1000.0);
 
+        if (StepTerraneReattachments > 0)
+        {
+            // Unbatched, every reattached terrane would have paid its own validation + adjacency rebuild.
+            UE_LOG(LogPlanetaryCreation, Log,
+                TEXT("[StepTiming] Step %d | Terranes reattached %d | Topology rebuilds %d (unbatched %d)"),
+                AbsoluteStep,
+                StepTerraneReattachments,
+                StepTerraneTopologyRebuilds,
+                StepTerraneReattachments);
+        }
+
         if (StageBDuration > StageBBudgetSeconds)
         {
             UE_LOG(LogPlanetaryCreation, Warning,
@@ -2462,6 +2520,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
         Profile.HydraulicMs = HydraulicTime * 1000.0;
         Profile.GpuReadbackMs = GpuReadbackSeconds * 1000.0;
         Profile.CacheInvalidationMs = CacheInvalidationSeconds * 1000.0;
+        Profile.BoundaryCacheMs = StepBoundaryCacheBuildMs;
         Profile.RidgeDirtyVertices = LastRidgeDirtyVertexCount;
         Profile.RidgeUpdatedVertices = LastRidgeDirectionUpdateCount;
         Profile.RidgeCacheHits = LastRidgeCacheHitCount;
@@ -2470,11 +2529,14 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
         Profile.RidgeGradientFallbacks = LastRidgeGradientFallbackCount;
         Profile.RidgePlateFallbacks = LastRidgePlateFallbackCount;
         Profile.RidgeMotionFallbacks = LastRidgeMotionFallbackCount;
+        Profile.RidgeSegmentIndexHits = LastRidgeSegmentIndexHitCount;
         Profile.VoronoiReassignedVertices = LastVoronoiReassignedCount;
         Profile.bVoronoiForcedFullRidge = bLastVoronoiForcedFullRidgeUpdate;
         Profile.OceanicBaselineReuseCount = LastOceanicBaselineReuseCount;
         Profile.OceanicMaskMismatchCount = LastOceanicMaskMismatchCount;
         Profile.bForcedOceanicCpuFallback = bLastOceanicForcedCpuFallback;
+        Profile.TerraneReattachments = StepTerraneReattachments;
+        Profile.TerraneTopologyRebuilds = StepTerraneTopologyRebuilds;
         LatestStageBProfile = Profile;
 
         {
@@ -2554,7 +2616,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
         if (StageBLogMode > 0)
         {
             UE_LOG(LogPlanetaryCreation, Log,
-                TEXT("[StageB][Profile] Step %d | LOD L%d | Ready %d (%s) | PendingGPU O:%d C:%d | Baseline %.2f ms | Ridge %.2f ms (Dirty %d | Updated %d | CacheHits %d | Missing %d | PoorAlign %d | Gradient %d | PlateFallback %d | MotionFallback %d) | Voronoi %d%s | OceanicCPU %.2f ms | OceanicGPU %.2f ms | ContinentalCPU %.2f ms | ContinentalGPU %.2f ms | Hydraulic %.2f ms | Readback %.2f ms | Cache %.2f ms | BaselineReuse %d | MaskMismatch %d | CPUFallback %d | Total %.2f ms"),
+                TEXT("[StageB][Profile] Step %d | LOD L%d | Ready %d (%s) | PendingGPU O:%d C:%d | Baseline %.2f ms | Ridge %.2f ms (Dirty %d | Updated %d | CacheHits %d | Missing %d | PoorAlign %d | Gradient %d | PlateFallback %d | MotionFallback %d | SegmentIndex %d) | Voronoi %d%s | OceanicCPU %.2f ms | OceanicGPU %.2f ms | ContinentalCPU %.2f ms | ContinentalGPU %.2f ms | Hydraulic %.2f ms | Readback %.2f ms | Cache %.2f ms | BoundaryCache %.2f ms | BaselineReuse %d | MaskMismatch %d | CPUFallback %d | Total %.2f ms"),
                 AbsoluteStep,
                 Parameters.RenderSubdivisionLevel,
                 Profile.bAmplificationReady ? 1 : 0,
@@ -2571,6 +2633,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                 Profile.RidgeGradientFallbacks,
                 Profile.RidgePlateFallbacks,
                 Profile.RidgeMotionFallbacks,
+                Profile.RidgeSegmentIndexHits,
                 Profile.VoronoiReassignedVertices,
                 Profile.bVoronoiForcedFullRidge ? TEXT("*") : TEXT(""),
                 Profile.OceanicCPUMs,
@@ -2580,6 +2643,7 @@ void UTectonicSimulationService::AdvanceSteps(int32 StepCount)
                 Profile.HydraulicMs,
                 Profile.GpuReadbackMs,
                 Profile.CacheInvalidationMs,
+                Profile.BoundaryCacheMs,
                 Profile.OceanicBaselineReuseCount,
                 Profile.OceanicMaskMismatchCount,
                 Profile.bForcedOceanicCpuFallback ? 1 : 0,
@@ -2729,6 +2793,7 @@ void UTectonicSimulationService::SetForceHydraulicErosionDisabled(bool bDisabled
 
 void UTectonicSimulationService::SetParameters(const FTectonicSimulationParameters& NewParams)
 {
+    FScopeLock StateLock(&SimulationStateLock);
     if (Parameters.VisualizationMode != NewParams.VisualizationMode)
     {
         FTectonicSimulationParameters ComparableParams = NewParams;
@@ -2842,6 +2907,9 @@ void UTectonicSimulationService::SetHeightmapPaletteMode(EHeightmapPaletteMode M
     HeightmapPaletteMode = Mode;
     Parameters.HeightmapPaletteMode = Mode;
 
+    // Bump like SetVisualizationMode so worker frames published for this change miss the cached colors.
+    SurfaceDataVersion++;
+
     const TCHAR* ModeLabel = (Mode == EHeightmapPaletteMode::NormalizedRange)
         ? TEXT("Normalized (min to max)")
         : TEXT("Absolute hypsometric");
@@ -2849,9 +2917,13 @@ void UTectonicSimulationService::SetHeightmapPaletteMode(EHeightmapPaletteMode M
     UE_LOG(LogPlanetaryCreation, Log, TEXT("[Visualization] Heightmap palette set to %s"), ModeLabel);
 
 #if WITH_EDITOR
-    if (FTectonicSimulationController* Controller = FTectonicSimulationController::GetActiveController())
+    // Queued by the simulation worker: the frame it publishes carries the new palette instead.
+    if (IsInGameThread())
     {
-        Controller->RefreshPreviewColors();
+        if (FTectonicSimulationController* Controller = FTectonicSimulationController::GetActiveController())
+        {
+            Controller->RefreshPreviewColors();
+        }
     }
 #endif
 }
@@ -2902,6 +2974,7 @@ void UTectonicSimulationService::SetAutomaticLODEnabled(bool bEnabled)
 
 void UTectonicSimulationService::SetRenderSubdivisionLevel(int32 NewLevel)
 {
+    FScopeLock StateLock(&SimulationStateLock);
     // Milestone 4 Phase 4.1: Update only the render subdivision level without resetting simulation
     // This preserves all tectonic state (plates, stress, rifts, hotspots, etc.) while changing LOD
 
@@ -2969,7 +3042,7 @@ bool UTectonicSimulationService::ShouldUseGPUAmplification() const
         return false;
     }
 
-    return CVarPlanetaryCreationUseGPUAmplification.GetValueOnGameThread() != 0 &&
+    return CVarPlanetaryCreationUseGPUAmplification.GetValueOnAnyThread() != 0 &&
         Parameters.RenderSubdivisionLevel >= Parameters.MinAmplificationLOD;
 #else
     return false;
@@ -2989,7 +3062,7 @@ PlanetaryCreation::StageB::FStageB_UnifiedParameters UTectonicSimulationService:
     Unified.ContinentalNormalizationEpsilon = 1.0e-3f;
     Unified.OceanicVarianceScale = 1.5f;
     Unified.ExtraVarianceAmplitude = 150.0f;
-    Unified.bEnableAnisotropy = CVarStageBEnableAnisotropy.GetValueOnGameThread() != 0;
+    Unified.bEnableAnisotropy = CVarStageBEnableAnisotropy.GetValueOnAnyThread() != 0;
     return Unified;
 }
 
@@ -3006,7 +3079,7 @@ bool UTectonicSimulationService::ApplyStageBUnifiedGPU(bool bRunOceanic, bool bR
 bool UTectonicSimulationService::ShouldUseGPUHydraulic() const
 {
 #if WITH_EDITOR
-    return CVarPlanetaryCreationUseGPUHydraulic.GetValueOnGameThread() != 0 &&
+    return CVarPlanetaryCreationUseGPUHydraulic.GetValueOnAnyThread() != 0 &&
         Parameters.bEnableHydraulicErosion &&
         Parameters.bSkipCPUAmplification &&
         ShouldUseGPUAmplification();
@@ -3229,6 +3302,7 @@ void UTectonicSimulationService::BuildBoundaryAdjacencyMap()
 {
     // Phase 1 Task 3: Build adjacency map from shared edges in icosphere topology
     Boundaries.Reset();
+    InvalidatePlateMetadata();
 
     // For each pair of plates, check if they share an edge
     for (int32 i = 0; i < Plates.Num(); ++i)
@@ -3351,6 +3425,62 @@ void UTectonicSimulationService::MigratePlateCentroids(double DeltaTimeMy)
 }
 
 void UTectonicSimulationService::UpdateBoundaryClassifications()
+{
+    SweepBoundaries(FPlateBoundaryTable::StageClassify, 0.0);
+}
+
+void UTectonicSimulationService::RefreshBoundaryTable()
+{
+    FPlateBoundaryTable& Table = BoundaryTable;
+    if (Table.CachedPlateMetadataSerial == PlateMetadataSerial &&
+        Table.CachedBoundaryCount == Boundaries.Num() &&
+        Table.CachedPlateCount == Plates.Num())
+    {
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefreshBoundaryTable);
+
+    const FPlateMetadataTable& Metadata = GetPlateMetadata();
+
+    Table.Keys.Reset(Boundaries.Num());
+    for (const auto& BoundaryPair : Boundaries)
+    {
+        Table.Keys.Add(BoundaryPair.Key);
+    }
+    Algo::Sort(Table.Keys, [](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+    {
+        return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+    });
+
+    const int32 BoundaryCount = Table.Keys.Num();
+    Table.Entries.SetNumUninitialized(BoundaryCount);
+    Table.PlateIndexA.SetNumUninitialized(BoundaryCount);
+    Table.PlateIndexB.SetNumUninitialized(BoundaryCount);
+    for (int32 EntryIdx = 0; EntryIdx < BoundaryCount; ++EntryIdx)
+    {
+        const TPair<int32, int32>& Key = Table.Keys[EntryIdx];
+        Table.Entries[EntryIdx] = &Boundaries.FindChecked(Key);
+        Table.PlateIndexA[EntryIdx] = Metadata.FindIndex(Key.Key);
+        Table.PlateIndexB[EntryIdx] = Metadata.FindIndex(Key.Value);
+    }
+
+    Table.ClassifiedTypes.SetNumUninitialized(BoundaryCount);
+    Table.ClassifiedVelocities.SetNumUninitialized(BoundaryCount);
+    Table.Classified.SetNumZeroed(BoundaryCount);
+    Table.ClassifiedValid.SetNumZeroed(BoundaryCount);
+    Table.SweepResults.SetNum(BoundaryCount);
+
+    Table.PlateMotion.Reset();
+    Table.PlateMotion.SetNum(Plates.Num());
+    Table.DirtyPlates.SetNumZeroed(Plates.Num());
+
+    Table.CachedPlateMetadataSerial = PlateMetadataSerial;
+    Table.CachedBoundaryCount = Boundaries.Num();
+    Table.CachedPlateCount = Plates.Num();
+}
+
+bool UTectonicSimulationService::ClassifyBoundary(const FTectonicPlate& PlateA, const FTectonicPlate& PlateB, FPlateBoundary& Boundary) const
 {
     // Phase 2 Task 5: Classify boundaries based on relative plate velocities
     // Velocity at a point on plate = ω × r (angular velocity cross radius vector)
@@ -3371,137 +3501,273 @@ void UTectonicSimulationService::UpdateBoundaryClassifications()
         return Rotated.GetSafeNormal();
     };
 
-    int32 DivergentCount = 0;
-    int32 ConvergentCount = 0;
-    int32 TransformCount = 0;
+    if (Boundary.SharedEdgeVertices.Num() != 2)
+    {
+        return false;
+    }
 
-    TArray<int32> DivergentSeeds;
-    DivergentSeeds.Reserve(Boundaries.Num() * 2);
-    TArray<int32> StateChangeSeeds;
-    StateChangeSeeds.Reserve(Boundaries.Num() * 2);
+    // Rotate boundary vertices to current simulation time for accurate classification
+    const FVector3d& V0_Original = SharedVertices[Boundary.SharedEdgeVertices[0]];
+    const FVector3d& V1_Original = SharedVertices[Boundary.SharedEdgeVertices[1]];
 
-    bool bChangedBoundaryTypes = false;
+    const double RotationAngleA = PlateA.AngularVelocity * CurrentTimeMy;
+    const double RotationAngleB = PlateB.AngularVelocity * CurrentTimeMy;
 
-    for (auto& BoundaryPair : Boundaries)
+    const FVector3d V0_FromA = RotateVertex(V0_Original, PlateA.EulerPoleAxis, RotationAngleA);
+    const FVector3d V1_FromA = RotateVertex(V1_Original, PlateA.EulerPoleAxis, RotationAngleA);
+    const FVector3d V0_FromB = RotateVertex(V0_Original, PlateB.EulerPoleAxis, RotationAngleB);
+    const FVector3d V1_FromB = RotateVertex(V1_Original, PlateB.EulerPoleAxis, RotationAngleB);
+
+    // Average both plate rotations so the midpoint stays between drifting plates.
+    const FVector3d V0_Current = ((V0_FromA + V0_FromB) * 0.5).GetSafeNormal();
+    const FVector3d V1_Current = ((V1_FromA + V1_FromB) * 0.5).GetSafeNormal();
+
+    if (V0_Current.IsNearlyZero() || V1_Current.IsNearlyZero())
     {
-        const TPair<int32, int32>& PlateIDs = BoundaryPair.Key;
-        FPlateBoundary& Boundary = BoundaryPair.Value;
+        return false;
+    }
+
+    const FVector3d BoundaryMidpoint = ((V0_Current + V1_Current) * 0.5).GetSafeNormal();
+    if (BoundaryMidpoint.IsNearlyZero())
+    {
+        return false;
+    }
 
-        // Find the two plates
-        const FTectonicPlate* PlateA = Plates.FindByPredicate([ID = PlateIDs.Key](const FTectonicPlate& P) { return P.PlateID == ID; });
-        const FTectonicPlate* PlateB = Plates.FindByPredicate([ID = PlateIDs.Value](const FTectonicPlate& P) { return P.PlateID == ID; });
+    // Compute velocity at boundary for each plate: v = ω × r
+    // ω is the angular velocity vector = AngularVelocity * EulerPoleAxis
+    const FVector3d OmegaA = PlateA.EulerPoleAxis * PlateA.AngularVelocity;
+    const FVector3d OmegaB = PlateB.EulerPoleAxis * PlateB.AngularVelocity;
 
-        if (!PlateA || !PlateB || Boundary.SharedEdgeVertices.Num() != 2)
-        {
-            continue;
-        }
+    const FVector3d VelocityA = FVector3d::CrossProduct(OmegaA, BoundaryMidpoint);
+    const FVector3d VelocityB = FVector3d::CrossProduct(OmegaB, BoundaryMidpoint);
 
-        // Rotate boundary vertices to current simulation time for accurate classification
-        const FVector3d& V0_Original = SharedVertices[Boundary.SharedEdgeVertices[0]];
-        const FVector3d& V1_Original = SharedVertices[Boundary.SharedEdgeVertices[1]];
+    // Relative velocity: vRel = vA - vB
+    const FVector3d RelativeVelocity = VelocityA - VelocityB;
+    Boundary.RelativeVelocity = RelativeVelocity.Length();
 
-        const double RotationAngleA = PlateA->AngularVelocity * CurrentTimeMy;
-        const double RotationAngleB = PlateB->AngularVelocity * CurrentTimeMy;
+    // Build a boundary normal that is tangent to the sphere and consistently oriented.
+    const FVector3d EdgeVector = (V1_Current - V0_Current).GetSafeNormal();
+    if (EdgeVector.IsNearlyZero())
+    {
+        return false;
+    }
 
-        const FVector3d V0_FromA = RotateVertex(V0_Original, PlateA->EulerPoleAxis, RotationAngleA);
-        const FVector3d V1_FromA = RotateVertex(V1_Original, PlateA->EulerPoleAxis, RotationAngleA);
-        const FVector3d V0_FromB = RotateVertex(V0_Original, PlateB->EulerPoleAxis, RotationAngleB);
-        const FVector3d V1_FromB = RotateVertex(V1_Original, PlateB->EulerPoleAxis, RotationAngleB);
+    // Project Plate A's centroid direction onto the tangent plane so the sign check
+    // is unaffected by radial components (which would otherwise flip classification).
+    const FVector3d PlateATangent = (PlateA.Centroid - FVector3d::DotProduct(PlateA.Centroid, BoundaryMidpoint) * BoundaryMidpoint);
 
-        // Average both plate rotations so the midpoint stays between drifting plates.
-        const FVector3d V0_Current = ((V0_FromA + V0_FromB) * 0.5).GetSafeNormal();
-        const FVector3d V1_Current = ((V1_FromA + V1_FromB) * 0.5).GetSafeNormal();
+    FVector3d BoundaryNormal = FVector3d::CrossProduct(BoundaryMidpoint, EdgeVector);
 
-        if (V0_Current.IsNearlyZero() || V1_Current.IsNearlyZero())
-        {
-            continue;
-        }
+    if (!BoundaryNormal.Normalize())
+    {
+        return false; // Degenerate geometry, skip classification this frame
+    }
 
-        const FVector3d BoundaryMidpoint = ((V0_Current + V1_Current) * 0.5).GetSafeNormal();
-        if (BoundaryMidpoint.IsNearlyZero())
-        {
-            continue;
-        }
+    FVector3d PlateTangentNormalized = PlateATangent;
+    const bool bHasPlateTangent = PlateTangentNormalized.Normalize();
+
+    // Ensure the normal points toward Plate A's side of the boundary so the
+    // dot(RelativeVelocity, BoundaryNormal) sign matches physical intuition.
+    if (bHasPlateTangent && FVector3d::DotProduct(BoundaryNormal, PlateTangentNormalized) < 0.0)
+    {
+        BoundaryNormal *= -1.0;
+    }
 
-        // Compute velocity at boundary for each plate: v = ω × r
-        // ω is the angular velocity vector = AngularVelocity * EulerPoleAxis
-        const FVector3d OmegaA = PlateA->EulerPoleAxis * PlateA->AngularVelocity;
-        const FVector3d OmegaB = PlateB->EulerPoleAxis * PlateB->AngularVelocity;
+    // Project relative velocity onto boundary normal
+    const double NormalComponent = FVector3d::DotProduct(RelativeVelocity, BoundaryNormal);
 
-        const FVector3d VelocityA = FVector3d::CrossProduct(OmegaA, BoundaryMidpoint);
-        const FVector3d VelocityB = FVector3d::CrossProduct(OmegaB, BoundaryMidpoint);
+    // Classify boundary
+    const double ClassificationThreshold = 0.001; // Radians/My threshold
+    EBoundaryType NewType = EBoundaryType::Transform;
+    if (NormalComponent > ClassificationThreshold)
+    {
+        NewType = EBoundaryType::Divergent; // Plates separating
+    }
+    else if (NormalComponent < -ClassificationThreshold)
+    {
+        NewType = EBoundaryType::Convergent; // Plates colliding
+    }
 
-        // Relative velocity: vRel = vA - vB
-        const FVector3d RelativeVelocity = VelocityA - VelocityB;
-        Boundary.RelativeVelocity = RelativeVelocity.Length();
+    Boundary.BoundaryType = NewType;
+    return true;
+}
 
-        // Build a boundary normal that is tangent to the sphere and consistently oriented.
-        const FVector3d EdgeVector = (V1_Current - V0_Current).GetSafeNormal();
-        if (EdgeVector.IsNearlyZero())
-        {
-            continue;
-        }
+void UTectonicSimulationService::SweepBoundaries(uint8 Stages, double DeltaTimeMy)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(SweepBoundaries);
 
-        // Project Plate A's centroid direction onto the tangent plane so the sign check
-        // is unaffected by radial components (which would otherwise flip classification).
-        const FVector3d PlateATangent = (PlateA->Centroid - FVector3d::DotProduct(PlateA->Centroid, BoundaryMidpoint) * BoundaryMidpoint);
+    if (!Parameters.bEnableRiftPropagation)
+    {
+        Stages &= ~FPlateBoundaryTable::StageRift;
+    }
+    if (Stages == 0)
+    {
+        return;
+    }
 
-        FVector3d BoundaryNormal = FVector3d::CrossProduct(BoundaryMidpoint, EdgeVector);
+    RefreshBoundaryTable();
+    FPlateBoundaryTable& Table = BoundaryTable;
+    const int32 BoundaryCount = Table.Keys.Num();
+    const bool bClassify = (Stages & FPlateBoundaryTable::StageClassify) != 0;
 
-        if (!BoundaryNormal.Normalize())
+    // A plate whose pole, spin, centroid or rotation angle drifted past epsilon since its boundaries were last
+    // classified dirties all of them; drift below epsilon accumulates against the stored motion.
+    if (bClassify)
+    {
+        constexpr double PlateMotionEpsilon = 1.0e-9;
+        for (int32 PlateIdx = 0; PlateIdx < Plates.Num(); ++PlateIdx)
         {
-            continue; // Degenerate geometry, skip classification this frame
+            const FTectonicPlate& Plate = Plates[PlateIdx];
+            FPlateBoundaryTable::FPlateMotion& Motion = Table.PlateMotion[PlateIdx];
+            const double RotationAngle = Plate.AngularVelocity * CurrentTimeMy;
+
+            const bool bDirty = !Motion.bValid ||
+                !Motion.EulerPoleAxis.Equals(Plate.EulerPoleAxis, PlateMotionEpsilon) ||
+                !Motion.Centroid.Equals(Plate.Centroid, PlateMotionEpsilon) ||
+                !FMath::IsNearlyEqual(Motion.AngularVelocity, Plate.AngularVelocity, PlateMotionEpsilon) ||
+                !FMath::IsNearlyEqual(Motion.RotationAngle, RotationAngle, PlateMotionEpsilon);
+
+            Table.DirtyPlates[PlateIdx] = bDirty ? 1 : 0;
+            if (bDirty)
+            {
+                Motion.EulerPoleAxis = Plate.EulerPoleAxis;
+                Motion.Centroid = Plate.Centroid;
+                Motion.AngularVelocity = Plate.AngularVelocity;
+                Motion.RotationAngle = RotationAngle;
+                Motion.bValid = true;
+            }
         }
+    }
 
-        FVector3d PlateTangentNormalized = PlateATangent;
-        const bool bHasPlateTangent = PlateTangentNormalized.Normalize();
+    // Entries touch only their own boundary; logging and seed collection happen serially below in key order.
+    constexpr int32 ParallelBoundaryThreshold = 512;
+    ParallelFor(BoundaryCount, [this, &Table, Stages, bClassify, DeltaTimeMy](int32 EntryIdx)
+    {
+        FPlateBoundary& Boundary = *Table.Entries[EntryIdx];
+        FPlateBoundaryTable::FSweepResult& Result = Table.SweepResults[EntryIdx];
+        Result = FPlateBoundaryTable::FSweepResult();
 
-        // Ensure the normal points toward Plate A's side of the boundary so the
-        // dot(RelativeVelocity, BoundaryNormal) sign matches physical intuition.
-        if (bHasPlateTangent && FVector3d::DotProduct(BoundaryNormal, PlateTangentNormalized) < 0.0)
+        if (bClassify)
         {
-            BoundaryNormal *= -1.0;
-        }
+            const int32 PlateIdxA = Table.PlateIndexA[EntryIdx];
+            const int32 PlateIdxB = Table.PlateIndexB[EntryIdx];
+            const bool bNeedsClassification = !Table.Classified[EntryIdx] ||
+                (PlateIdxA != INDEX_NONE && Table.DirtyPlates[PlateIdxA]) ||
+                (PlateIdxB != INDEX_NONE && Table.DirtyPlates[PlateIdxB]) ||
+                Boundary.BoundaryType != Table.ClassifiedTypes[EntryIdx] ||
+                Boundary.RelativeVelocity != Table.ClassifiedVelocities[EntryIdx];
+
+            if (bNeedsClassification)
+            {
+                const EBoundaryType PreviousType = Boundary.BoundaryType;
+                const bool bValid = PlateIdxA != INDEX_NONE && PlateIdxB != INDEX_NONE &&
+                    ClassifyBoundary(Plates[PlateIdxA], Plates[PlateIdxB], Boundary);
 
-        // Project relative velocity onto boundary normal
-        const double NormalComponent = FVector3d::DotProduct(RelativeVelocity, BoundaryNormal);
+                Result.Events |= FPlateBoundaryTable::EventReclassified;
+                if (bValid && Boundary.BoundaryType != PreviousType)
+                {
+                    Result.Events |= FPlateBoundaryTable::EventTypeChanged;
+                }
 
-        const EBoundaryType PreviousType = Boundary.BoundaryType;
+                Table.Classified[EntryIdx] = 1;
+                Table.ClassifiedValid[EntryIdx] = bValid ? 1 : 0;
+                Table.ClassifiedTypes[EntryIdx] = Boundary.BoundaryType;
+                Table.ClassifiedVelocities[EntryIdx] = Boundary.RelativeVelocity;
+            }
+        }
 
-        // Classify boundary
-        const double ClassificationThreshold = 0.001; // Radians/My threshold
-        EBoundaryType NewType = EBoundaryType::Transform;
-        if (NormalComponent > ClassificationThreshold)
+        if (Stages & FPlateBoundaryTable::StageStress)
         {
-            NewType = EBoundaryType::Divergent; // Plates separating
-            DivergentCount++;
+            AccumulateBoundaryStress(Boundary, DeltaTimeMy);
         }
-        else if (NormalComponent < -ClassificationThreshold)
+
+        if (Stages & FPlateBoundaryTable::StageStates)
         {
-            NewType = EBoundaryType::Convergent; // Plates colliding
-            ConvergentCount++;
+            const EBoundaryState OldState = Boundary.BoundaryState;
+            if (AdvanceBoundaryState(Boundary, DeltaTimeMy))
+            {
+                Result.Events |= FPlateBoundaryTable::EventStateChanged;
+                Result.OldState = OldState;
+                Result.NewState = Boundary.BoundaryState;
+            }
         }
-        else
+
+        if (Stages & FPlateBoundaryTable::StageRift)
         {
-            TransformCount++;
+            Result.Events |= AdvanceRiftProgression(Boundary, DeltaTimeMy);
         }
+    }, BoundaryCount < ParallelBoundaryThreshold ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    auto StateName = [](EBoundaryState State)
+    {
+        return State == EBoundaryState::Nascent ? TEXT("Nascent") : (State == EBoundaryState::Active ? TEXT("Active") : TEXT("Dormant"));
+    };
+
+    int32 DivergentCount = 0;
+    int32 ConvergentCount = 0;
+    int32 TransformCount = 0;
+    int32 ReclassifiedCount = 0;
 
-        if (NewType != PreviousType)
+    TArray<int32> DivergentSeeds;
+    TArray<int32> StateChangeSeeds;
+    bool bChangedBoundaryTypes = false;
+
+    for (int32 EntryIdx = 0; EntryIdx < BoundaryCount; ++EntryIdx)
+    {
+        const TPair<int32, int32>& PlateIDs = Table.Keys[EntryIdx];
+        const FPlateBoundary& Boundary = *Table.Entries[EntryIdx];
+        const uint8 Events = Table.SweepResults[EntryIdx].Events;
+
+        ReclassifiedCount += (Events & FPlateBoundaryTable::EventReclassified) ? 1 : 0;
+
+        // Boundaries that were not reclassified keep contributing their (unchanged) type, as a full pass would.
+        if (bClassify && Table.ClassifiedValid[EntryIdx])
         {
-            StateChangeSeeds.Append(Boundary.SharedEdgeVertices);
-            bChangedBoundaryTypes = true;
+            switch (Boundary.BoundaryType)
+            {
+            case EBoundaryType::Divergent:
+                DivergentCount++;
+                DivergentSeeds.Append(Boundary.SharedEdgeVertices);
+                break;
+            case EBoundaryType::Convergent:
+                ConvergentCount++;
+                break;
+            case EBoundaryType::Transform:
+                TransformCount++;
+                break;
+            }
+
+            if (Events & FPlateBoundaryTable::EventTypeChanged)
+            {
+                StateChangeSeeds.Append(Boundary.SharedEdgeVertices);
+                bChangedBoundaryTypes = true;
+            }
         }
 
-        Boundary.BoundaryType = NewType;
+        if (Events & FPlateBoundaryTable::EventStateChanged)
+        {
+            const FPlateBoundaryTable::FSweepResult& Result = Table.SweepResults[EntryIdx];
+            UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[Boundary State] Plate %d <-> %d: %s → %s at %.2f My (velocity=%.4f rad/My)"),
+                PlateIDs.Key, PlateIDs.Value, StateName(Result.OldState), StateName(Result.NewState),
+                CurrentTimeMy, Boundary.RelativeVelocity);
+        }
 
-        if (NewType == EBoundaryType::Divergent)
+        if (Stages & FPlateBoundaryTable::StageRift)
         {
-            DivergentSeeds.Append(Boundary.SharedEdgeVertices);
+            LogRiftProgression(PlateIDs, Boundary, Events);
         }
     }
 
-    UE_LOG(LogPlanetaryCreation, VeryVerbose, TEXT("Boundary classification: %d divergent, %d convergent, %d transform"),
-        DivergentCount, ConvergentCount, TransformCount);
+    if (!bClassify)
+    {
+        return;
+    }
+
+    Table.LastReclassified = ReclassifiedCount;
+    Table.LastSwept = BoundaryCount;
+
+    UE_LOG(LogPlanetaryCreation, VeryVerbose, TEXT("Boundary classification: %d divergent, %d convergent, %d transform (%d/%d reclassified)"),
+        DivergentCount, ConvergentCount, TransformCount, ReclassifiedCount, BoundaryCount);
 
     const int32 RidgeRingDepth = FMath::Max(0, Parameters.RidgeDirectionDirtyRingDepth);
     if (DivergentSeeds.Num() > 0 || StateChangeSeeds.Num() > 0)
@@ -3639,6 +3905,10 @@ void UTectonicSimulationService::ExportMetricsToCSV()
     CSVLines.Add(FString::Printf(TEXT("RetessLastCooldownDurationSteps,%d"), RetessellationCadenceStats.LastCooldownDuration));
     CSVLines.Add(FString::Printf(TEXT("RetessLastDriftDegrees,%.2f"), RetessellationCadenceStats.LastTriggerMaxDriftDegrees));
     CSVLines.Add(FString::Printf(TEXT("RetessLastBadTriangleRatio,%.4f"), RetessellationCadenceStats.LastTriggerBadTriangleRatio));
+    CSVLines.Add(FString::Printf(TEXT("RetessLastDurationMs,%.2f"), RetessellationCadenceStats.LastRetessellationMs));
+    CSVLines.Add(FString::Printf(TEXT("RetessTotalDurationMs,%.2f"), RetessellationCadenceStats.TotalRetessellationMs));
+    CSVLines.Add(FString::Printf(TEXT("RetessLastTrianglesTouched,%d"), RetessellationCadenceStats.LastTrianglesTouched));
+    CSVLines.Add(FString::Printf(TEXT("RetessTotalTrianglesTouched,%lld"), static_cast<long long>(RetessellationCadenceStats.TotalTrianglesTouched)));
 
     // Calculate total kinetic energy (for monitoring)
     double TotalKineticEnergy = 0.0;
@@ -4360,6 +4630,7 @@ void UTectonicSimulationService::GenerateRenderMesh(const TCHAR* RidgeInvalidate
 
     // Store final vertices and triangles
     RenderVertices = Vertices;
+    RenderVertexColumns.MarkColumnChanged(RenderPositionColumn);
     RenderTriangles.Reserve(Faces.Num() * 3);
 
     for (const TArray<int32>& Face : Faces)
@@ -4373,6 +4644,11 @@ void UTectonicSimulationService::GenerateRenderMesh(const TCHAR* RidgeInvalidate
     UE_LOG(LogPlanetaryCreation, Log, TEXT("Generated render mesh: Level %d, %d vertices, %d triangles (expected %d)"),
         SubdivLevel, RenderVertices.Num(), Faces.Num(), ExpectedFaceCount);
 
+    if (CVarPlanetaryCreationSpatialVertexOrder.GetValueOnAnyThread() != 0)
+    {
+        ApplySpatialVertexOrder();
+    }
+
     BuildRenderVertexAdjacency();
 
     // Validate Euler characteristic (V - E + F = 2) when we have plate assignments
@@ -4416,44 +4692,188 @@ void UTectonicSimulationService::GenerateRenderMesh(const TCHAR* RidgeInvalidate
     BumpOceanicAmplificationSerial();
 }
 
-int32 UTectonicSimulationService::GetMidpointIndex(int32 V0, int32 V1, TMap<TPair<int32, int32>, int32>& MidpointCache, TArray<FVector3d>& Vertices)
+namespace
 {
-    // Ensure consistent edge key ordering
-    const TPair<int32, int32> EdgeKey = (V0 < V1) ? TPair<int32, int32>(V0, V1) : TPair<int32, int32>(V1, V0);
-
-    // Check cache
-    if (const int32* CachedIndex = MidpointCache.Find(EdgeKey))
+    /** Hilbert index of (X, Y) on a 2^Order x 2^Order grid. */
+    uint32 HilbertIndex2D(uint32 X, uint32 Y, int32 Order)
     {
-        return *CachedIndex;
+        uint32 Index = 0;
+        for (uint32 Side = 1u << (Order - 1); Side > 0; Side >>= 1)
+        {
+            const uint32 RX = (X & Side) ? 1u : 0u;
+            const uint32 RY = (Y & Side) ? 1u : 0u;
+            Index += Side * Side * ((3u * RX) ^ RY);
+
+            // Rotate the quadrant so the curve stays continuous.
+            if (RY == 0)
+            {
+                if (RX == 1)
+                {
+                    X = Side - 1 - (X & (Side - 1));
+                    Y = Side - 1 - (Y & (Side - 1));
+                }
+                Swap(X, Y);
+            }
+        }
+        return Index;
     }
 
-    // Create new midpoint vertex
-    const FVector3d Midpoint = ((Vertices[V0] + Vertices[V1]) * 0.5).GetSafeNormal();
-    const int32 NewIndex = Vertices.Add(Midpoint);
-    MidpointCache.Add(EdgeKey, NewIndex);
+    /** Cube-face + Hilbert key for a unit vector: face in the high bits, curve position within the face below. */
+    uint64 CubeSphereHilbertKey(const FVector3d& Position)
+    {
+        constexpr int32 Order = 16;
+        constexpr double GridMax = static_cast<double>((1u << Order) - 1);
 
-    return NewIndex;
+        const FVector3d Abs = Position.GetAbs();
+        uint32 Face = 0;
+        double U = 0.0;
+        double V = 0.0;
+        if (Abs.X >= Abs.Y && Abs.X >= Abs.Z)
+        {
+            Face = Position.X >= 0.0 ? 0 : 1;
+            U = Position.Y / Abs.X;
+            V = Position.Z / Abs.X;
+        }
+        else if (Abs.Y >= Abs.Z)
+        {
+            Face = Position.Y >= 0.0 ? 2 : 3;
+            U = Position.X / Abs.Y;
+            V = Position.Z / Abs.Y;
+        }
+        else
+        {
+            Face = Position.Z >= 0.0 ? 4 : 5;
+            U = Position.X / FMath::Max(Abs.Z, UE_DOUBLE_SMALL_NUMBER);
+            V = Position.Y / FMath::Max(Abs.Z, UE_DOUBLE_SMALL_NUMBER);
+        }
+
+        const uint32 GridU = static_cast<uint32>(FMath::Clamp((U * 0.5 + 0.5) * GridMax, 0.0, GridMax));
+        const uint32 GridV = static_cast<uint32>(FMath::Clamp((V * 0.5 + 0.5) * GridMax, 0.0, GridMax));
+        return (static_cast<uint64>(Face) << 32) | HilbertIndex2D(GridU, GridV, Order);
+    }
 }
 
-// Milestone 3 Task 2.1: Build Voronoi mapping
-void UTectonicSimulationService::BuildVoronoiMapping()
+void UTectonicSimulationService::ApplySpatialVertexOrder()
 {
-    const int32 VertexCount = RenderVertices.Num();
-
-    const bool bHadComparableAssignments = CachedVoronoiAssignments.Num() == VertexCount;
-    LastVoronoiReassignedCount = 0;
-    bLastVoronoiForcedFullRidgeUpdate = false;
+    TRACE_CPUPROFILER_EVENT_SCOPE(ApplySpatialVertexOrder);
+    const double StartTime = FPlatformTime::Seconds();
 
-    if (VertexCount == 0 || Plates.Num() == 0)
+    const int32 VertexCount = RenderVertices.Num();
+    if (VertexCount < 2)
     {
-        UE_LOG(LogPlanetaryCreation, Warning, TEXT("Cannot build Voronoi mapping: RenderVertices=%d, Plates=%d"),
-            VertexCount, Plates.Num());
-        if (!bHadComparableAssignments)
-        {
-            MarkAllRidgeDirectionsDirty();
-            bLastVoronoiForcedFullRidgeUpdate = true;
-        }
-        CachedVoronoiAssignments.Reset();
+        return;
+    }
+
+    TArray<uint64> Keys;
+    Keys.SetNumUninitialized(VertexCount);
+    ParallelFor(VertexCount, [this, &Keys](int32 VertexIdx)
+    {
+        Keys[VertexIdx] = CubeSphereHilbertKey(RenderVertices[VertexIdx]);
+    });
+
+    TArray<int32> NewToOld;
+    NewToOld.SetNumUninitialized(VertexCount);
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        NewToOld[VertexIdx] = VertexIdx;
+    }
+    // Ties (duplicate keys) fall back to the original index so the order stays deterministic.
+    Algo::Sort(NewToOld, [&Keys](int32 A, int32 B)
+    {
+        return Keys[A] != Keys[B] ? Keys[A] < Keys[B] : A < B;
+    });
+
+    TArray<int32> OldToNew;
+    OldToNew.SetNumUninitialized(VertexCount);
+    for (int32 NewIdx = 0; NewIdx < VertexCount; ++NewIdx)
+    {
+        OldToNew[NewToOld[NewIdx]] = NewIdx;
+    }
+
+    // Only the freshly generated positions move. Per-vertex state that survives a same-level regeneration (plate
+    // split/merge, terrane spike) is already in this order; permuting it again would detach it from its positions.
+    TArray<FVector3d> SortedVertices;
+    SortedVertices.SetNumUninitialized(VertexCount);
+    for (int32 NewIdx = 0; NewIdx < VertexCount; ++NewIdx)
+    {
+        SortedVertices[NewIdx] = RenderVertices[NewToOld[NewIdx]];
+    }
+    RenderVertices = MoveTemp(SortedVertices);
+    RenderVertexColumns.MarkColumnChanged(RenderPositionColumn);
+
+    // Remap triangle corners (winding unchanged), then order triangles by their lowest new vertex index.
+    const int32 TriangleCount = RenderTriangles.Num() / 3;
+    TArray<int32> TriangleOrder;
+    TArray<int32> TriangleMinVertex;
+    TriangleOrder.SetNumUninitialized(TriangleCount);
+    TriangleMinVertex.SetNumUninitialized(TriangleCount);
+    for (int32 TriIdx = 0; TriIdx < TriangleCount; ++TriIdx)
+    {
+        int32* Corners = &RenderTriangles[TriIdx * 3];
+        Corners[0] = OldToNew[Corners[0]];
+        Corners[1] = OldToNew[Corners[1]];
+        Corners[2] = OldToNew[Corners[2]];
+        TriangleOrder[TriIdx] = TriIdx;
+        TriangleMinVertex[TriIdx] = FMath::Min3(Corners[0], Corners[1], Corners[2]);
+    }
+    Algo::Sort(TriangleOrder, [&TriangleMinVertex](int32 A, int32 B)
+    {
+        return TriangleMinVertex[A] != TriangleMinVertex[B] ? TriangleMinVertex[A] < TriangleMinVertex[B] : A < B;
+    });
+
+    TArray<int32> SortedTriangles;
+    SortedTriangles.SetNumUninitialized(RenderTriangles.Num());
+    for (int32 NewTriIdx = 0; NewTriIdx < TriangleCount; ++NewTriIdx)
+    {
+        const int32 OldTriIdx = TriangleOrder[NewTriIdx];
+        SortedTriangles[NewTriIdx * 3 + 0] = RenderTriangles[OldTriIdx * 3 + 0];
+        SortedTriangles[NewTriIdx * 3 + 1] = RenderTriangles[OldTriIdx * 3 + 1];
+        SortedTriangles[NewTriIdx * 3 + 2] = RenderTriangles[OldTriIdx * 3 + 2];
+    }
+    RenderTriangles = MoveTemp(SortedTriangles);
+
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[VertexOrder] Hilbert-ordered %d render vertices / %d triangles in %.2f ms"),
+        VertexCount, TriangleCount, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+int32 UTectonicSimulationService::GetMidpointIndex(int32 V0, int32 V1, TMap<TPair<int32, int32>, int32>& MidpointCache, TArray<FVector3d>& Vertices)
+{
+    // Ensure consistent edge key ordering
+    const TPair<int32, int32> EdgeKey = (V0 < V1) ? TPair<int32, int32>(V0, V1) : TPair<int32, int32>(V1, V0);
+
+    // Check cache
+    if (const int32* CachedIndex = MidpointCache.Find(EdgeKey))
+    {
+        return *CachedIndex;
+    }
+
+    // Create new midpoint vertex
+    const FVector3d Midpoint = ((Vertices[V0] + Vertices[V1]) * 0.5).GetSafeNormal();
+    const int32 NewIndex = Vertices.Add(Midpoint);
+    MidpointCache.Add(EdgeKey, NewIndex);
+
+    return NewIndex;
+}
+
+// Milestone 3 Task 2.1: Build Voronoi mapping
+void UTectonicSimulationService::BuildVoronoiMapping(FRetessellationJournal* Journal)
+{
+    const int32 VertexCount = RenderVertices.Num();
+
+    const bool bHadComparableAssignments = CachedVoronoiAssignments.Num() == VertexCount;
+    LastVoronoiReassignedCount = 0;
+    bLastVoronoiForcedFullRidgeUpdate = false;
+
+    if (VertexCount == 0 || Plates.Num() == 0)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("Cannot build Voronoi mapping: RenderVertices=%d, Plates=%d"),
+            VertexCount, Plates.Num());
+        if (!bHadComparableAssignments)
+        {
+            MarkAllRidgeDirectionsDirty();
+            bLastVoronoiForcedFullRidgeUpdate = true;
+        }
+        CachedVoronoiAssignments.Reset();
         return;
     }
 
@@ -4512,6 +4932,10 @@ void UTectonicSimulationService::BuildVoronoiMapping()
             }
         }
 
+        if (Journal && VertexPlateAssignments[i] != ClosestPlateID)
+        {
+            JournalRetessellationVertex(*Journal, i);
+        }
         VertexPlateAssignments[i] = ClosestPlateID;
 
         if (!CachedVoronoiAssignments.IsValidIndex(i) || CachedVoronoiAssignments[i] != ClosestPlateID)
@@ -4531,6 +4955,11 @@ void UTectonicSimulationService::BuildVoronoiMapping()
                     ? PaperElevationConstants::AbyssalPlainDepth_m
                     : PaperElevationConstants::ContinentalBaseline_m;
 
+                if (Journal)
+                {
+                    JournalRetessellationVertex(*Journal, i);
+                }
+
                 VertexElevationValues[i] = BaselineElevation;
 
                 if (VertexAmplifiedElevation.IsValidIndex(i))
@@ -4647,8 +5076,21 @@ void UTectonicSimulationService::BuildVoronoiMapping()
     CachedVoronoiAssignments = VertexPlateAssignments;
 }
 
+/** Gaussian falloff over the geodesic distance between two render vertices (smoothing kernel for CSR neighbors). */
+static float ComputeRenderAdjacencyWeight(const FVector3d& VertexPos, const FVector3d& NeighborPos, double InvTwoRadiusSq)
+{
+    const double Dot = FMath::Clamp(FVector3d::DotProduct(VertexPos.GetSafeNormal(), NeighborPos.GetSafeNormal()), -1.0, 1.0);
+    const double Geodesic = FMath::Acos(Dot);
+    return static_cast<float>(FMath::Exp(-(Geodesic * Geodesic) * InvTwoRadiusSq));
+}
+
 void UTectonicSimulationService::BuildRenderVertexAdjacency()
 {
+    // Triangles changed; the incidence index is rebuilt on demand
+    RenderVertexTriangleOffsets.Reset();
+    RenderVertexTriangles.Reset();
+    RenderVertexTriangleIncidenceTopologyVersion = INDEX_NONE;
+
     const int32 VertexCount = RenderVertices.Num();
     if (VertexCount == 0)
     {
@@ -4719,19 +5161,9 @@ void UTectonicSimulationService::BuildRenderVertexAdjacency()
             const int32 NeighborIdx = SortedNeighbors[LocalIdx];
             RenderVertexAdjacency[Start + LocalIdx] = NeighborIdx;
 
-            const FVector3d& NeighborPos = RenderVertices.IsValidIndex(NeighborIdx)
-                ? RenderVertices[NeighborIdx]
-                : FVector3d::ZeroVector;
-
-            double Weight = 0.0;
-            if (RenderVertices.IsValidIndex(NeighborIdx))
-            {
-                const double Dot = FMath::Clamp(FVector3d::DotProduct(VertexPos.GetSafeNormal(), NeighborPos.GetSafeNormal()), -1.0, 1.0);
-                const double Geodesic = FMath::Acos(Dot);
-                Weight = FMath::Exp(-(Geodesic * Geodesic) * InvTwoRadiusSq);
-            }
-
-            const float WeightFloat = static_cast<float>(Weight);
+            const float WeightFloat = RenderVertices.IsValidIndex(NeighborIdx)
+                ? ComputeRenderAdjacencyWeight(VertexPos, RenderVertices[NeighborIdx], InvTwoRadiusSq)
+                : 0.0f;
             RenderVertexAdjacencyWeights[Start + LocalIdx] = WeightFloat;
             WeightSum += WeightFloat;
         }
@@ -4780,13 +5212,247 @@ void UTectonicSimulationService::BuildRenderVertexReverseAdjacency()
     }
 }
 
+void UTectonicSimulationService::BuildRenderVertexTriangleIncidence()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(BuildRenderVertexTriangleIncidence);
+
+    const int32 VertexCount = RenderVertices.Num();
+    const int32 TriangleCount = RenderTriangles.Num() / 3;
+
+    // Counting sort over the corners: each vertex lists its triangles in increasing order.
+    RenderVertexTriangleOffsets.Init(0, VertexCount + 1);
+    for (int32 Corner = 0; Corner < TriangleCount * 3; ++Corner)
+    {
+        const int32 VertexIdx = RenderTriangles[Corner];
+        if (VertexIdx >= 0 && VertexIdx < VertexCount)
+        {
+            ++RenderVertexTriangleOffsets[VertexIdx + 1];
+        }
+    }
+
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        RenderVertexTriangleOffsets[VertexIdx + 1] += RenderVertexTriangleOffsets[VertexIdx];
+    }
+
+    TArray<int32> WriteCursor(RenderVertexTriangleOffsets.GetData(), VertexCount);
+    RenderVertexTriangles.SetNumUninitialized(RenderVertexTriangleOffsets[VertexCount]);
+    for (int32 Corner = 0; Corner < TriangleCount * 3; ++Corner)
+    {
+        const int32 VertexIdx = RenderTriangles[Corner];
+        if (VertexIdx >= 0 && VertexIdx < VertexCount)
+        {
+            RenderVertexTriangles[WriteCursor[VertexIdx]++] = Corner / 3;
+        }
+    }
+
+    RenderVertexTriangleIncidenceTopologyVersion = TopologyVersion;
+}
+
+void UTectonicSimulationService::PatchRenderVertexAdjacency(const TArray<int32>& OldToNew, const TMap<int32, TArray<int32>>& DirtyNeighbors)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(PatchRenderVertexAdjacency);
+
+    const int32 VertexCount = RenderVertices.Num();
+    const int32 OldVertexCount = RenderVertexAdjacencyOffsets.Num() - 1;
+    if (OldVertexCount < 0)
+    {
+        BuildRenderVertexAdjacency();
+        return;
+    }
+
+    const bool bHasOldWeights = RenderVertexAdjacencyWeights.Num() == RenderVertexAdjacency.Num() &&
+        RenderVertexAdjacencyWeightTotals.Num() == OldVertexCount;
+    const bool bHasOldReverse = RenderVertexReverseAdjacency.Num() == RenderVertexAdjacency.Num();
+    const bool bHasOldFlags = ConvergentNeighborFlags.Num() == OldVertexCount;
+
+    TArray<int32> NewToOld;
+    NewToOld.Init(INDEX_NONE, VertexCount);
+    for (int32 OldIdx = 0; OldIdx < OldToNew.Num(); ++OldIdx)
+    {
+        if (NewToOld.IsValidIndex(OldToNew[OldIdx]))
+        {
+            NewToOld[OldToNew[OldIdx]] = OldIdx;
+        }
+    }
+
+    TArray<const TArray<int32>*> DirtyLists;
+    DirtyLists.Init(nullptr, VertexCount);
+    for (const TPair<int32, TArray<int32>>& Pair : DirtyNeighbors)
+    {
+        if (DirtyLists.IsValidIndex(Pair.Key))
+        {
+            DirtyLists[Pair.Key] = &Pair.Value;
+        }
+    }
+
+    // Old index of a vertex whose list is carried over (INDEX_NONE for dirty or new vertices).
+    auto GetCleanOldIndex = [&](int32 VertexIdx)
+    {
+        const int32 OldIdx = DirtyLists[VertexIdx] ? INDEX_NONE : NewToOld[VertexIdx];
+        return (OldIdx >= 0 && OldIdx < OldVertexCount) ? OldIdx : INDEX_NONE;
+    };
+
+    TArray<int32> NewOffsets;
+    NewOffsets.SetNumUninitialized(VertexCount + 1);
+    int32 RunningTotal = 0;
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        NewOffsets[VertexIdx] = RunningTotal;
+        const int32 OldIdx = GetCleanOldIndex(VertexIdx);
+        if (const TArray<int32>* Dirty = DirtyLists[VertexIdx])
+        {
+            RunningTotal += Dirty->Num();
+        }
+        else if (OldIdx != INDEX_NONE)
+        {
+            RunningTotal += RenderVertexAdjacencyOffsets[OldIdx + 1] - RenderVertexAdjacencyOffsets[OldIdx];
+        }
+    }
+    NewOffsets[VertexCount] = RunningTotal;
+
+    TArray<int32> NewAdjacency;
+    TArray<float> NewWeights;
+    TArray<float> NewWeightTotals;
+    TArray<int32> NewReverse;
+    NewAdjacency.SetNumUninitialized(RunningTotal);
+    NewWeights.SetNumUninitialized(RunningTotal);
+    NewWeightTotals.SetNumUninitialized(VertexCount);
+    NewReverse.SetNumUninitialized(RunningTotal);
+
+    const double SmoothingRadius = FMath::Max(Parameters.OceanicDampeningSmoothingRadius, UE_DOUBLE_SMALL_NUMBER);
+    const double InvTwoRadiusSq = 1.0 / (2.0 * SmoothingRadius * SmoothingRadius);
+    const EParallelForFlags ParallelFlags = VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+    // Lists: dirty vertices take the given list with fresh weights; clean lists are remapped (OldToNew is
+    // order-preserving, so they stay sorted) and keep their weights.
+    ParallelFor(VertexCount, [&](int32 VertexIdx)
+    {
+        const int32 Start = NewOffsets[VertexIdx];
+        const int32 Count = NewOffsets[VertexIdx + 1] - Start;
+        const int32 OldIdx = GetCleanOldIndex(VertexIdx);
+        const TArray<int32>* Dirty = DirtyLists[VertexIdx];
+        const int32 OldStart = OldIdx != INDEX_NONE ? RenderVertexAdjacencyOffsets[OldIdx] : INDEX_NONE;
+
+        float WeightSum = 0.0f;
+        for (int32 LocalIdx = 0; LocalIdx < Count; ++LocalIdx)
+        {
+            int32 NeighborIdx = INDEX_NONE;
+            if (Dirty)
+            {
+                NeighborIdx = (*Dirty)[LocalIdx];
+            }
+            else
+            {
+                const int32 OldNeighbor = RenderVertexAdjacency[OldStart + LocalIdx];
+                NeighborIdx = OldToNew.IsValidIndex(OldNeighbor) ? OldToNew[OldNeighbor] : INDEX_NONE;
+            }
+            NewAdjacency[Start + LocalIdx] = NeighborIdx;
+
+            float Weight = 0.0f;
+            if (!Dirty && bHasOldWeights)
+            {
+                Weight = RenderVertexAdjacencyWeights[OldStart + LocalIdx];
+            }
+            else if (RenderVertices.IsValidIndex(NeighborIdx))
+            {
+                Weight = ComputeRenderAdjacencyWeight(RenderVertices[VertexIdx], RenderVertices[NeighborIdx], InvTwoRadiusSq);
+            }
+            NewWeights[Start + LocalIdx] = Weight;
+            WeightSum += Weight;
+        }
+
+        NewWeightTotals[VertexIdx] = (!Dirty && bHasOldWeights && OldIdx != INDEX_NONE)
+            ? RenderVertexAdjacencyWeightTotals[OldIdx]
+            : WeightSum;
+    }, ParallelFlags);
+
+    // Reverse slots: between two clean vertices the position inside the neighbor's list is unchanged, so the old
+    // slot is rebased; anything touching a dirty vertex is looked up.
+    ParallelFor(VertexCount, [&](int32 VertexIdx)
+    {
+        const int32 OldIdx = GetCleanOldIndex(VertexIdx);
+        for (int32 Offset = NewOffsets[VertexIdx]; Offset < NewOffsets[VertexIdx + 1]; ++Offset)
+        {
+            const int32 NeighborIdx = NewAdjacency[Offset];
+            if (!NewToOld.IsValidIndex(NeighborIdx))
+            {
+                NewReverse[Offset] = INDEX_NONE;
+                continue;
+            }
+
+            const int32 OldNeighborIdx = GetCleanOldIndex(NeighborIdx);
+            if (bHasOldReverse && OldIdx != INDEX_NONE && OldNeighborIdx != INDEX_NONE)
+            {
+                const int32 OldReverse = RenderVertexReverseAdjacency[RenderVertexAdjacencyOffsets[OldIdx] + (Offset - NewOffsets[VertexIdx])];
+                NewReverse[Offset] = OldReverse == INDEX_NONE
+                    ? INDEX_NONE
+                    : NewOffsets[NeighborIdx] + (OldReverse - RenderVertexAdjacencyOffsets[OldNeighborIdx]);
+                continue;
+            }
+
+            int32 ReverseIndex = INDEX_NONE;
+            for (int32 NeighborOffset = NewOffsets[NeighborIdx]; NeighborOffset < NewOffsets[NeighborIdx + 1]; ++NeighborOffset)
+            {
+                if (NewAdjacency[NeighborOffset] == VertexIdx)
+                {
+                    ReverseIndex = NeighborOffset;
+                    break;
+                }
+            }
+            NewReverse[Offset] = ReverseIndex;
+        }
+    }, ParallelFlags);
+
+    // Clean vertices keep their neighbor plates, so only dirty convergent flags are recomputed.
+    TArray<uint8> NewFlags;
+    NewFlags.SetNumZeroed(VertexCount);
+    if (bHasOldFlags)
+    {
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            const int32 OldIdx = GetCleanOldIndex(VertexIdx);
+            if (OldIdx != INDEX_NONE)
+            {
+                NewFlags[VertexIdx] = ConvergentNeighborFlags[OldIdx];
+            }
+        }
+    }
+
+    RenderVertexAdjacencyOffsets = MoveTemp(NewOffsets);
+    RenderVertexAdjacency = MoveTemp(NewAdjacency);
+    RenderVertexAdjacencyWeights = MoveTemp(NewWeights);
+    RenderVertexAdjacencyWeightTotals = MoveTemp(NewWeightTotals);
+    RenderVertexReverseAdjacency = MoveTemp(NewReverse);
+    ConvergentNeighborFlags = MoveTemp(NewFlags);
+
+    if (!bHasOldFlags)
+    {
+        UpdateConvergentNeighborFlags();
+        return;
+    }
+
+    for (const TPair<int32, TArray<int32>>& Pair : DirtyNeighbors)
+    {
+        if (ConvergentNeighborFlags.IsValidIndex(Pair.Key))
+        {
+            ConvergentNeighborFlags[Pair.Key] = ComputeConvergentNeighborFlag(Pair.Key);
+        }
+    }
+}
+
 void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(BuildRenderVertexBoundaryCache);
+    const double BuildStart = FPlatformTime::Seconds();
+
     const int32 VertexCount = RenderVertices.Num();
     RenderVertexBoundaryCache.SetNum(VertexCount);
+    ++RenderVertexBoundaryCacheSerial;
 
     if (VertexCount == 0)
     {
+        LastBoundaryCacheBuildMs = 0.0;
         return;
     }
 
@@ -4795,13 +5461,6 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
         BuildRenderVertexAdjacency();
     }
 
-    TArray<FVector3d> VertexNormals;
-    VertexNormals.SetNum(VertexCount);
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-    {
-        VertexNormals[VertexIdx] = RenderVertices[VertexIdx].GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
-    }
-
     const auto GetPlateID = [&](int32 Index) -> int32
     {
         return VertexPlateAssignments.IsValidIndex(Index) ? VertexPlateAssignments[Index] : INDEX_NONE;
@@ -4832,42 +5491,54 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
         Info.OpposingPlateID = INDEX_NONE;
         Info.bHasBoundary = false;
         Info.bIsDivergent = false;
+        Info.bBeyondInfluence = false;
     };
 
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    // Flat cell grid replacing the old TMap buckets: vertices sorted by packed quantized unit position,
+    // so coincident vertices (seam duplicates) end up in contiguous runs.
+    struct FBoundaryCellEntry
     {
-        ResetInfo(VertexIdx);
-    }
+        uint64 CellKey = 0;
+        int32 VertexIdx = INDEX_NONE;
+    };
 
     const double QuantizeScale = 10000.0;
-    auto QuantizeKey = [&](const FVector3d& Position) -> FIntVector
+    auto QuantizeCellKey = [QuantizeScale](const FVector3d& Unit) -> uint64
     {
-        const FVector3d Unit = Position.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
-        return FIntVector(
-            FMath::RoundToInt(Unit.X * QuantizeScale),
-            FMath::RoundToInt(Unit.Y * QuantizeScale),
-            FMath::RoundToInt(Unit.Z * QuantizeScale));
+        // |component| <= 1 keeps each axis within +/-10000, so a 16-bit biased field per axis is exact.
+        const uint64 X = static_cast<uint64>(FMath::RoundToInt(Unit.X * QuantizeScale) + 32768) & 0xFFFF;
+        const uint64 Y = static_cast<uint64>(FMath::RoundToInt(Unit.Y * QuantizeScale) + 32768) & 0xFFFF;
+        const uint64 Z = static_cast<uint64>(FMath::RoundToInt(Unit.Z * QuantizeScale) + 32768) & 0xFFFF;
+        return (X << 32) | (Y << 16) | Z;
     };
 
-    TMap<FIntVector, TArray<int32>> PositionBuckets;
-    PositionBuckets.Reserve(VertexCount / 2);
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-    {
-        PositionBuckets.FindOrAdd(QuantizeKey(RenderVertices[VertexIdx])).Add(VertexIdx);
-    }
+    TArray<FVector3d> VertexNormals;
+    VertexNormals.SetNumUninitialized(VertexCount);
+    TArray<FBoundaryCellEntry> CellEntries;
+    CellEntries.SetNumUninitialized(VertexCount);
 
     TArray<FVector3d> SeedTangents;
     SeedTangents.SetNumZeroed(VertexCount);
     TArray<int32> SeedOpposingPlate;
     SeedOpposingPlate.Init(INDEX_NONE, VertexCount);
-    TBitArray<> SeedMask(false, VertexCount);
+    TArray<uint8> SeedFlags;
+    SeedFlags.SetNumZeroed(VertexCount);
 
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    ParallelFor(VertexCount, [&](int32 VertexIdx)
+    {
+        ResetInfo(VertexIdx);
+        VertexNormals[VertexIdx] = RenderVertices[VertexIdx].GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
+        CellEntries[VertexIdx].CellKey = QuantizeCellKey(VertexNormals[VertexIdx]);
+        CellEntries[VertexIdx].VertexIdx = VertexIdx;
+    });
+
+    // Phase 1: seed vertices that touch a divergent boundary through CSR adjacency. Each vertex writes only its own slot.
+    ParallelFor(VertexCount, [&](int32 VertexIdx)
     {
         const int32 PlateID = GetPlateID(VertexIdx);
         if (PlateID == INDEX_NONE)
         {
-            continue;
+            return;
         }
 
         const FVector3d& VertexNormal = VertexNormals[VertexIdx];
@@ -4933,55 +5604,59 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
         {
             SeedTangents[VertexIdx] = TangentSum.GetSafeNormal();
             SeedOpposingPlate[VertexIdx] = OpposingPlateID;
-            SeedMask[VertexIdx] = true;
+            SeedFlags[VertexIdx] = 1;
         }
-    }
+    });
+
+    // Ties broken by vertex index so each run matches the insertion order of the old buckets.
+    Algo::Sort(CellEntries, [](const FBoundaryCellEntry& A, const FBoundaryCellEntry& B)
+    {
+        return A.CellKey != B.CellKey ? A.CellKey < B.CellKey : A.VertexIdx < B.VertexIdx;
+    });
 
-    TArray<FIntVector> BucketKeys;
-    PositionBuckets.GenerateKeyArray(BucketKeys);
-    BucketKeys.Sort([](const FIntVector& A, const FIntVector& B)
+    TArray<int32> SharedCellRunStarts;
+    for (int32 EntryIdx = 0; EntryIdx + 1 < VertexCount; )
     {
-        if (A.X != B.X)
+        int32 RunEnd = EntryIdx + 1;
+        while (RunEnd < VertexCount && CellEntries[RunEnd].CellKey == CellEntries[EntryIdx].CellKey)
         {
-            return A.X < B.X;
+            ++RunEnd;
         }
-        if (A.Y != B.Y)
+
+        if (RunEnd - EntryIdx >= 2)
         {
-            return A.Y < B.Y;
+            SharedCellRunStarts.Add(EntryIdx);
         }
-        return A.Z < B.Z;
-    });
+        EntryIdx = RunEnd;
+    }
 
-    for (const FIntVector& BucketKey : BucketKeys)
+    // Copy seeds across coincident vertices on opposite plates. Runs are disjoint, so they can be processed independently.
+    ParallelFor(SharedCellRunStarts.Num(), [&](int32 RunIdx)
     {
-        const TArray<int32>* BucketVerticesPtr = PositionBuckets.Find(BucketKey);
-        if (!BucketVerticesPtr)
+        const int32 RunStart = SharedCellRunStarts[RunIdx];
+        int32 RunEnd = RunStart + 1;
+        while (RunEnd < VertexCount && CellEntries[RunEnd].CellKey == CellEntries[RunStart].CellKey)
         {
-            continue;
-        }
-        const TArray<int32>& BucketVertices = *BucketVerticesPtr;
-        if (BucketVertices.Num() < 2)
-        {
-            continue;
+            ++RunEnd;
         }
 
-        for (int32 IndexA = 0; IndexA < BucketVertices.Num(); ++IndexA)
+        for (int32 IndexA = RunStart; IndexA < RunEnd; ++IndexA)
         {
-            const int32 VertexA = BucketVertices[IndexA];
+            const int32 VertexA = CellEntries[IndexA].VertexIdx;
             const int32 PlateA = GetPlateID(VertexA);
             if (PlateA == INDEX_NONE)
             {
                 continue;
             }
 
-            for (int32 IndexB = 0; IndexB < BucketVertices.Num(); ++IndexB)
+            for (int32 IndexB = RunStart; IndexB < RunEnd; ++IndexB)
             {
                 if (IndexA == IndexB)
                 {
                     continue;
                 }
 
-                const int32 VertexB = BucketVertices[IndexB];
+                const int32 VertexB = CellEntries[IndexB].VertexIdx;
                 const int32 PlateB = GetPlateID(VertexB);
                 if (PlateB == INDEX_NONE || PlateA == PlateB)
                 {
@@ -4994,14 +5669,32 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
                     continue;
                 }
 
-                if (SeedMask[VertexA] && !SeedMask[VertexB] && !SeedTangents[VertexA].IsNearlyZero())
+                if (SeedFlags[VertexA] && !SeedFlags[VertexB] && !SeedTangents[VertexA].IsNearlyZero())
                 {
-                    SeedMask[VertexB] = true;
+                    SeedFlags[VertexB] = 1;
                     SeedTangents[VertexB] = SeedTangents[VertexA];
                     SeedOpposingPlate[VertexB] = PlateA;
                 }
             }
         }
+    });
+
+    // Phase 2: propagation never crosses a plate boundary, so each plate's multi-source Dijkstra runs as its own task.
+    int32 MaxPlateID = INDEX_NONE;
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        MaxPlateID = FMath::Max(MaxPlateID, GetPlateID(VertexIdx));
+    }
+
+    TArray<TArray<int32>> PlateSeedVertices;
+    PlateSeedVertices.SetNum(MaxPlateID + 1);
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        const int32 PlateID = GetPlateID(VertexIdx);
+        if (SeedFlags[VertexIdx] && PlateID != INDEX_NONE)
+        {
+            PlateSeedVertices[PlateID].Add(VertexIdx);
+        }
     }
 
     struct FPropagationNode
@@ -5014,90 +5707,44 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
         bool bIsDivergent = false;
     };
 
-    struct FPropagationCompare
+    struct FPropagationLess
     {
         bool operator()(const FPropagationNode& A, const FPropagationNode& B) const
         {
-            return A.Distance > B.Distance;
+            return A.Distance != B.Distance ? A.Distance < B.Distance : A.VertexIdx < B.VertexIdx;
         }
     };
 
-    std::priority_queue<FPropagationNode, std::vector<FPropagationNode>, FPropagationCompare> Frontier;
-
     TArray<double> Distance;
     Distance.Init(TNumericLimits<double>::Max(), VertexCount);
+    TArray<uint8> BeyondInfluenceFlags;
+    BeyondInfluenceFlags.SetNumZeroed(VertexCount);
 
-    auto AddBoundarySeed = [&](int32 VertexIdx, int32 PlateID, int32 OpposingPlateID, const FVector3d& Tangent)
+    const double SmallNumber = 1e-8;
+    const double InfluenceRadians = FMath::Max(Parameters.RidgeBoundaryInfluenceRadians, 0.0);
+    const double MaxPropagationRadians = InfluenceRadians > UE_DOUBLE_SMALL_NUMBER ? InfluenceRadians : TNumericLimits<double>::Max();
+
+    auto ParallelTransportTangent = [](const FVector3d& Tangent, const FVector3d& FromNormal, const FVector3d& ToNormal)
     {
-        if (!RenderVertices.IsValidIndex(VertexIdx))
+        if (Tangent.IsNearlyZero() || FromNormal.IsNearlyZero() || ToNormal.IsNearlyZero())
         {
-            return;
+            return Tangent;
         }
 
-        if (PlateID == INDEX_NONE)
+        const double CosTheta = FMath::Clamp(FromNormal | ToNormal, -1.0, 1.0);
+        const double Angle = FMath::Acos(CosTheta);
+
+        if (!FMath::IsFinite(Angle) || Angle < UE_DOUBLE_SMALL_NUMBER)
         {
-            return;
+            FVector3d Projected = Tangent - (Tangent | ToNormal) * ToNormal;
+            return Projected.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, Tangent);
         }
 
-        const FVector3d NormalizedTangent = Tangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-        if (NormalizedTangent.IsNearlyZero())
+        FVector3d Axis = FVector3d::CrossProduct(FromNormal, ToNormal);
+        if (!Axis.Normalize())
         {
-            return;
-        }
-
-        FRenderVertexBoundaryInfo& Info = RenderVertexBoundaryCache[VertexIdx];
-        Info.bHasBoundary = true;
-        Info.bIsDivergent = true;
-        Info.SourcePlateID = PlateID;
-        Info.OpposingPlateID = OpposingPlateID;
-        Info.BoundaryTangent = NormalizedTangent;
-        Info.DistanceRadians = 0.0f;
-
-        Distance[VertexIdx] = 0.0;
-
-        FPropagationNode Node;
-        Node.VertexIdx = VertexIdx;
-        Node.Distance = 0.0;
-        Node.SourcePlateID = PlateID;
-        Node.OpposingPlateID = OpposingPlateID;
-        Node.Tangent = NormalizedTangent;
-        Node.bIsDivergent = true;
-        Frontier.push(Node);
-    };
-
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-    {
-        if (!SeedMask[VertexIdx])
-        {
-            continue;
-        }
-
-        AddBoundarySeed(VertexIdx, GetPlateID(VertexIdx), SeedOpposingPlate[VertexIdx], SeedTangents[VertexIdx]);
-    }
-
-    const double SmallNumber = 1e-8;
-
-    auto ParallelTransportTangent = [](const FVector3d& Tangent, const FVector3d& FromNormal, const FVector3d& ToNormal)
-    {
-        if (Tangent.IsNearlyZero() || FromNormal.IsNearlyZero() || ToNormal.IsNearlyZero())
-        {
-            return Tangent;
-        }
-
-        const double CosTheta = FMath::Clamp(FromNormal | ToNormal, -1.0, 1.0);
-        const double Angle = FMath::Acos(CosTheta);
-
-        if (!FMath::IsFinite(Angle) || Angle < UE_DOUBLE_SMALL_NUMBER)
-        {
-            FVector3d Projected = Tangent - (Tangent | ToNormal) * ToNormal;
-            return Projected.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, Tangent);
-        }
-
-        FVector3d Axis = FVector3d::CrossProduct(FromNormal, ToNormal);
-        if (!Axis.Normalize())
-        {
-            FVector3d Projected = Tangent - (Tangent | ToNormal) * ToNormal;
-            return Projected.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, Tangent);
+            FVector3d Projected = Tangent - (Tangent | ToNormal) * ToNormal;
+            return Projected.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, Tangent);
         }
 
         const double SinTheta = FMath::Sin(Angle);
@@ -5111,90 +5758,154 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
         return Projected.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, Rotated);
     };
 
-    while (!Frontier.empty())
+    ParallelFor(PlateSeedVertices.Num(), [&](int32 PlateID)
     {
-        const FPropagationNode Current = Frontier.top();
-        Frontier.pop();
-
-        if (Current.VertexIdx < 0 || Current.VertexIdx >= VertexCount)
-        {
-            continue;
-        }
-
-        if (Current.Distance > Distance[Current.VertexIdx] + SmallNumber)
+        const TArray<int32>& Seeds = PlateSeedVertices[PlateID];
+        if (Seeds.Num() == 0)
         {
-            continue;
-        }
-
-        const int32 CurrentPlateID = GetPlateID(Current.VertexIdx);
-        if (CurrentPlateID != Current.SourcePlateID)
-        {
-            continue;
+            return;
         }
 
-        const int32 Start = RenderVertexAdjacencyOffsets[Current.VertexIdx];
-        const int32 End = RenderVertexAdjacencyOffsets[Current.VertexIdx + 1];
-        const FVector3d& CurrentNormal = VertexNormals[Current.VertexIdx];
+        TArray<FPropagationNode> Frontier;
+        Frontier.Reserve(Seeds.Num() * 4);
+        TArray<int32> Pruned;
 
-        for (int32 Offset = Start; Offset < End; ++Offset)
+        for (const int32 SeedIdx : Seeds)
         {
-            const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
-            if (!RenderVertices.IsValidIndex(NeighborIdx))
+            const FVector3d NormalizedTangent = SeedTangents[SeedIdx].GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+            if (NormalizedTangent.IsNearlyZero())
             {
                 continue;
             }
 
-            if (GetPlateID(NeighborIdx) != CurrentPlateID)
+            FRenderVertexBoundaryInfo& Info = RenderVertexBoundaryCache[SeedIdx];
+            Info.bHasBoundary = true;
+            Info.bIsDivergent = true;
+            Info.SourcePlateID = PlateID;
+            Info.OpposingPlateID = SeedOpposingPlate[SeedIdx];
+            Info.BoundaryTangent = NormalizedTangent;
+            Info.DistanceRadians = 0.0f;
+
+            Distance[SeedIdx] = 0.0;
+
+            FPropagationNode Node;
+            Node.VertexIdx = SeedIdx;
+            Node.Distance = 0.0;
+            Node.SourcePlateID = PlateID;
+            Node.OpposingPlateID = SeedOpposingPlate[SeedIdx];
+            Node.Tangent = NormalizedTangent;
+            Node.bIsDivergent = true;
+            Frontier.HeapPush(Node, FPropagationLess());
+        }
+
+        while (Frontier.Num() > 0)
+        {
+            FPropagationNode Current;
+            Frontier.HeapPop(Current, FPropagationLess(), EAllowShrinking::No);
+
+            if (Current.Distance > Distance[Current.VertexIdx] + SmallNumber)
             {
                 continue;
             }
 
-            const FVector3d& NeighborNormal = VertexNormals[NeighborIdx];
-            double EdgeCost = FMath::Acos(FMath::Clamp(CurrentNormal | NeighborNormal, -1.0, 1.0));
-            if (!FMath::IsFinite(EdgeCost))
+            const int32 Start = RenderVertexAdjacencyOffsets[Current.VertexIdx];
+            const int32 End = RenderVertexAdjacencyOffsets[Current.VertexIdx + 1];
+            const FVector3d& CurrentNormal = VertexNormals[Current.VertexIdx];
+
+            for (int32 Offset = Start; Offset < End; ++Offset)
             {
-                EdgeCost = 0.0;
+                const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
+                if (!RenderVertices.IsValidIndex(NeighborIdx))
+                {
+                    continue;
+                }
+
+                if (GetPlateID(NeighborIdx) != PlateID)
+                {
+                    continue;
+                }
+
+                const FVector3d& NeighborNormal = VertexNormals[NeighborIdx];
+                double EdgeCost = FMath::Acos(FMath::Clamp(CurrentNormal | NeighborNormal, -1.0, 1.0));
+                if (!FMath::IsFinite(EdgeCost))
+                {
+                    EdgeCost = 0.0;
+                }
+
+                const double NewDistance = Current.Distance + EdgeCost;
+                if (NewDistance > MaxPropagationRadians)
+                {
+                    Pruned.Add(NeighborIdx);
+                    continue;
+                }
+
+                if (NewDistance + SmallNumber >= Distance[NeighborIdx])
+                {
+                    continue;
+                }
+
+                Distance[NeighborIdx] = NewDistance;
+
+                FRenderVertexBoundaryInfo& NeighborInfo = RenderVertexBoundaryCache[NeighborIdx];
+                NeighborInfo.bHasBoundary = true;
+                NeighborInfo.bIsDivergent = Current.bIsDivergent;
+                NeighborInfo.SourcePlateID = Current.SourcePlateID;
+                NeighborInfo.OpposingPlateID = Current.OpposingPlateID;
+
+                FVector3d TransportedTangent = Current.Tangent;
+                if (!TransportedTangent.IsNearlyZero())
+                {
+                    TransportedTangent = ParallelTransportTangent(Current.Tangent, CurrentNormal, NeighborNormal);
+                }
+
+                NeighborInfo.BoundaryTangent = TransportedTangent;
+                NeighborInfo.DistanceRadians = static_cast<float>(NewDistance);
+
+                FPropagationNode Next = Current;
+                Next.VertexIdx = NeighborIdx;
+                Next.Distance = NewDistance;
+                Next.Tangent = TransportedTangent;
+                Frontier.HeapPush(Next, FPropagationLess());
             }
+        }
 
-            const double NewDistance = Current.Distance + EdgeCost;
-            if (NewDistance + SmallNumber >= Distance[NeighborIdx])
+        // Flood the rest of the plate past the radius with a plain BFS (no acos, no transport) so Stage B can
+        // tell these vertices apart from plates that have no divergent boundary at all.
+        for (int32 Cursor = 0; Cursor < Pruned.Num(); ++Cursor)
+        {
+            const int32 PrunedIdx = Pruned[Cursor];
+            if (BeyondInfluenceFlags[PrunedIdx] || Distance[PrunedIdx] < TNumericLimits<double>::Max())
             {
                 continue;
             }
 
-            Distance[NeighborIdx] = NewDistance;
-
-            FRenderVertexBoundaryInfo& NeighborInfo = RenderVertexBoundaryCache[NeighborIdx];
-            NeighborInfo.bHasBoundary = true;
-            NeighborInfo.bIsDivergent = Current.bIsDivergent;
-            NeighborInfo.SourcePlateID = Current.SourcePlateID;
-            NeighborInfo.OpposingPlateID = Current.OpposingPlateID;
-
-            FVector3d TransportedTangent = Current.Tangent;
-            if (!TransportedTangent.IsNearlyZero())
+            BeyondInfluenceFlags[PrunedIdx] = 1;
+            const int32 Start = RenderVertexAdjacencyOffsets[PrunedIdx];
+            const int32 End = RenderVertexAdjacencyOffsets[PrunedIdx + 1];
+            for (int32 Offset = Start; Offset < End; ++Offset)
             {
-                TransportedTangent = ParallelTransportTangent(Current.Tangent, CurrentNormal, NeighborNormal);
+                const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
+                if (RenderVertices.IsValidIndex(NeighborIdx) && GetPlateID(NeighborIdx) == PlateID &&
+                    !BeyondInfluenceFlags[NeighborIdx] && Distance[NeighborIdx] == TNumericLimits<double>::Max())
+                {
+                    Pruned.Add(NeighborIdx);
+                }
             }
-
-            NeighborInfo.BoundaryTangent = TransportedTangent;
-            NeighborInfo.DistanceRadians = static_cast<float>(NewDistance);
-
-            FPropagationNode Next = Current;
-            Next.VertexIdx = NeighborIdx;
-            Next.Distance = NewDistance;
-            Next.Tangent = TransportedTangent;
-            Frontier.push(Next);
         }
-    }
+    }, EParallelForFlags::Unbalanced);
 
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    ParallelFor(VertexCount, [&](int32 VertexIdx)
     {
         const FRenderVertexBoundaryInfo& Info = RenderVertexBoundaryCache[VertexIdx];
         if (!Info.bHasBoundary || !Info.bIsDivergent)
         {
             ResetInfo(VertexIdx);
+            RenderVertexBoundaryCache[VertexIdx].bBeyondInfluence = BeyondInfluenceFlags[VertexIdx] != 0;
         }
-    }
+    });
+
+    LastBoundaryCacheBuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+    StepBoundaryCacheBuildMs += LastBoundaryCacheBuildMs;
 
 #if UE_BUILD_DEVELOPMENT
     int32 DivergentCount = 0;
@@ -5207,8 +5918,11 @@ void UTectonicSimulationService::BuildRenderVertexBoundaryCache()
     }
 
     UE_LOG(LogPlanetaryCreation, Log,
-        TEXT("[BoundaryCache] Divergent boundary tangents assigned to %d/%d vertices"),
-        DivergentCount, VertexCount);
+        TEXT("[BoundaryCache] Divergent boundary tangents assigned to %d/%d vertices (seeds=%d, shared cells=%d, %.2f ms)"),
+        DivergentCount, VertexCount,
+        Algo::CountIf(SeedFlags, [](uint8 Flag) { return Flag != 0; }),
+        SharedCellRunStarts.Num(),
+        LastBoundaryCacheBuildMs);
 #endif
 }
 
@@ -5345,44 +6059,45 @@ void UTectonicSimulationService::UpdateConvergentNeighborFlags()
 
     for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
     {
-        const int32 PlateA = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
-        if (PlateA == INDEX_NONE)
-        {
-            continue;
-        }
+        ConvergentNeighborFlags[VertexIdx] = ComputeConvergentNeighborFlag(VertexIdx);
+    }
+}
+
+uint8 UTectonicSimulationService::ComputeConvergentNeighborFlag(int32 VertexIdx) const
+{
+    const int32 PlateA = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
+    if (PlateA == INDEX_NONE || !RenderVertexAdjacencyOffsets.IsValidIndex(VertexIdx + 1))
+    {
+        return 0;
+    }
 
-        const int32 StartOffset = RenderVertexAdjacencyOffsets.IsValidIndex(VertexIdx) ? RenderVertexAdjacencyOffsets[VertexIdx] : INDEX_NONE;
-        const int32 EndOffset = RenderVertexAdjacencyOffsets.IsValidIndex(VertexIdx + 1) ? RenderVertexAdjacencyOffsets[VertexIdx + 1] : INDEX_NONE;
+    const int32 StartOffset = RenderVertexAdjacencyOffsets[VertexIdx];
+    const int32 EndOffset = RenderVertexAdjacencyOffsets[VertexIdx + 1];
+
+    for (int32 Offset = StartOffset; Offset < EndOffset; ++Offset)
+    {
+        const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
+        const int32 PlateB = VertexPlateAssignments.IsValidIndex(NeighborIdx) ? VertexPlateAssignments[NeighborIdx] : INDEX_NONE;
 
-        if (!RenderVertexAdjacencyOffsets.IsValidIndex(VertexIdx + 1))
+        if (PlateB == INDEX_NONE || PlateA == PlateB)
         {
             continue;
         }
 
-        for (int32 Offset = StartOffset; Offset < EndOffset; ++Offset)
-        {
-            const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
-            const int32 PlateB = VertexPlateAssignments.IsValidIndex(NeighborIdx) ? VertexPlateAssignments[NeighborIdx] : INDEX_NONE;
-
-            if (PlateB == INDEX_NONE || PlateA == PlateB)
-            {
-                continue;
-            }
-
-            const TPair<int32, int32> BoundaryKey = (PlateA < PlateB)
-                ? TPair<int32, int32>(PlateA, PlateB)
-                : TPair<int32, int32>(PlateB, PlateA);
+        const TPair<int32, int32> BoundaryKey = (PlateA < PlateB)
+            ? TPair<int32, int32>(PlateA, PlateB)
+            : TPair<int32, int32>(PlateB, PlateA);
 
-            if (const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey))
+        if (const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey))
+        {
+            if (Boundary->BoundaryType == EBoundaryType::Convergent)
             {
-                if (Boundary->BoundaryType == EBoundaryType::Convergent)
-                {
-                    ConvergentNeighborFlags[VertexIdx] = 1;
-                    break;
-                }
+                return 1;
             }
         }
     }
+
+    return 0;
 }
 
 void UTectonicSimulationService::ComputeVelocityField()
@@ -5426,6 +6141,11 @@ void UTectonicSimulationService::ComputeVelocityField()
 }
 
 void UTectonicSimulationService::UpdateBoundaryStress(double DeltaTimeMy)
+{
+    SweepBoundaries(FPlateBoundaryTable::StageStress, DeltaTimeMy);
+}
+
+void UTectonicSimulationService::AccumulateBoundaryStress(FPlateBoundary& Boundary, double DeltaTimeMy) const
 {
     // Milestone 3 Task 2.3: COSMETIC STRESS VISUALIZATION (simplified model)
     // NOT physically accurate - for visual effect only
@@ -5433,41 +6153,36 @@ void UTectonicSimulationService::UpdateBoundaryStress(double DeltaTimeMy)
     constexpr double MaxStressMPa = 100.0; // Cap at 100 MPa (~10km elevation equivalent)
     constexpr double DecayTimeConstant = 10.0; // τ = 10 My for exponential decay
 
-    for (auto& BoundaryPair : Boundaries)
+    switch (Boundary.BoundaryType)
     {
-        FPlateBoundary& Boundary = BoundaryPair.Value;
-
-        switch (Boundary.BoundaryType)
+    case EBoundaryType::Convergent:
+        // Convergent: accumulate stress based on relative velocity
+        // Stress += relativeVelocity × ΔT (simplified linear model)
+        // relativeVelocity is in rad/My, convert to stress units
         {
-        case EBoundaryType::Convergent:
-            // Convergent: accumulate stress based on relative velocity
-            // Stress += relativeVelocity × ΔT (simplified linear model)
-            // relativeVelocity is in rad/My, convert to stress units
-            {
-                const double StressRate = Boundary.RelativeVelocity * 1000.0; // Arbitrary scaling for visualization
-                Boundary.AccumulatedStress += StressRate * DeltaTimeMy;
-                Boundary.AccumulatedStress = FMath::Min(Boundary.AccumulatedStress, MaxStressMPa);
-            }
-            break;
+            const double StressRate = Boundary.RelativeVelocity * 1000.0; // Arbitrary scaling for visualization
+            Boundary.AccumulatedStress += StressRate * DeltaTimeMy;
+            Boundary.AccumulatedStress = FMath::Min(Boundary.AccumulatedStress, MaxStressMPa);
+        }
+        break;
 
-        case EBoundaryType::Divergent:
-            // Divergent: exponential decay toward zero
-            // S(t) = S₀ × exp(-Δt/τ)
-            {
-                const double DecayFactor = FMath::Exp(-DeltaTimeMy / DecayTimeConstant);
-                Boundary.AccumulatedStress *= DecayFactor;
-            }
-            break;
+    case EBoundaryType::Divergent:
+        // Divergent: exponential decay toward zero
+        // S(t) = S₀ × exp(-Δt/τ)
+        {
+            const double DecayFactor = FMath::Exp(-DeltaTimeMy / DecayTimeConstant);
+            Boundary.AccumulatedStress *= DecayFactor;
+        }
+        break;
 
-        case EBoundaryType::Transform:
-            // Transform: minimal accumulation (small fraction of convergent rate)
-            {
-                const double StressRate = Boundary.RelativeVelocity * 100.0; // 10x less than convergent
-                Boundary.AccumulatedStress += StressRate * DeltaTimeMy;
-                Boundary.AccumulatedStress = FMath::Min(Boundary.AccumulatedStress, MaxStressMPa * 0.5); // Lower cap
-            }
-            break;
+    case EBoundaryType::Transform:
+        // Transform: minimal accumulation (small fraction of convergent rate)
+        {
+            const double StressRate = Boundary.RelativeVelocity * 100.0; // 10x less than convergent
+            Boundary.AccumulatedStress += StressRate * DeltaTimeMy;
+            Boundary.AccumulatedStress = FMath::Min(Boundary.AccumulatedStress, MaxStressMPa * 0.5); // Lower cap
         }
+        break;
     }
 }
 
@@ -5687,12 +6402,7 @@ void UTectonicSimulationService::CaptureHistorySnapshot()
     Snapshot.CurrentTimeMy = CurrentTimeMy;
     Snapshot.Plates = Plates;
     Snapshot.SharedVertices = SharedVertices;
-    Snapshot.RenderVertices = RenderVertices;
     Snapshot.RenderTriangles = RenderTriangles;
-    Snapshot.VertexPlateAssignments = VertexPlateAssignments;
-    Snapshot.VertexVelocities = VertexVelocities;
-    Snapshot.VertexStressValues = VertexStressValues;
-    Snapshot.VertexTemperatureValues = VertexTemperatureValues;
     Snapshot.Boundaries = Boundaries;
     Snapshot.TopologyEvents = TopologyEvents;
     Snapshot.Hotspots = Hotspots;
@@ -5700,22 +6410,15 @@ void UTectonicSimulationService::CaptureHistorySnapshot()
     Snapshot.TopologyVersion = TopologyVersion;
     Snapshot.SurfaceDataVersion = SurfaceDataVersion;
 
-    // Milestone 5: Capture erosion state
-    Snapshot.VertexElevationValues = VertexElevationValues;
-    Snapshot.VertexErosionRates = VertexErosionRates;
-    Snapshot.VertexSedimentThickness = VertexSedimentThickness;
-    Snapshot.VertexCrustAge = VertexCrustAge;
+    // Per-vertex state (positions, erosion, ridge/fold caches) in one parallel column copy
+    RenderVertexColumns.CaptureSnapshot(Snapshot.VertexColumns, ERenderVertexColumnFlags::History);
 
     // Milestone 6: Capture terrane state
     Snapshot.Terranes = Terranes;
     Snapshot.NextTerraneID = NextTerraneID;
-    Snapshot.VertexRidgeDirections = VertexRidgeDirections;
-    Snapshot.VertexFoldDirection = VertexFoldDirection;
-    Snapshot.VertexOrogenyClass = VertexOrogenyClass;
-    Snapshot.RenderVertexBoundaryCache = RenderVertexBoundaryCache;
 
     // Add to stack
-    HistoryStack.Add(Snapshot);
+    HistoryStack.Add(MoveTemp(Snapshot));
     CurrentHistoryIndex = HistoryStack.Num() - 1;
 
     // Enforce max history size (sliding window)
@@ -5732,12 +6435,9 @@ void UTectonicSimulationService::CaptureHistorySnapshot()
 
 void UTectonicSimulationService::RestoreRidgeCacheFromSnapshot(const FSimulationHistorySnapshot& Snapshot)
 {
-    const int32 VertexCount = Snapshot.RenderVertices.Num();
-
-    VertexRidgeDirections = Snapshot.VertexRidgeDirections;
-    VertexFoldDirection = Snapshot.VertexFoldDirection;
-    VertexOrogenyClass = Snapshot.VertexOrogenyClass;
-    RenderVertexBoundaryCache = Snapshot.RenderVertexBoundaryCache;
+    // Ridge/fold/orogeny/boundary columns were restored with the rest of Snapshot.VertexColumns.
+    const int32 VertexCount = Snapshot.VertexColumns.VertexCount;
+    ++RenderVertexBoundaryCacheSerial;
 
     EnsureRidgeDirtyMaskSize(VertexCount);
 
@@ -5810,54 +6510,54 @@ void UTectonicSimulationService::RestoreRidgeCacheFromSnapshot(const FSimulation
     LastRidgeMotionFallbackCount = 0;
 }
 
-bool UTectonicSimulationService::Undo()
+void UTectonicSimulationService::RestoreHistorySnapshot(int32 Index)
 {
-    if (!CanUndo())
-    {
-        UE_LOG(LogPlanetaryCreation, Warning, TEXT("Undo: No previous state available"));
-        return false;
-    }
-
-    CurrentHistoryIndex--;
-    const FSimulationHistorySnapshot& Snapshot = HistoryStack[CurrentHistoryIndex];
+    const FSimulationHistorySnapshot& Snapshot = HistoryStack[Index];
 
     // Restore state from snapshot
     CurrentTimeMy = Snapshot.CurrentTimeMy;
     Plates = Snapshot.Plates;
     SharedVertices = Snapshot.SharedVertices;
-    RenderVertices = Snapshot.RenderVertices;
     RenderTriangles = Snapshot.RenderTriangles;
-    VertexPlateAssignments = Snapshot.VertexPlateAssignments;
-    CachedVoronoiAssignments = VertexPlateAssignments;
-    VertexVelocities = Snapshot.VertexVelocities;
-    VertexStressValues = Snapshot.VertexStressValues;
-    VertexTemperatureValues = Snapshot.VertexTemperatureValues;
     Boundaries = Snapshot.Boundaries;
+    InvalidatePlateMetadata();
     TopologyEvents = Snapshot.TopologyEvents;
     Hotspots = Snapshot.Hotspots;
     InitialPlateCentroids = Snapshot.InitialPlateCentroids;
     TopologyVersion = Snapshot.TopologyVersion;
     SurfaceDataVersion = Snapshot.SurfaceDataVersion;
 
-    // Milestone 5: Restore erosion state
-    VertexElevationValues = Snapshot.VertexElevationValues;
-    VertexErosionRates = Snapshot.VertexErosionRates;
-    VertexSedimentThickness = Snapshot.VertexSedimentThickness;
-    VertexCrustAge = Snapshot.VertexCrustAge;
+    RenderVertexColumns.RestoreSnapshot(Snapshot.VertexColumns);
+    CachedVoronoiAssignments = VertexPlateAssignments;
 
     // Milestone 6: Restore terrane state
     Terranes = Snapshot.Terranes;
     NextTerraneID = Snapshot.NextTerraneID;
 
-    UE_LOG(LogPlanetaryCreation, Log, TEXT("Undo: Restored snapshot %d (%.1f My)"),
-        CurrentHistoryIndex, CurrentTimeMy);
     RestoreRidgeCacheFromSnapshot(Snapshot);
     BumpOceanicAmplificationSerial();
+}
+
+bool UTectonicSimulationService::Undo()
+{
+    FScopeLock StateLock(&SimulationStateLock);
+    if (!CanUndo())
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("Undo: No previous state available"));
+        return false;
+    }
+
+    CurrentHistoryIndex--;
+    RestoreHistorySnapshot(CurrentHistoryIndex);
+
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("Undo: Restored snapshot %d (%.1f My)"),
+        CurrentHistoryIndex, CurrentTimeMy);
     return true;
 }
 
 bool UTectonicSimulationService::Redo()
 {
+    FScopeLock StateLock(&SimulationStateLock);
     if (!CanRedo())
     {
         UE_LOG(LogPlanetaryCreation, Warning, TEXT("Redo: No future state available"));
@@ -5865,45 +6565,16 @@ bool UTectonicSimulationService::Redo()
     }
 
     CurrentHistoryIndex++;
-    const FSimulationHistorySnapshot& Snapshot = HistoryStack[CurrentHistoryIndex];
-
-    // Restore state from snapshot
-    CurrentTimeMy = Snapshot.CurrentTimeMy;
-    Plates = Snapshot.Plates;
-    SharedVertices = Snapshot.SharedVertices;
-    RenderVertices = Snapshot.RenderVertices;
-    RenderTriangles = Snapshot.RenderTriangles;
-    VertexPlateAssignments = Snapshot.VertexPlateAssignments;
-    CachedVoronoiAssignments = VertexPlateAssignments;
-    VertexVelocities = Snapshot.VertexVelocities;
-    VertexStressValues = Snapshot.VertexStressValues;
-    VertexTemperatureValues = Snapshot.VertexTemperatureValues;
-    Boundaries = Snapshot.Boundaries;
-    TopologyEvents = Snapshot.TopologyEvents;
-    Hotspots = Snapshot.Hotspots;
-    InitialPlateCentroids = Snapshot.InitialPlateCentroids;
-    TopologyVersion = Snapshot.TopologyVersion;
-    SurfaceDataVersion = Snapshot.SurfaceDataVersion;
-
-    // Milestone 5: Restore erosion state
-    VertexElevationValues = Snapshot.VertexElevationValues;
-    VertexErosionRates = Snapshot.VertexErosionRates;
-    VertexSedimentThickness = Snapshot.VertexSedimentThickness;
-    VertexCrustAge = Snapshot.VertexCrustAge;
-
-    // Milestone 6: Restore terrane state
-    Terranes = Snapshot.Terranes;
-    NextTerraneID = Snapshot.NextTerraneID;
+    RestoreHistorySnapshot(CurrentHistoryIndex);
 
     UE_LOG(LogPlanetaryCreation, Log, TEXT("Redo: Restored snapshot %d (%.1f My)"),
         CurrentHistoryIndex, CurrentTimeMy);
-    RestoreRidgeCacheFromSnapshot(Snapshot);
-    BumpOceanicAmplificationSerial();
     return true;
 }
 
 bool UTectonicSimulationService::JumpToHistoryIndex(int32 Index)
 {
+    FScopeLock StateLock(&SimulationStateLock);
     if (!HistoryStack.IsValidIndex(Index))
     {
         UE_LOG(LogPlanetaryCreation, Warning, TEXT("JumpToHistoryIndex: Invalid index %d (stack size %d)"),
@@ -5912,40 +6583,10 @@ bool UTectonicSimulationService::JumpToHistoryIndex(int32 Index)
     }
 
     CurrentHistoryIndex = Index;
-    const FSimulationHistorySnapshot& Snapshot = HistoryStack[CurrentHistoryIndex];
-
-    // Restore state from snapshot
-    CurrentTimeMy = Snapshot.CurrentTimeMy;
-    Plates = Snapshot.Plates;
-    SharedVertices = Snapshot.SharedVertices;
-    RenderVertices = Snapshot.RenderVertices;
-    RenderTriangles = Snapshot.RenderTriangles;
-    VertexPlateAssignments = Snapshot.VertexPlateAssignments;
-    CachedVoronoiAssignments = VertexPlateAssignments;
-    VertexVelocities = Snapshot.VertexVelocities;
-    VertexStressValues = Snapshot.VertexStressValues;
-    VertexTemperatureValues = Snapshot.VertexTemperatureValues;
-    Boundaries = Snapshot.Boundaries;
-    TopologyEvents = Snapshot.TopologyEvents;
-    Hotspots = Snapshot.Hotspots;
-    InitialPlateCentroids = Snapshot.InitialPlateCentroids;
-    TopologyVersion = Snapshot.TopologyVersion;
-    SurfaceDataVersion = Snapshot.SurfaceDataVersion;
-
-    // Milestone 5: Restore erosion state
-    VertexElevationValues = Snapshot.VertexElevationValues;
-    VertexErosionRates = Snapshot.VertexErosionRates;
-    VertexSedimentThickness = Snapshot.VertexSedimentThickness;
-    VertexCrustAge = Snapshot.VertexCrustAge;
-
-    // Milestone 6: Restore terrane state
-    Terranes = Snapshot.Terranes;
-    NextTerraneID = Snapshot.NextTerraneID;
+    RestoreHistorySnapshot(CurrentHistoryIndex);
 
     UE_LOG(LogPlanetaryCreation, Log, TEXT("JumpToHistoryIndex: Jumped to snapshot %d (%.1f My)"),
         CurrentHistoryIndex, CurrentTimeMy);
-    RestoreRidgeCacheFromSnapshot(Snapshot);
-    BumpOceanicAmplificationSerial();
     return true;
 }
 
@@ -6159,6 +6800,15 @@ void UTectonicSimulationService::InvalidateRenderVertexCaches()
     RenderVertexReverseAdjacency.Reset();
     ConvergentNeighborFlags.Reset();
 
+    InvalidateRenderVertexDerivedCaches();
+}
+
+void UTectonicSimulationService::InvalidateRenderVertexDerivedCaches()
+{
+    RenderVertexTriangleOffsets.Reset();
+    RenderVertexTriangles.Reset();
+    RenderVertexTriangleIncidenceTopologyVersion = INDEX_NONE;
+
     PendingCrustAgeResetSeeds.Reset();
     PendingCrustAgeResetMask.Init(false, RenderVertices.Num());
 
@@ -6194,6 +6844,7 @@ int32 UTectonicSimulationService::AppendRenderVertexFromRecord(const FTerraneVer
     AppendIfSized(VertexCrustAge, Record.CrustAge);
     AppendIfSized(VertexAmplifiedElevation, Record.AmplifiedElevation);
     AppendIfSized(VertexRidgeDirections, Record.RidgeDirection);
+    RenderVertexColumns.MarkAllColumnsChanged();
 
     if (VertexPlateAssignments.Num() == NewIndex)
     {
@@ -6239,89 +6890,8 @@ void UTectonicSimulationService::CompactRenderVertexData(const TArray<int32>& Ve
         }
     }
 
-    const int32 KeptReserve = FMath::Max(OriginalCount - VerticesToRemove.Num(), 0);
-
-    TArray<FVector3d> NewRenderVertices;
-    NewRenderVertices.Reserve(KeptReserve);
-
-    const bool bHasVelocities = VertexVelocities.Num() == OriginalCount;
-    const bool bHasStress = VertexStressValues.Num() == OriginalCount;
-    const bool bHasTemperature = VertexTemperatureValues.Num() == OriginalCount;
-    const bool bHasElevation = VertexElevationValues.Num() == OriginalCount;
-    const bool bHasErosion = VertexErosionRates.Num() == OriginalCount;
-    const bool bHasSediment = VertexSedimentThickness.Num() == OriginalCount;
-    const bool bHasCrustAge = VertexCrustAge.Num() == OriginalCount;
-    const bool bHasAmplified = VertexAmplifiedElevation.Num() == OriginalCount;
-    const bool bHasRidgeDir = VertexRidgeDirections.Num() == OriginalCount;
-    const bool bHasAssignments = VertexPlateAssignments.Num() == OriginalCount;
-
-    TArray<FVector3d> NewVelocities; if (bHasVelocities) { NewVelocities.Reserve(KeptReserve); }
-    TArray<double> NewStress; if (bHasStress) { NewStress.Reserve(KeptReserve); }
-    TArray<double> NewTemperature; if (bHasTemperature) { NewTemperature.Reserve(KeptReserve); }
-    TArray<double> NewElevation; if (bHasElevation) { NewElevation.Reserve(KeptReserve); }
-    TArray<double> NewErosion; if (bHasErosion) { NewErosion.Reserve(KeptReserve); }
-    TArray<double> NewSediment; if (bHasSediment) { NewSediment.Reserve(KeptReserve); }
-    TArray<double> NewCrustAge; if (bHasCrustAge) { NewCrustAge.Reserve(KeptReserve); }
-    TArray<double> NewAmplified; if (bHasAmplified) { NewAmplified.Reserve(KeptReserve); }
-    TArray<FVector3d> NewRidgeDir; if (bHasRidgeDir) { NewRidgeDir.Reserve(KeptReserve); }
-    TArray<int32> NewAssignments; if (bHasAssignments) { NewAssignments.Reserve(KeptReserve); }
-
-    for (int32 Index = 0; Index < OriginalCount; ++Index)
-    {
-        if (RemovalMask[Index])
-        {
-            OutOldToNew[Index] = INDEX_NONE;
-            continue;
-        }
-
-        const int32 NewIndex = NewRenderVertices.Num();
-        OutOldToNew[Index] = NewIndex;
-
-        NewRenderVertices.Add(RenderVertices[Index]);
-
-        if (bHasVelocities) { NewVelocities.Add(VertexVelocities[Index]); }
-        if (bHasStress) { NewStress.Add(VertexStressValues[Index]); }
-        if (bHasTemperature) { NewTemperature.Add(VertexTemperatureValues[Index]); }
-        if (bHasElevation) { NewElevation.Add(VertexElevationValues[Index]); }
-        if (bHasErosion) { NewErosion.Add(VertexErosionRates[Index]); }
-        if (bHasSediment) { NewSediment.Add(VertexSedimentThickness[Index]); }
-        if (bHasCrustAge) { NewCrustAge.Add(VertexCrustAge[Index]); }
-        if (bHasAmplified) { NewAmplified.Add(VertexAmplifiedElevation[Index]); }
-        if (bHasRidgeDir) { NewRidgeDir.Add(VertexRidgeDirections[Index]); }
-        if (bHasAssignments) { NewAssignments.Add(VertexPlateAssignments[Index]); }
-    }
-
-    RenderVertices = MoveTemp(NewRenderVertices);
-
-    if (bHasVelocities) { VertexVelocities = MoveTemp(NewVelocities); }
-    else { VertexVelocities.Reset(); }
-
-    if (bHasStress) { VertexStressValues = MoveTemp(NewStress); }
-    else { VertexStressValues.Reset(); }
-
-    if (bHasTemperature) { VertexTemperatureValues = MoveTemp(NewTemperature); }
-    else { VertexTemperatureValues.Reset(); }
-
-    if (bHasElevation) { VertexElevationValues = MoveTemp(NewElevation); }
-    else { VertexElevationValues.Reset(); }
-
-    if (bHasErosion) { VertexErosionRates = MoveTemp(NewErosion); }
-    else { VertexErosionRates.Reset(); }
-
-    if (bHasSediment) { VertexSedimentThickness = MoveTemp(NewSediment); }
-    else { VertexSedimentThickness.Reset(); }
-
-    if (bHasCrustAge) { VertexCrustAge = MoveTemp(NewCrustAge); }
-    else { VertexCrustAge.Reset(); }
-
-    if (bHasAmplified) { VertexAmplifiedElevation = MoveTemp(NewAmplified); }
-    else { VertexAmplifiedElevation.Reset(); }
-
-    if (bHasRidgeDir) { VertexRidgeDirections = MoveTemp(NewRidgeDir); }
-    else { VertexRidgeDirections.Reset(); }
-
-    if (bHasAssignments) { VertexPlateAssignments = MoveTemp(NewAssignments); }
-    else { VertexPlateAssignments.SetNum(RenderVertices.Num()); }
+    // Every Topology column (positions, plate assignments, erosion state, ridge directions, ...) in one pass.
+    RenderVertexColumns.Compact(RemovalMask, OutOldToNew);
     CachedVoronoiAssignments = VertexPlateAssignments;
 }
 
@@ -6427,42 +6997,79 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
     }
 
     FString ValidationError;
-    if (!ValidateTopology(ValidationError))
+    const bool bFullValidation = CVarPlanetaryCreationTerraneSurgeryFullValidation.GetValueOnAnyThread() != 0;
+    if (bFullValidation && !ValidateTopology(ValidationError))
     {
         UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Pre-extraction topology invalid: %s"), *ValidationError);
         return false;
     }
 
+    TRACE_CPUPROFILER_EVENT_SCOPE(ExtractTerrane_Surgery);
+    const double SurgeryStartTime = FPlatformTime::Seconds();
     const int32 SavedNextTerraneID = NextTerraneID;
 
-    TSet<int32> TerraneVertexSet(SortedVertexIndices);
-
-    TArray<FIntVector> InsideTriangles;
-    InsideTriangles.Reserve(RenderTriangles.Num() / 3);
-
-    TArray<int32> RemainingTriangles;
-    RemainingTriangles.Reserve(RenderTriangles.Num());
-
-    for (int32 TriIdx = 0; TriIdx < RenderTriangles.Num(); TriIdx += 3)
+    // Localized surgery: the region is found through the vertex -> triangle incidence of the terrane and its rim,
+    // and nothing is written until the whole plan (hole fill, rim rewrite, local topology check) has succeeded.
+    if (RenderVertexTriangleIncidenceTopologyVersion != TopologyVersion ||
+        RenderVertexTriangleOffsets.Num() != VertexCount + 1 ||
+        RenderVertexTriangles.Num() != RenderTriangles.Num())
     {
-        const int32 A = RenderTriangles[TriIdx];
-        const int32 B = RenderTriangles[TriIdx + 1];
-        const int32 C = RenderTriangles[TriIdx + 2];
-
-        const bool bAIn = TerraneVertexSet.Contains(A);
-        const bool bBIn = TerraneVertexSet.Contains(B);
-        const bool bCIn = TerraneVertexSet.Contains(C);
+        BuildRenderVertexTriangleIncidence();
+    }
 
-        if (bAIn && bBIn && bCIn)
+    auto ForEachIncidentTriangle = [this](int32 VertexIdx, auto&& Func)
+    {
+        for (int32 Offset = RenderVertexTriangleOffsets[VertexIdx]; Offset < RenderVertexTriangleOffsets[VertexIdx + 1]; ++Offset)
         {
-            InsideTriangles.Add(FIntVector(A, B, C));
+            Func(RenderVertexTriangles[Offset]);
         }
-        else
+    };
+
+    auto SortUnique = [](TArray<int32>& Values)
+    {
+        Values.Sort();
+        int32 UniqueCount = 0;
+        for (int32 Index = 0; Index < Values.Num(); ++Index)
         {
-            RemainingTriangles.Add(A);
-            RemainingTriangles.Add(B);
-            RemainingTriangles.Add(C);
+            if (UniqueCount == 0 || Values[UniqueCount - 1] != Values[Index])
+            {
+                Values[UniqueCount++] = Values[Index];
+            }
         }
+        Values.SetNum(UniqueCount);
+    };
+
+    TSet<int32> TerraneVertexSet(SortedVertexIndices);
+
+    auto IsInsideTriangle = [&](int32 TriangleIdx)
+    {
+        return TerraneVertexSet.Contains(RenderTriangles[TriangleIdx * 3]) &&
+            TerraneVertexSet.Contains(RenderTriangles[TriangleIdx * 3 + 1]) &&
+            TerraneVertexSet.Contains(RenderTriangles[TriangleIdx * 3 + 2]);
+    };
+
+    // Each inside triangle is claimed by its lowest corner; sorting keeps the original triangle order.
+    TArray<int32> InsideTriangleIndices;
+    for (int32 VertexIdx : SortedVertexIndices)
+    {
+        ForEachIncidentTriangle(VertexIdx, [&](int32 TriangleIdx)
+        {
+            const int32 A = RenderTriangles[TriangleIdx * 3];
+            const int32 B = RenderTriangles[TriangleIdx * 3 + 1];
+            const int32 C = RenderTriangles[TriangleIdx * 3 + 2];
+            if (FMath::Min3(A, B, C) == VertexIdx && IsInsideTriangle(TriangleIdx))
+            {
+                InsideTriangleIndices.Add(TriangleIdx);
+            }
+        });
+    }
+    InsideTriangleIndices.Sort();
+
+    TArray<FIntVector> InsideTriangles;
+    InsideTriangles.Reserve(InsideTriangleIndices.Num());
+    for (int32 TriangleIdx : InsideTriangleIndices)
+    {
+        InsideTriangles.Add(FIntVector(RenderTriangles[TriangleIdx * 3], RenderTriangles[TriangleIdx * 3 + 1], RenderTriangles[TriangleIdx * 3 + 2]));
     }
 
     if (InsideTriangles.Num() == 0)
@@ -6610,6 +7217,28 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
         BoundaryLoops.Add(MoveTemp(Loop));
     }
 
+    // A terrane vertex that keeps remaining triangles must lie on a boundary loop (it gets a duplicate there);
+    // otherwise removing it would leave those triangles dangling.
+    for (int32 VertexIdx : SortedVertexIndices)
+    {
+        if (BoundaryAdjacency.Contains(VertexIdx))
+        {
+            continue;
+        }
+
+        bool bHasRemainingTriangle = false;
+        ForEachIncidentTriangle(VertexIdx, [&](int32 TriangleIdx)
+        {
+            bHasRemainingTriangle |= !IsInsideTriangle(TriangleIdx);
+        });
+
+        if (bHasRemainingTriangle)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Triangle remap failed for vertex %d (shares triangles with the remaining mesh but is not on the terrane boundary)"), VertexIdx);
+            return false;
+        }
+    }
+
     FContinentalTerrane NewTerrane;
     int32 AssignedTerraneID = INDEX_NONE;
     const int32 SaltBase = SavedNextTerraneID;
@@ -6679,6 +7308,11 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
 
     TerraneCentroid.Normalize();
     NewTerrane.Centroid = TerraneCentroid;
+    for (const FTerraneVertexRecord& Record : NewTerrane.VertexPayload)
+    {
+        NewTerrane.BoundingRadiusRad = FMath::Max(NewTerrane.BoundingRadiusRad,
+            FMath::Acos(FMath::Clamp(TerraneCentroid | Record.Position.GetSafeNormal(), -1.0, 1.0)));
+    }
 
     NewTerrane.ExtractedTriangles.Reserve(InsideTriangles.Num() * 3);
     for (const FIntVector& Tri : InsideTriangles)
@@ -6719,27 +7353,14 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
         BoundaryLoopsLocal.Add(MoveTemp(LocalLoop));
     }
 
-    const TArray<FVector3d> BackupRenderVertices = RenderVertices;
-    const TArray<int32> BackupRenderTriangles = RenderTriangles;
-    const TArray<int32> BackupVertexAssignments = VertexPlateAssignments;
-    const TArray<FVector3d> BackupVertexVelocities = VertexVelocities;
-    const TArray<double> BackupVertexStress = VertexStressValues;
-    const TArray<double> BackupVertexTemperature = VertexTemperatureValues;
-    const TArray<double> BackupVertexElevation = VertexElevationValues;
-    const TArray<double> BackupVertexErosion = VertexErosionRates;
-    const TArray<double> BackupVertexSediment = VertexSedimentThickness;
-    const TArray<double> BackupVertexCrustAge = VertexCrustAge;
-    const TArray<double> BackupVertexAmplified = VertexAmplifiedElevation;
-    const TArray<FVector3d> BackupVertexRidgeDirections = VertexRidgeDirections;
-    const TArray<int32> BackupAdjOffsets = RenderVertexAdjacencyOffsets;
-    const TArray<int32> BackupAdjacency = RenderVertexAdjacency;
-    const TArray<float> BackupAdjWeights = RenderVertexAdjacencyWeights;
-    const TArray<int32> BackupReverseAdjacency = RenderVertexReverseAdjacency;
-    const TArray<uint8> BackupConvergentFlags = ConvergentNeighborFlags;
-    const TArray<int32> BackupPendingSeeds = PendingCrustAgeResetSeeds;
-    const TBitArray<> BackupPendingMask = PendingCrustAgeResetMask;
+    // Plan the hole fill. Appended vertices get virtual indices VertexCount, VertexCount + 1, ... in append order,
+    // which is exactly where AppendRenderVertexFromRecord will put them.
+    const double BaselineElevation = (SourcePlate && SourcePlate->CrustType == ECrustType::Continental)
+        ? PaperElevationConstants::ContinentalBaseline_m
+        : PaperElevationConstants::AbyssalPlainDepth_m;
 
-    TArray<int32> WorkingTriangles = MoveTemp(RemainingTriangles);
+    TArray<FTerraneVertexRecord> AppendedRecords;
+    TArray<int32> AppendedSources; // Vertex whose boundary cache entry each appended vertex inherits
     TArray<int32> PendingPatchVertexIndices;
     TArray<int32> PendingPatchTriangles;
     TMap<int32, int32> BoundaryDuplicateMap;
@@ -6747,40 +7368,17 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
     PendingPatchVertexIndices.Reserve(SortedVertexIndices.Num());
     PendingPatchTriangles.Reserve(BoundaryLoopsLocal.Num() * 6);
 
+    auto GetPlannedPosition = [&](int32 VirtualIdx) -> const FVector3d&
+    {
+        return VirtualIdx < VertexCount ? RenderVertices[VirtualIdx] : AppendedRecords[VirtualIdx - VertexCount].Position;
+    };
+
     for (int32 LoopIdx = 0; LoopIdx < BoundaryLoopsLocal.Num(); ++LoopIdx)
     {
         const TArray<int32>& LocalLoop = BoundaryLoopsLocal[LoopIdx];
         const TArray<int32>& OriginalLoop = BoundaryLoops[LoopIdx];
         const int32 LoopCount = LocalLoop.Num();
 
-        if (LoopCount < 3)
-        {
-            UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Local boundary loop too small (%d vertices)"), LoopCount);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
-            NextTerraneID = SavedNextTerraneID;
-            return false;
-        }
-
         TArray<int32> DuplicatedIndices;
         DuplicatedIndices.Reserve(LoopCount);
 
@@ -6797,28 +7395,17 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
             else
             {
                 FTerraneVertexRecord Record = NewTerrane.VertexPayload[LocalVertexIdx];
-                const double BaselineElevation = (SourcePlate && SourcePlate->CrustType == ECrustType::Continental)
-                    ? PaperElevationConstants::ContinentalBaseline_m
-                    : PaperElevationConstants::AbyssalPlainDepth_m;
                 Record.Elevation = BaselineElevation;
                 Record.AmplifiedElevation = BaselineElevation;
-                DuplicateIdx = AppendRenderVertexFromRecord(Record, SourcePlateID);
+                DuplicateIdx = VertexCount + AppendedRecords.Num();
+                AppendedRecords.Add(Record);
+                AppendedSources.Add(OriginalVertexIdx);
                 BoundaryDuplicateMap.Add(OriginalVertexIdx, DuplicateIdx);
                 PendingPatchVertexIndices.Add(DuplicateIdx);
             }
 
-            FTerraneVertexRecord& PayloadRecord = NewTerrane.VertexPayload[LocalVertexIdx];
-            PayloadRecord.ReplacementVertexIndex = DuplicateIdx;
-
+            NewTerrane.VertexPayload[LocalVertexIdx].ReplacementVertexIndex = DuplicateIdx;
             DuplicatedIndices.Add(DuplicateIdx);
-
-            for (int32& TriangleIndex : WorkingTriangles)
-            {
-                if (TriangleIndex == OriginalVertexIdx)
-                {
-                    TriangleIndex = DuplicateIdx;
-                }
-            }
         }
 
         FTerraneVertexRecord CenterRecord;
@@ -6860,12 +7447,11 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
             CenterRecord.RidgeDirection = FVector3d::ZeroVector;
         }
 
-        const double BaselineElevation = (SourcePlate && SourcePlate->CrustType == ECrustType::Continental)
-            ? PaperElevationConstants::ContinentalBaseline_m
-            : PaperElevationConstants::AbyssalPlainDepth_m;
         CenterRecord.Elevation = BaselineElevation;
         CenterRecord.AmplifiedElevation = BaselineElevation;
-        const int32 CenterIdx = AppendRenderVertexFromRecord(CenterRecord, SourcePlateID);
+        const int32 CenterIdx = VertexCount + AppendedRecords.Num();
+        AppendedRecords.Add(CenterRecord);
+        AppendedSources.Add(OriginalLoop[0]);
         PendingPatchVertexIndices.Add(CenterIdx);
 
         auto QueuePatchTriangle = [&](int32 V0, int32 V1, int32 V2)
@@ -6879,9 +7465,9 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
         {
             const int32 V0 = DuplicatedIndices[i];
             const int32 V1 = DuplicatedIndices[(i + 1) % DuplicatedIndices.Num()];
-            const FVector3d& A = RenderVertices[V0];
-            const FVector3d& B = RenderVertices[V1];
-            const FVector3d& C = RenderVertices[CenterIdx];
+            const FVector3d& A = GetPlannedPosition(V0);
+            const FVector3d& B = GetPlannedPosition(V1);
+            const FVector3d& C = GetPlannedPosition(CenterIdx);
 
             const FVector3d Normal = FVector3d::CrossProduct(B - A, C - A);
             const double Orientation = Normal | A;
@@ -6896,155 +7482,268 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
         }
     }
 
-    TArray<int32> OldToNewIndex;
-    CompactRenderVertexData(SortedVertexIndices, OldToNewIndex);
+    // Rim: remaining triangles touching the boundary; their boundary corners move to the duplicates.
+    auto ToDuplicate = [&BoundaryDuplicateMap](int32 VertexIdx)
+    {
+        const int32* DuplicateIdx = BoundaryDuplicateMap.Find(VertexIdx);
+        return DuplicateIdx ? *DuplicateIdx : VertexIdx;
+    };
 
-    for (FTerraneVertexRecord& PayloadRecord : NewTerrane.VertexPayload)
+    TArray<int32> RimTriangleIndices;
+    for (const TPair<int32, int32>& Pair : BoundaryDuplicateMap)
     {
-        if (PayloadRecord.ReplacementVertexIndex != INDEX_NONE)
+        ForEachIncidentTriangle(Pair.Key, [&](int32 TriangleIdx)
         {
-            if (!OldToNewIndex.IsValidIndex(PayloadRecord.ReplacementVertexIndex) || OldToNewIndex[PayloadRecord.ReplacementVertexIndex] == INDEX_NONE)
-            {
-                UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Failed to remap replacement vertex %d"), PayloadRecord.ReplacementVertexIndex);
-
-                RenderVertices = BackupRenderVertices;
-                RenderTriangles = BackupRenderTriangles;
-                VertexPlateAssignments = BackupVertexAssignments;
-                CachedVoronoiAssignments = VertexPlateAssignments;
-                VertexVelocities = BackupVertexVelocities;
-                VertexStressValues = BackupVertexStress;
-                VertexTemperatureValues = BackupVertexTemperature;
-                VertexElevationValues = BackupVertexElevation;
-                VertexErosionRates = BackupVertexErosion;
-                VertexSedimentThickness = BackupVertexSediment;
-                VertexCrustAge = BackupVertexCrustAge;
-                VertexAmplifiedElevation = BackupVertexAmplified;
-                VertexRidgeDirections = BackupVertexRidgeDirections;
-                RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-                RenderVertexAdjacency = BackupAdjacency;
-                RenderVertexAdjacencyWeights = BackupAdjWeights;
-                RenderVertexReverseAdjacency = BackupReverseAdjacency;
-                ConvergentNeighborFlags = BackupConvergentFlags;
-                PendingCrustAgeResetSeeds = BackupPendingSeeds;
-                PendingCrustAgeResetMask = BackupPendingMask;
-                NextTerraneID = SavedNextTerraneID;
-                return false;
+            if (!IsInsideTriangle(TriangleIdx))
+            {
+                RimTriangleIndices.Add(TriangleIdx);
             }
+        });
+    }
+    SortUnique(RimTriangleIndices);
 
-            PayloadRecord.ReplacementVertexIndex = OldToNewIndex[PayloadRecord.ReplacementVertexIndex];
+    TArray<int32> RimTriangles;
+    RimTriangles.Reserve(RimTriangleIndices.Num() * 3);
+    TArray<int32> OutsideRimVertices;
+    for (int32 TriangleIdx : RimTriangleIndices)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 VertexIdx = RenderTriangles[TriangleIdx * 3 + Corner];
+            RimTriangles.Add(ToDuplicate(VertexIdx));
+            if (!TerraneVertexSet.Contains(VertexIdx))
+            {
+                OutsideRimVertices.Add(VertexIdx);
+            }
         }
     }
+    SortUnique(OutsideRimVertices);
 
-    auto RemapIndex = [&](int32& Index) -> bool
+    // Local topology check; the rest of the mesh is untouched. Every edge at a new vertex must be shared by exactly
+    // two triangles, and the removed and added V - E + F must balance so the Euler characteristic is preserved.
     {
-        if (!OldToNewIndex.IsValidIndex(Index) || OldToNewIndex[Index] == INDEX_NONE)
+        TMap<TPair<int32, int32>, int32> NewEdgeUseCounts;
+        bool bDegenerate = false;
+        auto RecordNewTriangle = [&](const int32* Corners)
         {
-            return false;
+            if (Corners[0] == Corners[1] || Corners[1] == Corners[2] || Corners[2] == Corners[0])
+            {
+                bDegenerate = true;
+                return;
+            }
+
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32 V0 = Corners[Corner];
+                const int32 V1 = Corners[(Corner + 1) % 3];
+                if (V0 >= VertexCount || V1 >= VertexCount)
+                {
+                    NewEdgeUseCounts.FindOrAdd(TPair<int32, int32>(FMath::Min(V0, V1), FMath::Max(V0, V1)))++;
+                }
+            }
+        };
+
+        for (int32 TriIdx = 0; TriIdx < RimTriangles.Num(); TriIdx += 3)
+        {
+            RecordNewTriangle(&RimTriangles[TriIdx]);
+        }
+        for (int32 TriIdx = 0; TriIdx < PendingPatchTriangles.Num(); TriIdx += 3)
+        {
+            RecordNewTriangle(&PendingPatchTriangles[TriIdx]);
         }
-        Index = OldToNewIndex[Index];
-        return true;
-    };
 
-    for (int32& Index : WorkingTriangles)
-    {
-        if (!RemapIndex(Index))
+        int32 NonManifoldEdges = 0;
+        for (const TPair<TPair<int32, int32>, int32>& Pair : NewEdgeUseCounts)
+        {
+            NonManifoldEdges += Pair.Value != 2 ? 1 : 0;
+        }
+
+        TSet<TPair<int32, int32>> RemovedEdges;
+        for (int32 VertexIdx : SortedVertexIndices)
+        {
+            ForEachIncidentTriangle(VertexIdx, [&](int32 TriangleIdx)
+            {
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const int32 V0 = RenderTriangles[TriangleIdx * 3 + Corner];
+                    const int32 V1 = RenderTriangles[TriangleIdx * 3 + (Corner + 1) % 3];
+                    if (TerraneVertexSet.Contains(V0) || TerraneVertexSet.Contains(V1))
+                    {
+                        RemovedEdges.Add(TPair<int32, int32>(FMath::Min(V0, V1), FMath::Max(V0, V1)));
+                    }
+                }
+            });
+        }
+
+        const int32 DeltaVertices = AppendedRecords.Num() - SortedVertexIndices.Num();
+        const int32 DeltaEdges = NewEdgeUseCounts.Num() - RemovedEdges.Num();
+        const int32 DeltaFaces = PendingPatchTriangles.Num() / 3 - InsideTriangles.Num();
+        const int32 EulerDelta = DeltaVertices - DeltaEdges + DeltaFaces;
+
+        if (bDegenerate || NonManifoldEdges > 0 || EulerDelta != 0)
         {
-            UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Triangle remap failed for vertex %d"), Index);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
+            UE_LOG(LogPlanetaryCreation, Error,
+                TEXT("ExtractTerrane: Post-extraction topology invalid: %d non-manifold edges, degenerate=%d, Euler delta %d (dV=%d dE=%d dF=%d)"),
+                NonManifoldEdges, bDegenerate ? 1 : 0, EulerDelta, DeltaVertices, DeltaEdges, DeltaFaces);
             NextTerraneID = SavedNextTerraneID;
             return false;
         }
     }
 
-    for (int32& Index : PendingPatchTriangles)
+    // One-rings that change: the outside rim corners (their rim neighbors became duplicates) and the new vertices.
+    // Every triangle touching them is either a rim triangle, an untouched triangle of an outside rim vertex, or a patch triangle.
+    TMap<int32, TArray<int32>> PlannedNeighbors;
     {
-        if (!RemapIndex(Index))
+        TSet<int32> DirtyVertices(OutsideRimVertices);
+        for (int32 AppendedIdx = 0; AppendedIdx < AppendedRecords.Num(); ++AppendedIdx)
         {
-            UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Patch triangle remap failed for vertex %d"), Index);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
-            NextTerraneID = SavedNextTerraneID;
-            return false;
+            DirtyVertices.Add(VertexCount + AppendedIdx);
+        }
+
+        auto AddPlannedTriangle = [&](int32 A, int32 B, int32 C)
+        {
+            const int32 Corners[3] = {A, B, C};
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                if (DirtyVertices.Contains(Corners[Corner]))
+                {
+                    TArray<int32>& Neighbors = PlannedNeighbors.FindOrAdd(Corners[Corner]);
+                    Neighbors.AddUnique(Corners[(Corner + 1) % 3]);
+                    Neighbors.AddUnique(Corners[(Corner + 2) % 3]);
+                }
+            }
+        };
+
+        TArray<int32> OneRingTriangles;
+        for (int32 VertexIdx : OutsideRimVertices)
+        {
+            ForEachIncidentTriangle(VertexIdx, [&OneRingTriangles](int32 TriangleIdx)
+            {
+                OneRingTriangles.Add(TriangleIdx);
+            });
+        }
+        SortUnique(OneRingTriangles);
+
+        for (int32 TriangleIdx : OneRingTriangles)
+        {
+            AddPlannedTriangle(
+                ToDuplicate(RenderTriangles[TriangleIdx * 3]),
+                ToDuplicate(RenderTriangles[TriangleIdx * 3 + 1]),
+                ToDuplicate(RenderTriangles[TriangleIdx * 3 + 2]));
+        }
+        for (int32 TriIdx = 0; TriIdx < PendingPatchTriangles.Num(); TriIdx += 3)
+        {
+            AddPlannedTriangle(PendingPatchTriangles[TriIdx], PendingPatchTriangles[TriIdx + 1], PendingPatchTriangles[TriIdx + 2]);
+        }
+    }
+
+    // Commit. Nothing below can fail, so no whole-mesh backup is needed.
+    const bool bCanPatchAdjacency = RenderVertexAdjacencyOffsets.Num() == VertexCount + 1;
+    const bool bCanPatchBoundaryCache = RenderVertexBoundaryCache.Num() == VertexCount;
+
+    for (const FTerraneVertexRecord& Record : AppendedRecords)
+    {
+        AppendRenderVertexFromRecord(Record, SourcePlateID);
+    }
+
+    for (int32 RimIdx = 0; RimIdx < RimTriangleIndices.Num(); ++RimIdx)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            RenderTriangles[RimTriangleIndices[RimIdx] * 3 + Corner] = RimTriangles[RimIdx * 3 + Corner];
+        }
+    }
+
+    // Not local: compaction rewrites every vertex column, and the remaps below walk the whole triangle list and CSR.
+    // Tombstoned slots would avoid this, but reattachment and ReplacementVertexIndex bookkeeping expect dense columns.
+    TArray<int32> OldToNewIndex;
+    CompactRenderVertexData(SortedVertexIndices, OldToNewIndex);
+
+    // Drop the inside triangles in place, remap the survivors and append the patch fan.
+    {
+        const int32 TriangleCount = RenderTriangles.Num() / 3;
+        int32 WriteTriangle = 0;
+        int32 NextInside = 0;
+        for (int32 TriangleIdx = 0; TriangleIdx < TriangleCount; ++TriangleIdx)
+        {
+            if (NextInside < InsideTriangleIndices.Num() && InsideTriangleIndices[NextInside] == TriangleIdx)
+            {
+                ++NextInside;
+                continue;
+            }
+
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                RenderTriangles[WriteTriangle * 3 + Corner] = OldToNewIndex[RenderTriangles[TriangleIdx * 3 + Corner]];
+            }
+            ++WriteTriangle;
         }
+        RenderTriangles.SetNum(WriteTriangle * 3);
     }
 
+    for (int32& Index : PendingPatchTriangles)
+    {
+        Index = OldToNewIndex[Index];
+    }
     for (int32& Index : PendingPatchVertexIndices)
     {
-        if (!RemapIndex(Index))
+        Index = OldToNewIndex[Index];
+    }
+    for (FTerraneVertexRecord& PayloadRecord : NewTerrane.VertexPayload)
+    {
+        if (PayloadRecord.ReplacementVertexIndex != INDEX_NONE)
         {
-            UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Patch vertex remap failed for vertex %d"), Index);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
-            NextTerraneID = SavedNextTerraneID;
-            return false;
+            PayloadRecord.ReplacementVertexIndex = OldToNewIndex[PayloadRecord.ReplacementVertexIndex];
         }
     }
 
-    RenderTriangles = MoveTemp(WorkingTriangles);
     RenderTriangles.Append(PendingPatchTriangles);
 
     NewTerrane.PatchVertexIndices = MoveTemp(PendingPatchVertexIndices);
     NewTerrane.PatchTriangles = MoveTemp(PendingPatchTriangles);
 
-    InvalidateRenderVertexCaches();
+    // Boundary cache: survivors keep their entry, new vertices inherit the rim vertex they replace.
+    if (bCanPatchBoundaryCache)
+    {
+        TArray<FRenderVertexBoundaryInfo> PatchedBoundaryCache;
+        PatchedBoundaryCache.SetNum(RenderVertices.Num());
+        for (int32 OldIdx = 0; OldIdx < OldToNewIndex.Num(); ++OldIdx)
+        {
+            const int32 NewIdx = OldToNewIndex[OldIdx];
+            if (NewIdx != INDEX_NONE)
+            {
+                const int32 SourceIdx = OldIdx < VertexCount ? OldIdx : AppendedSources[OldIdx - VertexCount];
+                PatchedBoundaryCache[NewIdx] = RenderVertexBoundaryCache[SourceIdx];
+            }
+        }
+        RenderVertexBoundaryCache = MoveTemp(PatchedBoundaryCache);
+        ++RenderVertexBoundaryCacheSerial;
+    }
+
+    InvalidateRenderVertexDerivedCaches();
+
+    int32 PatchedAdjacencyVertexCount = 0;
+    if (bCanPatchAdjacency)
+    {
+        TMap<int32, TArray<int32>> DirtyNeighbors;
+        DirtyNeighbors.Reserve(PlannedNeighbors.Num());
+        for (TPair<int32, TArray<int32>>& Pair : PlannedNeighbors)
+        {
+            for (int32& Neighbor : Pair.Value)
+            {
+                Neighbor = OldToNewIndex[Neighbor];
+            }
+            Pair.Value.Sort();
+            DirtyNeighbors.Add(OldToNewIndex[Pair.Key], MoveTemp(Pair.Value));
+        }
+
+        PatchRenderVertexAdjacency(OldToNewIndex, DirtyNeighbors);
+        PatchedAdjacencyVertexCount = DirtyNeighbors.Num();
+    }
+    else
+    {
+        BuildRenderVertexAdjacency();
+    }
 
     SurfaceDataVersion++;
     TopologyVersion++;
@@ -7052,47 +7751,27 @@ bool UTectonicSimulationService::ExtractTerrane(int32 SourcePlateID, const TArra
     MarkAllRidgeDirectionsDirty();
     BumpOceanicAmplificationSerial();
 
+    RemapTerraneMeshIndices(OldToNewIndex);
     Terranes.Add(NewTerrane);
     OutTerraneID = NewTerrane.TerraneID;
 
-    if (!ValidateTopology(ValidationError))
+    if (bFullValidation && !ValidateTopology(ValidationError))
     {
-        UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Post-extraction topology invalid: %s"), *ValidationError);
-
-        RenderVertices = BackupRenderVertices;
-        RenderTriangles = BackupRenderTriangles;
-        VertexPlateAssignments = BackupVertexAssignments;
-        CachedVoronoiAssignments = VertexPlateAssignments;
-        VertexVelocities = BackupVertexVelocities;
-        VertexStressValues = BackupVertexStress;
-        VertexTemperatureValues = BackupVertexTemperature;
-        VertexElevationValues = BackupVertexElevation;
-        VertexErosionRates = BackupVertexErosion;
-        VertexSedimentThickness = BackupVertexSediment;
-        VertexCrustAge = BackupVertexCrustAge;
-        VertexAmplifiedElevation = BackupVertexAmplified;
-        VertexRidgeDirections = BackupVertexRidgeDirections;
-        RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-        RenderVertexAdjacency = BackupAdjacency;
-        RenderVertexAdjacencyWeights = BackupAdjWeights;
-        RenderVertexReverseAdjacency = BackupReverseAdjacency;
-        ConvergentNeighborFlags = BackupConvergentFlags;
-        PendingCrustAgeResetSeeds = BackupPendingSeeds;
-        PendingCrustAgeResetMask = BackupPendingMask;
-        Terranes.Pop();
-        NextTerraneID = SavedNextTerraneID;
-        SurfaceDataVersion--;
-        TopologyVersion--;
-        InvalidateRenderVertexCaches();
-        return false;
+        UE_LOG(LogPlanetaryCreation, Error, TEXT("ExtractTerrane: Full post-extraction validation failed: %s"), *ValidationError);
     }
 
-    BuildRenderVertexAdjacency();
-    BuildRenderVertexReverseAdjacency();
-    UpdateConvergentNeighborFlags();
+    LastTerraneSurgeryStats = FTerraneSurgeryStats();
+    LastTerraneSurgeryStats.RemovedVertexCount = SortedVertexIndices.Num();
+    LastTerraneSurgeryStats.AddedVertexCount = AppendedRecords.Num();
+    LastTerraneSurgeryStats.RemovedTriangleCount = InsideTriangles.Num();
+    LastTerraneSurgeryStats.RimTriangleCount = RimTriangleIndices.Num();
+    LastTerraneSurgeryStats.PatchTriangleCount = NewTerrane.PatchTriangles.Num() / 3;
+    LastTerraneSurgeryStats.PatchedAdjacencyVertexCount = PatchedAdjacencyVertexCount;
+    LastTerraneSurgeryStats.bPatchedAdjacency = bCanPatchAdjacency;
+    LastTerraneSurgeryStats.SurgeryMs = (FPlatformTime::Seconds() - SurgeryStartTime) * 1000.0;
 
-    UE_LOG(LogPlanetaryCreation, Log, TEXT("ExtractTerrane: Successfully extracted terrane %d (%.2f km²) from plate %d"),
-        OutTerraneID, TerraneArea, SourcePlateID);
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("ExtractTerrane: Successfully extracted terrane %d (%.2f km²) from plate %d (%d rim triangles, %d one-rings patched, %.2f ms)"),
+        OutTerraneID, TerraneArea, SourcePlateID, RimTriangleIndices.Num(), PatchedAdjacencyVertexCount, LastTerraneSurgeryStats.SurgeryMs);
 
     AssignTerraneCarrier(OutTerraneID);
     return true;
@@ -7103,72 +7782,102 @@ bool UTectonicSimulationService::ReattachTerrane(int32 TerraneID, int32 TargetPl
     UE_LOG(LogPlanetaryCreation, Log, TEXT("ReattachTerrane: Attempting to reattach terrane %d to plate %d"),
         TerraneID, TargetPlateID);
 
-    // Find terrane
-    FContinentalTerrane* Terrane = nullptr;
-    int32 TerraneIndex = INDEX_NONE;
-    for (int32 i = 0; i < Terranes.Num(); ++i)
+    TArray<TPair<int32, int32>> TerraneTargets;
+    TerraneTargets.Emplace(TerraneID, TargetPlateID);
+    return ReattachTerranes(TerraneTargets) == 1;
+}
+
+int32 UTectonicSimulationService::ReattachTerranes(const TArray<TPair<int32, int32>>& TerraneTargets)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ReattachTerranes);
+
+    struct FStagedReattachment
     {
-        if (Terranes[i].TerraneID == TerraneID)
+        int32 TerraneIndex = INDEX_NONE;
+        int32 TargetPlateID = INDEX_NONE;
+        TArray<int32> LocalToGlobal;
+    };
+
+    TArray<FStagedReattachment> Staged;
+    Staged.Reserve(TerraneTargets.Num());
+
+    for (const TPair<int32, int32>& Request : TerraneTargets)
+    {
+        const int32 TerraneID = Request.Key;
+        const int32 TargetPlateID = Request.Value;
+
+        int32 TerraneIndex = INDEX_NONE;
+        for (int32 i = 0; i < Terranes.Num(); ++i)
         {
-            Terrane = &Terranes[i];
-            TerraneIndex = i;
-            break;
+            if (Terranes[i].TerraneID == TerraneID)
+            {
+                TerraneIndex = i;
+                break;
+            }
         }
-    }
 
-    if (!Terrane)
-    {
-        UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Terrane %d not found"), TerraneID);
-        return false;
-    }
+        if (TerraneIndex == INDEX_NONE)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Terrane %d not found"), TerraneID);
+            continue;
+        }
 
-    // Validation: Terrane must be detached (Extracted, Transporting, or Colliding)
-    if (Terrane->State != ETerraneState::Extracted &&
-        Terrane->State != ETerraneState::Transporting &&
-        Terrane->State != ETerraneState::Colliding)
-    {
-        UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Terrane %d not in detached state (current: %d, expected: 1=Extracted, 2=Transporting, 3=Colliding)"),
-            TerraneID, static_cast<int32>(Terrane->State));
-        return false;
-    }
+        if (Staged.ContainsByPredicate([TerraneIndex](const FStagedReattachment& Entry) { return Entry.TerraneIndex == TerraneIndex; }))
+        {
+            UE_LOG(LogPlanetaryCreation, Warning, TEXT("ReattachTerrane: Terrane %d requested twice in one batch, ignoring the repeat"), TerraneID);
+            continue;
+        }
 
-    // Find target plate
-    FTectonicPlate* TargetPlate = nullptr;
-    for (FTectonicPlate& Plate : Plates)
-    {
-        if (Plate.PlateID == TargetPlateID)
+        const FContinentalTerrane& Terrane = Terranes[TerraneIndex];
+
+        // Validation: Terrane must be detached (Extracted, Transporting, or Colliding)
+        if (Terrane.State != ETerraneState::Extracted &&
+            Terrane.State != ETerraneState::Transporting &&
+            Terrane.State != ETerraneState::Colliding)
         {
-            TargetPlate = &Plate;
-            break;
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Terrane %d not in detached state (current: %d, expected: 1=Extracted, 2=Transporting, 3=Colliding)"),
+                TerraneID, static_cast<int32>(Terrane.State));
+            continue;
         }
-    }
 
-    if (!TargetPlate)
-    {
-        UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Target plate %d not found"), TargetPlateID);
-        return false;
+        const FTectonicPlate* TargetPlate = Plates.FindByPredicate([TargetPlateID](const FTectonicPlate& Plate) { return Plate.PlateID == TargetPlateID; });
+        if (!TargetPlate)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Target plate %d not found"), TargetPlateID);
+            continue;
+        }
+
+        // Validation: Target must be continental
+        if (TargetPlate->CrustType != ECrustType::Continental)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Target plate %d is not continental"), TargetPlateID);
+            continue;
+        }
+
+        if (Terrane.VertexPayload.Num() == 0)
+        {
+            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Terrane %d has no stored vertex payload"), TerraneID);
+            continue;
+        }
+
+        FStagedReattachment& Entry = Staged.AddDefaulted_GetRef();
+        Entry.TerraneIndex = TerraneIndex;
+        Entry.TargetPlateID = TargetPlateID;
     }
 
-    // Validation: Target must be continental
-    if (TargetPlate->CrustType != ECrustType::Continental)
+    if (Staged.Num() == 0)
     {
-        UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Target plate %d is not continental"), TargetPlateID);
-        return false;
+        return 0;
     }
 
     FString ValidationError;
     if (!ValidateTopology(ValidationError))
     {
         UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Pre-reattachment topology invalid: %s"), *ValidationError);
-        return false;
-    }
-
-    if (Terrane->VertexPayload.Num() == 0)
-    {
-        UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Terrane %d has no stored vertex payload"), TerraneID);
-        return false;
+        return 0;
     }
 
+    // One snapshot for the whole batch; every failure below restores it.
     const TArray<FVector3d> BackupRenderVertices = RenderVertices;
     const TArray<int32> BackupRenderTriangles = RenderTriangles;
     const TArray<int32> BackupVertexAssignments = VertexPlateAssignments;
@@ -7184,11 +7893,38 @@ bool UTectonicSimulationService::ReattachTerrane(int32 TerraneID, int32 TargetPl
     const TArray<int32> BackupAdjOffsets = RenderVertexAdjacencyOffsets;
     const TArray<int32> BackupAdjacency = RenderVertexAdjacency;
     const TArray<float> BackupAdjWeights = RenderVertexAdjacencyWeights;
+    const TArray<float> BackupAdjWeightTotals = RenderVertexAdjacencyWeightTotals;
     const TArray<int32> BackupReverseAdjacency = RenderVertexReverseAdjacency;
     const TArray<uint8> BackupConvergentFlags = ConvergentNeighborFlags;
     const TArray<int32> BackupPendingSeeds = PendingCrustAgeResetSeeds;
     const TBitArray<> BackupPendingMask = PendingCrustAgeResetMask;
 
+    auto RestoreBackup = [&]()
+    {
+        RenderVertices = BackupRenderVertices;
+        RenderVertexColumns.MarkAllColumnsChanged();
+        RenderTriangles = BackupRenderTriangles;
+        VertexPlateAssignments = BackupVertexAssignments;
+        CachedVoronoiAssignments = VertexPlateAssignments;
+        VertexVelocities = BackupVertexVelocities;
+        VertexStressValues = BackupVertexStress;
+        VertexTemperatureValues = BackupVertexTemperature;
+        VertexElevationValues = BackupVertexElevation;
+        VertexErosionRates = BackupVertexErosion;
+        VertexSedimentThickness = BackupVertexSediment;
+        VertexCrustAge = BackupVertexCrustAge;
+        VertexAmplifiedElevation = BackupVertexAmplified;
+        VertexRidgeDirections = BackupVertexRidgeDirections;
+        RenderVertexAdjacencyOffsets = BackupAdjOffsets;
+        RenderVertexAdjacency = BackupAdjacency;
+        RenderVertexAdjacencyWeights = BackupAdjWeights;
+        RenderVertexAdjacencyWeightTotals = BackupAdjWeightTotals;
+        RenderVertexReverseAdjacency = BackupReverseAdjacency;
+        ConvergentNeighborFlags = BackupConvergentFlags;
+        PendingCrustAgeResetSeeds = BackupPendingSeeds;
+        PendingCrustAgeResetMask = BackupPendingMask;
+    };
+
     auto MakeSortedTriangleKey = [](int32 A, int32 B, int32 C)
     {
         int32 Values[3] = {A, B, C};
@@ -7213,13 +7949,17 @@ bool UTectonicSimulationService::ReattachTerrane(int32 TerraneID, int32 TargetPl
         return FIntVector(Values[0], Values[1], Values[2]);
     };
 
+    // Cap triangles and cap vertices of every staged terrane come out in a single filter + compaction.
     TSet<FIntVector> PatchTriangleSet;
-    for (int32 TriIdx = 0; TriIdx < Terrane->PatchTriangles.Num(); TriIdx += 3)
+    TArray<int32> PatchVerticesSorted;
+    for (const FStagedReattachment& Entry : Staged)
     {
-        const int32 A = Terrane->PatchTriangles[TriIdx];
-        const int32 B = Terrane->PatchTriangles[TriIdx + 1];
-        const int32 C = Terrane->PatchTriangles[TriIdx + 2];
-        PatchTriangleSet.Add(MakeSortedTriangleKey(A, B, C));
+        const FContinentalTerrane& Terrane = Terranes[Entry.TerraneIndex];
+        for (int32 TriIdx = 0; TriIdx < Terrane.PatchTriangles.Num(); TriIdx += 3)
+        {
+            PatchTriangleSet.Add(MakeSortedTriangleKey(Terrane.PatchTriangles[TriIdx], Terrane.PatchTriangles[TriIdx + 1], Terrane.PatchTriangles[TriIdx + 2]));
+        }
+        PatchVerticesSorted.Append(Terrane.PatchVertexIndices);
     }
 
     TArray<int32> FilteredTriangles;
@@ -7238,52 +7978,42 @@ bool UTectonicSimulationService::ReattachTerrane(int32 TerraneID, int32 TargetPl
         FilteredTriangles.Add(C);
     }
 
-    const TSet<int32> PatchVertexSet(Terrane->PatchVertexIndices);
-
-    TArray<int32> LocalToGlobal;
-    LocalToGlobal.Reserve(Terrane->VertexPayload.Num());
-    for (const FTerraneVertexRecord& Payload : Terrane->VertexPayload)
-    {
-        FTerraneVertexRecord Record = Payload;
-        Record.PlateID = TargetPlateID;
-        const int32 NewIndex = AppendRenderVertexFromRecord(Record, TargetPlateID);
-        LocalToGlobal.Add(NewIndex);
-    }
-
-    TMap<int32, int32> ReplacementToLocal;
-    for (int32 LocalIdx = 0; LocalIdx < Terrane->VertexPayload.Num(); ++LocalIdx)
+    // Payload vertices are appended per terrane; rim triangles move from the boundary duplicates back onto them.
+    TMap<int32, int32> ReplacementToGlobal;
+    for (FStagedReattachment& Entry : Staged)
     {
-        const int32 ReplacementIdx = Terrane->VertexPayload[LocalIdx].ReplacementVertexIndex;
-        if (ReplacementIdx != INDEX_NONE)
+        FContinentalTerrane& Terrane = Terranes[Entry.TerraneIndex];
+        MaterializeTerranePayload(Terrane);
+        Entry.LocalToGlobal.Reserve(Terrane.VertexPayload.Num());
+        for (const FTerraneVertexRecord& Payload : Terrane.VertexPayload)
         {
-            ReplacementToLocal.Add(ReplacementIdx, LocalIdx);
+            FTerraneVertexRecord Record = Payload;
+            Record.PlateID = Entry.TargetPlateID;
+            const int32 NewIndex = AppendRenderVertexFromRecord(Record, Entry.TargetPlateID);
+            Entry.LocalToGlobal.Add(NewIndex);
+
+            if (Payload.ReplacementVertexIndex != INDEX_NONE)
+            {
+                ReplacementToGlobal.Add(Payload.ReplacementVertexIndex, NewIndex);
+            }
         }
     }
 
     for (int32& Index : FilteredTriangles)
     {
-        if (int32* LocalIdxPtr = ReplacementToLocal.Find(Index))
+        if (const int32* GlobalIdx = ReplacementToGlobal.Find(Index))
         {
-            const int32 LocalIdx = *LocalIdxPtr;
-            if (LocalToGlobal.IsValidIndex(LocalIdx))
-            {
-                Index = LocalToGlobal[LocalIdx];
-            }
+            Index = *GlobalIdx;
         }
     }
 
-    TArray<int32> PatchVerticesSorted = Terrane->PatchVertexIndices;
     PatchVerticesSorted.Sort();
     int32 PatchWriteIndex = 0;
-    int32 PatchLastValue = MIN_int32;
-    bool bHasPatchLast = false;
-    for (int32 Value : PatchVerticesSorted)
+    for (int32 ReadIndex = 0; ReadIndex < PatchVerticesSorted.Num(); ++ReadIndex)
     {
-        if (!bHasPatchLast || Value != PatchLastValue)
+        if (PatchWriteIndex == 0 || PatchVerticesSorted[PatchWriteIndex - 1] != PatchVerticesSorted[ReadIndex])
         {
-            PatchVerticesSorted[PatchWriteIndex++] = Value;
-            PatchLastValue = Value;
-            bHasPatchLast = true;
+            PatchVerticesSorted[PatchWriteIndex++] = PatchVerticesSorted[ReadIndex];
         }
     }
     PatchVerticesSorted.SetNum(PatchWriteIndex);
@@ -7306,105 +8036,49 @@ bool UTectonicSimulationService::ReattachTerrane(int32 TerraneID, int32 TargetPl
         if (!RemapIndex(Index))
         {
             UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Failed to remap retained triangle index %d"), Index);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
-            return false;
+            RestoreBackup();
+            return 0;
         }
     }
 
-    for (int32& Index : LocalToGlobal)
+    for (FStagedReattachment& Entry : Staged)
     {
-        if (!RemapIndex(Index))
+        for (int32& Index : Entry.LocalToGlobal)
         {
-            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Failed to remap terrane vertex index %d"), Index);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
-            return false;
+            if (!RemapIndex(Index))
+            {
+                UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Failed to remap terrane vertex index %d"), Index);
+                RestoreBackup();
+                return 0;
+            }
         }
     }
 
-    RenderTriangles = MoveTemp(FilteredTriangles);
+    RenderTriangles = MoveTemp(FilteredTriangles);
+
+    for (const FStagedReattachment& Entry : Staged)
+    {
+        const FContinentalTerrane& Terrane = Terranes[Entry.TerraneIndex];
+        for (int32 TriIdx = 0; TriIdx < Terrane.ExtractedTriangles.Num(); TriIdx += 3)
+        {
+            const int32 LocalA = Terrane.ExtractedTriangles[TriIdx];
+            const int32 LocalB = Terrane.ExtractedTriangles[TriIdx + 1];
+            const int32 LocalC = Terrane.ExtractedTriangles[TriIdx + 2];
+
+            if (!Entry.LocalToGlobal.IsValidIndex(LocalA) || !Entry.LocalToGlobal.IsValidIndex(LocalB) || !Entry.LocalToGlobal.IsValidIndex(LocalC))
+            {
+                UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Invalid local triangle indices (%d, %d, %d)"), LocalA, LocalB, LocalC);
+                RestoreBackup();
+                return 0;
+            }
 
-    for (int32 TriIdx = 0; TriIdx < Terrane->ExtractedTriangles.Num(); TriIdx += 3)
-    {
-        const int32 LocalA = Terrane->ExtractedTriangles[TriIdx];
-        const int32 LocalB = Terrane->ExtractedTriangles[TriIdx + 1];
-        const int32 LocalC = Terrane->ExtractedTriangles[TriIdx + 2];
-
-        if (!LocalToGlobal.IsValidIndex(LocalA) || !LocalToGlobal.IsValidIndex(LocalB) || !LocalToGlobal.IsValidIndex(LocalC))
-        {
-            UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Invalid local triangle indices (%d, %d, %d)"), LocalA, LocalB, LocalC);
-
-            RenderVertices = BackupRenderVertices;
-            RenderTriangles = BackupRenderTriangles;
-            VertexPlateAssignments = BackupVertexAssignments;
-            CachedVoronoiAssignments = VertexPlateAssignments;
-            VertexVelocities = BackupVertexVelocities;
-            VertexStressValues = BackupVertexStress;
-            VertexTemperatureValues = BackupVertexTemperature;
-            VertexElevationValues = BackupVertexElevation;
-            VertexErosionRates = BackupVertexErosion;
-            VertexSedimentThickness = BackupVertexSediment;
-            VertexCrustAge = BackupVertexCrustAge;
-            VertexAmplifiedElevation = BackupVertexAmplified;
-            VertexRidgeDirections = BackupVertexRidgeDirections;
-            RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-            RenderVertexAdjacency = BackupAdjacency;
-            RenderVertexAdjacencyWeights = BackupAdjWeights;
-            RenderVertexReverseAdjacency = BackupReverseAdjacency;
-            ConvergentNeighborFlags = BackupConvergentFlags;
-            PendingCrustAgeResetSeeds = BackupPendingSeeds;
-            PendingCrustAgeResetMask = BackupPendingMask;
-            return false;
+            RenderTriangles.Add(Entry.LocalToGlobal[LocalA]);
+            RenderTriangles.Add(Entry.LocalToGlobal[LocalB]);
+            RenderTriangles.Add(Entry.LocalToGlobal[LocalC]);
         }
-
-        const int32 GlobalA = LocalToGlobal[LocalA];
-        const int32 GlobalB = LocalToGlobal[LocalB];
-        const int32 GlobalC = LocalToGlobal[LocalC];
-
-        RenderTriangles.Add(GlobalA);
-        RenderTriangles.Add(GlobalB);
-        RenderTriangles.Add(GlobalC);
     }
 
+    // Derived structures are rebuilt once for the whole batch.
     InvalidateRenderVertexCaches();
 
     SurfaceDataVersion++;
@@ -7416,46 +8090,73 @@ bool UTectonicSimulationService::ReattachTerrane(int32 TerraneID, int32 TargetPl
     if (!ValidateTopology(ValidationError))
     {
         UE_LOG(LogPlanetaryCreation, Error, TEXT("ReattachTerrane: Post-reattachment topology invalid: %s"), *ValidationError);
-
-        RenderVertices = BackupRenderVertices;
-        RenderTriangles = BackupRenderTriangles;
-        VertexPlateAssignments = BackupVertexAssignments;
-        CachedVoronoiAssignments = VertexPlateAssignments;
-        VertexVelocities = BackupVertexVelocities;
-        VertexStressValues = BackupVertexStress;
-        VertexTemperatureValues = BackupVertexTemperature;
-        VertexElevationValues = BackupVertexElevation;
-        VertexErosionRates = BackupVertexErosion;
-        VertexSedimentThickness = BackupVertexSediment;
-        VertexCrustAge = BackupVertexCrustAge;
-        VertexAmplifiedElevation = BackupVertexAmplified;
-        VertexRidgeDirections = BackupVertexRidgeDirections;
-        RenderVertexAdjacencyOffsets = BackupAdjOffsets;
-        RenderVertexAdjacency = BackupAdjacency;
-        RenderVertexAdjacencyWeights = BackupAdjWeights;
-        RenderVertexReverseAdjacency = BackupReverseAdjacency;
-        ConvergentNeighborFlags = BackupConvergentFlags;
-        PendingCrustAgeResetSeeds = BackupPendingSeeds;
-        PendingCrustAgeResetMask = BackupPendingMask;
+        RestoreBackup();
         SurfaceDataVersion--;
         TopologyVersion--;
-        return false;
+        return 0;
     }
 
     BuildRenderVertexAdjacency();
-    BuildRenderVertexReverseAdjacency();
-    UpdateConvergentNeighborFlags();
+    ++StepTerraneTopologyRebuilds;
+    StepTerraneReattachments += Staged.Num();
+
+    TArray<int32> ReattachedIndices;
+    ReattachedIndices.Reserve(Staged.Num());
+    for (const FStagedReattachment& Entry : Staged)
+    {
+        FContinentalTerrane& Terrane = Terranes[Entry.TerraneIndex];
+        Terrane.State = ETerraneState::Attached;
+        Terrane.TargetPlateID = Entry.TargetPlateID;
+        Terrane.CarrierPlateID = INDEX_NONE;
+        Terrane.ReattachmentTimeMy = CurrentTimeMy;
 
-    Terrane->State = ETerraneState::Attached;
-    Terrane->TargetPlateID = TargetPlateID;
-    Terrane->CarrierPlateID = INDEX_NONE;
-    Terrane->ReattachmentTimeMy = CurrentTimeMy;
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("ReattachTerrane: Successfully reattached terrane %d to plate %d (%.2f My transport duration)"),
+            Terrane.TerraneID, Entry.TargetPlateID, CurrentTimeMy - Terrane.ExtractionTimeMy);
+        ReattachedIndices.Add(Entry.TerraneIndex);
+    }
 
-    Terranes.RemoveAt(TerraneIndex);
+    ReattachedIndices.Sort(TGreater<int32>());
+    for (int32 TerraneIndex : ReattachedIndices)
+    {
+        Terranes.RemoveAt(TerraneIndex);
+    }
 
-    UE_LOG(LogPlanetaryCreation, Log, TEXT("ReattachTerrane: Successfully reattached terrane %d to plate %d (%.2f My transport duration)"),
-        TerraneID, TargetPlateID, CurrentTimeMy - Terrane->ExtractionTimeMy);
-    return true;
+    // Terranes still in transport keep cap indices into the render mesh; follow the compaction.
+    RemapTerraneMeshIndices(OldToNewIndex);
+
+    if (Staged.Num() > 1)
+    {
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("ReattachTerranes: Spliced %d terranes with one topology rebuild"), Staged.Num());
+    }
+
+    return Staged.Num();
+}
+
+void UTectonicSimulationService::RemapTerraneMeshIndices(const TArray<int32>& OldToNew)
+{
+    auto Remap = [&OldToNew](int32& Index)
+    {
+        Index = OldToNew.IsValidIndex(Index) ? OldToNew[Index] : INDEX_NONE;
+    };
+
+    for (FContinentalTerrane& Terrane : Terranes)
+    {
+        for (int32& Index : Terrane.PatchVertexIndices)
+        {
+            Remap(Index);
+        }
+        for (int32& Index : Terrane.PatchTriangles)
+        {
+            Remap(Index);
+        }
+        for (FTerraneVertexRecord& Record : Terrane.VertexPayload)
+        {
+            if (Record.ReplacementVertexIndex != INDEX_NONE)
+            {
+                Remap(Record.ReplacementVertexIndex);
+            }
+        }
+    }
 }
 
 bool UTectonicSimulationService::AssignTerraneCarrier(int32 TerraneID)
@@ -7549,39 +8250,113 @@ void UTectonicSimulationService::UpdateTerranePositions(double DeltaTimeMy)
             continue;
         }
 
-        // Rotate terrane vertices around carrier plate's Euler pole
-        const FVector3d& RotationAxis = CarrierPlate->EulerPoleAxis;
+        // Rotate around the carrier plate's Euler pole. Only the bounding cap moves here; the payload is rigid, so its
+        // positions take the accumulated rotation in one pass when they are next needed (MaterializeTerranePayload).
+        const FVector3d RotationAxis = CarrierPlate->EulerPoleAxis.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
         const double RotationAngle = CarrierPlate->AngularVelocity * DeltaTimeMy;
+        if (RotationAxis.IsZero() || RotationAngle == 0.0)
+        {
+            continue;
+        }
 
-        // Rodrigues' rotation formula: v' = v*cos(θ) + (k×v)*sin(θ) + k*(k·v)*(1-cos(θ))
-        const double CosTheta = FMath::Cos(RotationAngle);
-        const double SinTheta = FMath::Sin(RotationAngle);
-        const double OneMinusCosTheta = 1.0 - CosTheta;
+        const FQuat4d StepRotation(RotationAxis, RotationAngle);
+        Terrane.Centroid = StepRotation.RotateVector(Terrane.Centroid).GetSafeNormal();
+        Terrane.PendingPayloadRotation = StepRotation * Terrane.PendingPayloadRotation;
+        Terrane.PendingPayloadRotation.Normalize();
+    }
+
+    BumpOceanicAmplificationSerial();
+}
+
+void UTectonicSimulationService::MaterializeTerranePayload(FContinentalTerrane& Terrane) const
+{
+    if (Terrane.PendingPayloadRotation.Equals(FQuat4d::Identity, 0.0))
+    {
+        return;
+    }
+
+    const FQuat4d Rotation = Terrane.PendingPayloadRotation;
+    for (FTerraneVertexRecord& VertexRecord : Terrane.VertexPayload)
+    {
+        VertexRecord.Position = Rotation.RotateVector(VertexRecord.Position).GetSafeNormal();
+    }
+    Terrane.PendingPayloadRotation = FQuat4d::Identity;
+}
+
+void UTectonicSimulationService::RefreshTerraneCollisionIndex()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefreshTerraneCollisionIndex);
+
+    FTerraneCollisionIndex& Index = TerraneCollisionIndex;
+    Index.Segments.Reset();
+    for (TPair<int32, TArray<int32>>& Pair : Index.CarrierSegments)
+    {
+        Pair.Value.Reset();
+    }
 
-        for (FTerraneVertexRecord& VertexRecord : Terrane.VertexPayload)
+    const FPlateMetadataTable& Metadata = GetPlateMetadata();
+
+    auto AddSegments = [this, &Index](const FPlateBoundary& Boundary, int32 CarrierPlateID, int32 TargetPlateID, int32 TargetPlateOrder)
+    {
+        TArray<int32>& Bucket = Index.CarrierSegments.FindOrAdd(CarrierPlateID);
+        const int32 PointCount = Boundary.SharedEdgeVertices.Num();
+        const int32 SegmentCount = PointCount > 1 ? PointCount - 1 : PointCount;
+        for (int32 SegmentIdx = 0; SegmentIdx < SegmentCount; ++SegmentIdx)
+        {
+            const int32 V0Index = Boundary.SharedEdgeVertices[SegmentIdx];
+            const int32 V1Index = Boundary.SharedEdgeVertices[FMath::Min(SegmentIdx + 1, PointCount - 1)];
+            if (!SharedVertices.IsValidIndex(V0Index) || !SharedVertices.IsValidIndex(V1Index))
+            {
+                continue;
+            }
+
+            FTerraneCollisionIndex::FSegment Segment;
+            Segment.V0 = SharedVertices[V0Index].GetSafeNormal();
+            Segment.V1 = SharedVertices[V1Index].GetSafeNormal();
+            Segment.CapCenter = (Segment.V0 + Segment.V1).GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, Segment.V0);
+            Segment.CapRadiusRad = FMath::Acos(FMath::Clamp(Segment.CapCenter | Segment.V0, -1.0, 1.0));
+            Segment.TargetPlateID = TargetPlateID;
+            Segment.TargetPlateOrder = TargetPlateOrder;
+            Bucket.Add(Index.Segments.Add(Segment));
+        }
+    };
+
+    for (const TPair<TPair<int32, int32>, FPlateBoundary>& BoundaryPair : Boundaries)
+    {
+        const FPlateBoundary& Boundary = BoundaryPair.Value;
+        if (Boundary.BoundaryType != EBoundaryType::Convergent || Boundary.SharedEdgeVertices.Num() == 0)
         {
-            FVector3d& V = VertexRecord.Position;
-            const FVector3d KCrossV = RotationAxis ^ V;
-            const double KDotV = RotationAxis | V;
+            continue;
+        }
 
-            V = V * CosTheta + KCrossV * SinTheta + RotationAxis * KDotV * OneMinusCosTheta;
-            V.Normalize(); // Maintain unit sphere
+        const int32 PlateAID = BoundaryPair.Key.Key;
+        const int32 PlateBID = BoundaryPair.Key.Value;
+        const int32 PlateAOrder = Metadata.FindIndex(PlateAID);
+        const int32 PlateBOrder = Metadata.FindIndex(PlateBID);
+        if (PlateAOrder == INDEX_NONE || PlateBOrder == INDEX_NONE)
+        {
+            continue;
         }
 
-        // Update terrane centroid
-        FVector3d NewCentroid = FVector3d::ZeroVector;
-        for (const FTerraneVertexRecord& VertexRecord : Terrane.VertexPayload)
+        // A terrane carried by one side collides with the other side when that side is continental.
+        if (Metadata.CrustTypes[PlateBOrder] == ECrustType::Continental)
         {
-            NewCentroid += VertexRecord.Position;
+            AddSegments(Boundary, PlateAID, PlateBID, PlateBOrder);
         }
-        if (Terrane.VertexPayload.Num() > 0)
+        if (Metadata.CrustTypes[PlateAOrder] == ECrustType::Continental)
         {
-            NewCentroid /= static_cast<double>(Terrane.VertexPayload.Num());
-            Terrane.Centroid = NewCentroid.GetSafeNormal();
+            AddSegments(Boundary, PlateBID, PlateAID, PlateAOrder);
         }
     }
 
-    BumpOceanicAmplificationSerial();
+    // Scan order matches the previous per-plate loop: the first continental plate in Plates order wins.
+    for (TPair<int32, TArray<int32>>& Pair : Index.CarrierSegments)
+    {
+        Pair.Value.StableSort([&Index](int32 A, int32 B)
+        {
+            return Index.Segments[A].TargetPlateOrder < Index.Segments[B].TargetPlateOrder;
+        });
+    }
 }
 
 void UTectonicSimulationService::DetectTerraneCollisions()
@@ -7589,6 +8364,20 @@ void UTectonicSimulationService::DetectTerraneCollisions()
     const double CollisionThreshold_km = 500.0; // Paper Section 6: proximity threshold for collision detection
     const double CollisionThreshold_rad = CollisionThreshold_km / (Parameters.PlanetRadius / 1000.0);
 
+    TerraneCollisionIndex.LastCapHits = 0;
+    TerraneCollisionIndex.LastSegmentsVisited = 0;
+
+    const bool bAnyTransporting = Terranes.ContainsByPredicate([](const FContinentalTerrane& Terrane)
+    {
+        return Terrane.State == ETerraneState::Transporting;
+    });
+    if (!bAnyTransporting)
+    {
+        return;
+    }
+
+    RefreshTerraneCollisionIndex();
+
     for (FContinentalTerrane& Terrane : Terranes)
     {
         // Only check terranes that are currently being transported
@@ -7597,104 +8386,112 @@ void UTectonicSimulationService::DetectTerraneCollisions()
             continue;
         }
 
-        // Check distance to all continental plates
-        for (const FTectonicPlate& Plate : Plates)
+        // Only convergent boundaries between the carrier and a continental plate can trigger a collision
+        const TArray<int32>* CarrierSegments = TerraneCollisionIndex.CarrierSegments.Find(Terrane.CarrierPlateID);
+        if (!CarrierSegments)
         {
-            if (Plate.CrustType != ECrustType::Continental)
+            continue;
+        }
+
+        // Query cap: the terrane footprint grown by the threshold. A segment whose cap misses it cannot hold a
+        // boundary point within the threshold of the centroid.
+        const double QueryRadius = Terrane.BoundingRadiusRad + CollisionThreshold_rad;
+
+        int32 HitPlateOrder = INDEX_NONE;
+        int32 HitPlateID = INDEX_NONE;
+        double MinDistanceToBoundary = TNumericLimits<double>::Max();
+        for (const int32 SegmentID : *CarrierSegments)
+        {
+            const FTerraneCollisionIndex::FSegment& Segment = TerraneCollisionIndex.Segments[SegmentID];
+            if (HitPlateOrder != INDEX_NONE && Segment.TargetPlateOrder != HitPlateOrder)
             {
-                continue; // Skip oceanic plates
+                break; // Later plates only matter when no earlier plate was in range
             }
 
             // Skip source plate (terrane came from here)
-            if (Plate.PlateID == Terrane.SourcePlateID)
+            if (Segment.TargetPlateID == Terrane.SourcePlateID)
             {
                 continue;
             }
 
-            // Check if terrane is approaching this continental plate
-            // Find closest boundary point between carrier and target plate
-            const TPair<int32, int32> BoundaryKey = Terrane.CarrierPlateID < Plate.PlateID
-                ? MakeTuple(Terrane.CarrierPlateID, Plate.PlateID)
-                : MakeTuple(Plate.PlateID, Terrane.CarrierPlateID);
-
-            const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey);
-            if (!Boundary)
-            {
-                continue; // No boundary between carrier and this continental plate
-            }
-
-            // Check if boundary is convergent (collision zone)
-            if (Boundary->BoundaryType != EBoundaryType::Convergent)
+            ++TerraneCollisionIndex.LastSegmentsVisited;
+            if ((Terrane.Centroid | Segment.CapCenter) < FMath::Cos(FMath::Min(QueryRadius + Segment.CapRadiusRad, PI)))
             {
-                continue; // Only convergent boundaries trigger collisions
+                continue;
             }
+            ++TerraneCollisionIndex.LastCapHits;
 
-            // Compute distance from terrane centroid to boundary
-            double MinDistanceToBoundary = TNumericLimits<double>::Max();
-            for (int32 SharedVertexIdx : Boundary->SharedEdgeVertices)
+            // Distance from terrane centroid to the boundary points
+            const double Distance = FMath::Min(
+                FMath::Acos(FMath::Clamp(Terrane.Centroid | Segment.V0, -1.0, 1.0)),
+                FMath::Acos(FMath::Clamp(Terrane.Centroid | Segment.V1, -1.0, 1.0)));
+            if (Distance < CollisionThreshold_rad)
             {
-                if (SharedVertexIdx < 0 || SharedVertexIdx >= SharedVertices.Num())
-                {
-                    continue;
-                }
-
-                const FVector3d& BoundaryPoint = SharedVertices[SharedVertexIdx];
-                const double Distance = FMath::Acos(FMath::Clamp(Terrane.Centroid | BoundaryPoint, -1.0, 1.0));
-
-                if (Distance < MinDistanceToBoundary)
-                {
-                    MinDistanceToBoundary = Distance;
-                }
+                HitPlateOrder = Segment.TargetPlateOrder;
+                HitPlateID = Segment.TargetPlateID;
+                MinDistanceToBoundary = FMath::Min(MinDistanceToBoundary, Distance);
             }
+        }
 
-            // Check if terrane is within collision threshold
-            if (MinDistanceToBoundary < CollisionThreshold_rad)
-            {
-                // Mark terrane as colliding and set target plate
-                Terrane.State = ETerraneState::Colliding;
-                Terrane.TargetPlateID = Plate.PlateID;
-
-                const double DistanceKm = MinDistanceToBoundary * (Parameters.PlanetRadius / 1000.0);
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("DetectTerraneCollisions: Terrane %d approaching plate %d (distance: %.1f km, threshold: %.1f km)"),
-                    Terrane.TerraneID, Plate.PlateID, DistanceKm, CollisionThreshold_km);
+        if (HitPlateID != INDEX_NONE)
+        {
+            // Mark terrane as colliding and set target plate
+            Terrane.State = ETerraneState::Colliding;
+            Terrane.TargetPlateID = HitPlateID;
 
-                break; // Stop checking other plates for this terrane
-            }
+            const double DistanceKm = MinDistanceToBoundary * (Parameters.PlanetRadius / 1000.0);
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("DetectTerraneCollisions: Terrane %d approaching plate %d (distance: %.1f km, threshold: %.1f km)"),
+                Terrane.TerraneID, HitPlateID, DistanceKm, CollisionThreshold_km);
         }
     }
+
+    UE_LOG(LogPlanetaryCreation, Verbose, TEXT("DetectTerraneCollisions: %d convergent segments indexed, %d cap hits of %d visited"),
+        TerraneCollisionIndex.Segments.Num(), TerraneCollisionIndex.LastCapHits, TerraneCollisionIndex.LastSegmentsVisited);
 }
 
 void UTectonicSimulationService::ProcessTerraneReattachments()
 {
-    // Milestone 6 Task 1.3: Automatically reattach colliding terranes
-    // Note: Iterate backwards since ReattachTerrane removes terranes from array
-    for (int32 i = Terranes.Num() - 1; i >= 0; --i)
+    // Milestone 6 Task 1.3: Automatically reattach colliding terranes, staged into one batched splice per step
+    TArray<TPair<int32, int32>> TerraneTargets;
+    for (const FContinentalTerrane& Terrane : Terranes)
     {
-        FContinentalTerrane& Terrane = Terranes[i];
+        if (Terrane.State != ETerraneState::Colliding)
+        {
+            continue;
+        }
 
-        if (Terrane.State == ETerraneState::Colliding)
+        if (Terrane.TargetPlateID == INDEX_NONE)
         {
-            if (Terrane.TargetPlateID == INDEX_NONE)
-            {
-                UE_LOG(LogPlanetaryCreation, Warning, TEXT("ProcessTerraneReattachments: Terrane %d in Colliding state but no target plate assigned, skipping"),
-                    Terrane.TerraneID);
-                continue;
-            }
+            UE_LOG(LogPlanetaryCreation, Warning, TEXT("ProcessTerraneReattachments: Terrane %d in Colliding state but no target plate assigned, skipping"),
+                Terrane.TerraneID);
+            continue;
+        }
 
-            const double TransportDuration = CurrentTimeMy - Terrane.ExtractionTimeMy;
-            UE_LOG(LogPlanetaryCreation, Log, TEXT("ProcessTerraneReattachments: Auto-reattaching terrane %d to plate %d after %.2f My transport"),
-                Terrane.TerraneID, Terrane.TargetPlateID, TransportDuration);
+        const double TransportDuration = CurrentTimeMy - Terrane.ExtractionTimeMy;
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("ProcessTerraneReattachments: Auto-reattaching terrane %d to plate %d after %.2f My transport"),
+            Terrane.TerraneID, Terrane.TargetPlateID, TransportDuration);
+        TerraneTargets.Emplace(Terrane.TerraneID, Terrane.TargetPlateID);
+    }
 
-            // Attempt reattachment (will validate topology and rollback on failure)
-            const bool bSuccess = ReattachTerrane(Terrane.TerraneID, Terrane.TargetPlateID);
+    if (TerraneTargets.Num() == 0)
+    {
+        return;
+    }
 
-            if (!bSuccess)
-            {
-                UE_LOG(LogPlanetaryCreation, Warning, TEXT("ProcessTerraneReattachments: Failed to reattach terrane %d, will retry next step"),
-                    Terrane.TerraneID);
-                // Keep terrane in Colliding state for retry next step
-            }
-            // Note: If successful, terrane was removed from Terranes array by ReattachTerrane
+    // Attempt reattachment (validates topology and rolls the whole batch back on failure)
+    if (ReattachTerranes(TerraneTargets) > 0 || TerraneTargets.Num() == 1)
+    {
+        // Terranes that failed validation stay Colliding for retry next step
+        return;
+    }
+
+    // The batch splice was rejected; isolate the offending terrane so the others still land this step.
+    for (const TPair<int32, int32>& Target : TerraneTargets)
+    {
+        if (!ReattachTerrane(Target.Key, Target.Value))
+        {
+            UE_LOG(LogPlanetaryCreation, Warning, TEXT("ProcessTerraneReattachments: Failed to reattach terrane %d, will retry next step"),
+                Target.Key);
         }
     }
 }
@@ -8027,6 +8824,144 @@ bool UTectonicSimulationService::RefreshRidgeDirectionsIfNeeded()
 
 
 
+namespace
+{
+    /** Per-chunk ridge counters; merged in chunk order so totals are independent of scheduling. */
+    struct FRidgeChunkStats
+    {
+        int32 UpdatedVertices = 0;
+        int32 CacheHits = 0;
+        int32 MissingTangents = 0;
+        int32 PoorAlignment = 0;
+        int32 GradientFallbacks = 0;
+        int32 PlateFallbacks = 0;
+        int32 MotionFallbacks = 0;
+        int32 CacheAvailable = 0;
+        int32 SegmentIndexHits = 0;
+        int32 DivergentBoundaryVertices = 0;
+        int32 DivergentBoundaryValidTangents = 0;
+    };
+
+    constexpr int32 RidgeDirectionChunkSize = 512;
+
+    bool FindNearestRidgeSegment(
+        const FRidgeBoundarySegmentIndex& Index,
+        int32 PlateID,
+        const FVector3d& VertexNormal,
+        FVector3d& OutTangent,
+        double& OutDistanceRadians)
+    {
+        if (!Index.PlateTrees.IsValidIndex(PlateID) || !Index.PlateTrees[PlateID].IsValid())
+        {
+            return false;
+        }
+
+        double ChordDistanceSq = TNumericLimits<double>::Max();
+        const int32 SegmentID = Index.PlateTrees[PlateID].FindNearest(VertexNormal, ChordDistanceSq);
+        if (!Index.SegmentTangents.IsValidIndex(SegmentID))
+        {
+            return false;
+        }
+
+        // Re-project the seed tangent into this vertex's tangent plane.
+        const FVector3d& SeedTangent = Index.SegmentTangents[SegmentID];
+        const FVector3d Projected = (SeedTangent - (SeedTangent | VertexNormal) * VertexNormal)
+            .GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+        if (Projected.IsNearlyZero())
+        {
+            return false;
+        }
+
+        const double HalfChord = FMath::Clamp(FMath::Sqrt(ChordDistanceSq) * 0.5, 0.0, 1.0);
+        OutTangent = Projected;
+        OutDistanceRadians = 2.0 * FMath::Asin(HalfChord);
+        return true;
+    }
+}
+
+void UTectonicSimulationService::RefreshRidgeBoundarySegmentIndex()
+{
+    FRidgeBoundarySegmentIndex& Index = RidgeBoundarySegmentIndex;
+    const int32 VertexCount = RenderVertices.Num();
+    const int32 PlateCount = Plates.Num();
+
+    if (Index.CachedBoundaryCacheSerial == RenderVertexBoundaryCacheSerial &&
+        Index.CachedVertexCount == VertexCount &&
+        Index.CachedPlateCount == PlateCount)
+    {
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefreshRidgeBoundarySegmentIndex);
+
+    Index.PlateTrees.Reset();
+    Index.SegmentTangents.Reset();
+    Index.PlateFallbackTangents.Init(FVector3d::ZeroVector, PlateCount);
+
+    TArray<TArray<FVector3d>> PlateSeedPositions;
+    TArray<TArray<int32>> PlateSeedIDs;
+    PlateSeedPositions.SetNum(PlateCount);
+    PlateSeedIDs.SetNum(PlateCount);
+
+    if (RenderVertexBoundaryCache.Num() == VertexCount)
+    {
+        // Serial in vertex order so the per-plate tangent sums match the previous TMap accumulation exactly.
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            const FRenderVertexBoundaryInfo& Info = RenderVertexBoundaryCache[VertexIdx];
+            if (!Info.bHasBoundary || !Info.bIsDivergent)
+            {
+                continue;
+            }
+
+            if (!Index.PlateFallbackTangents.IsValidIndex(Info.SourcePlateID))
+            {
+                continue;
+            }
+
+            if (Info.BoundaryTangent.IsNearlyZero())
+            {
+                continue;
+            }
+
+            const FVector3d UnitTangent = Info.BoundaryTangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+            Index.PlateFallbackTangents[Info.SourcePlateID] += UnitTangent;
+
+            const bool bIsSeed = Info.DistanceRadians <= 0.0f &&
+                VertexPlateAssignments.IsValidIndex(VertexIdx) &&
+                VertexPlateAssignments[VertexIdx] == Info.SourcePlateID;
+            if (bIsSeed && !UnitTangent.IsNearlyZero())
+            {
+                const int32 SegmentID = Index.SegmentTangents.Add(UnitTangent);
+                PlateSeedPositions[Info.SourcePlateID].Add(RenderVertices[VertexIdx].GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector));
+                PlateSeedIDs[Info.SourcePlateID].Add(SegmentID);
+            }
+        }
+
+        for (FVector3d& Sum : Index.PlateFallbackTangents)
+        {
+            Sum = Sum.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+        }
+    }
+
+    Index.PlateTrees.SetNum(PlateCount);
+    ParallelFor(PlateCount, [&Index, &PlateSeedPositions, &PlateSeedIDs](int32 PlateIdx)
+    {
+        if (PlateSeedPositions[PlateIdx].Num() > 0)
+        {
+            Index.PlateTrees[PlateIdx].Build(PlateSeedPositions[PlateIdx], PlateSeedIDs[PlateIdx]);
+        }
+    });
+
+    Index.CachedBoundaryCacheSerial = RenderVertexBoundaryCacheSerial;
+    Index.CachedVertexCount = VertexCount;
+    Index.CachedPlateCount = PlateCount;
+
+    UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[StageB][RidgeCache] Segment index rebuilt: %d divergent seeds across %d plates"),
+        Index.SegmentTangents.Num(),
+        PlateCount);
+}
+
 void UTectonicSimulationService::ComputeRidgeDirections()
 {
     // Paper Section 5: "using the recorded parameters r_c, i.e. the local direction parallel to the ridge"
@@ -8101,417 +9036,439 @@ void UTectonicSimulationService::ComputeRidgeDirections()
         RidgeDirectionDirtyMask.Reset();
         RidgeDirectionDirtyCount = 0;
         LastRidgeDirectionUpdateCount = 0;
-        return;
-    }
-
-#if UE_BUILD_DEVELOPMENT
-    UE_LOG(LogPlanetaryCreation, VeryVerbose,
-        TEXT("[RidgeCompute] DirtyMask.Num=%d DirtyCount=%d DirtyVertices.Num=%d"),
-        RidgeDirectionDirtyMask.Num(), RidgeDirectionDirtyCount, DirtyVertices.Num());
-#endif
-
-    if (RenderVertexBoundaryCache.Num() != VertexCount)
-    {
-        BuildRenderVertexBoundaryCache();
-    }
-
-    TMap<int32, FVector3d> PlateBoundaryFallbackTangents;
-    if (RenderVertexBoundaryCache.Num() == VertexCount)
-    {
-        for (int32 CacheIdx = 0; CacheIdx < VertexCount; ++CacheIdx)
-        {
-            const FRenderVertexBoundaryInfo& Info = RenderVertexBoundaryCache[CacheIdx];
-            if (!Info.bHasBoundary || !Info.bIsDivergent)
-            {
-                continue;
-            }
-
-            if (Info.SourcePlateID == INDEX_NONE)
-            {
-                continue;
-            }
-
-            if (Info.BoundaryTangent.IsNearlyZero())
-            {
-                continue;
-            }
+        return;
+    }
 
-            FVector3d& Sum = PlateBoundaryFallbackTangents.FindOrAdd(Info.SourcePlateID);
-            Sum += Info.BoundaryTangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-        }
+#if UE_BUILD_DEVELOPMENT
+    UE_LOG(LogPlanetaryCreation, VeryVerbose,
+        TEXT("[RidgeCompute] DirtyMask.Num=%d DirtyCount=%d DirtyVertices.Num=%d"),
+        RidgeDirectionDirtyMask.Num(), RidgeDirectionDirtyCount, DirtyVertices.Num());
+#endif
 
-        for (TPair<int32, FVector3d>& Pair : PlateBoundaryFallbackTangents)
-        {
-            Pair.Value = Pair.Value.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-        }
+    if (RenderVertexBoundaryCache.Num() != VertexCount)
+    {
+        BuildRenderVertexBoundaryCache();
     }
 
-    int32 UpdatedVertices = 0;
-    int32 RidgeCacheHitsLocal = 0;
-    int32 RidgeMissingTangentLocal = 0;
-    int32 RidgePoorAlignmentLocal = 0;
-    int32 RidgeGradientFallbackLocal = 0;
-    int32 RidgePlateFallbackLocal = 0;
-    int32 RidgeMotionFallbackLocal = 0;
-    int32 RidgeCacheAvailableLocal = 0;
-    int32 DivergentBoundaryVertexCount = 0;
-    int32 DivergentBoundaryValidTangents = 0;
+    RefreshRidgeBoundarySegmentIndex();
+    const FRidgeBoundarySegmentIndex& SegmentIndex = RidgeBoundarySegmentIndex;
+
 #if UE_BUILD_DEVELOPMENT
-    int32 RidgeDiagLogged = 0;
+    std::atomic<int32> RidgeDiagLogged{0};
+    auto ClaimRidgeDiagSlot = [&RidgeDiagLogged]()
+    {
+        return RidgeDiagLogged.fetch_add(1, std::memory_order_relaxed) < 50;
+    };
 #endif
 
     const double InfluenceRadians = FMath::Max(Parameters.RidgeBoundaryInfluenceRadians, 0.0);
     const bool bUseDistanceGate = InfluenceRadians > UE_DOUBLE_SMALL_NUMBER;
 
-    for (int32 VertexIdx : DirtyVertices)
+    // Each dirty vertex only writes its own slots, so chunks run independently; counters stay per chunk.
+    const int32 DirtyVertexTotal = DirtyVertices.Num();
+    const int32 ChunkCount = FMath::DivideAndRoundUp(DirtyVertexTotal, RidgeDirectionChunkSize);
+    TArray<FRidgeChunkStats> ChunkStats;
+    ChunkStats.SetNum(ChunkCount);
+
+    ParallelFor(ChunkCount, [&](int32 ChunkIdx)
     {
-        if (!RenderVertices.IsValidIndex(VertexIdx))
+        FRidgeChunkStats& Stats = ChunkStats[ChunkIdx];
+        const int32 ChunkBegin = ChunkIdx * RidgeDirectionChunkSize;
+        const int32 ChunkEnd = FMath::Min(ChunkBegin + RidgeDirectionChunkSize, DirtyVertexTotal);
+
+        for (int32 DirtyIdx = ChunkBegin; DirtyIdx < ChunkEnd; ++DirtyIdx)
         {
-            continue;
-        }
+            const int32 VertexIdx = DirtyVertices[DirtyIdx];
+            if (!RenderVertices.IsValidIndex(VertexIdx))
+            {
+                continue;
+            }
 
-        const FVector3d& VertexPosition = RenderVertices[VertexIdx];
-        const int32 PlateID = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
+            const FVector3d& VertexPosition = RenderVertices[VertexIdx];
+            const int32 PlateID = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
 
-        FVector3d ResultDirection = FVector3d::ZAxisVector;
+            FVector3d ResultDirection = FVector3d::ZAxisVector;
 
-        if (PlateID == INDEX_NONE || !Plates.IsValidIndex(PlateID))
-        {
-            VertexRidgeDirections[VertexIdx] = ResultDirection;
-            const FVector3d SafeDir = ResultDirection;
-            RidgeSoA.DirX[VertexIdx] = static_cast<float>(SafeDir.X);
-            RidgeSoA.DirY[VertexIdx] = static_cast<float>(SafeDir.Y);
-            RidgeSoA.DirZ[VertexIdx] = static_cast<float>(SafeDir.Z);
-            ++UpdatedVertices;
-            continue;
-        }
+            if (PlateID == INDEX_NONE || !Plates.IsValidIndex(PlateID))
+            {
+                VertexRidgeDirections[VertexIdx] = ResultDirection;
+                const FVector3d SafeDir = ResultDirection;
+                RidgeSoA.DirX[VertexIdx] = static_cast<float>(SafeDir.X);
+                RidgeSoA.DirY[VertexIdx] = static_cast<float>(SafeDir.Y);
+                RidgeSoA.DirZ[VertexIdx] = static_cast<float>(SafeDir.Z);
+                ++Stats.UpdatedVertices;
+                continue;
+            }
 
-        const FTectonicPlate& Plate = Plates[PlateID];
-        if (Plate.CrustType != ECrustType::Oceanic)
-        {
-            VertexRidgeDirections[VertexIdx] = ResultDirection;
-            const FVector3d SafeDir = ResultDirection;
-            RidgeSoA.DirX[VertexIdx] = static_cast<float>(SafeDir.X);
-            RidgeSoA.DirY[VertexIdx] = static_cast<float>(SafeDir.Y);
-            RidgeSoA.DirZ[VertexIdx] = static_cast<float>(SafeDir.Z);
-            if (VertexRidgeTangents.IsValidIndex(VertexIdx))
+            const FTectonicPlate& Plate = Plates[PlateID];
+            if (Plate.CrustType != ECrustType::Oceanic)
             {
-                VertexRidgeTangents[VertexIdx] = FVector3f::ZeroVector;
+                VertexRidgeDirections[VertexIdx] = ResultDirection;
+                const FVector3d SafeDir = ResultDirection;
+                RidgeSoA.DirX[VertexIdx] = static_cast<float>(SafeDir.X);
+                RidgeSoA.DirY[VertexIdx] = static_cast<float>(SafeDir.Y);
+                RidgeSoA.DirZ[VertexIdx] = static_cast<float>(SafeDir.Z);
+                if (VertexRidgeTangents.IsValidIndex(VertexIdx))
+                {
+                    VertexRidgeTangents[VertexIdx] = FVector3f::ZeroVector;
+                }
+                ++Stats.UpdatedVertices;
+                continue;
             }
-            ++UpdatedVertices;
-            continue;
-        }
 
-        FVector3f ExistingStoredTangent = FVector3f::ZeroVector;
-        FVector3d StoredBoundaryTangent = FVector3d::ZeroVector;
-        bool bHadStoredBoundaryTangent = false;
-        if (VertexRidgeTangents.IsValidIndex(VertexIdx))
-        {
-            ExistingStoredTangent = VertexRidgeTangents[VertexIdx];
-            StoredBoundaryTangent = FVector3d(
-                static_cast<double>(ExistingStoredTangent.X),
-                static_cast<double>(ExistingStoredTangent.Y),
-                static_cast<double>(ExistingStoredTangent.Z));
-            if (!StoredBoundaryTangent.IsNearlyZero())
+            FVector3f ExistingStoredTangent = FVector3f::ZeroVector;
+            FVector3d StoredBoundaryTangent = FVector3d::ZeroVector;
+            bool bHadStoredBoundaryTangent = false;
+            if (VertexRidgeTangents.IsValidIndex(VertexIdx))
             {
-                StoredBoundaryTangent = StoredBoundaryTangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-                bHadStoredBoundaryTangent = !StoredBoundaryTangent.IsNearlyZero();
+                ExistingStoredTangent = VertexRidgeTangents[VertexIdx];
+                StoredBoundaryTangent = FVector3d(
+                    static_cast<double>(ExistingStoredTangent.X),
+                    static_cast<double>(ExistingStoredTangent.Y),
+                    static_cast<double>(ExistingStoredTangent.Z));
+                if (!StoredBoundaryTangent.IsNearlyZero())
+                {
+                    StoredBoundaryTangent = StoredBoundaryTangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+                    bHadStoredBoundaryTangent = !StoredBoundaryTangent.IsNearlyZero();
+                }
             }
-        }
 
-        const FVector3d VertexNormal = VertexPosition.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
-        const bool bIsYoungCrust = VertexCrustAge.IsValidIndex(VertexIdx) && VertexCrustAge[VertexIdx] <= 15.0;
+            const FVector3d VertexNormal = VertexPosition.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
+            const bool bIsYoungCrust = VertexCrustAge.IsValidIndex(VertexIdx) && VertexCrustAge[VertexIdx] <= 15.0;
 
-        bool bUsedBoundaryCache = false;
-        bool bUsedGradient = false;
-        bool bAppliedPlateFallback = false;
-        bool bAppliedMotionFallback = false;
+            bool bUsedBoundaryCache = false;
+            bool bUsedGradient = false;
+            bool bAppliedPlateFallback = false;
+            bool bAppliedMotionFallback = false;
 
-        double BoundaryDistance = TNumericLimits<double>::Max();
-        FVector3d SelectedBoundaryTangent = FVector3d::ZeroVector;
+            double BoundaryDistance = TNumericLimits<double>::Max();
+            FVector3d SelectedBoundaryTangent = FVector3d::ZeroVector;
 
-        bool bCacheValid = false;
-        bool bCacheWithinInfluence = false;
-        bool bIsDivergentBoundaryCandidate = false;
+            bool bCacheValid = false;
+            bool bCacheWithinInfluence = false;
+            bool bIsDivergentBoundaryCandidate = false;
 
-        if (RenderVertexBoundaryCache.IsValidIndex(VertexIdx))
-        {
-            const FRenderVertexBoundaryInfo& CacheInfo = RenderVertexBoundaryCache[VertexIdx];
-            if (CacheInfo.bHasBoundary && CacheInfo.bIsDivergent && CacheInfo.SourcePlateID == Plate.PlateID)
+            if (RenderVertexBoundaryCache.IsValidIndex(VertexIdx))
             {
-                bIsDivergentBoundaryCandidate = true;
-
-                if (!CacheInfo.BoundaryTangent.IsNearlyZero())
+                const FRenderVertexBoundaryInfo& CacheInfo = RenderVertexBoundaryCache[VertexIdx];
+                if (CacheInfo.bHasBoundary && CacheInfo.bIsDivergent && CacheInfo.SourcePlateID == Plate.PlateID)
                 {
-                    bCacheValid = true;
-                    ++RidgeCacheAvailableLocal;
+                    bIsDivergentBoundaryCandidate = true;
 
-                    BoundaryDistance = FMath::Max(static_cast<double>(CacheInfo.DistanceRadians), 0.0);
-                    SelectedBoundaryTangent = CacheInfo.BoundaryTangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-                    if (!SelectedBoundaryTangent.IsNearlyZero())
+                    if (!CacheInfo.BoundaryTangent.IsNearlyZero())
                     {
-                        StoredBoundaryTangent = SelectedBoundaryTangent;
-                        bHadStoredBoundaryTangent = true;
+                        bCacheValid = true;
+                        ++Stats.CacheAvailable;
+
+                        BoundaryDistance = FMath::Max(static_cast<double>(CacheInfo.DistanceRadians), 0.0);
+                        SelectedBoundaryTangent = CacheInfo.BoundaryTangent.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+                        if (!SelectedBoundaryTangent.IsNearlyZero())
+                        {
+                            StoredBoundaryTangent = SelectedBoundaryTangent;
+                            bHadStoredBoundaryTangent = true;
+                        }
+
+                        bCacheWithinInfluence = !bUseDistanceGate || BoundaryDistance <= InfluenceRadians;
+                        if (bCacheWithinInfluence && !SelectedBoundaryTangent.IsNearlyZero())
+                        {
+                            ResultDirection = SelectedBoundaryTangent;
+                            bUsedBoundaryCache = true;
+                            ++Stats.CacheHits;
+                        }
                     }
+                }
+            }
 
+            if (!bIsDivergentBoundaryCandidate)
+            {
+                // No cache entry for this plate (past the propagation radius or stale after reassignment):
+                // take the tangent of the nearest divergent seed on the same plate from the segment index.
+                // The distance only feeds the diagnostics below.
+                FVector3d SegmentTangent = FVector3d::ZeroVector;
+                double SegmentDistance = TNumericLimits<double>::Max();
+                if (FindNearestRidgeSegment(SegmentIndex, Plate.PlateID, VertexNormal, SegmentTangent, SegmentDistance))
+                {
+                    bCacheValid = true;
+                    BoundaryDistance = SegmentDistance;
+                    SelectedBoundaryTangent = SegmentTangent;
                     bCacheWithinInfluence = !bUseDistanceGate || BoundaryDistance <= InfluenceRadians;
-                    if (bCacheWithinInfluence && !SelectedBoundaryTangent.IsNearlyZero())
-                    {
-                        ResultDirection = SelectedBoundaryTangent;
-                        bUsedBoundaryCache = true;
-                        ++RidgeCacheHitsLocal;
-                    }
+                    ResultDirection = SelectedBoundaryTangent;
+                    bUsedBoundaryCache = true;
+                    ++Stats.CacheHits;
+                    ++Stats.SegmentIndexHits;
                 }
             }
-        }
 
-        if (!bUsedBoundaryCache && bCacheValid && bIsDivergentBoundaryCandidate && bHadStoredBoundaryTangent)
-        {
-            ResultDirection = StoredBoundaryTangent;
-            bUsedBoundaryCache = true;
-            ++RidgeCacheHitsLocal;
-        }
+            if (!bUsedBoundaryCache && bCacheValid && bIsDivergentBoundaryCandidate && bHadStoredBoundaryTangent)
+            {
+                ResultDirection = StoredBoundaryTangent;
+                bUsedBoundaryCache = true;
+                ++Stats.CacheHits;
+            }
 
-        FVector3d AgeGradient = FVector3d::ZeroVector;
-        double GradientLength = 0.0;
+            FVector3d AgeGradient = FVector3d::ZeroVector;
+            double GradientLength = 0.0;
 
-        if (!bUsedBoundaryCache)
-        {
-            if (VertexCrustAge.IsValidIndex(VertexIdx) && RenderVertexAdjacencyOffsets.IsValidIndex(VertexIdx + 1))
+            if (!bUsedBoundaryCache)
             {
-                const int32 StartAdj = RenderVertexAdjacencyOffsets[VertexIdx];
-                const int32 EndAdj = RenderVertexAdjacencyOffsets[VertexIdx + 1];
-                for (int32 Offset = StartAdj; Offset < EndAdj; ++Offset)
+                if (VertexCrustAge.IsValidIndex(VertexIdx) && RenderVertexAdjacencyOffsets.IsValidIndex(VertexIdx + 1))
                 {
-                    const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
-                    if (!RenderVertices.IsValidIndex(NeighborIdx))
+                    const int32 StartAdj = RenderVertexAdjacencyOffsets[VertexIdx];
+                    const int32 EndAdj = RenderVertexAdjacencyOffsets[VertexIdx + 1];
+                    for (int32 Offset = StartAdj; Offset < EndAdj; ++Offset)
                     {
-                        continue;
-                    }
+                        const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
+                        if (!RenderVertices.IsValidIndex(NeighborIdx))
+                        {
+                            continue;
+                        }
 
-                    if (!VertexCrustAge.IsValidIndex(NeighborIdx))
-                    {
-                        continue;
-                    }
+                        if (!VertexCrustAge.IsValidIndex(NeighborIdx))
+                        {
+                            continue;
+                        }
 
-                    const int32 NeighborPlateID = VertexPlateAssignments.IsValidIndex(NeighborIdx) ? VertexPlateAssignments[NeighborIdx] : INDEX_NONE;
-                    if (NeighborPlateID != Plate.PlateID)
-                    {
-                        continue;
-                    }
+                        const int32 NeighborPlateID = VertexPlateAssignments.IsValidIndex(NeighborIdx) ? VertexPlateAssignments[NeighborIdx] : INDEX_NONE;
+                        if (NeighborPlateID != Plate.PlateID)
+                        {
+                            continue;
+                        }
 
-                    FVector3d Step = RenderVertices[NeighborIdx] - VertexPosition;
-                    Step -= (Step | VertexNormal) * VertexNormal;
-                    if (Step.IsNearlyZero())
-                    {
-                        continue;
-                    }
+                        FVector3d Step = RenderVertices[NeighborIdx] - VertexPosition;
+                        Step -= (Step | VertexNormal) * VertexNormal;
+                        if (Step.IsNearlyZero())
+                        {
+                            continue;
+                        }
 
-                    const double AgeDiff = VertexCrustAge[NeighborIdx] - VertexCrustAge[VertexIdx];
-                    AgeGradient += AgeDiff * Step;
+                        const double AgeDiff = VertexCrustAge[NeighborIdx] - VertexCrustAge[VertexIdx];
+                        AgeGradient += AgeDiff * Step;
+                    }
                 }
-            }
 
-            GradientLength = AgeGradient.Length();
-            if (GradientLength > UE_DOUBLE_SMALL_NUMBER)
-            {
-                const FVector3d GradientDir = (AgeGradient / GradientLength).GetSafeNormal();
-                FVector3d Candidate = FVector3d::CrossProduct(VertexNormal, GradientDir).GetSafeNormal();
-                if (!Candidate.IsNearlyZero())
+                GradientLength = AgeGradient.Length();
+                if (GradientLength > UE_DOUBLE_SMALL_NUMBER)
                 {
-                    ResultDirection = Candidate;
-                    bUsedGradient = true;
+                    const FVector3d GradientDir = (AgeGradient / GradientLength).GetSafeNormal();
+                    FVector3d Candidate = FVector3d::CrossProduct(VertexNormal, GradientDir).GetSafeNormal();
+                    if (!Candidate.IsNearlyZero())
+                    {
+                        ResultDirection = Candidate;
+                        bUsedGradient = true;
+                    }
                 }
             }
-        }
 
-        if (!bUsedBoundaryCache && !bUsedGradient)
-        {
-            if (bIsYoungCrust)
+            if (!bUsedBoundaryCache && !bUsedGradient)
             {
-                if (const FVector3d* PlateFallback = PlateBoundaryFallbackTangents.Find(Plate.PlateID))
+                if (bIsYoungCrust)
                 {
-                    if (PlateFallback && !PlateFallback->IsNearlyZero())
+                    const FVector3d PlateFallback = SegmentIndex.PlateFallbackTangents.IsValidIndex(Plate.PlateID)
+                        ? SegmentIndex.PlateFallbackTangents[Plate.PlateID]
+                        : FVector3d::ZeroVector;
+                    if (!PlateFallback.IsNearlyZero())
                     {
-                        const FVector3d PlateDir = PlateFallback->GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+                        const FVector3d PlateDir = PlateFallback.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
                         if (!PlateDir.IsNearlyZero())
                         {
                             ResultDirection = PlateDir;
                             bAppliedPlateFallback = true;
-                            ++RidgePlateFallbackLocal;
+                            ++Stats.PlateFallbacks;
                         }
                     }
-                }
 
-                if (!bAppliedPlateFallback)
-                {
-                    const FVector3d PlateAxis = Plate.EulerPoleAxis.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
-                    FVector3d PlateMotion = FVector3d::CrossProduct(PlateAxis, VertexPosition).GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-                    if (!PlateMotion.IsNearlyZero())
+                    if (!bAppliedPlateFallback)
                     {
-                        FVector3d MotionDir = FVector3d::CrossProduct(VertexNormal, PlateMotion).GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
-                        if (!MotionDir.IsNearlyZero())
+                        const FVector3d PlateAxis = Plate.EulerPoleAxis.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
+                        FVector3d PlateMotion = FVector3d::CrossProduct(PlateAxis, VertexPosition).GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+                        if (!PlateMotion.IsNearlyZero())
                         {
-                            ResultDirection = MotionDir;
-                            bAppliedMotionFallback = true;
-                            ++RidgeMotionFallbackLocal;
+                            FVector3d MotionDir = FVector3d::CrossProduct(VertexNormal, PlateMotion).GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZeroVector);
+                            if (!MotionDir.IsNearlyZero())
+                            {
+                                ResultDirection = MotionDir;
+                                bAppliedMotionFallback = true;
+                                ++Stats.MotionFallbacks;
+                            }
                         }
                     }
                 }
-            }
 
-            if (!bAppliedPlateFallback && !bAppliedMotionFallback)
-            {
-                ResultDirection = FVector3d::CrossProduct(VertexNormal, FVector3d::UpVector).GetSafeNormal();
-                if (ResultDirection.IsNearlyZero())
+                if (!bAppliedPlateFallback && !bAppliedMotionFallback)
                 {
-                    ResultDirection = FVector3d::ZAxisVector;
+                    ResultDirection = FVector3d::CrossProduct(VertexNormal, FVector3d::UpVector).GetSafeNormal();
+                    if (ResultDirection.IsNearlyZero())
+                    {
+                        ResultDirection = FVector3d::ZAxisVector;
+                    }
                 }
             }
-        }
 
-        if (bIsDivergentBoundaryCandidate)
-        {
-            ++DivergentBoundaryVertexCount;
-            if (bCacheValid)
+            if (bIsDivergentBoundaryCandidate)
             {
-                ++DivergentBoundaryValidTangents;
+                ++Stats.DivergentBoundaryVertices;
+                if (bCacheValid)
+                {
+                    ++Stats.DivergentBoundaryValidTangents;
+                }
             }
-        }
 
-        VertexRidgeDirections[VertexIdx] = ResultDirection;
+            VertexRidgeDirections[VertexIdx] = ResultDirection;
 
-        const FVector3d SafeDir = ResultDirection.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
-        RidgeSoA.DirX[VertexIdx] = static_cast<float>(SafeDir.X);
-        RidgeSoA.DirY[VertexIdx] = static_cast<float>(SafeDir.Y);
-        RidgeSoA.DirZ[VertexIdx] = static_cast<float>(SafeDir.Z);
+            const FVector3d SafeDir = ResultDirection.GetSafeNormal(UE_DOUBLE_SMALL_NUMBER, FVector3d::ZAxisVector);
+            RidgeSoA.DirX[VertexIdx] = static_cast<float>(SafeDir.X);
+            RidgeSoA.DirY[VertexIdx] = static_cast<float>(SafeDir.Y);
+            RidgeSoA.DirZ[VertexIdx] = static_cast<float>(SafeDir.Z);
 
-        FVector3f TangentToStore = ExistingStoredTangent;
-        bool bShouldWriteTangent = false;
-        if (bCacheValid)
-        {
-            TangentToStore = FVector3f(
-                static_cast<float>(SelectedBoundaryTangent.X),
-                static_cast<float>(SelectedBoundaryTangent.Y),
-                static_cast<float>(SelectedBoundaryTangent.Z));
-            bShouldWriteTangent = true;
-        }
-        else if (!bHadStoredBoundaryTangent && (bUsedGradient || bAppliedPlateFallback || bAppliedMotionFallback))
-        {
-            TangentToStore = FVector3f(
-                static_cast<float>(SafeDir.X),
-                static_cast<float>(SafeDir.Y),
-                static_cast<float>(SafeDir.Z));
-            bShouldWriteTangent = true;
-        }
+            FVector3f TangentToStore = ExistingStoredTangent;
+            bool bShouldWriteTangent = false;
+            if (bCacheValid)
+            {
+                TangentToStore = FVector3f(
+                    static_cast<float>(SelectedBoundaryTangent.X),
+                    static_cast<float>(SelectedBoundaryTangent.Y),
+                    static_cast<float>(SelectedBoundaryTangent.Z));
+                bShouldWriteTangent = true;
+            }
+            else if (!bHadStoredBoundaryTangent && (bUsedGradient || bAppliedPlateFallback || bAppliedMotionFallback))
+            {
+                TangentToStore = FVector3f(
+                    static_cast<float>(SafeDir.X),
+                    static_cast<float>(SafeDir.Y),
+                    static_cast<float>(SafeDir.Z));
+                bShouldWriteTangent = true;
+            }
 
-        if (bShouldWriteTangent && VertexRidgeTangents.IsValidIndex(VertexIdx))
-        {
-            VertexRidgeTangents[VertexIdx] = TangentToStore;
-        }
+            if (bShouldWriteTangent && VertexRidgeTangents.IsValidIndex(VertexIdx))
+            {
+                VertexRidgeTangents[VertexIdx] = TangentToStore;
+            }
 
-        ++UpdatedVertices;
+            ++Stats.UpdatedVertices;
 
-        const double DirLength = ResultDirection.Length();
-        const bool bUsedFallback = bAppliedPlateFallback || bAppliedMotionFallback;
+            const double DirLength = ResultDirection.Length();
+            const bool bUsedFallback = bAppliedPlateFallback || bAppliedMotionFallback;
 
-        if (VertexCrustAge.IsValidIndex(VertexIdx) && VertexCrustAge[VertexIdx] < 15.0)
-        {
-            if (!bCacheValid && !bUsedGradient && !bUsedFallback)
-            {
-                ++RidgeMissingTangentLocal;
-#if UE_BUILD_DEVELOPMENT
-                if (RidgeDiagLogged < 50)
-                {
-                    UE_LOG(LogPlanetaryCreation, Warning,
-                        TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My missing cache tangent"),
-                        VertexIdx,
-                        Plate.PlateID,
-                        VertexCrustAge[VertexIdx]);
-                    ++RidgeDiagLogged;
-                }
-#endif
-            }
-            else if (bCacheWithinInfluence)
+            if (VertexCrustAge.IsValidIndex(VertexIdx) && VertexCrustAge[VertexIdx] < 15.0)
             {
-                if (!bUsedBoundaryCache)
+                if (!bCacheValid && !bUsedGradient && !bUsedFallback)
                 {
-                    ++RidgeMissingTangentLocal;
+                    ++Stats.MissingTangents;
 #if UE_BUILD_DEVELOPMENT
-                    if (RidgeDiagLogged < 50)
+                    if (ClaimRidgeDiagSlot())
                     {
                         UE_LOG(LogPlanetaryCreation, Warning,
-                            TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My cache tangent suppressed (dist=%.3f rad)"),
+                            TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My missing cache tangent"),
                             VertexIdx,
                             Plate.PlateID,
-                            VertexCrustAge[VertexIdx],
-                            BoundaryDistance);
-                        ++RidgeDiagLogged;
+                            VertexCrustAge[VertexIdx]);
                     }
 #endif
                 }
-                else
+                else if (bCacheWithinInfluence)
                 {
-                    const double Alignment = FMath::Abs(ResultDirection | SelectedBoundaryTangent);
-                    if (DirLength < 0.95 || Alignment < 0.95)
+                    if (!bUsedBoundaryCache)
                     {
-                        ++RidgePoorAlignmentLocal;
+                        ++Stats.MissingTangents;
 #if UE_BUILD_DEVELOPMENT
-                        if (RidgeDiagLogged < 50)
+                        if (ClaimRidgeDiagSlot())
                         {
                             UE_LOG(LogPlanetaryCreation, Warning,
-                                TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My |Dir|=%.3f Alignment=%.1f%% (dist=%.3f rad)"),
+                                TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My cache tangent suppressed (dist=%.3f rad)"),
                                 VertexIdx,
                                 Plate.PlateID,
                                 VertexCrustAge[VertexIdx],
-                                DirLength,
-                                Alignment * 100.0,
                                 BoundaryDistance);
-                            UE_LOG(LogPlanetaryCreation, Warning,
-                                TEXT("    ResultDir=(%.3f, %.3f, %.3f) CacheTan=(%.3f, %.3f, %.3f)"),
-                                ResultDirection.X, ResultDirection.Y, ResultDirection.Z,
-                                SelectedBoundaryTangent.X, SelectedBoundaryTangent.Y, SelectedBoundaryTangent.Z);
-                            ++RidgeDiagLogged;
                         }
 #endif
                     }
-                }
-            }
-            else if (!bCacheValid && bUsedFallback)
-            {
+                    else
+                    {
+                        const double Alignment = FMath::Abs(ResultDirection | SelectedBoundaryTangent);
+                        if (DirLength < 0.95 || Alignment < 0.95)
+                        {
+                            ++Stats.PoorAlignment;
 #if UE_BUILD_DEVELOPMENT
-                if (RidgeDiagLogged < 50)
-                {
-                    UE_LOG(LogPlanetaryCreation, Log,
-                        TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My fallback via %s"),
-                        VertexIdx,
-                        Plate.PlateID,
-                        VertexCrustAge[VertexIdx],
-                        bAppliedPlateFallback ? TEXT("PlateAverage") : TEXT("PlateMotion"));
-                    ++RidgeDiagLogged;
-                }
+                            if (ClaimRidgeDiagSlot())
+                            {
+                                UE_LOG(LogPlanetaryCreation, Warning,
+                                    TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My |Dir|=%.3f Alignment=%.1f%% (dist=%.3f rad)"),
+                                    VertexIdx,
+                                    Plate.PlateID,
+                                    VertexCrustAge[VertexIdx],
+                                    DirLength,
+                                    Alignment * 100.0,
+                                    BoundaryDistance);
+                                UE_LOG(LogPlanetaryCreation, Warning,
+                                    TEXT("    ResultDir=(%.3f, %.3f, %.3f) CacheTan=(%.3f, %.3f, %.3f)"),
+                                    ResultDirection.X, ResultDirection.Y, ResultDirection.Z,
+                                    SelectedBoundaryTangent.X, SelectedBoundaryTangent.Y, SelectedBoundaryTangent.Z);
+                            }
 #endif
-            }
-            else if (bCacheValid && bUsedGradient)
-            {
-                ++RidgeGradientFallbackLocal;
-#if UE_BUILD_DEVELOPMENT
-                if (RidgeDiagLogged < 50)
+                        }
+                    }
+                }
+                else if (!bCacheValid && bUsedFallback)
                 {
-                    UE_LOG(LogPlanetaryCreation, Warning,
-                        TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My gradient fallback (|Grad|=%.3f, dist=%.3f rad)"),
-                        VertexIdx,
-                        Plate.PlateID,
-                        VertexCrustAge[VertexIdx],
-                        GradientLength,
-                        BoundaryDistance);
-                    ++RidgeDiagLogged;
+#if UE_BUILD_DEVELOPMENT
+                    if (ClaimRidgeDiagSlot())
+                    {
+                        UE_LOG(LogPlanetaryCreation, Log,
+                            TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My fallback via %s"),
+                            VertexIdx,
+                            Plate.PlateID,
+                            VertexCrustAge[VertexIdx],
+                            bAppliedPlateFallback ? TEXT("PlateAverage") : TEXT("PlateMotion"));
+                    }
+#endif
                 }
+                else if (bCacheValid && bUsedGradient)
+                {
+                    ++Stats.GradientFallbacks;
+#if UE_BUILD_DEVELOPMENT
+                    if (ClaimRidgeDiagSlot())
+                    {
+                        UE_LOG(LogPlanetaryCreation, Warning,
+                            TEXT("[RidgeDiag] Vertex %d Plate=%d Age=%.2f My gradient fallback (|Grad|=%.3f, dist=%.3f rad)"),
+                            VertexIdx,
+                            Plate.PlateID,
+                            VertexCrustAge[VertexIdx],
+                            GradientLength,
+                            BoundaryDistance);
+                    }
 #endif
+                }
             }
         }
+    }, ChunkCount <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    FRidgeChunkStats Totals;
+    for (const FRidgeChunkStats& Stats : ChunkStats)
+    {
+        Totals.UpdatedVertices += Stats.UpdatedVertices;
+        Totals.CacheHits += Stats.CacheHits;
+        Totals.MissingTangents += Stats.MissingTangents;
+        Totals.PoorAlignment += Stats.PoorAlignment;
+        Totals.GradientFallbacks += Stats.GradientFallbacks;
+        Totals.PlateFallbacks += Stats.PlateFallbacks;
+        Totals.MotionFallbacks += Stats.MotionFallbacks;
+        Totals.CacheAvailable += Stats.CacheAvailable;
+        Totals.SegmentIndexHits += Stats.SegmentIndexHits;
+        Totals.DivergentBoundaryVertices += Stats.DivergentBoundaryVertices;
+        Totals.DivergentBoundaryValidTangents += Stats.DivergentBoundaryValidTangents;
     }
 
+    const int32 UpdatedVertices = Totals.UpdatedVertices;
+    const int32 RidgeCacheHitsLocal = Totals.CacheHits;
+    const int32 RidgeMissingTangentLocal = Totals.MissingTangents;
+    const int32 RidgePoorAlignmentLocal = Totals.PoorAlignment;
+    const int32 RidgeGradientFallbackLocal = Totals.GradientFallbacks;
+    const int32 RidgePlateFallbackLocal = Totals.PlateFallbacks;
+    const int32 RidgeMotionFallbackLocal = Totals.MotionFallbacks;
+    const int32 RidgeCacheAvailableLocal = Totals.CacheAvailable;
+    const int32 DivergentBoundaryVertexCount = Totals.DivergentBoundaryVertices;
+    const int32 DivergentBoundaryValidTangents = Totals.DivergentBoundaryValidTangents;
+
     for (int32 VertexIdx : DirtyVertices)
     {
         if (RidgeDirectionDirtyMask.IsValidIndex(VertexIdx))
@@ -8534,6 +9491,7 @@ void UTectonicSimulationService::ComputeRidgeDirections()
     LastRidgeGradientFallbackCount = RidgeGradientFallbackLocal;
     LastRidgePlateFallbackCount = RidgePlateFallbackLocal;
     LastRidgeMotionFallbackCount = RidgeMotionFallbackLocal;
+    LastRidgeSegmentIndexHitCount = Totals.SegmentIndexHits;
     LastRidgeOceanicVertexCount = DivergentBoundaryVertexCount;
     LastRidgeValidTangentCount = DivergentBoundaryValidTangents;
     const double TangentCoveragePct = DivergentBoundaryVertexCount > 0
@@ -9046,6 +10004,31 @@ bool UTectonicSimulationService::ShouldUseTemporaryIsotropicStageB() const
     return Parameters.RenderSubdivisionLevel >= Parameters.MinAmplificationLOD;
 }
 
+double UTectonicSimulationService::ComputeOceanicRidgeFactor(int32 VertexIdx) const
+{
+    if (RenderVertexBoundaryCache.Num() != RenderVertices.Num() || !RenderVertexBoundaryCache.IsValidIndex(VertexIdx))
+    {
+        return 0.35;
+    }
+
+    const double InfluenceRadians = FMath::DegreesToRadians(8.0);
+    const FRenderVertexBoundaryInfo& BoundaryInfo = RenderVertexBoundaryCache[VertexIdx];
+    if (BoundaryInfo.bHasBoundary && BoundaryInfo.bIsDivergent)
+    {
+        const double DistanceRad = FMath::Max(static_cast<double>(BoundaryInfo.DistanceRadians), 0.0);
+        return FMath::Exp(-DistanceRad / InfluenceRadians);
+    }
+
+    if (BoundaryInfo.bBeyondInfluence)
+    {
+        // Propagation stopped at the cache radius; hold the falloff value there rather than the no-boundary floor.
+        const double CacheRadius = FMath::Max(Parameters.RidgeBoundaryInfluenceRadians, 0.0);
+        return FMath::Exp(-CacheRadius / InfluenceRadians);
+    }
+
+    return BoundaryInfo.bHasBoundary ? 0.15 : 0.35;
+}
+
 void UTectonicSimulationService::ApplyTemporaryIsotropicStageBAmplification(double& OutOceanicCpuSeconds, bool& OutSurfaceDataChanged)
 {
     TRACE_CPUPROFILER_EVENT_SCOPE(StageBIsotropicSpike);
@@ -9090,9 +10073,7 @@ void UTectonicSimulationService::ApplyTemporaryIsotropicStageBAmplification(doub
     const double BaseAmplitude = Parameters.OceanicFaultAmplitude * 0.6;
     const double BaseFrequency = FMath::Max(Parameters.OceanicFaultFrequency, 0.005);
     const bool bHasAge = VertexCrustAge.Num() == VertexCount;
-    const bool bHasBoundaryInfo = RenderVertexBoundaryCache.Num() == VertexCount;
     const double AgeFalloff = FMath::Max(Parameters.OceanicAgeFalloff, 0.0005);
-    const double InfluenceRadians = FMath::DegreesToRadians(8.0);
 
     static const FVector NoiseOffsets[3] =
     {
@@ -9117,21 +10098,7 @@ void UTectonicSimulationService::ApplyTemporaryIsotropicStageBAmplification(doub
             const double AgeMy = bHasAge ? FMath::Max(VertexCrustAge[VertexIdx], 0.0) : 0.0;
             const double AgeFactor = FMath::Exp(-AgeMy * AgeFalloff);
 
-            double RidgeFactor = 0.35;
-            if (bHasBoundaryInfo)
-            {
-                const FRenderVertexBoundaryInfo& BoundaryInfo = RenderVertexBoundaryCache[VertexIdx];
-                if (BoundaryInfo.bHasBoundary && BoundaryInfo.bIsDivergent)
-                {
-                    const double DistanceRad = FMath::Max(static_cast<double>(BoundaryInfo.DistanceRadians), 0.0);
-                    const double Influence = FMath::Max(InfluenceRadians, UE_DOUBLE_SMALL_NUMBER);
-                    RidgeFactor = FMath::Exp(-DistanceRad / Influence);
-                }
-                else if (BoundaryInfo.bHasBoundary)
-                {
-                    RidgeFactor = 0.15;
-                }
-            }
+            const double RidgeFactor = ComputeOceanicRidgeFactor(VertexIdx);
 
             double FbmValue = 0.0;
             double WeightSum = 0.0;
@@ -9795,6 +10762,19 @@ void UTectonicSimulationService::ForceRidgeRingDirtyForTest(const TArray<int32>&
 #endif
 }
 
+bool UTectonicSimulationService::ForceSplitPlateForTest(const TPair<int32, int32>& BoundaryKey)
+{
+    const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey);
+    if (!Boundary)
+    {
+        return false;
+    }
+
+    // SplitPlate rebuilds the boundary map, so hand it a copy.
+    const FPlateBoundary BoundaryCopy = *Boundary;
+    return SplitPlate(BoundaryKey.Key, BoundaryKey, BoundaryCopy);
+}
+
 void UTectonicSimulationService::SetVertexCrustAgeForTest(int32 VertexIndex, double AgeMy)
 {
 #if UE_BUILD_DEVELOPMENT
@@ -11605,6 +12585,16 @@ void UTectonicSimulationService::RefreshRenderVertexFloatSoA() const
 {
     FRenderVertexFloatSoA& Cache = RenderVertexFloatSoA;
     const int32 VertexCount = RenderVertices.Num();
+    const uint64 SourceVersion = RenderPositionColumn != INDEX_NONE ? RenderVertexColumns.GetColumnVersion(RenderPositionColumn) : 0;
+
+    // Views derive from the position column only; rebuild when it has been written since the last build.
+    if (SourceVersion != 0 && Cache.CachedSourceVersion == SourceVersion && Cache.PositionX.Num() == VertexCount)
+    {
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(RefreshRenderVertexFloatSoA);
+    Cache.CachedSourceVersion = SourceVersion;
 
     if (VertexCount <= 0)
     {
@@ -11620,19 +12610,19 @@ void UTectonicSimulationService::RefreshRenderVertexFloatSoA() const
         return;
     }
 
-    Cache.PositionX.SetNum(VertexCount);
-    Cache.PositionY.SetNum(VertexCount);
-    Cache.PositionZ.SetNum(VertexCount);
-    Cache.NormalX.SetNum(VertexCount);
-    Cache.NormalY.SetNum(VertexCount);
-    Cache.NormalZ.SetNum(VertexCount);
-    Cache.TangentX.SetNum(VertexCount);
-    Cache.TangentY.SetNum(VertexCount);
-        Cache.TangentZ.SetNum(VertexCount);
+    Cache.PositionX.SetNumUninitialized(VertexCount);
+    Cache.PositionY.SetNumUninitialized(VertexCount);
+    Cache.PositionZ.SetNumUninitialized(VertexCount);
+    Cache.NormalX.SetNumUninitialized(VertexCount);
+    Cache.NormalY.SetNumUninitialized(VertexCount);
+    Cache.NormalZ.SetNumUninitialized(VertexCount);
+    Cache.TangentX.SetNumUninitialized(VertexCount);
+    Cache.TangentY.SetNumUninitialized(VertexCount);
+    Cache.TangentZ.SetNumUninitialized(VertexCount);
 
-        for (int32 Index = 0; Index < VertexCount; ++Index)
-        {
-            const FVector3d& Vertex = RenderVertices[Index];
+    ParallelFor(VertexCount, [this, &Cache](int32 Index)
+    {
+        const FVector3d& Vertex = RenderVertices[Index];
         Cache.PositionX[Index] = static_cast<float>(Vertex.X);
         Cache.PositionY[Index] = static_cast<float>(Vertex.Y);
         Cache.PositionZ[Index] = static_cast<float>(Vertex.Z);
@@ -11652,7 +12642,7 @@ void UTectonicSimulationService::RefreshRenderVertexFloatSoA() const
         Cache.TangentX[Index] = static_cast<float>(Tangent.X);
         Cache.TangentY[Index] = static_cast<float>(Tangent.Y);
         Cache.TangentZ[Index] = static_cast<float>(Tangent.Z);
-    }
+    }, VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 }
 
 void UTectonicSimulationService::RefreshOceanicAmplificationFloatInputs() const
@@ -11683,29 +12673,27 @@ void UTectonicSimulationService::RefreshOceanicAmplificationFloatInputs() const
         return;
     }
 
-    Cache.BaselineElevation.SetNum(VertexCount);
-    Cache.CrustAge.SetNum(VertexCount);
-    Cache.RidgeDirections.SetNum(VertexCount);
-    Cache.RenderPositions.SetNum(VertexCount);
-    Cache.OceanicMask.SetNum(VertexCount);
+    Cache.BaselineElevation.SetNumUninitialized(VertexCount);
+    Cache.CrustAge.SetNumUninitialized(VertexCount);
+    Cache.RidgeDirections.SetNumUninitialized(VertexCount);
+    Cache.RenderPositions.SetNumUninitialized(VertexCount);
+    Cache.OceanicMask.SetNumUninitialized(VertexCount);
 
-    auto FindPlateByID = [this](int32 LookupPlateID) -> const FTectonicPlate*
+    // Plate ID -> oceanic flag, so the per-vertex pass does not scan Plates.
+    int32 MaxPlateID = INDEX_NONE;
+    for (const FTectonicPlate& Plate : Plates)
     {
-        if (LookupPlateID == INDEX_NONE)
-        {
-            return nullptr;
-        }
-
-        for (const FTectonicPlate& Plate : Plates)
+        MaxPlateID = FMath::Max(MaxPlateID, Plate.PlateID);
+    }
+    TArray<uint8> OceanicByPlateID;
+    OceanicByPlateID.Init(0, MaxPlateID + 1);
+    for (const FTectonicPlate& Plate : Plates)
+    {
+        if (Plate.PlateID >= 0)
         {
-            if (Plate.PlateID == LookupPlateID)
-            {
-                return &Plate;
-            }
+            OceanicByPlateID[Plate.PlateID] = Plate.CrustType == ECrustType::Oceanic ? 1 : 0;
         }
-
-        return nullptr;
-    };
+    }
 
     const bool bHasRidgeSoA =
         RidgeDirectionFloatSoA.CachedTopologyVersion == CachedRidgeDirectionTopologyVersion &&
@@ -11714,7 +12702,7 @@ void UTectonicSimulationService::RefreshOceanicAmplificationFloatInputs() const
         RidgeDirectionFloatSoA.DirY.Num() == VertexCount &&
         RidgeDirectionFloatSoA.DirZ.Num() == VertexCount;
 
-    for (int32 Index = 0; Index < VertexCount; ++Index)
+    ParallelFor(VertexCount, [this, &Cache, &OceanicByPlateID, bHasRidgeSoA](int32 Index)
     {
         Cache.BaselineElevation[Index] = static_cast<float>(VertexAmplifiedElevation[Index]);
         Cache.CrustAge[Index] = static_cast<float>(VertexCrustAge[Index]);
@@ -11745,17 +12733,9 @@ void UTectonicSimulationService::RefreshOceanicAmplificationFloatInputs() const
             static_cast<float>(Position.Y),
             static_cast<float>(Position.Z));
 
-        uint32 bIsOceanic = 0;
-        const int32 PlateId = VertexPlateAssignments.IsValidIndex(Index) ? VertexPlateAssignments[Index] : INDEX_NONE;
-        if (const FTectonicPlate* PlatePtr = FindPlateByID(PlateId))
-        {
-            if (PlatePtr->CrustType == ECrustType::Oceanic)
-            {
-                bIsOceanic = 1;
-            }
-        }
-        Cache.OceanicMask[Index] = bIsOceanic;
-    }
+        const int32 PlateId = VertexPlateAssignments[Index];
+        Cache.OceanicMask[Index] = OceanicByPlateID.IsValidIndex(PlateId) ? OceanicByPlateID[PlateId] : 0u;
+    }, VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
     Cache.CachedDataSerial = OceanicAmplificationDataSerial;
 }
@@ -0,0 +1,248 @@
+#include "Simulation/TectonicSimulationWorker.h"
+
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void FTectonicSimulationUIState::Capture(const UTectonicSimulationService& Service)
+{
+    Parameters = Service.GetParameters();
+    HeightmapPaletteMode = Service.GetHeightmapPaletteMode();
+    bStageBReady = Service.IsStageBAmplificationReady();
+    StageBNotReadyReason = Service.GetStageBAmplificationNotReadyReason();
+    CurrentTimeMy = Service.GetCurrentTimeMy();
+    HistoryIndex = Service.GetHistoryIndex();
+    HistorySize = Service.GetHistorySize();
+    bCanUndo = Service.CanUndo();
+    bCanRedo = Service.CanRedo();
+    bHighlightSeaLevel = Service.IsHighlightSeaLevelEnabled();
+}
+
+FTectonicSimulationWorker::FTectonicSimulationWorker(UTectonicSimulationService& InService)
+    : Service(&InService)
+{
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FTectonicSimulationWorker::~FTectonicSimulationWorker()
+{
+    if (Thread)
+    {
+        // Kill(true) calls Stop() and waits for the batch in flight to finish.
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+}
+
+bool FTectonicSimulationWorker::Start()
+{
+    if (Thread)
+    {
+        return true;
+    }
+
+    bStopRequested.store(false, std::memory_order_relaxed);
+    Thread = FRunnableThread::Create(this, TEXT("TectonicSimulationWorker"), 0, TPri_Normal);
+    if (!Thread)
+    {
+        UE_LOG(LogPlanetaryCreation, Warning, TEXT("[SimWorker] Failed to create simulation worker thread"));
+        return false;
+    }
+
+    UE_LOG(LogPlanetaryCreation, Log, TEXT("[SimWorker] Simulation worker thread started"));
+    return true;
+}
+
+void FTectonicSimulationWorker::RequestSteps(int32 Steps, EElevationMode ElevationMode)
+{
+    if (Steps <= 0 || !Thread)
+    {
+        return;
+    }
+
+    RequestedElevationMode.store(static_cast<uint8>(ElevationMode), std::memory_order_relaxed);
+    // Counted before the enqueue so IsBusy never reports idle while the request is in the queue.
+    PendingSteps.fetch_add(Steps, std::memory_order_release);
+    PendingCommands.fetch_add(1, std::memory_order_release);
+
+    FTectonicSimulationCommand Command;
+    Command.Steps = Steps;
+    Commands.Enqueue(MoveTemp(Command));
+    WakeEvent->Trigger();
+}
+
+void FTectonicSimulationWorker::EnqueueMutation(FTectonicSimulationMutation&& Mutation, EElevationMode ElevationMode)
+{
+    if (!Mutation || !Thread)
+    {
+        return;
+    }
+
+    RequestedElevationMode.store(static_cast<uint8>(ElevationMode), std::memory_order_relaxed);
+    // Counted before the enqueue so IsBusy never reports idle while the edit is in the queue.
+    PendingCommands.fetch_add(1, std::memory_order_release);
+
+    FTectonicSimulationCommand Command;
+    Command.Mutation = MoveTemp(Mutation);
+    Commands.Enqueue(MoveTemp(Command));
+    WakeEvent->Trigger();
+}
+
+bool FTectonicSimulationWorker::IsBusy() const
+{
+    // Pending is read first: the worker raises bBatchInFlight before draining PendingCommands.
+    return PendingCommands.load(std::memory_order_acquire) > 0
+        || bBatchInFlight.load(std::memory_order_acquire);
+}
+
+bool FTectonicSimulationWorker::WaitUntilIdle(double TimeoutSeconds) const
+{
+    const double WaitStart = FPlatformTime::Seconds();
+    while (IsBusy())
+    {
+        FPlatformProcess::Sleep(0.001f);
+
+        if ((FPlatformTime::Seconds() - WaitStart) > TimeoutSeconds)
+        {
+            UE_LOG(LogPlanetaryCreation, Warning, TEXT("[SimWorker] Timed out after %.1fs waiting for the simulation worker"), TimeoutSeconds);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FTectonicSimulationWorker::ConsumeLatestFrame(FTectonicSimulationFramePtr& OutFrame)
+{
+    if (!Frames.IsDirty())
+    {
+        return false;
+    }
+
+    Frames.SwapReadBuffers();
+    OutFrame = Frames.Read();
+    return OutFrame.IsValid();
+}
+
+uint32 FTectonicSimulationWorker::Run()
+{
+    while (!bStopRequested.load(std::memory_order_acquire))
+    {
+        WakeEvent->Wait(100);
+
+        while (!bStopRequested.load(std::memory_order_acquire))
+        {
+            bBatchInFlight.store(true, std::memory_order_release);
+            // Only what was queued when the batch started; later requests go to the next batch and frame.
+            const int32 CommandCount = PendingCommands.load(std::memory_order_acquire);
+            if (CommandCount <= 0)
+            {
+                bBatchInFlight.store(false, std::memory_order_release);
+                break;
+            }
+
+            SimulateBatch(CommandCount);
+            bBatchInFlight.store(false, std::memory_order_release);
+        }
+    }
+
+    return 0;
+}
+
+void FTectonicSimulationWorker::Stop()
+{
+    bStopRequested.store(true, std::memory_order_release);
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FTectonicSimulationWorker::SimulateBatch(int32 CommandCount)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(TectonicSimulationWorkerBatch);
+    const double BatchStart = FPlatformTime::Seconds();
+
+    int32 Steps = 0;
+    FTectonicSimulationFramePtr Frame = MakeShared<FTectonicSimulationFrame, ESPMode::ThreadSafe>();
+    {
+        // Hold the state lock across steps + edits + capture so the frame is exactly the post-batch state.
+        FScopeLock StateLock(&Service->GetSimulationStateLock());
+
+        bool bNeedsFrame = false;
+        int32 QueuedSteps = 0;
+        auto FlushSteps = [&]()
+        {
+            if (QueuedSteps > 0)
+            {
+                Service->AdvanceSteps(QueuedSteps);
+                Steps += QueuedSteps;
+                QueuedSteps = 0;
+                bNeedsFrame = true;
+            }
+        };
+
+        // Runs of step requests merge into one AdvanceSteps; an edit first flushes the steps requested before it.
+        FTectonicSimulationCommand Command;
+        for (int32 CommandIdx = 0; CommandIdx < CommandCount && Commands.Dequeue(Command); ++CommandIdx)
+        {
+            if (Command.Mutation)
+            {
+                FlushSteps();
+                bNeedsFrame |= Command.Mutation(*Service);
+            }
+            else
+            {
+                // Taken into this batch: HasPendingSteps only reports steps still waiting behind it.
+                QueuedSteps += Command.Steps;
+                PendingSteps.fetch_sub(Command.Steps, std::memory_order_acq_rel);
+            }
+
+            Command.Mutation.Reset();
+            PendingCommands.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        FlushSteps();
+
+        if (!bNeedsFrame)
+        {
+            return;
+        }
+
+        Frame->TopologyVersion = Service->GetTopologyVersion();
+        Frame->SurfaceDataVersion = Service->GetSurfaceDataVersion();
+        Frame->RenderLevel = Service->GetParameters().RenderSubdivisionLevel;
+        Frame->CurrentTimeMy = Service->GetCurrentTimeMy();
+        Frame->LastStepTimeMs = Service->GetLastStepTimeMs();
+        Frame->PlateCount = Service->GetPlates().Num();
+        Frame->RenderVertexCount = Service->GetRenderVertices().Num();
+        Frame->RenderTriangleCount = Service->GetRenderTriangles().Num() / 3;
+        Frame->RetessellationCadenceStats = Service->GetRetessellationCadenceStats();
+        Frame->UIState.Capture(*Service);
+        FTectonicSimulationController::CaptureMeshBuildSnapshot(*Service, Frame->Snapshot);
+    }
+
+    Frame->StepsAdvanced = Steps;
+    Frame->Snapshot.ElevationMode = static_cast<EElevationMode>(RequestedElevationMode.load(std::memory_order_relaxed));
+    // The service may be mid-step by the time this frame is meshed.
+    Frame->Snapshot.bAllowServiceSoA = false;
+    Frame->FrameSerial = PublishedFrameCount.load(std::memory_order_relaxed) + 1;
+
+    Frames.GetWriteBuffer() = MoveTemp(Frame);
+    Frames.SwapWriteBuffers();
+    PublishedFrameCount.fetch_add(1, std::memory_order_release);
+
+    UE_LOG(LogPlanetaryCreation, Verbose, TEXT("[SimWorker] Published frame %d (%d steps, %.2f ms)"),
+        PublishedFrameCount.load(std::memory_order_relaxed), Steps, (FPlatformTime::Seconds() - BatchStart) * 1000.0);
+}
@@ -1,87 +1,292 @@
 // Milestone 4 Task 2.3: Thermal & Stress Coupling (Analytic Model)
 
 #include "Simulation/TectonicSimulationService.h"
+#include "Simulation/VelocityFieldGlyphs.h"
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
-void UTectonicSimulationService::ComputeThermalField()
+namespace
 {
-    // Milestone 4 Task 2.3: Analytic temperature field T(r) = T_max * exp(-r^2 / σ^2)
-    // Combines hotspot thermal plumes + subduction zone heating
-
-    VertexTemperatureValues.SetNum(RenderVertices.Num());
-
     // Baseline mantle temperature (Kelvin)
     constexpr double BaselineMantleTemp = 1600.0; // ~1600K at 100km depth
 
-    for (int32 VertexIdx = 0; VertexIdx < RenderVertices.Num(); ++VertexIdx)
+    // Subduction heating influence radius (~0.1 rad ≈ 5.7°)
+    constexpr double SubductionInfluenceRadius = 0.1;
+
+    // Grid cells span ~0.1 rad, matching the default hotspot and subduction radii.
+    constexpr int32 ThermalGridCellsPerFaceEdge = 16;
+
+    // Upper bound on the angle from a cell center to any point of the cell: each equal-angle cell spans at most
+    // PI / (2N) along either grid direction, so center -> edge midpoint -> corner stays within PI / (2N).
+    constexpr double ThermalGridCellRadius = PI / (2.0 * ThermalGridCellsPerFaceEdge) + 1.0e-6;
+
+    FThermalFieldIndex::FSource MakeSource(const FVector3d& Position, double RadiusRad, double PeakK)
     {
-        const FVector3d& VertexPos = RenderVertices[VertexIdx];
-        double Temperature = BaselineMantleTemp;
+        FThermalFieldIndex::FSource Source;
+        Source.Position = Position;
+        Source.RadiusRad = RadiusRad;
+        Source.CosRadius = FMath::Cos(RadiusRad);
+        Source.PeakK = PeakK;
+        return Source;
+    }
 
-        // Contribution 1: Hotspot plumes (Gaussian falloff)
-        if (Parameters.bEnableHotspots && Hotspots.Num() > 0)
+    /** Analytic Gaussian: T(r) = T_max * exp(-r^2 / σ^2), σ = R / 2. The dot test rejects most pairs before acos. */
+    double ComputeHotspotHeat(const FThermalFieldIndex::FSource& Source, const FVector3d& VertexPos)
+    {
+        const double CosDistance = FVector3d::DotProduct(VertexPos, Source.Position);
+        if (CosDistance < Source.CosRadius)
         {
-            for (const FMantleHotspot& Hotspot : Hotspots)
-            {
-                // Angular distance from hotspot (great circle distance)
-                const double CosDistance = FMath::Clamp(FVector3d::DotProduct(VertexPos, Hotspot.Position), -1.0, 1.0);
-                const double AngularDistance = FMath::Acos(CosDistance);
+            return 0.0;
+        }
+
+        const double AngularDistance = FMath::Acos(FMath::Min(CosDistance, 1.0));
+        const double Sigma = Source.RadiusRad / 2.0;
+        return Source.PeakK * FMath::Exp(-FMath::Square(AngularDistance) / FMath::Square(Sigma));
+    }
+
+    /** Linear falloff from boundary: T = T_max * (1 - r/R). */
+    double ComputeSubductionHeat(const FThermalFieldIndex::FSource& Source, const FVector3d& VertexPos)
+    {
+        const double CosDistance = FVector3d::DotProduct(VertexPos, Source.Position);
+        if (CosDistance < Source.CosRadius)
+        {
+            return 0.0;
+        }
+
+        const double AngularDistance = FMath::Acos(FMath::Min(CosDistance, 1.0));
+        return Source.PeakK * (1.0 - (AngularDistance / Source.RadiusRad));
+    }
+
+    /** Per-cell source lists (CSR) for every cell a source cap can reach; IDs stay in source order within a cell. */
+    void BucketSources(const TArray<FThermalFieldIndex::FSource>& Sources, const TArray<FVector3d>& CellCenters,
+        TArray<int32>& OutOffsets, TArray<int32>& OutSourceIDs)
+    {
+        const int32 CellCount = CellCenters.Num();
+        TArray<double> CosReach;
+        CosReach.SetNumUninitialized(Sources.Num());
+        for (int32 SourceID = 0; SourceID < Sources.Num(); ++SourceID)
+        {
+            CosReach[SourceID] = FMath::Cos(FMath::Min(Sources[SourceID].RadiusRad + ThermalGridCellRadius, PI));
+        }
 
-                if (AngularDistance > Hotspot.InfluenceRadius)
-                    continue; // Outside influence radius
+        auto Reaches = [&](int32 SourceID, int32 Cell)
+        {
+            return FVector3d::DotProduct(CellCenters[Cell], Sources[SourceID].Position) >= CosReach[SourceID];
+        };
 
-                // Analytic Gaussian: T(r) = T_max * exp(-r^2 / σ^2)
-                // T_max scales with thermal output (major hotspots = hotter)
-                const double T_max = 400.0 * Hotspot.ThermalOutput; // Major: 800K, Minor: 400K
-                const double Sigma = Hotspot.InfluenceRadius / 2.0;
-                const double Falloff = FMath::Exp(-FMath::Square(AngularDistance) / FMath::Square(Sigma));
+        OutOffsets.Init(0, CellCount + 1);
+        for (int32 SourceID = 0; SourceID < Sources.Num(); ++SourceID)
+        {
+            for (int32 Cell = 0; Cell < CellCount; ++Cell)
+            {
+                OutOffsets[Cell + 1] += Reaches(SourceID, Cell) ? 1 : 0;
+            }
+        }
+        for (int32 Cell = 0; Cell < CellCount; ++Cell)
+        {
+            OutOffsets[Cell + 1] += OutOffsets[Cell];
+        }
+
+        OutSourceIDs.SetNumUninitialized(OutOffsets[CellCount]);
+        TArray<int32> Cursor(OutOffsets.GetData(), CellCount);
+        for (int32 SourceID = 0; SourceID < Sources.Num(); ++SourceID)
+        {
+            for (int32 Cell = 0; Cell < CellCount; ++Cell)
+            {
+                if (Reaches(SourceID, Cell))
+                {
+                    OutSourceIDs[Cursor[Cell]++] = SourceID;
+                }
+            }
+        }
+    }
 
-                Temperature += T_max * Falloff;
+    void MarkOccupiedCells(const TArray<int32>& Offsets, TBitArray<>& InOutCells)
+    {
+        for (int32 Cell = 0; Cell + 1 < Offsets.Num(); ++Cell)
+        {
+            if (Offsets[Cell + 1] > Offsets[Cell])
+            {
+                InOutCells[Cell] = true;
             }
         }
+    }
+}
+
+void UTectonicSimulationService::ComputeThermalField()
+{
+    // Milestone 4 Task 2.3: Analytic temperature field T(r) = T_max * exp(-r^2 / σ^2)
+    // Combines hotspot thermal plumes + subduction zone heating
+    TRACE_CPUPROFILER_EVENT_SCOPE(ComputeThermalField);
+
+    FThermalFieldIndex& Index = ThermalFieldIndex;
+    const int32 VertexCount = RenderVertices.Num();
+    Index.LastVerticesUpdated = 0;
+    Index.bLastUpdateIncremental = false;
+
+    // Render vertex cells only change with the mesh.
+    const uint64 PositionVersion = RenderPositionColumn != INDEX_NONE ? RenderVertexColumns.GetColumnVersion(RenderPositionColumn) : 0;
+    if (Index.CachedTopologyVersion != TopologyVersion ||
+        Index.CachedPositionVersion != PositionVersion ||
+        Index.CachedVertexCount != VertexCount ||
+        Index.CellsPerFaceEdge != ThermalGridCellsPerFaceEdge)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(ComputeThermalField_BuildGrid);
+
+        const int32 CellCount = 6 * ThermalGridCellsPerFaceEdge * ThermalGridCellsPerFaceEdge;
+        Index.CellsPerFaceEdge = ThermalGridCellsPerFaceEdge;
+        Index.CellCenters.SetNumUninitialized(CellCount);
+        for (int32 Cell = 0; Cell < CellCount; ++Cell)
+        {
+            Index.CellCenters[Cell] = FVelocityFieldGlyphs::GetCubeSphereCellCenter(Cell, ThermalGridCellsPerFaceEdge);
+        }
 
-        // Contribution 2: Subduction zone heating (linear proximity to convergent boundaries)
-        // Subduction generates heat from friction and mantle wedge melting
-        for (const auto& BoundaryPair : Boundaries)
+        Index.VertexCells.SetNumUninitialized(VertexCount);
+        ParallelFor(VertexCount, [&](int32 VertexIdx)
         {
-            const FPlateBoundary& Boundary = BoundaryPair.Value;
+            Index.VertexCells[VertexIdx] = FVelocityFieldGlyphs::GetCubeSphereCell(RenderVertices[VertexIdx], ThermalGridCellsPerFaceEdge);
+        }, VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-            // Only convergent boundaries contribute thermal heating
-            if (Boundary.BoundaryType != EBoundaryType::Convergent)
-                continue;
+        Index.CellVertexOffsets.Init(0, CellCount + 1);
+        for (int32 Cell : Index.VertexCells)
+        {
+            ++Index.CellVertexOffsets[Cell + 1];
+        }
+        for (int32 Cell = 0; Cell < CellCount; ++Cell)
+        {
+            Index.CellVertexOffsets[Cell + 1] += Index.CellVertexOffsets[Cell];
+        }
+        Index.CellVertices.SetNumUninitialized(VertexCount);
+        TArray<int32> Cursor(Index.CellVertexOffsets.GetData(), CellCount);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            Index.CellVertices[Cursor[Index.VertexCells[VertexIdx]]++] = VertexIdx;
+        }
+
+        Index.CachedTopologyVersion = TopologyVersion;
+        Index.CachedPositionVersion = PositionVersion;
+        Index.CachedVertexCount = VertexCount;
+        Index.bFieldValid = false;
+    }
+
+    // Influence sources, built once per call instead of per vertex.
+    TArray<FThermalFieldIndex::FSource> HotspotSources;
+    if (Parameters.bEnableHotspots)
+    {
+        HotspotSources.Reserve(Hotspots.Num());
+        for (const FMantleHotspot& Hotspot : Hotspots)
+        {
+            // T_max scales with thermal output (major hotspots = hotter)
+            HotspotSources.Add(MakeSource(Hotspot.Position, Hotspot.InfluenceRadius, 400.0 * Hotspot.ThermalOutput)); // Major: 800K, Minor: 400K
+        }
+    }
 
-            // Skip low-stress boundaries (not actively subducting)
-            if (Boundary.AccumulatedStress < 50.0)
-                continue;
+    // Subduction generates heat from friction and mantle wedge melting
+    TArray<FThermalFieldIndex::FSource> SubductionSources;
+    for (const auto& BoundaryPair : Boundaries)
+    {
+        const FPlateBoundary& Boundary = BoundaryPair.Value;
 
-            // Compute distance to boundary (approximate using plate centroids)
-            const int32 PlateA_ID = BoundaryPair.Key.Key;
-            const int32 PlateB_ID = BoundaryPair.Key.Value;
+        // Only convergent boundaries contribute thermal heating; skip low-stress ones (not actively subducting)
+        if (Boundary.BoundaryType != EBoundaryType::Convergent || Boundary.AccumulatedStress < 50.0)
+        {
+            continue;
+        }
 
-            if (!Plates.IsValidIndex(PlateA_ID) || !Plates.IsValidIndex(PlateB_ID))
-                continue;
+        const int32 PlateA_ID = BoundaryPair.Key.Key;
+        const int32 PlateB_ID = BoundaryPair.Key.Value;
+        if (!Plates.IsValidIndex(PlateA_ID) || !Plates.IsValidIndex(PlateB_ID))
+        {
+            continue;
+        }
 
-            // Midpoint between plate centroids as boundary location approximation
-            const FVector3d BoundaryPos = ((Plates[PlateA_ID].Centroid + Plates[PlateB_ID].Centroid) * 0.5).GetSafeNormal();
+        // Midpoint between plate centroids as boundary location approximation
+        const FVector3d BoundaryPos = ((Plates[PlateA_ID].Centroid + Plates[PlateB_ID].Centroid) * 0.5).GetSafeNormal();
 
-            // Angular distance from boundary
-            const double CosDistance = FMath::Clamp(FVector3d::DotProduct(VertexPos, BoundaryPos), -1.0, 1.0);
-            const double AngularDistance = FMath::Acos(CosDistance);
+        // T_max scales with stress (higher stress = more friction heating): 100 MPa → +200K
+        SubductionSources.Add(MakeSource(BoundaryPos, SubductionInfluenceRadius, Boundary.AccumulatedStress * 2.0));
+    }
 
-            // Subduction heating influence radius (~0.1 rad ≈ 5.7°)
-            constexpr double SubductionInfluenceRadius = 0.1;
+    const bool bSubductionUnchanged = Index.bFieldValid &&
+        VertexTemperatureValues.Num() == VertexCount &&
+        SubductionSources == Index.SubductionSources;
 
-            if (AngularDistance < SubductionInfluenceRadius)
-            {
-                // Linear falloff from boundary: T = T_max * (1 - r/R)
-                // T_max scales with stress (higher stress = more friction heating)
-                const double T_max_subduction = Boundary.AccumulatedStress * 2.0; // 100 MPa → +200K
-                const double Falloff = 1.0 - (AngularDistance / SubductionInfluenceRadius);
+    if (bSubductionUnchanged && HotspotSources == Index.HotspotSources)
+    {
+        Index.bLastUpdateIncremental = true;
+        return;
+    }
 
-                Temperature += T_max_subduction * Falloff;
-            }
+    auto ComputeVertexTemperature = [&](int32 VertexIdx, double SubductionHeat)
+    {
+        const FVector3d& VertexPos = RenderVertices[VertexIdx];
+        const int32 Cell = Index.VertexCells[VertexIdx];
+
+        double Temperature = BaselineMantleTemp;
+        for (int32 Offset = Index.CellHotspotOffsets[Cell]; Offset < Index.CellHotspotOffsets[Cell + 1]; ++Offset)
+        {
+            Temperature += ComputeHotspotHeat(Index.HotspotSources[Index.CellHotspots[Offset]], VertexPos);
         }
 
         // Clamp temperature to realistic range (0K - 3000K mantle max)
-        VertexTemperatureValues[VertexIdx] = FMath::Clamp(Temperature, 0.0, 3000.0);
+        VertexTemperatureValues[VertexIdx] = FMath::Clamp(Temperature + SubductionHeat, 0.0, 3000.0);
+    };
+
+    if (bSubductionUnchanged)
+    {
+        // Only hotspots moved: revisit the cells their old or new caps reach, keeping the cached subduction heat.
+        TRACE_CPUPROFILER_EVENT_SCOPE(ComputeThermalField_Hotspots);
+
+        TBitArray<> DirtyCells(false, Index.CellCenters.Num());
+        MarkOccupiedCells(Index.CellHotspotOffsets, DirtyCells);
+        Index.HotspotSources = MoveTemp(HotspotSources);
+        BucketSources(Index.HotspotSources, Index.CellCenters, Index.CellHotspotOffsets, Index.CellHotspots);
+        MarkOccupiedCells(Index.CellHotspotOffsets, DirtyCells);
+
+        TArray<int32> Cells;
+        for (TConstSetBitIterator<> It(DirtyCells); It; ++It)
+        {
+            Cells.Add(It.GetIndex());
+            Index.LastVerticesUpdated += Index.CellVertexOffsets[It.GetIndex() + 1] - Index.CellVertexOffsets[It.GetIndex()];
+        }
+
+        ParallelFor(Cells.Num(), [&](int32 CellIdx)
+        {
+            const int32 Cell = Cells[CellIdx];
+            for (int32 Offset = Index.CellVertexOffsets[Cell]; Offset < Index.CellVertexOffsets[Cell + 1]; ++Offset)
+            {
+                const int32 VertexIdx = Index.CellVertices[Offset];
+                ComputeVertexTemperature(VertexIdx, Index.SubductionHeatK[VertexIdx]);
+            }
+        }, Index.LastVerticesUpdated < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+        Index.bLastUpdateIncremental = true;
+        return;
     }
+
+    Index.HotspotSources = MoveTemp(HotspotSources);
+    Index.SubductionSources = MoveTemp(SubductionSources);
+    BucketSources(Index.HotspotSources, Index.CellCenters, Index.CellHotspotOffsets, Index.CellHotspots);
+    BucketSources(Index.SubductionSources, Index.CellCenters, Index.CellSubductionOffsets, Index.CellSubductions);
+
+    VertexTemperatureValues.SetNum(VertexCount);
+    Index.SubductionHeatK.SetNumUninitialized(VertexCount);
+
+    ParallelFor(VertexCount, [&](int32 VertexIdx)
+    {
+        const FVector3d& VertexPos = RenderVertices[VertexIdx];
+        const int32 Cell = Index.VertexCells[VertexIdx];
+
+        double SubductionHeat = 0.0;
+        for (int32 Offset = Index.CellSubductionOffsets[Cell]; Offset < Index.CellSubductionOffsets[Cell + 1]; ++Offset)
+        {
+            SubductionHeat += ComputeSubductionHeat(Index.SubductionSources[Index.CellSubductions[Offset]], VertexPos);
+        }
+
+        Index.SubductionHeatK[VertexIdx] = SubductionHeat;
+        ComputeVertexTemperature(VertexIdx, SubductionHeat);
+    }, VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    Index.LastVerticesUpdated = VertexCount;
+    Index.bFieldValid = true;
 }
@@ -0,0 +1,220 @@
+#include "Simulation/VelocityFieldGlyphs.h"
+
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+    /** Face (major axis * 2 + negative) and the two minor axes, in increasing index order. */
+    void GetCubeFace(const FVector3d& Position, int32& OutFace, double& OutU, double& OutV)
+    {
+        const FVector3d Abs = Position.GetAbs();
+        int32 Axis = 0;
+        if (Abs.Y > Abs.X && Abs.Y >= Abs.Z)
+        {
+            Axis = 1;
+        }
+        else if (Abs.Z > Abs.X && Abs.Z > Abs.Y)
+        {
+            Axis = 2;
+        }
+
+        const double Major = FMath::Max(Abs[Axis], UE_DOUBLE_SMALL_NUMBER);
+        const int32 AxisU = Axis == 0 ? 1 : 0;
+        const int32 AxisV = Axis == 2 ? 1 : 2;
+
+        OutFace = Axis * 2 + (Position[Axis] < 0.0 ? 1 : 0);
+        OutU = Position[AxisU] / Major;
+        OutV = Position[AxisV] / Major;
+    }
+
+    /** Equal-angle grid coordinate in [0, N) for a cube face coordinate in [-1, 1]. */
+    double ToGridCoordinate(double FaceCoordinate, int32 CellsPerFaceEdge)
+    {
+        const double Angle = FMath::Atan(FMath::Clamp(FaceCoordinate, -1.0, 1.0)) * (4.0 / PI); // [-1, 1]
+        return (Angle + 1.0) * 0.5 * CellsPerFaceEdge;
+    }
+
+    /** Cell of Position plus its squared grid distance to the cell center (lower is closer). */
+    int32 LocateCell(const FVector3d& Position, int32 CellsPerFaceEdge, double& OutCenterDistanceSq)
+    {
+        int32 Face = 0;
+        double U = 0.0;
+        double V = 0.0;
+        GetCubeFace(Position, Face, U, V);
+
+        const double GridU = ToGridCoordinate(U, CellsPerFaceEdge);
+        const double GridV = ToGridCoordinate(V, CellsPerFaceEdge);
+        const int32 Column = FMath::Clamp(FMath::FloorToInt32(GridU), 0, CellsPerFaceEdge - 1);
+        const int32 Row = FMath::Clamp(FMath::FloorToInt32(GridV), 0, CellsPerFaceEdge - 1);
+
+        OutCenterDistanceSq = FMath::Square(GridU - (Column + 0.5)) + FMath::Square(GridV - (Row + 0.5));
+        return (Face * CellsPerFaceEdge + Row) * CellsPerFaceEdge + Column;
+    }
+
+    FColor GetVelocityColor(double NormalizedVelocity)
+    {
+        // Color ramp: Blue (0.0) → Cyan (0.25) → Green (0.5) → Yellow (0.75) → Red (1.0)
+        const float Velocity = static_cast<float>(FMath::Clamp(NormalizedVelocity, 0.0, 1.0));
+        if (Velocity < 0.25f)
+        {
+            const float T = Velocity / 0.25f;
+            return FColor(0, static_cast<uint8>(T * 255), 255, 255);
+        }
+        else if (Velocity < 0.5f)
+        {
+            const float T = (Velocity - 0.25f) / 0.25f;
+            return FColor(0, 255, static_cast<uint8>((1.0f - T) * 255), 255);
+        }
+        else if (Velocity < 0.75f)
+        {
+            const float T = (Velocity - 0.5f) / 0.25f;
+            return FColor(static_cast<uint8>(T * 255), 255, 0, 255);
+        }
+
+        const float T = (Velocity - 0.75f) / 0.25f;
+        return FColor(255, static_cast<uint8>((1.0f - T) * 255), 0, 255);
+    }
+}
+
+void FVelocityFieldGlyphs::Reset()
+{
+    SurfaceDataVersion = INDEX_NONE;
+    TopologyVersion = INDEX_NONE;
+    LODBand = INDEX_NONE;
+    CellsPerFaceEdge = 0;
+    VertexCount = 0;
+    RadiusUE = 0.0f;
+    Arrows.Empty();
+    SampleVertices.Empty();
+}
+
+int32 FVelocityFieldGlyphs::GetCellsPerFaceEdge(int32 InLODBand, int32 MaxArrows)
+{
+    int32 Cells = 2 + 2 * FMath::Max(InLODBand, 0);
+    if (MaxArrows > 0)
+    {
+        Cells = FMath::Min(Cells, FMath::FloorToInt32(FMath::Sqrt(MaxArrows / 6.0)));
+    }
+    return FMath::Max(Cells, 1);
+}
+
+int32 FVelocityFieldGlyphs::GetCubeSphereCell(const FVector3d& UnitPosition, int32 InCellsPerFaceEdge)
+{
+    double CenterDistanceSq = 0.0;
+    return LocateCell(UnitPosition, InCellsPerFaceEdge, CenterDistanceSq);
+}
+
+FVector3d FVelocityFieldGlyphs::GetCubeSphereCellCenter(int32 Cell, int32 InCellsPerFaceEdge)
+{
+    const int32 Column = Cell % InCellsPerFaceEdge;
+    const int32 Row = (Cell / InCellsPerFaceEdge) % InCellsPerFaceEdge;
+    const int32 Face = Cell / (InCellsPerFaceEdge * InCellsPerFaceEdge);
+
+    auto ToFaceCoordinate = [InCellsPerFaceEdge](int32 Index)
+    {
+        const double Angle = ((Index + 0.5) / InCellsPerFaceEdge) * 2.0 - 1.0;
+        return FMath::Tan(Angle * (PI / 4.0));
+    };
+
+    const int32 Axis = Face / 2;
+    const int32 AxisU = Axis == 0 ? 1 : 0;
+    const int32 AxisV = Axis == 2 ? 1 : 2;
+
+    FVector3d Position = FVector3d::ZeroVector;
+    Position[Axis] = (Face % 2) ? -1.0 : 1.0;
+    Position[AxisU] = ToFaceCoordinate(Column);
+    Position[AxisV] = ToFaceCoordinate(Row);
+    return Position.GetSafeNormal();
+}
+
+void FVelocityFieldGlyphs::Build(int32 InSurfaceDataVersion, int32 InTopologyVersion, int32 InLODBand, int32 InCellsPerFaceEdge,
+    float InRadiusUE, float OffsetUE, const TArray<FVector3d>& RenderVertices, const TArray<FVector3d>& VertexVelocities)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(VelocityFieldGlyphs_Build);
+
+    Reset();
+    SurfaceDataVersion = InSurfaceDataVersion;
+    TopologyVersion = InTopologyVersion;
+    LODBand = InLODBand;
+    CellsPerFaceEdge = FMath::Max(InCellsPerFaceEdge, 1);
+    VertexCount = RenderVertices.Num();
+    RadiusUE = InRadiusUE;
+
+    if (VertexCount == 0 || VertexVelocities.Num() != VertexCount || RadiusUE <= KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const EParallelForFlags Flags = VertexCount < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+    TArray<int32> VertexCells;
+    TArray<double> CenterDistances;
+    VertexCells.SetNumUninitialized(VertexCount);
+    CenterDistances.SetNumUninitialized(VertexCount);
+    ParallelFor(VertexCount, [&](int32 Vertex)
+    {
+        VertexCells[Vertex] = LocateCell(RenderVertices[Vertex], CellsPerFaceEdge, CenterDistances[Vertex]);
+    }, Flags);
+
+    // Nearest vertex per cell; ties keep the lower index so the pick is stable.
+    const int32 CellCount = 6 * CellsPerFaceEdge * CellsPerFaceEdge;
+    TArray<int32> CellVertex;
+    CellVertex.Init(INDEX_NONE, CellCount);
+    for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+    {
+        int32& Best = CellVertex[VertexCells[Vertex]];
+        if (Best == INDEX_NONE || CenterDistances[Vertex] < CenterDistances[Best])
+        {
+            Best = Vertex;
+        }
+    }
+
+    double MaxSpeed = 0.0;
+    for (const int32 Vertex : CellVertex)
+    {
+        if (Vertex != INDEX_NONE && !VertexVelocities[Vertex].IsNearlyZero())
+        {
+            SampleVertices.Add(Vertex);
+            MaxSpeed = FMath::Max(MaxSpeed, VertexVelocities[Vertex].Length());
+        }
+    }
+
+    if (SampleVertices.Num() == 0)
+    {
+        return;
+    }
+
+    // Arrows stay inside their cell: a cell spans ~90 / N degrees of arc.
+    const double CellArcUE = (HALF_PI / CellsPerFaceEdge) * RadiusUE;
+    const double LiftedRadiusUE = static_cast<double>(RadiusUE) + OffsetUE;
+
+    Arrows.SetNum(SampleVertices.Num());
+    ParallelFor(SampleVertices.Num(), [&](int32 Sample)
+    {
+        const int32 Vertex = SampleVertices[Sample];
+        const FVector3d Normal = RenderVertices[Vertex].GetSafeNormal();
+        const FVector3d& Velocity = VertexVelocities[Vertex];
+
+        FVector3d Direction = (Velocity - Normal * FVector3d::DotProduct(Velocity, Normal)).GetSafeNormal();
+        if (Direction.IsNearlyZero())
+        {
+            Direction = Velocity.GetSafeNormal();
+        }
+        const FVector3d Side = FVector3d::CrossProduct(Normal, Direction).GetSafeNormal();
+
+        const double NormalizedSpeed = MaxSpeed > UE_DOUBLE_SMALL_NUMBER ? Velocity.Length() / MaxSpeed : 0.0;
+        const double Length = CellArcUE * (0.3 + 0.5 * NormalizedSpeed);
+        const double HeadLength = Length * 0.25;
+
+        const FVector3d Tail = Normal * LiftedRadiusUE;
+        const FVector3d Tip = Tail + Direction * Length;
+
+        FVelocityFieldArrow& Arrow = Arrows[Sample];
+        Arrow.Tail = FVector3f(Tail);
+        Arrow.Tip = FVector3f(Tip);
+        Arrow.HeadLeft = FVector3f(Tip - Direction * HeadLength + Side * (HeadLength * 0.5));
+        Arrow.HeadRight = FVector3f(Tip - Direction * HeadLength - Side * (HeadLength * 0.5));
+        Arrow.Color = GetVelocityColor(NormalizedSpeed);
+    }, SampleVertices.Num() < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
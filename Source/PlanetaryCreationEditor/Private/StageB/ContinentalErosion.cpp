@@ -3,6 +3,7 @@
 #include "Utilities/PlanetaryCreationLogging.h"
 #include "Simulation/TectonicSimulationService.h"
 #include "Math/UnrealMathUtility.h"
+#include "Async/ParallelFor.h"
 
 /**
  * Milestone 5 Task 2.1: Continental Erosion Implementation
@@ -37,102 +38,142 @@ void UTectonicSimulationService::ApplyContinentalErosion(double DeltaTimeMy)
     // Get max stress/temperature for normalization
     double MaxStress = 1.0;
     double MaxTemperature = 1000.0; // Kelvin
+    ComputeErosionNormalization(MaxStress, MaxTemperature);
 
-    if (VertexStressValues.Num() > 0)
+    // Apply erosion to each vertex (Gauss-Seidel: slopes see already-eroded lower-index neighbours)
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
     {
-        for (double Stress : VertexStressValues)
-        {
-            MaxStress = FMath::Max(MaxStress, Stress);
-        }
+        ErodeContinentalVertex(VertexIdx, DeltaTimeMy, MaxStress, MaxTemperature);
     }
+}
+
+void UTectonicSimulationService::ComputeErosionNormalization(double& OutMaxStress, double& OutMaxTemperature) const
+{
+    constexpr int32 ReductionChunkSize = 8192;
+
+    OutMaxStress = 1.0;
+    OutMaxTemperature = 1000.0; // Kelvin
 
-    if (VertexTemperatureValues.Num() > 0)
+    const int32 Count = FMath::Max(VertexStressValues.Num(), VertexTemperatureValues.Num());
+    if (Count == 0)
     {
-        for (double Temp : VertexTemperatureValues)
-        {
-            MaxTemperature = FMath::Max(MaxTemperature, Temp);
-        }
+        return;
     }
 
-    // Apply erosion to each vertex
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-    {
-        // M5 Phase 3 fix: Elevations now seeded in ResetSimulation(), just read them here
-        double Elevation_m = VertexElevationValues[VertexIdx]; // Elevation in METERS (non-const for stress-lift update)
+    // Max is order-independent, so the chunked reduction is bit-identical to a serial scan.
+    const int32 NumChunks = FMath::DivideAndRoundUp(Count, ReductionChunkSize);
+    TArray<double> ChunkMaxStress;
+    TArray<double> ChunkMaxTemperature;
+    ChunkMaxStress.Init(OutMaxStress, NumChunks);
+    ChunkMaxTemperature.Init(OutMaxTemperature, NumChunks);
 
-        // M5 Phase 3 fix: Skip erosion for oceanic crust entirely (only erode continental)
-        const int32 PlateIdx = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
+    ParallelFor(NumChunks, [this, Count, &ChunkMaxStress, &ChunkMaxTemperature](int32 ChunkIdx)
+    {
+        const int32 Start = ChunkIdx * ReductionChunkSize;
+        const int32 End = FMath::Min(Start + ReductionChunkSize, Count);
 
-        // M5 Phase 3 fix: Treat INDEX_NONE vertices as oceanic (skip erosion and log warning)
-        if (PlateIdx == INDEX_NONE)
+        double LocalStress = ChunkMaxStress[ChunkIdx];
+        double LocalTemperature = ChunkMaxTemperature[ChunkIdx];
+        for (int32 Index = Start; Index < End; ++Index)
         {
-            VertexErosionRates[VertexIdx] = 0.0;
-            continue;
+            if (VertexStressValues.IsValidIndex(Index))
+            {
+                LocalStress = FMath::Max(LocalStress, VertexStressValues[Index]);
+            }
+            if (VertexTemperatureValues.IsValidIndex(Index))
+            {
+                LocalTemperature = FMath::Max(LocalTemperature, VertexTemperatureValues[Index]);
+            }
         }
 
-        const bool bIsOceanic = Plates.IsValidIndex(PlateIdx)
-            ? (Plates[PlateIdx].CrustType == ECrustType::Oceanic)
-            : false;
+        ChunkMaxStress[ChunkIdx] = LocalStress;
+        ChunkMaxTemperature[ChunkIdx] = LocalTemperature;
+    });
 
-        if (bIsOceanic)
-        {
-            VertexErosionRates[VertexIdx] = 0.0;
-            continue; // Oceanic crust not subject to continental erosion
-        }
+    for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+    {
+        OutMaxStress = FMath::Max(OutMaxStress, ChunkMaxStress[ChunkIdx]);
+        OutMaxTemperature = FMath::Max(OutMaxTemperature, ChunkMaxTemperature[ChunkIdx]);
+    }
+}
 
-        // M5 Phase 3.7 fix: Apply stress-driven uplift BEFORE checking sea level
-        // Scaling: 1 MPa → 100 m elevation (reasonable for tectonic mountain building)
-        // Example: 50 MPa convergence → 5 km mountain (Himalayas-scale)
-        double StressLift_m = 0.0;
-        if (VertexStressValues.IsValidIndex(VertexIdx))
-        {
-            constexpr double StressToElevationScale = 10.0; // 1 MPa → 10 m uplift
-            constexpr double MaxPerStepStressLift = 1500.0; // Cap uplift to a plausible per-step change
-            StressLift_m = FMath::Clamp(VertexStressValues[VertexIdx] * StressToElevationScale, 0.0, MaxPerStepStressLift);
-        }
+void UTectonicSimulationService::ErodeContinentalVertex(int32 VertexIdx, double DeltaTimeMy, double MaxStress, double MaxTemperature)
+{
+    // M5 Phase 3 fix: Elevations now seeded in ResetSimulation(), just read them here
+    double Elevation_m = VertexElevationValues[VertexIdx]; // Elevation in METERS (non-const for stress-lift update)
 
-        if (StressLift_m > 0.0)
-        {
-            VertexElevationValues[VertexIdx] = FMath::Max(Elevation_m + StressLift_m, 250.0);
-            Elevation_m = VertexElevationValues[VertexIdx]; // Update local var for erosion calc
-        }
+    // M5 Phase 3 fix: Skip erosion for oceanic crust entirely (only erode continental)
+    const int32 PlateIdx = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
 
-        // Only erode terrain above sea level (both in meters)
-        if (Elevation_m <= Parameters.SeaLevel)
-        {
-            VertexErosionRates[VertexIdx] = 0.0;
-            continue;
-        }
+    // M5 Phase 3 fix: Treat INDEX_NONE vertices as oceanic (skip erosion and log warning)
+    if (PlateIdx == INDEX_NONE)
+    {
+        VertexErosionRates[VertexIdx] = 0.0;
+        return;
+    }
 
-        // Compute slope at this vertex
-        const double Slope = ComputeVertexSlope(VertexIdx);
+    const bool bIsOceanic = Plates.IsValidIndex(PlateIdx)
+        ? (Plates[PlateIdx].CrustType == ECrustType::Oceanic)
+        : false;
 
-        // Base erosion rate (both elevation and sea level in meters)
-        double ErosionRate = Parameters.ErosionConstant * Slope * (Elevation_m - Parameters.SeaLevel);
+    if (bIsOceanic)
+    {
+        VertexErosionRates[VertexIdx] = 0.0;
+        return; // Oceanic crust not subject to continental erosion
+    }
 
-        // Thermal factor: Hotter regions erode faster (1.0-1.5× multiplier)
-        double ThermalFactor = 1.0;
-        if (VertexTemperatureValues.IsValidIndex(VertexIdx) && MaxTemperature > 0.0)
-        {
-            ThermalFactor = 1.0 + 0.5 * (VertexTemperatureValues[VertexIdx] / MaxTemperature);
-        }
+    // M5 Phase 3.7 fix: Apply stress-driven uplift BEFORE checking sea level
+    // Scaling: 1 MPa → 100 m elevation (reasonable for tectonic mountain building)
+    // Example: 50 MPa convergence → 5 km mountain (Himalayas-scale)
+    double StressLift_m = 0.0;
+    if (VertexStressValues.IsValidIndex(VertexIdx))
+    {
+        constexpr double StressToElevationScale = 10.0; // 1 MPa → 10 m uplift
+        constexpr double MaxPerStepStressLift = 1500.0; // Cap uplift to a plausible per-step change
+        StressLift_m = FMath::Clamp(VertexStressValues[VertexIdx] * StressToElevationScale, 0.0, MaxPerStepStressLift);
+    }
 
-        // Stress factor: High-stress regions (mountains) erode faster (1.0-1.3× multiplier)
-        double StressFactor = 1.0;
-        if (VertexStressValues.IsValidIndex(VertexIdx) && MaxStress > 0.0)
-        {
-            StressFactor = 1.0 + 0.3 * (VertexStressValues[VertexIdx] / MaxStress);
-        }
+    if (StressLift_m > 0.0)
+    {
+        VertexElevationValues[VertexIdx] = FMath::Max(Elevation_m + StressLift_m, 250.0);
+        Elevation_m = VertexElevationValues[VertexIdx]; // Update local var for erosion calc
+    }
+
+    // Only erode terrain above sea level (both in meters)
+    if (Elevation_m <= Parameters.SeaLevel)
+    {
+        VertexErosionRates[VertexIdx] = 0.0;
+        return;
+    }
+
+    // Compute slope at this vertex
+    const double Slope = ComputeVertexSlope(VertexIdx);
 
-        // Total erosion for this step (meters)
-        const double TotalErosion = ErosionRate * ThermalFactor * StressFactor * DeltaTimeMy;
+    // Base erosion rate (both elevation and sea level in meters)
+    double ErosionRate = Parameters.ErosionConstant * Slope * (Elevation_m - Parameters.SeaLevel);
 
-        // Store erosion rate for visualization/CSV export (m/My)
-        VertexErosionRates[VertexIdx] = ErosionRate * ThermalFactor * StressFactor;
+    // Thermal factor: Hotter regions erode faster (1.0-1.5× multiplier)
+    double ThermalFactor = 1.0;
+    if (VertexTemperatureValues.IsValidIndex(VertexIdx) && MaxTemperature > 0.0)
+    {
+        ThermalFactor = 1.0 + 0.5 * (VertexTemperatureValues[VertexIdx] / MaxTemperature);
+    }
 
-        // Apply erosion (never go below sea level, all in meters)
-        VertexElevationValues[VertexIdx] = FMath::Max(Parameters.SeaLevel, Elevation_m - TotalErosion);
+    // Stress factor: High-stress regions (mountains) erode faster (1.0-1.3× multiplier)
+    double StressFactor = 1.0;
+    if (VertexStressValues.IsValidIndex(VertexIdx) && MaxStress > 0.0)
+    {
+        StressFactor = 1.0 + 0.3 * (VertexStressValues[VertexIdx] / MaxStress);
     }
+
+    // Total erosion for this step (meters)
+    const double TotalErosion = ErosionRate * ThermalFactor * StressFactor * DeltaTimeMy;
+
+    // Store erosion rate for visualization/CSV export (m/My)
+    VertexErosionRates[VertexIdx] = ErosionRate * ThermalFactor * StressFactor;
+
+    // Apply erosion (never go below sea level, all in meters)
+    VertexElevationValues[VertexIdx] = FMath::Max(Parameters.SeaLevel, Elevation_m - TotalErosion);
 }
 
 double UTectonicSimulationService::ComputeVertexSlope(int32 VertexIdx) const
@@ -0,0 +1,298 @@
+// Copyright 2025 Michael Hall. All Rights Reserved.
+
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+
+/**
+ * Fused Stage A surface processes.
+ *
+ * Runs continental erosion, sediment transport and oceanic dampening over shared scratch with the same per-vertex
+ * math as the sequential passes, so results are identical:
+ *   1. One parallel max reduction over stress/temperature.
+ *   2. Erosion in wavefronts. The sequential loop is Gauss-Seidel (slopes see lower-index neighbours already
+ *      eroded), so a modifiable vertex is scheduled one wavefront after its latest lower-index modifiable neighbour.
+ *   3. One block sweep seeding sediment and evaluating dampening; both read post-erosion elevation only.
+ *   4. Sediment diffusion iterations (still against post-erosion elevation).
+ *   5. One block sweep committing sediment, seafloor elevation and crust age.
+ */
+
+namespace
+{
+    /** Vertices per task in the fused block sweeps. */
+    constexpr int32 SurfaceProcessBlockSize = 2048;
+
+    /** Wavefronts smaller than this run inline; dispatch overhead dominates. */
+    constexpr int32 ErosionWavefrontParallelThreshold = 1024;
+
+    /** Mirrors ErodeContinentalVertex: only vertices that reach the uplift/erosion body can change elevation. */
+    inline bool IsErosionModifiable(const TArray<int32>& PlateAssignments, const TArray<FTectonicPlate>& Plates, int32 VertexIdx)
+    {
+        const int32 PlateIdx = PlateAssignments.IsValidIndex(VertexIdx) ? PlateAssignments[VertexIdx] : INDEX_NONE;
+        if (PlateIdx == INDEX_NONE)
+        {
+            return false;
+        }
+
+        return !(Plates.IsValidIndex(PlateIdx) && Plates[PlateIdx].CrustType == ECrustType::Oceanic);
+    }
+}
+
+void UTectonicSimulationService::ApplyFusedSurfaceProcesses(double DeltaTimeMy)
+{
+    LastSurfaceProcessTimings = FSurfaceProcessTimings();
+
+    const bool bErosion = Parameters.bEnableContinentalErosion;
+    const bool bSediment = Parameters.bEnableSedimentTransport;
+    const bool bDampening = Parameters.bEnableOceanicDampening;
+    if (!bErosion && !bSediment && !bDampening)
+    {
+        return;
+    }
+
+    const int32 VertexCount = RenderVertices.Num();
+    if (VertexCount == 0)
+    {
+        return;
+    }
+
+    if (RenderVertexAdjacencyOffsets.Num() != VertexCount + 1 || RenderVertexAdjacency.Num() == 0)
+    {
+        BuildRenderVertexAdjacency();
+    }
+
+    if (RenderVertexAdjacencyOffsets.Num() != VertexCount + 1 || RenderVertexAdjacency.Num() == 0)
+    {
+        // Without adjacency the passes degrade differently; let the sequential path handle it.
+        ApplyContinentalErosion(DeltaTimeMy);
+        ApplySedimentTransport(DeltaTimeMy);
+        ApplyOceanicDampening(DeltaTimeMy);
+        return;
+    }
+
+    // Crust-age seed resets only touch VertexCrustAge, which erosion and sediment never read.
+    if (bDampening)
+    {
+        ResetCrustAgeForSeeds(FMath::Max(0, Parameters.RidgeDirectionDirtyRingDepth));
+    }
+
+    if (VertexElevationValues.Num() != VertexCount)
+    {
+        VertexElevationValues.SetNumZeroed(VertexCount);
+    }
+    if ((bErosion || bSediment) && VertexErosionRates.Num() != VertexCount)
+    {
+        VertexErosionRates.SetNumZeroed(VertexCount);
+    }
+    if ((bSediment || bDampening) && VertexSedimentThickness.Num() != VertexCount)
+    {
+        VertexSedimentThickness.SetNumZeroed(VertexCount);
+    }
+    if (bDampening && VertexCrustAge.Num() != VertexCount)
+    {
+        VertexCrustAge.SetNumZeroed(VertexCount);
+    }
+
+    FSurfaceProcessTimings& Timings = LastSurfaceProcessTimings;
+    FSurfaceProcessScratch& Scratch = SurfaceProcessScratch;
+    const int32 NumBlocks = FMath::DivideAndRoundUp(VertexCount, SurfaceProcessBlockSize);
+
+    auto LogTimings = [&Timings]()
+    {
+        UE_LOG(LogPlanetaryCreation, Verbose,
+            TEXT("[SurfaceProcesses] Fused %.2f ms (Reduction %.2f | Erosion %.2f [%d wavefronts] | SourceSweep %.2f | Sediment %.2f | Commit %.2f)"),
+            Timings.TotalMs(),
+            Timings.ReductionMs,
+            Timings.ErosionMs,
+            Timings.ErosionWavefrontCount,
+            Timings.SourceSweepMs,
+            Timings.SedimentMs,
+            Timings.CommitMs);
+    };
+
+    if (bErosion)
+    {
+        double MaxStress = 1.0;
+        double MaxTemperature = 1000.0;
+        {
+            TRACE_CPUPROFILER_EVENT_SCOPE(FusedSurfaceProcesses_Reduction);
+            const double PhaseStart = FPlatformTime::Seconds();
+            ComputeErosionNormalization(MaxStress, MaxTemperature);
+            Timings.ReductionMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+        }
+
+        TRACE_CPUPROFILER_EVENT_SCOPE(FusedSurfaceProcesses_Erosion);
+        const double PhaseStart = FPlatformTime::Seconds();
+
+        // Wavefront of a modifiable vertex = 1 + latest wavefront among its lower-index modifiable neighbours.
+        // Non-modifiable vertices never write elevation and go in wavefront 0.
+        TArray<int32>& Level = Scratch.ErosionWavefrontLevel;
+        Level.SetNumUninitialized(VertexCount);
+        int32 MaxLevel = 0;
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            if (!IsErosionModifiable(VertexPlateAssignments, Plates, VertexIdx))
+            {
+                Level[VertexIdx] = INDEX_NONE;
+                continue;
+            }
+
+            int32 VertexLevel = 0;
+            for (int32 Offset = RenderVertexAdjacencyOffsets[VertexIdx]; Offset < RenderVertexAdjacencyOffsets[VertexIdx + 1]; ++Offset)
+            {
+                const int32 NeighborIdx = RenderVertexAdjacency[Offset];
+                if (NeighborIdx >= 0 && NeighborIdx < VertexIdx && Level[NeighborIdx] != INDEX_NONE)
+                {
+                    VertexLevel = FMath::Max(VertexLevel, Level[NeighborIdx] + 1);
+                }
+            }
+
+            Level[VertexIdx] = VertexLevel;
+            MaxLevel = FMath::Max(MaxLevel, VertexLevel);
+        }
+
+        const int32 WavefrontCount = MaxLevel + 1;
+        TArray<int32>& Offsets = Scratch.ErosionWavefrontOffsets;
+        TArray<int32>& Order = Scratch.ErosionWavefrontOrder;
+        Offsets.Init(0, WavefrontCount + 1);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            ++Offsets[FMath::Max(Level[VertexIdx], 0) + 1];
+        }
+        for (int32 Wavefront = 0; Wavefront < WavefrontCount; ++Wavefront)
+        {
+            Offsets[Wavefront + 1] += Offsets[Wavefront];
+        }
+
+        Order.SetNumUninitialized(VertexCount);
+        TArray<int32> Cursor(Offsets.GetData(), WavefrontCount);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            Order[Cursor[FMath::Max(Level[VertexIdx], 0)]++] = VertexIdx;
+        }
+
+        for (int32 Wavefront = 0; Wavefront < WavefrontCount; ++Wavefront)
+        {
+            const int32 Start = Offsets[Wavefront];
+            const int32 Count = Offsets[Wavefront + 1] - Start;
+            const EParallelForFlags Flags = Count >= ErosionWavefrontParallelThreshold
+                ? EParallelForFlags::None
+                : EParallelForFlags::ForceSingleThread;
+
+            ParallelFor(Count, [this, &Order, Start, DeltaTimeMy, MaxStress, MaxTemperature](int32 Index)
+            {
+                ErodeContinentalVertex(Order[Start + Index], DeltaTimeMy, MaxStress, MaxTemperature);
+            }, Flags);
+        }
+
+        Timings.ErosionWavefrontCount = WavefrontCount;
+        Timings.ErosionMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+    }
+
+    if (!bSediment && !bDampening)
+    {
+        LogTimings();
+        return;
+    }
+
+    const double DampFactor = FMath::Clamp(Parameters.OceanicDampeningConstant * DeltaTimeMy, 0.0, 1.0);
+    const double AgePullScale = 0.01 * DeltaTimeMy;
+
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(FusedSurfaceProcesses_SourceSweep);
+        const double PhaseStart = FPlatformTime::Seconds();
+
+        if (bSediment)
+        {
+            BeginSedimentTransport(DeltaTimeMy);
+        }
+        if (bDampening)
+        {
+            Scratch.Resize(VertexCount);
+        }
+
+        ParallelFor(NumBlocks, [this, VertexCount, bSediment, bDampening, DeltaTimeMy, DampFactor, AgePullScale](int32 BlockIdx)
+        {
+            const int32 Start = BlockIdx * SurfaceProcessBlockSize;
+            const int32 End = FMath::Min(Start + SurfaceProcessBlockSize, VertexCount);
+            for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+            {
+                if (bSediment)
+                {
+                    SeedSedimentTransportVertex(VertexIdx, DeltaTimeMy);
+                }
+                if (bDampening)
+                {
+                    ComputeOceanicDampeningVertex(VertexIdx, DeltaTimeMy, DampFactor, AgePullScale);
+                }
+            }
+        });
+
+        Timings.SourceSweepMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+    }
+
+    if (bSediment)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(FusedSurfaceProcesses_Sediment);
+        const double PhaseStart = FPlatformTime::Seconds();
+        IterateSedimentTransport();
+        Timings.SedimentMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+    }
+
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE(FusedSurfaceProcesses_Commit);
+        const double PhaseStart = FPlatformTime::Seconds();
+
+        const FSedimentTransportScratch& SedimentScratch = SedimentTransportScratch;
+        TArray<double> BlockDeposited;
+        BlockDeposited.SetNumZeroed(NumBlocks);
+
+        ParallelFor(NumBlocks, [this, &Scratch, &SedimentScratch, &BlockDeposited, VertexCount, bSediment, bDampening](int32 BlockIdx)
+        {
+            const int32 Start = BlockIdx * SurfaceProcessBlockSize;
+            const int32 End = FMath::Min(Start + SurfaceProcessBlockSize, VertexCount);
+            double Deposited = 0.0;
+            for (int32 VertexIdx = Start; VertexIdx < End; ++VertexIdx)
+            {
+                if (bSediment)
+                {
+                    const double FinalSediment = SedimentScratch.CurrentSediment[VertexIdx];
+                    const double NetChange = FinalSediment - VertexSedimentThickness[VertexIdx];
+                    if (NetChange > 0.0)
+                    {
+                        Deposited += NetChange;
+                    }
+                    VertexSedimentThickness[VertexIdx] = FinalSediment;
+                }
+                if (bDampening)
+                {
+                    VertexElevationValues[VertexIdx] = Scratch.NextElevation[VertexIdx];
+                    VertexCrustAge[VertexIdx] = Scratch.NextCrustAge[VertexIdx];
+                }
+            }
+            BlockDeposited[BlockIdx] = Deposited;
+        });
+
+        if (bDampening)
+        {
+            BumpOceanicAmplificationSerial();
+        }
+
+        Timings.CommitMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+
+        if (bSediment)
+        {
+            double TotalDepositedMass = 0.0;
+            for (const double Deposited : BlockDeposited)
+            {
+                TotalDepositedMass += Deposited;
+            }
+            UE_LOG(LogPlanetaryCreation, VeryVerbose, TEXT("[Sediment] Deposited mass this step: %.4f m"), TotalDepositedMass);
+        }
+    }
+
+    LogTimings();
+}
@@ -2,6 +2,7 @@
 
 #include "Simulation/TectonicSimulationService.h"
 
+#include "Algo/Sort.h"
 #include "Async/ParallelFor.h"
 #include "Utilities/PlanetaryCreationLogging.h"
 
@@ -11,6 +12,9 @@ namespace
     {
         return Plates.IsValidIndex(PlateIdx) && Plates[PlateIdx].CrustType == ECrustType::Continental;
     }
+
+    /** Vertices per task in the level sweep and the deposit pass. */
+    constexpr int32 HydraulicLevelChunkSize = 2048;
 }
 
 void UTectonicSimulationService::ApplyHydraulicErosion(double DeltaTimeMy)
@@ -47,7 +51,7 @@ void UTectonicSimulationService::ApplyHydraulicErosion(double DeltaTimeMy)
     }
 
     HydraulicDownhillNeighbor.SetNum(VertexCount);
-    HydraulicFlowAccumulation.SetNum(VertexCount);
+    HydraulicFlowAccumulation.Init(1.0f, VertexCount);
     HydraulicErosionBuffer.SetNumZeroed(VertexCount);
     HydraulicSelfDepositBuffer.SetNumZeroed(VertexCount);
     HydraulicDownstreamDepositBuffer.SetNumZeroed(VertexCount);
@@ -149,13 +153,33 @@ void UTectonicSimulationService::ApplyHydraulicErosion(double DeltaTimeMy)
         HydraulicDownhillNeighbor[VertexIdx] = LowestIdx;
     });
 
-    for (int32 i = 0; i < VertexCount; ++i)
+    // Donor CSR (reverse of the downhill forest), filled in ascending vertex order so every pull below
+    // sums its donors in the same order regardless of scheduling.
+    HydraulicDonorOffsets.SetNumZeroed(VertexCount + 1);
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        const int32 DownstreamIdx = HydraulicDownhillNeighbor[VertexIdx];
+        if (DownstreamIdx != INDEX_NONE && DownstreamIdx < VertexCount)
+        {
+            ++HydraulicDonorOffsets[DownstreamIdx + 1];
+        }
+    }
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        HydraulicDonorOffsets[VertexIdx + 1] += HydraulicDonorOffsets[VertexIdx];
+        HydraulicUpstreamCount[VertexIdx] = HydraulicDonorOffsets[VertexIdx + 1] - HydraulicDonorOffsets[VertexIdx];
+    }
+
+    HydraulicDonors.SetNumUninitialized(HydraulicDonorOffsets[VertexCount]);
     {
-        HydraulicFlowAccumulation[i] = 1.0f;
-        const int32 DownstreamIdx = HydraulicDownhillNeighbor.IsValidIndex(i) ? HydraulicDownhillNeighbor[i] : INDEX_NONE;
-        if (DownstreamIdx != INDEX_NONE && HydraulicUpstreamCount.IsValidIndex(DownstreamIdx))
+        TArray<int32> FillCursor(HydraulicDonorOffsets.GetData(), VertexCount);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
         {
-            ++HydraulicUpstreamCount[DownstreamIdx];
+            const int32 DownstreamIdx = HydraulicDownhillNeighbor[VertexIdx];
+            if (DownstreamIdx != INDEX_NONE && DownstreamIdx < VertexCount)
+            {
+                HydraulicDonors[FillCursor[DownstreamIdx]++] = VertexIdx;
+            }
         }
     }
 
@@ -167,42 +191,71 @@ void UTectonicSimulationService::ApplyHydraulicErosion(double DeltaTimeMy)
         }
     }
 
-    int32 QueueHead = 0;
-    while (QueueHead < HydraulicProcessingQueue.Num())
-    {
-        const int32 VertexIdx = HydraulicProcessingQueue[QueueHead++];
-        const float Flow = HydraulicFlowAccumulation.IsValidIndex(VertexIdx)
-            ? HydraulicFlowAccumulation[VertexIdx]
-            : 1.0f;
+    // Level-synchronous topological sweep: every vertex in a level has all donors in earlier levels,
+    // so a level is evaluated in parallel by pulling donor flow. HydraulicProcessingQueue ends up holding
+    // the full topological order with level boundaries in HydraulicLevelOffsets.
+    HydraulicLevelOffsets.Reset();
+    HydraulicLevelOffsets.Add(0);
 
-        const int32 DownstreamIdx = HydraulicDownhillNeighbor.IsValidIndex(VertexIdx)
-            ? HydraulicDownhillNeighbor[VertexIdx]
-            : INDEX_NONE;
+    TArray<TArray<int32>> ChunkReady;
+    int32 LevelStart = 0;
+    while (LevelStart < HydraulicProcessingQueue.Num())
+    {
+        const int32 LevelEnd = HydraulicProcessingQueue.Num();
+        const int32 LevelSize = LevelEnd - LevelStart;
+        const int32 ChunkCount = FMath::DivideAndRoundUp(LevelSize, HydraulicLevelChunkSize);
+        const EParallelForFlags LevelFlags = ChunkCount > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
 
-        if (DownstreamIdx != INDEX_NONE && HydraulicFlowAccumulation.IsValidIndex(DownstreamIdx))
+        ChunkReady.SetNum(ChunkCount, EAllowShrinking::No);
+        for (TArray<int32>& Ready : ChunkReady)
         {
-            HydraulicFlowAccumulation[DownstreamIdx] += Flow;
+            Ready.Reset();
+        }
 
-            if (HydraulicUpstreamCount.IsValidIndex(DownstreamIdx))
+        ParallelFor(ChunkCount, [this, LevelStart, LevelEnd, &ChunkReady](int32 ChunkIdx)
+        {
+            const int32 ChunkBegin = LevelStart + ChunkIdx * HydraulicLevelChunkSize;
+            const int32 ChunkEnd = FMath::Min(ChunkBegin + HydraulicLevelChunkSize, LevelEnd);
+            for (int32 QueueIdx = ChunkBegin; QueueIdx < ChunkEnd; ++QueueIdx)
             {
-                int32& Remaining = HydraulicUpstreamCount[DownstreamIdx];
-                if (Remaining > 0)
+                const int32 VertexIdx = HydraulicProcessingQueue[QueueIdx];
+
+                double Flow = 1.0;
+                for (int32 DonorOffset = HydraulicDonorOffsets[VertexIdx]; DonorOffset < HydraulicDonorOffsets[VertexIdx + 1]; ++DonorOffset)
                 {
-                    --Remaining;
-                    if (Remaining == 0)
-                    {
-                        HydraulicProcessingQueue.Add(DownstreamIdx);
-                    }
+                    Flow += static_cast<double>(HydraulicFlowAccumulation[HydraulicDonors[DonorOffset]]);
+                }
+                HydraulicFlowAccumulation[VertexIdx] = static_cast<float>(Flow);
+
+                const int32 DownstreamIdx = HydraulicDownhillNeighbor[VertexIdx];
+                if (DownstreamIdx != INDEX_NONE && DownstreamIdx < HydraulicUpstreamCount.Num() &&
+                    FPlatformAtomics::InterlockedDecrement(&HydraulicUpstreamCount[DownstreamIdx]) == 0)
+                {
+                    ChunkReady[ChunkIdx].Add(DownstreamIdx);
                 }
             }
+        }, LevelFlags);
+
+        for (int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ++ChunkIdx)
+        {
+            const TArray<int32>& Ready = ChunkReady[ChunkIdx];
+            HydraulicProcessingQueue.Append(Ready);
         }
+
+        // Which chunk releases a vertex depends on timing; sorting keeps the queue itself reproducible.
+        Algo::Sort(MakeArrayView(HydraulicProcessingQueue.GetData() + LevelEnd, HydraulicProcessingQueue.Num() - LevelEnd));
+
+        LevelStart = LevelEnd;
+        HydraulicLevelOffsets.Add(LevelStart);
     }
 
-    if (QueueHead != VertexCount)
+    LastHydraulicFlowLevelCount = HydraulicLevelOffsets.Num() - 1;
+
+    if (HydraulicProcessingQueue.Num() != VertexCount)
     {
         UE_LOG(LogPlanetaryCreation, Warning,
             TEXT("[Hydraulic] Topological traversal visited %d / %d vertices (possible cycle or disconnected component)"),
-            QueueHead,
+            HydraulicProcessingQueue.Num(),
             VertexCount);
     }
 
@@ -264,45 +317,79 @@ void UTectonicSimulationService::ApplyHydraulicErosion(double DeltaTimeMy)
         HydraulicDownstreamDepositBuffer[VertexIdx] = DownstreamRatio * ErosionAmount;
     });
 
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    // Apply erosion and deposits by pulling from donors, so no two tasks write the same vertex.
+    // Mass totals are summed per fixed chunk and merged in chunk order to stay reproducible.
+    struct FHydraulicChunkTotals
     {
-        const double Erode = HydraulicErosionBuffer[VertexIdx];
-        if (Erode <= 0.0 || !FMath::IsFinite(Erode))
-        {
-            continue;
-        }
+        double Eroded = 0.0;
+        double Deposited = 0.0;
+        double LostToOcean = 0.0;
+    };
 
-        const double SelfDeposit = HydraulicSelfDepositBuffer[VertexIdx];
-        const double DownstreamDeposit = HydraulicDownstreamDepositBuffer[VertexIdx];
+    const int32 ApplyChunkCount = FMath::DivideAndRoundUp(VertexCount, HydraulicLevelChunkSize);
+    TArray<FHydraulicChunkTotals> ChunkTotals;
+    ChunkTotals.SetNum(ApplyChunkCount);
 
-        if (VertexAmplifiedElevation.IsValidIndex(VertexIdx))
-        {
-            VertexAmplifiedElevation[VertexIdx] -= Erode;
-            VertexAmplifiedElevation[VertexIdx] += SelfDeposit;
-        }
-        if (VertexElevationValues.IsValidIndex(VertexIdx))
+    ParallelFor(ApplyChunkCount, [this, VertexCount, &ChunkTotals](int32 ChunkIdx)
+    {
+        FHydraulicChunkTotals& Totals = ChunkTotals[ChunkIdx];
+        const int32 ChunkBegin = ChunkIdx * HydraulicLevelChunkSize;
+        const int32 ChunkEnd = FMath::Min(ChunkBegin + HydraulicLevelChunkSize, VertexCount);
+
+        for (int32 VertexIdx = ChunkBegin; VertexIdx < ChunkEnd; ++VertexIdx)
         {
-            VertexElevationValues[VertexIdx] -= Erode;
-            VertexElevationValues[VertexIdx] += SelfDeposit;
-        }
+            const double Erode = HydraulicErosionBuffer[VertexIdx];
+            if (Erode > 0.0 && FMath::IsFinite(Erode))
+            {
+                const double SelfDeposit = HydraulicSelfDepositBuffer[VertexIdx];
+                const double DownstreamDeposit = HydraulicDownstreamDepositBuffer[VertexIdx];
 
-        LastHydraulicTotalEroded += Erode;
-        LastHydraulicTotalDeposited += SelfDeposit;
+                VertexAmplifiedElevation[VertexIdx] -= Erode;
+                VertexAmplifiedElevation[VertexIdx] += SelfDeposit;
+                if (VertexElevationValues.IsValidIndex(VertexIdx))
+                {
+                    VertexElevationValues[VertexIdx] -= Erode;
+                    VertexElevationValues[VertexIdx] += SelfDeposit;
+                }
 
-        const int32 DownstreamIdx = HydraulicDownhillNeighbor.IsValidIndex(VertexIdx) ? HydraulicDownhillNeighbor[VertexIdx] : INDEX_NONE;
-        if (DownstreamIdx != INDEX_NONE && DownstreamDeposit > 0.0 && VertexAmplifiedElevation.IsValidIndex(DownstreamIdx))
-        {
-            VertexAmplifiedElevation[DownstreamIdx] += DownstreamDeposit;
-            if (VertexElevationValues.IsValidIndex(DownstreamIdx))
+                Totals.Eroded += Erode;
+                Totals.Deposited += SelfDeposit;
+
+                const int32 DownstreamIdx = HydraulicDownhillNeighbor[VertexIdx];
+                if (DownstreamIdx != INDEX_NONE && DownstreamDeposit > 0.0 && DownstreamIdx < VertexCount)
+                {
+                    Totals.Deposited += DownstreamDeposit;
+                }
+                else
+                {
+                    Totals.LostToOcean += DownstreamDeposit;
+                }
+            }
+
+            for (int32 DonorOffset = HydraulicDonorOffsets[VertexIdx]; DonorOffset < HydraulicDonorOffsets[VertexIdx + 1]; ++DonorOffset)
             {
-                VertexElevationValues[DownstreamIdx] += DownstreamDeposit;
+                const int32 DonorIdx = HydraulicDonors[DonorOffset];
+                const double DonorErode = HydraulicErosionBuffer[DonorIdx];
+                const double DonorDeposit = HydraulicDownstreamDepositBuffer[DonorIdx];
+                if (DonorErode <= 0.0 || !FMath::IsFinite(DonorErode) || DonorDeposit <= 0.0)
+                {
+                    continue;
+                }
+
+                VertexAmplifiedElevation[VertexIdx] += DonorDeposit;
+                if (VertexElevationValues.IsValidIndex(VertexIdx))
+                {
+                    VertexElevationValues[VertexIdx] += DonorDeposit;
+                }
             }
-            LastHydraulicTotalDeposited += DownstreamDeposit;
-        }
-        else
-        {
-            LastHydraulicLostToOcean += DownstreamDeposit;
         }
+    });
+
+    for (const FHydraulicChunkTotals& Totals : ChunkTotals)
+    {
+        LastHydraulicTotalEroded += Totals.Eroded;
+        LastHydraulicTotalDeposited += Totals.Deposited;
+        LastHydraulicLostToOcean += Totals.LostToOcean;
     }
 
     if (!FMath::IsFinite(LastHydraulicTotalEroded))
@@ -41,96 +41,91 @@ void UTectonicSimulationService::ApplyOceanicDampening(double DeltaTimeMy)
         VertexSedimentThickness.SetNumZeroed(VertexCount);
     }
 
-    TArray<uint8> OceanicMask;
-    OceanicMask.SetNumZeroed(VertexCount);
+    FSurfaceProcessScratch& Scratch = SurfaceProcessScratch;
+    Scratch.Resize(VertexCount);
 
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    const double DampFactor = FMath::Clamp(Parameters.OceanicDampeningConstant * DeltaTimeMy, 0.0, 1.0);
+    const double AgePullScale = 0.01 * DeltaTimeMy;
+
+    ParallelFor(VertexCount, [this, DampFactor, AgePullScale, DeltaTimeMy](int32 VertexIdx)
     {
-        const int32 PlateIdx = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
-        const bool bIsOceanicPlate = (PlateIdx != INDEX_NONE && Plates.IsValidIndex(PlateIdx))
-            ? (Plates[PlateIdx].CrustType == ECrustType::Oceanic)
-            : false;
+        ComputeOceanicDampeningVertex(VertexIdx, DeltaTimeMy, DampFactor, AgePullScale);
+    });
 
-        if (bIsOceanicPlate && VertexElevationValues.IsValidIndex(VertexIdx) && VertexElevationValues[VertexIdx] < Parameters.SeaLevel)
-        {
-            OceanicMask[VertexIdx] = 1;
-        }
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        VertexElevationValues[VertexIdx] = Scratch.NextElevation[VertexIdx];
+        VertexCrustAge[VertexIdx] = Scratch.NextCrustAge[VertexIdx];
     }
 
-    TArray<double> NextElevation;
-    NextElevation.SetNumUninitialized(VertexCount);
-    TArray<double> NextCrustAge;
-    NextCrustAge.SetNumUninitialized(VertexCount);
+    BumpOceanicAmplificationSerial();
+}
 
-    const double RidgeDepth = PaperElevationConstants::OceanicRidgeDepth_m;
-    const double AbyssalDepth = PaperElevationConstants::AbyssalPlainDepth_m;
-    const double DampFactor = FMath::Clamp(Parameters.OceanicDampeningConstant * DeltaTimeMy, 0.0, 1.0);
-    const double AgePullScale = 0.01 * DeltaTimeMy;
+void UTectonicSimulationService::ComputeOceanicDampeningVertex(int32 VertexIdx, double DeltaTimeMy, double DampFactor, double AgePullScale)
+{
+    FSurfaceProcessScratch& Scratch = SurfaceProcessScratch;
 
-    ParallelFor(VertexCount, [this, &OceanicMask, &NextElevation, &NextCrustAge, DampFactor, AgePullScale, RidgeDepth, AbyssalDepth, DeltaTimeMy](int32 VertexIdx)
-    {
-        const double CurrentElevation = VertexElevationValues.IsValidIndex(VertexIdx) ? VertexElevationValues[VertexIdx] : 0.0;
-        const double CurrentAge = VertexCrustAge.IsValidIndex(VertexIdx) ? VertexCrustAge[VertexIdx] : 0.0;
+    const double CurrentElevation = VertexElevationValues.IsValidIndex(VertexIdx) ? VertexElevationValues[VertexIdx] : 0.0;
+    const double CurrentAge = VertexCrustAge.IsValidIndex(VertexIdx) ? VertexCrustAge[VertexIdx] : 0.0;
 
-        if (!OceanicMask[VertexIdx])
-        {
-            NextElevation[VertexIdx] = CurrentElevation;
-            NextCrustAge[VertexIdx] = CurrentAge;
-            return;
-        }
+    // Only submerged vertices on oceanic plates are dampened.
+    const int32 PlateIdx = VertexPlateAssignments.IsValidIndex(VertexIdx) ? VertexPlateAssignments[VertexIdx] : INDEX_NONE;
+    const bool bIsOceanicPlate = (PlateIdx != INDEX_NONE && Plates.IsValidIndex(PlateIdx))
+        ? (Plates[PlateIdx].CrustType == ECrustType::Oceanic)
+        : false;
+
+    if (!bIsOceanicPlate || !VertexElevationValues.IsValidIndex(VertexIdx) || !(CurrentElevation < Parameters.SeaLevel))
+    {
+        Scratch.NextElevation[VertexIdx] = CurrentElevation;
+        Scratch.NextCrustAge[VertexIdx] = CurrentAge;
+        return;
+    }
 
-        const double UpdatedAge = CurrentAge + DeltaTimeMy;
+    const double RidgeDepth = PaperElevationConstants::OceanicRidgeDepth_m;
+    const double AbyssalDepth = PaperElevationConstants::AbyssalPlainDepth_m;
+    const double UpdatedAge = CurrentAge + DeltaTimeMy;
 
-        const double AgeSubsidence = Parameters.OceanicAgeSubsidenceCoeff * FMath::Sqrt(UpdatedAge);
-        const double TargetDepth = FMath::Max(RidgeDepth - AgeSubsidence, AbyssalDepth);
+    const double AgeSubsidence = Parameters.OceanicAgeSubsidenceCoeff * FMath::Sqrt(UpdatedAge);
+    const double TargetDepth = FMath::Max(RidgeDepth - AgeSubsidence, AbyssalDepth);
 
-        double WeightedSum = 0.0;
-        const double WeightTotal = RenderVertexAdjacencyWeightTotals.IsValidIndex(VertexIdx)
-            ? static_cast<double>(RenderVertexAdjacencyWeightTotals[VertexIdx])
-            : 0.0;
+    double WeightedSum = 0.0;
+    const double WeightTotal = RenderVertexAdjacencyWeightTotals.IsValidIndex(VertexIdx)
+        ? static_cast<double>(RenderVertexAdjacencyWeightTotals[VertexIdx])
+        : 0.0;
 
-        const int32 StartOffset = RenderVertexAdjacencyOffsets[VertexIdx];
-        const int32 EndOffset = RenderVertexAdjacencyOffsets[VertexIdx + 1];
+    const int32 StartOffset = RenderVertexAdjacencyOffsets[VertexIdx];
+    const int32 EndOffset = RenderVertexAdjacencyOffsets[VertexIdx + 1];
 
-        for (int32 Offset = StartOffset; Offset < EndOffset; ++Offset)
+    for (int32 Offset = StartOffset; Offset < EndOffset; ++Offset)
+    {
+        const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
+        if (!VertexElevationValues.IsValidIndex(NeighborIdx))
         {
-            const int32 NeighborIdx = RenderVertexAdjacency.IsValidIndex(Offset) ? RenderVertexAdjacency[Offset] : INDEX_NONE;
-            if (!VertexElevationValues.IsValidIndex(NeighborIdx))
-            {
-                continue;
-            }
-
-            const double Weight = RenderVertexAdjacencyWeights.IsValidIndex(Offset)
-                ? RenderVertexAdjacencyWeights[Offset]
-                : 0.0f;
-
-            if (Weight <= 0.0)
-            {
-                continue;
-            }
-
-            WeightedSum += Weight * VertexElevationValues[NeighborIdx];
+            continue;
         }
 
-        double SmoothedElevation = CurrentElevation;
-        if (WeightTotal > UE_DOUBLE_SMALL_NUMBER)
+        const double Weight = RenderVertexAdjacencyWeights.IsValidIndex(Offset)
+            ? RenderVertexAdjacencyWeights[Offset]
+            : 0.0f;
+
+        if (Weight <= 0.0)
         {
-            SmoothedElevation = (CurrentElevation + WeightedSum) / (1.0 + WeightTotal);
+            continue;
         }
 
-        const double DampedElevation = FMath::Lerp(CurrentElevation, SmoothedElevation, DampFactor);
-        const double AgePull = (TargetDepth - DampedElevation) * AgePullScale;
-        const double ClampedElevation = FMath::Min(DampedElevation + AgePull, Parameters.SeaLevel - 1.0);
-
-        NextElevation[VertexIdx] = ClampedElevation;
-        NextCrustAge[VertexIdx] = UpdatedAge;
-    });
+        WeightedSum += Weight * VertexElevationValues[NeighborIdx];
+    }
 
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    double SmoothedElevation = CurrentElevation;
+    if (WeightTotal > UE_DOUBLE_SMALL_NUMBER)
     {
-        VertexElevationValues[VertexIdx] = NextElevation[VertexIdx];
-        VertexCrustAge[VertexIdx] = NextCrustAge[VertexIdx];
+        SmoothedElevation = (CurrentElevation + WeightedSum) / (1.0 + WeightTotal);
     }
 
-    BumpOceanicAmplificationSerial();
+    const double DampedElevation = FMath::Lerp(CurrentElevation, SmoothedElevation, DampFactor);
+    const double AgePull = (TargetDepth - DampedElevation) * AgePullScale;
+    const double ClampedElevation = FMath::Min(DampedElevation + AgePull, Parameters.SeaLevel - 1.0);
+
+    Scratch.NextElevation[VertexIdx] = ClampedElevation;
+    Scratch.NextCrustAge[VertexIdx] = UpdatedAge;
 }
@@ -41,160 +41,133 @@ void UTectonicSimulationService::ApplySedimentTransport(double DeltaTimeMy)
         return;
     }
 
+    BeginSedimentTransport(DeltaTimeMy);
+
     // Stage 0 erosion pool: existing sediment + new erosion from this step
-    TArray<double> CurrentSediment;
-    CurrentSediment.SetNumZeroed(VertexCount);
+    ParallelFor(VertexCount, [this, DeltaTimeMy](int32 VertexIdx)
+    {
+        SeedSedimentTransportVertex(VertexIdx, DeltaTimeMy);
+    });
+
+    IterateSedimentTransport();
+
+    const FSedimentTransportScratch& Scratch = SedimentTransportScratch;
+    double TotalDepositedMass = 0.0;
 
     for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
     {
-        double Value = VertexSedimentThickness[VertexIdx];
-        if (VertexErosionRates.IsValidIndex(VertexIdx))
+        const double FinalSediment = Scratch.CurrentSediment[VertexIdx];
+        const double NetChange = FinalSediment - VertexSedimentThickness[VertexIdx];
+        if (NetChange > 0.0)
         {
-            const double ErosionThisStep = VertexErosionRates[VertexIdx] * DeltaTimeMy;
-            if (ErosionThisStep > 0.0)
-            {
-                Value += ErosionThisStep;
-            }
+            TotalDepositedMass += NetChange;
         }
-        CurrentSediment[VertexIdx] = FMath::Max(0.0, Value);
+
+        VertexSedimentThickness[VertexIdx] = FinalSediment;
     }
 
-    const int32 EdgeCount = RenderVertexAdjacency.Num();
-    if (RenderVertexReverseAdjacency.Num() != EdgeCount)
+    UE_LOG(LogPlanetaryCreation, VeryVerbose, TEXT("[Sediment] Deposited mass this step: %.4f m"), TotalDepositedMass);
+}
+
+void UTectonicSimulationService::BeginSedimentTransport(double DeltaTimeMy)
+{
+    // Elevations are fixed for the whole diffusion, so the downhill split is a per-step constant. Each vertex
+    // pulls (Transfer_u / TotalGradient_u) * (h_u - h_v) from every higher neighbour u; no reverse-adjacency gather.
+    FSedimentTransportScratch& Scratch = SedimentTransportScratch;
+    Scratch.Resize(RenderVertices.Num());
+
+    Scratch.DiffusionIterations = Parameters.bSkipCPUAmplification ? 4 : 6;
+    Scratch.TransferScale = Parameters.SedimentDiffusionRate * (DeltaTimeMy / Scratch.DiffusionIterations);
+    Scratch.ConvergentDeposit = 0.05 * Parameters.SedimentDiffusionRate * DeltaTimeMy;
+}
+
+void UTectonicSimulationService::SeedSedimentTransportVertex(int32 VertexIdx, double DeltaTimeMy)
+{
+    FSedimentTransportScratch& Scratch = SedimentTransportScratch;
+
+    double Value = VertexSedimentThickness[VertexIdx];
+    const double ErosionThisStep = VertexErosionRates[VertexIdx] * DeltaTimeMy;
+    if (ErosionThisStep > 0.0)
     {
-        BuildRenderVertexReverseAdjacency();
+        Value += ErosionThisStep;
     }
+    Scratch.CurrentSediment[VertexIdx] = FMath::Max(0.0, Value);
 
-    const int32 DiffusionIterations = Parameters.bSkipCPUAmplification ? 4 : 6;
+    const double CurrentElevation = VertexElevationValues[VertexIdx];
+    double TotalGradient = 0.0;
+    double MaxGradient = 0.0;
+    for (int32 Offset = RenderVertexAdjacencyOffsets[VertexIdx]; Offset < RenderVertexAdjacencyOffsets[VertexIdx + 1]; ++Offset)
+    {
+        const int32 NeighborIdx = RenderVertexAdjacency[Offset];
+        if (!VertexElevationValues.IsValidIndex(NeighborIdx))
+        {
+            continue;
+        }
+
+        const double Gradient = CurrentElevation - VertexElevationValues[NeighborIdx];
+        if (Gradient > 0.0)
+        {
+            TotalGradient += Gradient;
+            MaxGradient = FMath::Max(MaxGradient, Gradient);
+        }
+    }
 
-    TArray<double> NextSediment;
-    NextSediment.SetNumZeroed(VertexCount);
-    TArray<float> OutgoingFlow;
-    OutgoingFlow.SetNumZeroed(EdgeCount);
-    TArray<float> SelfReduction;
-    SelfReduction.SetNumZeroed(VertexCount);
+    Scratch.InvTotalGradient[VertexIdx] = TotalGradient > 0.0 ? static_cast<float>(1.0 / TotalGradient) : 0.0f;
+    Scratch.SlopeFactor[VertexIdx] = static_cast<float>(FMath::Min(1.0, MaxGradient / 500.0));
+    Scratch.Transfer[0][VertexIdx] = Scratch.ComputeTransfer(VertexIdx, Scratch.CurrentSediment[VertexIdx]);
+}
 
+void UTectonicSimulationService::IterateSedimentTransport()
+{
+    FSedimentTransportScratch& Scratch = SedimentTransportScratch;
+    const int32 VertexCount = RenderVertices.Num();
+    const int32 DiffusionIterations = Scratch.DiffusionIterations;
+    const double ConvergentDeposit = Scratch.ConvergentDeposit;
+
+    // One dispatch per iteration: apply iteration k and, in the same visit, compute the transfer for k+1.
+    // Leaves the final pool in Scratch.CurrentSediment.
+    int32 ReadBuffer = 0;
     for (int32 Iteration = 0; Iteration < DiffusionIterations; ++Iteration)
     {
-        FMemory::Memset(OutgoingFlow.GetData(), 0, EdgeCount * sizeof(float));
-        FMemory::Memset(SelfReduction.GetData(), 0, VertexCount * sizeof(float));
+        const bool bHasNextIteration = Iteration + 1 < DiffusionIterations;
+        const TArray<float>& TransferIn = Scratch.Transfer[ReadBuffer];
+        TArray<float>& TransferOut = Scratch.Transfer[ReadBuffer ^ 1];
 
-        ParallelFor(VertexCount, [this, &CurrentSediment, &OutgoingFlow, &SelfReduction, DiffusionIterations, DeltaTimeMy](int32 VertexIdx)
+        ParallelFor(VertexCount, [this, &Scratch, &TransferIn, &TransferOut, ConvergentDeposit, bHasNextIteration](int32 VertexIdx)
         {
-            if (!VertexElevationValues.IsValidIndex(VertexIdx))
-            {
-                return;
-            }
-
             const double CurrentElevation = VertexElevationValues[VertexIdx];
-            const int32 StartOffset = RenderVertexAdjacencyOffsets[VertexIdx];
-            const int32 EndOffset = RenderVertexAdjacencyOffsets[VertexIdx + 1];
+            double Delta = -static_cast<double>(TransferIn[VertexIdx]);
 
-            if (StartOffset == EndOffset)
-            {
-                return;
-            }
-
-            TArray<int32, TInlineAllocator<12>> DownhillOffsets;
-            TArray<double, TInlineAllocator<12>> NeighborGradients;
-            double TotalGradient = 0.0;
-
-            for (int32 Offset = StartOffset; Offset < EndOffset; ++Offset)
+            for (int32 Offset = RenderVertexAdjacencyOffsets[VertexIdx]; Offset < RenderVertexAdjacencyOffsets[VertexIdx + 1]; ++Offset)
             {
                 const int32 NeighborIdx = RenderVertexAdjacency[Offset];
-                if (!VertexElevationValues.IsValidIndex(NeighborIdx))
+                if (!TransferIn.IsValidIndex(NeighborIdx) || TransferIn[NeighborIdx] <= 0.0f)
                 {
                     continue;
                 }
 
-                const double NeighborElevation = VertexElevationValues[NeighborIdx];
-                if (NeighborElevation < CurrentElevation)
+                const double Gradient = VertexElevationValues[NeighborIdx] - CurrentElevation;
+                if (Gradient > 0.0)
                 {
-                    const double Gradient = CurrentElevation - NeighborElevation;
-                    DownhillOffsets.Add(Offset);
-                    NeighborGradients.Add(Gradient);
-                    TotalGradient += Gradient;
+                    const float Share = static_cast<float>(Gradient) * Scratch.InvTotalGradient[NeighborIdx];
+                    Delta += static_cast<double>(TransferIn[NeighborIdx] * Share);
                 }
             }
 
-            if (DownhillOffsets.Num() == 0 || TotalGradient <= 0.0)
-            {
-                return;
-            }
-
-            const double Available = CurrentSediment[VertexIdx];
-            if (Available <= 0.0)
-            {
-                return;
-            }
-
-            double MaxGradient = 0.0;
-            for (double Gradient : NeighborGradients)
-            {
-                MaxGradient = FMath::Max(MaxGradient, Gradient);
-            }
-
-            const double SlopeFactor = FMath::Min(1.0, MaxGradient / 500.0);
-            const double TransferAmount = Available * Parameters.SedimentDiffusionRate * SlopeFactor * (DeltaTimeMy / DiffusionIterations);
-            if (TransferAmount <= 0.0)
+            if (ConvergentNeighborFlags.IsValidIndex(VertexIdx) && ConvergentNeighborFlags[VertexIdx])
             {
-                return;
+                Delta += ConvergentDeposit;
             }
 
-            SelfReduction[VertexIdx] = static_cast<float>(TransferAmount);
-
-            for (int32 LocalIdx = 0; LocalIdx < DownhillOffsets.Num(); ++LocalIdx)
+            const double Updated = FMath::Max(0.0, Scratch.CurrentSediment[VertexIdx] + Delta);
+            Scratch.NextSediment[VertexIdx] = Updated;
+            if (bHasNextIteration)
             {
-                const int32 Offset = DownhillOffsets[LocalIdx];
-                const double Gradient = NeighborGradients[LocalIdx];
-                const double ProportionalTransfer = TransferAmount * (Gradient / TotalGradient);
-                OutgoingFlow[Offset] = static_cast<float>(ProportionalTransfer);
+                TransferOut[VertexIdx] = Scratch.ComputeTransfer(VertexIdx, Updated);
             }
         });
 
-        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-        {
-            double Delta = -static_cast<double>(SelfReduction[VertexIdx]);
-
-            const int32 StartOffset = RenderVertexAdjacencyOffsets[VertexIdx];
-            const int32 EndOffset = RenderVertexAdjacencyOffsets[VertexIdx + 1];
-
-            for (int32 Offset = StartOffset; Offset < EndOffset; ++Offset)
-            {
-                const int32 ReverseIndex = RenderVertexReverseAdjacency.IsValidIndex(Offset)
-                    ? RenderVertexReverseAdjacency[Offset]
-                    : INDEX_NONE;
-                if (ReverseIndex != INDEX_NONE)
-                {
-                    Delta += OutgoingFlow[ReverseIndex];
-                }
-            }
-
-            if (ConvergentNeighborFlags.IsValidIndex(VertexIdx) && ConvergentNeighborFlags[VertexIdx])
-            {
-                Delta += 0.05 * Parameters.SedimentDiffusionRate * DeltaTimeMy;
-            }
-
-            const double Updated = FMath::Max(0.0, CurrentSediment[VertexIdx] + Delta);
-            NextSediment[VertexIdx] = Updated;
-        }
-
-        CurrentSediment = NextSediment;
+        Swap(Scratch.CurrentSediment, Scratch.NextSediment);
+        ReadBuffer ^= 1;
     }
-
-    double TotalDepositedMass = 0.0;
-
-    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
-    {
-        const double FinalSediment = CurrentSediment[VertexIdx];
-        const double NetChange = FinalSediment - VertexSedimentThickness[VertexIdx];
-        if (NetChange > 0.0)
-        {
-            TotalDepositedMass += NetChange;
-        }
-
-        VertexSedimentThickness[VertexIdx] = FinalSediment;
-    }
-
-    UE_LOG(LogPlanetaryCreation, VeryVerbose, TEXT("[Sediment] Deposited mass this step: %.4f m"), TotalDepositedMass);
 }
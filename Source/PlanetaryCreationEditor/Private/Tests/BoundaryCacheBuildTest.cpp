@@ -0,0 +1,94 @@
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBoundaryCacheBuildTest,
+    "PlanetaryCreation.StageB.BoundaryCacheBuild",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBoundaryCacheBuildTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor->GetEditorSubsystem<UTectonicSimulationService>();
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    Service->ResetSimulation();
+    Service->ProcessPendingOceanicGPUReadbacks(true);
+    Service->ProcessPendingContinentalGPUReadbacks(true);
+
+    Service->BuildRenderVertexBoundaryCache();
+    const TArray<UTectonicSimulationService::FRenderVertexBoundaryInfo> FirstCache = Service->GetRenderVertexBoundaryCache();
+    const double FirstMs = Service->GetLastBoundaryCacheBuildMs();
+
+    Service->BuildRenderVertexBoundaryCache();
+    const TArray<UTectonicSimulationService::FRenderVertexBoundaryInfo>& SecondCache = Service->GetRenderVertexBoundaryCache();
+    const double SecondMs = Service->GetLastBoundaryCacheBuildMs();
+
+    TestEqual(TEXT("Boundary cache covers every render vertex"), SecondCache.Num(), Service->GetRenderVertices().Num());
+    TestEqual(TEXT("Boundary cache size is stable across rebuilds"), SecondCache.Num(), FirstCache.Num());
+
+    const double InfluenceRadians = FMath::Max(Service->GetParameters().RidgeBoundaryInfluenceRadians, 0.0);
+    const TArray<int32>& PlateAssignments = Service->GetVertexPlateAssignments();
+
+    int32 SeedCount = 0;
+    int32 PropagatedCount = 0;
+    int32 OutOfRange = 0;
+    int32 CrossPlate = 0;
+    int32 Mismatches = 0;
+
+    const int32 Count = FMath::Min(FirstCache.Num(), SecondCache.Num());
+    for (int32 VertexIdx = 0; VertexIdx < Count; ++VertexIdx)
+    {
+        const UTectonicSimulationService::FRenderVertexBoundaryInfo& A = FirstCache[VertexIdx];
+        const UTectonicSimulationService::FRenderVertexBoundaryInfo& B = SecondCache[VertexIdx];
+        if (A.bHasBoundary != B.bHasBoundary ||
+            A.SourcePlateID != B.SourcePlateID ||
+            A.DistanceRadians != B.DistanceRadians ||
+            !A.BoundaryTangent.Equals(B.BoundaryTangent, 0.0))
+        {
+            ++Mismatches;
+        }
+
+        if (!B.bHasBoundary)
+        {
+            continue;
+        }
+
+        if (B.DistanceRadians <= 0.0f)
+        {
+            ++SeedCount;
+        }
+        else
+        {
+            ++PropagatedCount;
+        }
+
+        if (InfluenceRadians > UE_DOUBLE_SMALL_NUMBER && static_cast<double>(B.DistanceRadians) > InfluenceRadians + KINDA_SMALL_NUMBER)
+        {
+            ++OutOfRange;
+        }
+
+        if (PlateAssignments.IsValidIndex(VertexIdx) && PlateAssignments[VertexIdx] != B.SourcePlateID)
+        {
+            ++CrossPlate;
+        }
+    }
+
+    TestTrue(TEXT("Divergent seeds found"), SeedCount > 0);
+    TestTrue(TEXT("Seeds propagated into plate interiors"), PropagatedCount > 0);
+    TestEqual(TEXT("Propagation stays within RidgeBoundaryInfluenceRadians"), OutOfRange, 0);
+    TestEqual(TEXT("Propagation never crosses plates"), CrossPlate, 0);
+    TestEqual(TEXT("Parallel rebuild is deterministic"), Mismatches, 0);
+
+    AddInfo(FString::Printf(TEXT("[BoundaryCacheBuildTest] Vertices=%d Seeds=%d Propagated=%d First=%.2f ms Second=%.2f ms"),
+        Count,
+        SeedCount,
+        PropagatedCount,
+        FirstMs,
+        SecondMs));
+
+    return true;
+}
@@ -0,0 +1,145 @@
+// Boundary overlay seam set: the CSR edge pass must find exactly the plate-crossing render edges, trace every edge of a
+// non-branching seam once, and the controller must rebuild/re-upload the overlay only when the seams change.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/BoundaryOverlaySet.h"
+#include "Simulation/TectonicSimulationController.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBoundaryOverlaySetTest,
+    "PlanetaryCreation.Milestone4.BoundaryOverlaySet",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBoundaryOverlaySetTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.LloydIterations = 2;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+    Service->AdvanceSteps(2);
+
+    const TArray<int32>& RenderTriangles = Service->GetRenderTriangles();
+    const TArray<int32>& Assignments = Service->GetVertexPlateAssignments();
+
+    // Reference: plate-crossing edges from a triangle walk.
+    TSet<FIntPoint> ExpectedEdges;
+    for (int32 TriIdx = 0; TriIdx < RenderTriangles.Num(); TriIdx += 3)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 A = RenderTriangles[TriIdx + Corner];
+            const int32 B = RenderTriangles[TriIdx + (Corner + 1) % 3];
+            if (Assignments[A] != Assignments[B] && Assignments[A] != INDEX_NONE && Assignments[B] != INDEX_NONE)
+            {
+                ExpectedEdges.Add(FIntPoint(FMath::Min(A, B), FMath::Max(A, B)));
+            }
+        }
+    }
+
+    const uint64 AssignmentHash = FBoundaryOverlaySet::HashAssignments(Assignments);
+    FBoundaryOverlaySet Set;
+    Set.Build(Service->GetTopologyVersion(), Service->GetRenderVertexAdjacencyOffsets(), Service->GetRenderVertexAdjacency(),
+        RenderTriangles, Assignments, AssignmentHash);
+
+    TestEqual(TEXT("CSR pass finds every seam edge once"), Set.Edges.Num(), ExpectedEdges.Num());
+    bool bAllExpected = true;
+    for (const FBoundaryOverlayEdge& Edge : Set.Edges)
+    {
+        bAllExpected &= Edge.V0 < Edge.V1 && ExpectedEdges.Contains(FIntPoint(Edge.V0, Edge.V1));
+    }
+    TestTrue(TEXT("Only plate-crossing edges are extracted"), bAllExpected);
+
+    int32 GroupedEdges = 0;
+    bool bGroupsConsistent = true;
+    bool bPolylinesCoverSeams = true;
+    for (const FBoundaryOverlayGroup& Group : Set.Groups)
+    {
+        TestEqual(TEXT("Groups are contiguous"), Group.FirstEdge, GroupedEdges);
+        GroupedEdges += Group.NumEdges;
+
+        for (int32 EdgeIdx = Group.FirstEdge; EdgeIdx < Group.FirstEdge + Group.NumEdges; ++EdgeIdx)
+        {
+            const int32 PlateA = Assignments[Set.Edges[EdgeIdx].V0];
+            const int32 PlateB = Assignments[Set.Edges[EdgeIdx].V1];
+            bGroupsConsistent &= Group.PlateKey == TPair<int32, int32>(FMath::Min(PlateA, PlateB), FMath::Max(PlateA, PlateB));
+        }
+
+        if (Group.BranchVertex == INDEX_NONE)
+        {
+            int32 TracedEdges = 0;
+            for (const FBoundaryOverlayPolyline& Polyline : Group.Polylines)
+            {
+                TracedEdges += Polyline.Vertices.Num() - 1;
+                bPolylinesCoverSeams &= !Polyline.bClosed || Polyline.Vertices[0] == Polyline.Vertices.Last();
+            }
+            bPolylinesCoverSeams &= TracedEdges == Group.NumEdges;
+        }
+        else
+        {
+            bPolylinesCoverSeams &= Group.Polylines.Num() == 0 && Group.BranchDegree > 2;
+        }
+    }
+    TestEqual(TEXT("Groups cover every edge"), GroupedEdges, Set.Edges.Num());
+    TestTrue(TEXT("Each group holds a single plate pair"), bGroupsConsistent);
+    TestTrue(TEXT("Polylines trace each non-branching seam edge once"), bPolylinesCoverSeams);
+
+    // Without a matching CSR the set falls back to the triangle list and finds the same seams.
+    FBoundaryOverlaySet FallbackSet;
+    FallbackSet.Build(Service->GetTopologyVersion(), TArray<int32>(), TArray<int32>(), RenderTriangles, Assignments, AssignmentHash);
+    TestEqual(TEXT("Triangle fallback matches CSR edge count"), FallbackSet.Edges.Num(), Set.Edges.Num());
+    TestEqual(TEXT("Triangle fallback matches CSR grouping"), FallbackSet.Groups.Num(), Set.Groups.Num());
+
+    // Controller: redraws with unchanged seams neither rebuild the set nor re-upload the section.
+    TSharedPtr<FTectonicSimulationController> Controller = MakeShared<FTectonicSimulationController>();
+    Controller->Initialize();
+
+    ON_SCOPE_EXIT
+    {
+        Controller->Shutdown();
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    Controller->RebuildPreview();
+    Controller->SetBoundariesVisible(true);
+
+    FBoundaryOverlayStats First;
+    Controller->GetBoundaryOverlayStats(First);
+    TestEqual(TEXT("Controller seams match the reference"), First.EdgeCount, ExpectedEdges.Num());
+    TestTrue(TEXT("Overlay uploaded once shown"), First.Uploads > 0);
+
+    Controller->RefreshBoundaryOverlay();
+    FBoundaryOverlayStats Unchanged;
+    Controller->GetBoundaryOverlayStats(Unchanged);
+    TestEqual(TEXT("Unchanged seams reuse the set"), Unchanged.SetBuilds, First.SetBuilds);
+    TestEqual(TEXT("Unchanged seams skip the upload"), Unchanged.Uploads, First.Uploads);
+    TestEqual(TEXT("Skipped upload counted"), Unchanged.SkippedUploads - First.SkippedUploads, 1LL);
+
+    Controller->SetBoundaryOverlayMode(1);
+    FBoundaryOverlayStats Simplified;
+    Controller->GetBoundaryOverlayStats(Simplified);
+    TestEqual(TEXT("Mode switch reuses the set"), Simplified.SetBuilds, First.SetBuilds);
+    TestEqual(TEXT("Mode switch re-uploads"), Simplified.Uploads - Unchanged.Uploads, 1LL);
+
+    AddInfo(FString::Printf(TEXT("[BoundaryOverlaySet] %d seam edges in %d boundaries, %d polylines; builds %lld, uploads %lld, skipped %lld"),
+        Simplified.EdgeCount, Simplified.BoundaryCount, Simplified.PolylineCount,
+        Simplified.SetBuilds, Simplified.Uploads, Simplified.SkippedUploads));
+
+    return true;
+}
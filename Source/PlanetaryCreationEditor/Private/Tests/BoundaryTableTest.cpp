@@ -0,0 +1,155 @@
+// Flat boundary table: keys are sorted and address the live Boundaries entries, a step reclassifies only boundaries
+// touching plates that moved, and the incremental sweep matches forced full reclassification step for step.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBoundaryTableTest,
+    "PlanetaryCreation.Milestone4.BoundaryTable",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FBoundaryTableTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 2;
+    Params.bEnableRiftPropagation = true;
+    Params.bEnableDynamicRetessellation = false;
+    Params.bEnableAutomaticLOD = false;
+
+    // Only the first plate spins; the others sit still so their shared boundaries stay classified.
+    int32 MovingPlateID = INDEX_NONE;
+    auto ResetWithOneMovingPlate = [&]()
+    {
+        Service->SetParameters(Params);
+        TArray<FTectonicPlate>& Plates = Service->GetPlatesForModification();
+        MovingPlateID = Plates[0].PlateID;
+        for (int32 PlateIdx = 1; PlateIdx < Plates.Num(); ++PlateIdx)
+        {
+            Plates[PlateIdx].AngularVelocity = 0.0;
+        }
+    };
+
+    struct FBoundarySample
+    {
+        EBoundaryType Type;
+        EBoundaryState State;
+        double RelativeVelocity;
+        double AccumulatedStress;
+        double RiftWidthMeters;
+    };
+
+    auto Capture = [Service]()
+    {
+        TArray<FBoundarySample> Samples;
+        for (const TPair<int32, int32>& Key : Service->GetBoundaryTable().Keys)
+        {
+            const FPlateBoundary& Boundary = Service->GetBoundaries().FindChecked(Key);
+            Samples.Add({Boundary.BoundaryType, Boundary.BoundaryState, Boundary.RelativeVelocity,
+                Boundary.AccumulatedStress, Boundary.RiftWidthMeters});
+        }
+        return Samples;
+    };
+
+    constexpr int32 StepCount = 6;
+
+    // Incremental run
+    ResetWithOneMovingPlate();
+    Service->AdvanceSteps(1);
+
+    const FPlateBoundaryTable& Table = Service->GetBoundaryTable();
+    const TMap<TPair<int32, int32>, FPlateBoundary>& Boundaries = Service->GetBoundaries();
+    TestEqual(TEXT("Table covers every boundary"), Table.Keys.Num(), Boundaries.Num());
+
+    bool bSortedAndLive = true;
+    for (int32 EntryIdx = 0; EntryIdx < Table.Keys.Num(); ++EntryIdx)
+    {
+        bSortedAndLive &= Table.Entries[EntryIdx] == Boundaries.Find(Table.Keys[EntryIdx]);
+        if (EntryIdx > 0)
+        {
+            const TPair<int32, int32>& Prev = Table.Keys[EntryIdx - 1];
+            const TPair<int32, int32>& Key = Table.Keys[EntryIdx];
+            bSortedAndLive &= Prev.Key < Key.Key || (Prev.Key == Key.Key && Prev.Value < Key.Value);
+        }
+    }
+    TestTrue(TEXT("Keys sorted and entries point into Boundaries"), bSortedAndLive);
+    TestEqual(TEXT("Plate edit reclassifies every boundary"), Table.LastReclassified, Table.LastSwept);
+
+    int32 MovingPlateBoundaries = 0;
+    for (const TPair<int32, int32>& Key : Table.Keys)
+    {
+        MovingPlateBoundaries += (Key.Key == MovingPlateID || Key.Value == MovingPlateID) ? 1 : 0;
+    }
+
+    TArray<TArray<FBoundarySample>> IncrementalSamples;
+    IncrementalSamples.Add(Capture());
+    bool bOnlyMovingPlateReclassified = true;
+    for (int32 Step = 1; Step < StepCount; ++Step)
+    {
+        Service->AdvanceSteps(1);
+        bOnlyMovingPlateReclassified &= Table.LastReclassified == MovingPlateBoundaries;
+        IncrementalSamples.Add(Capture());
+    }
+    TestTrue(TEXT("Only boundaries of the moving plate are reclassified"), bOnlyMovingPlateReclassified);
+
+    // Reference run: dropping plate metadata before each step forces a full reclassification.
+    ResetWithOneMovingPlate();
+    bool bMatchesFullReclassification = true;
+    for (int32 Step = 0; Step < StepCount; ++Step)
+    {
+        Service->InvalidatePlateMetadata();
+        Service->AdvanceSteps(1);
+        bMatchesFullReclassification &= Table.LastReclassified == Table.LastSwept;
+
+        const TArray<FBoundarySample> Reference = Capture();
+        const TArray<FBoundarySample>& Incremental = IncrementalSamples[Step];
+        bMatchesFullReclassification &= Reference.Num() == Incremental.Num();
+        for (int32 Index = 0; bMatchesFullReclassification && Index < Reference.Num(); ++Index)
+        {
+            bMatchesFullReclassification &= Reference[Index].Type == Incremental[Index].Type &&
+                Reference[Index].State == Incremental[Index].State &&
+                Reference[Index].RelativeVelocity == Incremental[Index].RelativeVelocity &&
+                Reference[Index].AccumulatedStress == Incremental[Index].AccumulatedStress &&
+                Reference[Index].RiftWidthMeters == Incremental[Index].RiftWidthMeters;
+        }
+    }
+    TestTrue(TEXT("Incremental sweep matches full reclassification"), bMatchesFullReclassification);
+
+    // An outside write to a boundary type is overwritten on the next classifying sweep.
+    TMap<TPair<int32, int32>, FPlateBoundary>& MutableBoundaries = const_cast<TMap<TPair<int32, int32>, FPlateBoundary>&>(Boundaries);
+    const TPair<int32, int32>* StillKey = Table.Keys.FindByPredicate([MovingPlateID](const TPair<int32, int32>& Key)
+    {
+        return Key.Key != MovingPlateID && Key.Value != MovingPlateID;
+    });
+    if (StillKey)
+    {
+        FPlateBoundary& Still = MutableBoundaries[*StillKey];
+        const EBoundaryType Expected = Still.BoundaryType;
+        Still.BoundaryType = Expected == EBoundaryType::Convergent ? EBoundaryType::Divergent : EBoundaryType::Convergent;
+        Service->AdvanceSteps(1);
+        TestEqual(TEXT("Outside write forces reclassification"), Table.LastReclassified, MovingPlateBoundaries + 1);
+        TestTrue(TEXT("Stationary boundary returns to its classified type"), Still.BoundaryType == Expected);
+    }
+
+    AddInfo(FString::Printf(TEXT("[BoundaryTable] %d boundaries, %d reclassified per step with one moving plate"),
+        Table.LastSwept, MovingPlateBoundaries));
+
+    return true;
+}
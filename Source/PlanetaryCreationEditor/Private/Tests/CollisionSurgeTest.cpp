@@ -140,6 +140,27 @@ bool FCollisionSurgeTest::RunTest(const FString& Parameters)
     }
     TestTrue(TEXT("folds tangent/unit"), bFoldOK);
 
+    // Precomputed region: flood fill from the edge endpoint reaches the same cap as the brute-force scan
+    Collision::FCollisionEvent RegionEvt = Evt;
+    RegionEvt.RadiusRad = r_ang;
+    Collision::BuildAffectedRegion(Points, Offsets, Adj, Points[a].Dot(Q) >= Points[b].Dot(Q) ? a : b, RegionEvt);
+    TestTrue(TEXT("flood fill matches brute-force region"), RegionEvt.AffectedVertexIndices == Affected);
+
+    TArray<double> Elev_region; Elev_region.Init(0.0, N);
+    TArray<FVector3d> Folds_region; Folds_region.Init(FVector3d::ZeroVector, N);
+    Collision::ApplyCollisionSurge(Points, RegionEvt, Elev_region, &Folds_region);
+    TestTrue(TEXT("precomputed region surge matches"), Elev_region == Elev_copy && Folds_region == Folds_copy);
+
+    // Detection attaches a radius and non-empty region to every event, at most CollisionDistance_km
+    TArray<Collision::FCollisionEvent> Detected;
+    Collision::DetectCollisions(Points, PlateAssign, Omegas, PlateCrustType, Offsets, Adj, BF, Detected);
+    bool bRegionsOK = Detected.Num() > 0;
+    for (const Collision::FCollisionEvent& E : Detected)
+    {
+        bRegionsOK &= E.RadiusRad > 0.0 && E.RadiusRad <= KmToGeodesicRadians(CollisionDistance_km) && E.AffectedVertexIndices.Num() > 0;
+    }
+    TestTrue(TEXT("detected events carry regions"), bRegionsOK);
+
     // Metrics JSON
     FString BackendName; bool bUsedFallback = false;
     FSphericalTriangulatorFactory::Resolve(BackendName, bUsedFallback);
@@ -0,0 +1,125 @@
+// Compact LOD streams: quantized and MeshOptimizer-encoded cache entries must round-trip within preview tolerances
+// and shrink the float stream footprint.
+
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/CompactLODStreams.h"
+#include "Simulation/TectonicSimulationService.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCompactLODStreamsTest,
+    "PlanetaryCreation.Milestone4.CompactLODStreams",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCompactLODStreamsTest::RunTest(const FString& Parameters)
+{
+    // Latitude/longitude grid sphere with a duplicated seam column, displaced like the preview mesh.
+    constexpr int32 Rings = 48;
+    constexpr int32 Segments = 96;
+    const float RadiusUE = MetersToUE(127400.0);
+
+    TArray<float> PositionX, PositionY, PositionZ;
+    TArray<float> NormalX, NormalY, NormalZ;
+    TArray<float> TangentX, TangentY, TangentZ;
+    TArray<FColor> Colors;
+    TArray<FVector2f> UVs;
+    TArray<float> Heights;
+    TArray<uint32> Indices;
+    TArray<int32> SourceIndices;
+
+    for (int32 Ring = 0; Ring <= Rings; ++Ring)
+    {
+        for (int32 Segment = 0; Segment <= Segments; ++Segment)
+        {
+            const float Theta = PI * Ring / Rings;
+            const float Phi = 2.0f * PI * Segment / Segments;
+            const FVector3f Normal(FMath::Sin(Theta) * FMath::Cos(Phi), FMath::Sin(Theta) * FMath::Sin(Phi), FMath::Cos(Theta));
+            const FVector3f Tangent = FVector3f(-FMath::Sin(Phi), FMath::Cos(Phi), 0.0f);
+            const float HeightMeters = 4000.0f * FMath::Sin(3.0f * Phi) * FMath::Sin(2.0f * Theta);
+            const FVector3f Position = Normal * (RadiusUE + MetersToUE(HeightMeters));
+
+            PositionX.Add(Position.X);
+            PositionY.Add(Position.Y);
+            PositionZ.Add(Position.Z);
+            NormalX.Add(Normal.X);
+            NormalY.Add(Normal.Y);
+            NormalZ.Add(Normal.Z);
+            TangentX.Add(Tangent.X);
+            TangentY.Add(Tangent.Y);
+            TangentZ.Add(Tangent.Z);
+            Colors.Add(FColor(Ring * 5, Segment * 2, 128, 255));
+            UVs.Add(FVector2f(static_cast<float>(Segment) / Segments, static_cast<float>(Ring) / Rings));
+            Heights.Add(HeightMeters);
+            SourceIndices.Add(Segment == Segments ? Ring * (Segments + 1) : SourceIndices.Num());
+        }
+    }
+
+    for (int32 Ring = 0; Ring < Rings; ++Ring)
+    {
+        for (int32 Segment = 0; Segment < Segments; ++Segment)
+        {
+            const uint32 A = Ring * (Segments + 1) + Segment;
+            const uint32 B = A + Segments + 1;
+            Indices.Append({ A, B, A + 1, A + 1, B, B + 1 });
+        }
+    }
+
+    const int32 VertexCount = PositionX.Num();
+    const SIZE_T FloatBytes = VertexCount * (sizeof(float) * 10 + sizeof(FColor) + sizeof(FVector2f) + sizeof(int32)) + Indices.Num() * sizeof(uint32);
+
+    for (const bool bEncode : { false, true })
+    {
+        const TCHAR* Label = bEncode ? TEXT("encoded") : TEXT("quantized");
+
+        FCompactLODStreams Compact;
+        TestTrue(FString::Printf(TEXT("%s: quantize succeeds"), Label), Compact.Quantize(RadiusUE, MetersToUE(1.0),
+            PositionX, PositionY, PositionZ, NormalX, NormalY, NormalZ, TangentX, TangentY, TangentZ,
+            Colors, UVs, Heights, Indices, SourceIndices));
+        TestEqual(FString::Printf(TEXT("%s: small meshes use 16-bit indices"), Label), Compact.Indices16.Num(), Indices.Num());
+        TestTrue(FString::Printf(TEXT("%s: only seam source indices are stored"), Label), Compact.SeamSourceIndices.Num() < VertexCount);
+        if (bEncode)
+        {
+            TestTrue(TEXT("encoded: MeshOptimizer codec applied"), Compact.Encode() && Compact.IsEncoded());
+        }
+
+        const SIZE_T CompactBytes = Compact.GetAllocatedSize();
+        TestTrue(FString::Printf(TEXT("%s: compact streams are under half the float footprint"), Label), CompactBytes * 2 < FloatBytes);
+
+        TArray<float> OutPX, OutPY, OutPZ, OutNX, OutNY, OutNZ, OutTX, OutTY, OutTZ, OutHeights;
+        TArray<FColor> OutColors;
+        TArray<FVector2f> OutUVs;
+        TArray<uint32> OutIndices;
+        TArray<int32> OutSourceIndices;
+        TestTrue(FString::Printf(TEXT("%s: dequantize succeeds"), Label), Compact.Dequantize(OutPX, OutPY, OutPZ, OutNX, OutNY, OutNZ,
+            OutTX, OutTY, OutTZ, OutColors, OutUVs, OutHeights, OutIndices, OutSourceIndices));
+
+        TestTrue(FString::Printf(TEXT("%s: indices round-trip exactly"), Label), OutIndices == Indices);
+        TestTrue(FString::Printf(TEXT("%s: source indices round-trip exactly"), Label), OutSourceIndices == SourceIndices);
+        TestTrue(FString::Printf(TEXT("%s: colors round-trip exactly"), Label), OutColors == Colors);
+
+        double MaxPositionErrorMeters = 0.0;
+        double MaxNormalError = 0.0;
+        double MaxHeightError = 0.0;
+        double MaxUVError = 0.0;
+        for (int32 Index = 0; Index < VertexCount; ++Index)
+        {
+            const FVector3f Original(PositionX[Index], PositionY[Index], PositionZ[Index]);
+            const FVector3f Restored(OutPX[Index], OutPY[Index], OutPZ[Index]);
+            MaxPositionErrorMeters = FMath::Max(MaxPositionErrorMeters, static_cast<double>((Original - Restored).Length()) / MetersToUE(1.0));
+            MaxNormalError = FMath::Max(MaxNormalError, static_cast<double>((FVector3f(NormalX[Index], NormalY[Index], NormalZ[Index]) -
+                FVector3f(OutNX[Index], OutNY[Index], OutNZ[Index])).Length()));
+            MaxHeightError = FMath::Max(MaxHeightError, static_cast<double>(FMath::Abs(Heights[Index] - OutHeights[Index])));
+            MaxUVError = FMath::Max(MaxUVError, static_cast<double>((UVs[Index] - OutUVs[Index]).GetAbsMax()));
+        }
+
+        // Octahedral snorm16 direction error on a 127 km planet is a few meters; half heights lose ~2 m near 4 km.
+        TestTrue(FString::Printf(TEXT("%s: positions within 10 m"), Label), MaxPositionErrorMeters < 10.0);
+        TestTrue(FString::Printf(TEXT("%s: normals within 1e-3"), Label), MaxNormalError < 1.0e-3);
+        TestTrue(FString::Printf(TEXT("%s: heights within 4 m"), Label), MaxHeightError < 4.0);
+        TestTrue(FString::Printf(TEXT("%s: UVs within half precision"), Label), MaxUVError < 1.0e-3);
+
+        AddInfo(FString::Printf(TEXT("[CompactLODStreams] %s: %d verts, %.1f KB -> %.1f KB, max pos err %.2f m, normal err %.5f, height err %.2f m"),
+            Label, VertexCount, FloatBytes / 1024.0, CompactBytes / 1024.0, MaxPositionErrorMeters, MaxNormalError, MaxHeightError));
+    }
+
+    return true;
+}
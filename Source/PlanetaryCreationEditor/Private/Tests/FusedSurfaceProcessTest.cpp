@@ -0,0 +1,114 @@
+// Fused surface-process pass must reproduce the sequential erosion -> sediment -> dampening pipeline exactly.
+
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFusedSurfaceProcessTest,
+    "PlanetaryCreation.Milestone5.FusedSurfaceProcesses",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+    struct FSurfaceProcessSnapshot
+    {
+        TArray<double> Elevation;
+        TArray<double> ErosionRates;
+        TArray<double> Sediment;
+        TArray<double> CrustAge;
+    };
+
+    FSurfaceProcessSnapshot RunSurfaceProcesses(UTectonicSimulationService& Service, const FTectonicSimulationParameters& BaseParams, bool bFused, int32 Steps)
+    {
+        FTectonicSimulationParameters Params = BaseParams;
+        Params.bEnableFusedSurfaceProcesses = bFused;
+        Service.SetParameters(Params);
+        Service.ResetSimulation();
+        Service.AdvanceSteps(Steps);
+
+        FSurfaceProcessSnapshot Snapshot;
+        Snapshot.Elevation = Service.GetVertexElevationValues();
+        Snapshot.ErosionRates = Service.GetVertexErosionRates();
+        Snapshot.Sediment = Service.GetVertexSedimentThickness();
+        Snapshot.CrustAge = Service.GetVertexCrustAge();
+        return Snapshot;
+    }
+
+    int32 CountMismatches(const TArray<double>& Sequential, const TArray<double>& Fused)
+    {
+        if (Sequential.Num() != Fused.Num())
+        {
+            return FMath::Max(Sequential.Num(), Fused.Num());
+        }
+
+        int32 Mismatches = 0;
+        for (int32 Index = 0; Index < Sequential.Num(); ++Index)
+        {
+            if (Sequential[Index] != Fused[Index])
+            {
+                ++Mismatches;
+            }
+        }
+        return Mismatches;
+    }
+}
+
+bool FFusedSurfaceProcessTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 13579;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 6;
+    Params.LloydIterations = 0;
+    Params.bEnableContinentalErosion = true;
+    Params.bEnableSedimentTransport = true;
+    Params.bEnableOceanicDampening = true;
+    Params.bEnableDynamicRetessellation = false;
+    Params.bEnableAutomaticLOD = false;
+
+    constexpr int32 Steps = 5;
+    const FSurfaceProcessSnapshot Sequential = RunSurfaceProcesses(*Service, Params, false, Steps);
+    const FSurfaceProcessSnapshot Fused = RunSurfaceProcesses(*Service, Params, true, Steps);
+    const FSurfaceProcessTimings Timings = Service->GetLastSurfaceProcessTimings();
+
+    TestTrue(TEXT("Surface process arrays populated"), Sequential.Elevation.Num() > 0);
+    TestEqual(TEXT("Fused elevation matches sequential"), CountMismatches(Sequential.Elevation, Fused.Elevation), 0);
+    TestEqual(TEXT("Fused erosion rates match sequential"), CountMismatches(Sequential.ErosionRates, Fused.ErosionRates), 0);
+    TestEqual(TEXT("Fused sediment matches sequential"), CountMismatches(Sequential.Sediment, Fused.Sediment), 0);
+    TestEqual(TEXT("Fused crust age matches sequential"), CountMismatches(Sequential.CrustAge, Fused.CrustAge), 0);
+    TestTrue(TEXT("Fused pass scheduled erosion wavefronts"), Timings.ErosionWavefrontCount > 0);
+
+    // Each process keeps its own flag: erosion-only must still match.
+    FTectonicSimulationParameters ErosionOnly = Params;
+    ErosionOnly.bEnableSedimentTransport = false;
+    ErosionOnly.bEnableOceanicDampening = false;
+    const FSurfaceProcessSnapshot SequentialErosion = RunSurfaceProcesses(*Service, ErosionOnly, false, 2);
+    const FSurfaceProcessSnapshot FusedErosion = RunSurfaceProcesses(*Service, ErosionOnly, true, 2);
+    TestEqual(TEXT("Erosion-only fused elevation matches sequential"), CountMismatches(SequentialErosion.Elevation, FusedErosion.Elevation), 0);
+    TestEqual(TEXT("Erosion-only fused sediment untouched"), CountMismatches(SequentialErosion.Sediment, FusedErosion.Sediment), 0);
+
+    AddInfo(FString::Printf(TEXT("[FusedSurfaceProcessTest] Vertices=%d Fused=%.2f ms (Reduction %.2f | Erosion %.2f [%d wavefronts] | SourceSweep %.2f | Sediment %.2f | Commit %.2f)"),
+        Fused.Elevation.Num(),
+        Timings.TotalMs(),
+        Timings.ReductionMs,
+        Timings.ErosionMs,
+        Timings.ErosionWavefrontCount,
+        Timings.SourceSweepMs,
+        Timings.SedimentMs,
+        Timings.CommitMs));
+
+    Service->SetParameters(OriginalParams);
+    Service->ResetSimulation();
+    return true;
+}
@@ -0,0 +1,139 @@
+// Hydraulic flow accumulation: level-synchronous parallel sweep vs serial reference, benchmarked at L7/L8.
+
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Misc/AutomationTest.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHydraulicFlowAccumulationBenchmarkTest,
+    "PlanetaryCreation.StageB.HydraulicFlowAccumulationBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+    /** Serial Kahn walk over the downhill forest, matching the pre-parallel implementation. */
+    void ComputeReferenceFlow(const TArray<int32>& Downhill, TArray<double>& OutFlow)
+    {
+        const int32 VertexCount = Downhill.Num();
+        OutFlow.Init(1.0, VertexCount);
+
+        TArray<int32> Upstream;
+        Upstream.SetNumZeroed(VertexCount);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            if (Downhill.IsValidIndex(Downhill[VertexIdx]))
+            {
+                ++Upstream[Downhill[VertexIdx]];
+            }
+        }
+
+        TArray<int32> Queue;
+        Queue.Reserve(VertexCount);
+        for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+        {
+            if (Upstream[VertexIdx] == 0)
+            {
+                Queue.Add(VertexIdx);
+            }
+        }
+
+        for (int32 Head = 0; Head < Queue.Num(); ++Head)
+        {
+            const int32 VertexIdx = Queue[Head];
+            const int32 DownstreamIdx = Downhill[VertexIdx];
+            if (!Downhill.IsValidIndex(DownstreamIdx))
+            {
+                continue;
+            }
+
+            OutFlow[DownstreamIdx] += OutFlow[VertexIdx];
+            if (--Upstream[DownstreamIdx] == 0)
+            {
+                Queue.Add(DownstreamIdx);
+            }
+        }
+    }
+}
+
+bool FHydraulicFlowAccumulationBenchmarkTest::RunTest(const FString& Parameters)
+{
+    if (!GEditor)
+    {
+        AddError(TEXT("Hydraulic flow benchmark requires editor context."));
+        return false;
+    }
+
+    UTectonicSimulationService* Service = GEditor->GetEditorSubsystem<UTectonicSimulationService>();
+    if (!Service)
+    {
+        AddError(TEXT("Failed to acquire UTectonicSimulationService."));
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    // L7 = 163,842 vertices, L8 = 655,362 vertices.
+    const int32 BenchmarkLevels[] = { 7, 8 };
+    for (const int32 Level : BenchmarkLevels)
+    {
+        FTectonicSimulationParameters Params;
+        Params.Seed = 24680;
+        Params.SubdivisionLevel = 0;
+        Params.RenderSubdivisionLevel = Level;
+        Params.MinAmplificationLOD = 5;
+        Params.LloydIterations = 0;
+        Params.bEnableOceanicAmplification = true;
+        Params.bEnableContinentalAmplification = true;
+        Params.bEnableHydraulicErosion = true;
+        Params.bSkipCPUAmplification = false;
+        Params.bEnableDynamicRetessellation = false;
+        Params.bEnableAutomaticLOD = false;
+
+        Service->SetParameters(Params);
+        Service->AdvanceSteps(2);
+
+        const TArray<int32>& Downhill = Service->GetHydraulicDownhillNeighbors();
+        const TArray<float>& Flow = Service->GetHydraulicFlowAccumulation();
+        TestEqual(FString::Printf(TEXT("L%d flow array sized to render mesh"), Level), Flow.Num(), Service->GetRenderVertices().Num());
+        if (Flow.Num() == 0 || Flow.Num() != Downhill.Num())
+        {
+            continue;
+        }
+
+        TArray<double> ReferenceFlow;
+        const double ReferenceStart = FPlatformTime::Seconds();
+        ComputeReferenceFlow(Downhill, ReferenceFlow);
+        const double ReferenceMs = (FPlatformTime::Seconds() - ReferenceStart) * 1000.0;
+
+        int32 Mismatches = 0;
+        double MaxFlow = 0.0;
+        for (int32 VertexIdx = 0; VertexIdx < Flow.Num(); ++VertexIdx)
+        {
+            const double Expected = ReferenceFlow[VertexIdx];
+            MaxFlow = FMath::Max(MaxFlow, Expected);
+            if (FMath::Abs(static_cast<double>(Flow[VertexIdx]) - Expected) > FMath::Max(1.0e-4 * Expected, 1.0e-3))
+            {
+                ++Mismatches;
+            }
+        }
+        TestEqual(FString::Printf(TEXT("L%d parallel flow matches serial reference"), Level), Mismatches, 0);
+
+        const double TotalEroded = Service->GetLastHydraulicTotalEroded();
+        const double Balance = FMath::Abs(TotalEroded - (Service->GetLastHydraulicTotalDeposited() + Service->GetLastHydraulicLostToOcean()));
+        const double BalanceRatio = TotalEroded > 1e-3 ? Balance / TotalEroded : 0.0;
+        TestTrue(FString::Printf(TEXT("L%d hydraulic mass accounting balanced"), Level), BalanceRatio <= 1.0e-4);
+
+        const FStageBProfile& Profile = Service->GetLatestStageBProfile();
+        AddInfo(FString::Printf(TEXT("[HydraulicFlowBenchmark] L%d Vertices=%d Levels=%d MaxFlow=%.0f Hydraulic=%.2f ms SerialFlowRef=%.2f ms"),
+            Level,
+            Flow.Num(),
+            Service->GetLastHydraulicFlowLevelCount(),
+            MaxFlow,
+            Profile.HydraulicMs,
+            ReferenceMs));
+    }
+
+    Service->SetParameters(OriginalParams);
+    return true;
+}
@@ -0,0 +1,105 @@
+// LOD cache budget: least recently used entries are evicted once the cache exceeds r.PlanetaryCreation.LODCacheBudgetMB,
+// while the active LOD and its neighbors stay pinned; hit/miss/eviction counters track the traffic.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "HAL/IConsoleManager.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationController.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLODCacheBudgetTest,
+    "PlanetaryCreation.Milestone4.LODCacheBudget",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FLODCacheBudgetTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    IConsoleVariable* BudgetCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.PlanetaryCreation.LODCacheBudgetMB"));
+    if (!BudgetCVar)
+    {
+        AddError(TEXT("r.PlanetaryCreation.LODCacheBudgetMB was not found."));
+        return false;
+    }
+
+    const float OriginalBudget = BudgetCVar->GetFloat();
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 4242;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 0; // L0-L2 build synchronously
+    Params.LloydIterations = 0;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+
+    TSharedPtr<FTectonicSimulationController> Controller = MakeShared<FTectonicSimulationController>();
+    Controller->Initialize();
+
+    ON_SCOPE_EXIT
+    {
+        BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+        Controller->Shutdown();
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    // A budget below a single entry: everything outside the pinned neighborhood is evicted.
+    BudgetCVar->Set(0.0001f, ECVF_SetByCode);
+
+    auto ShowLOD = [&](int32 LODLevel)
+    {
+        Service->SetRenderSubdivisionLevel(LODLevel);
+        Controller->RebuildPreview();
+    };
+
+    FLODCacheMemoryStats Baseline;
+    Controller->GetCacheStats(Baseline);
+
+    ShowLOD(0);
+    ShowLOD(1);
+    ShowLOD(2); // Active L2 pins L1..L3, so L0 goes.
+
+    FLODCacheMemoryStats Stats;
+    Controller->GetCacheStats(Stats);
+    TestEqual(TEXT("Three LODs missed the cache"), Stats.Misses - Baseline.Misses, 3LL);
+    TestEqual(TEXT("L0 evicted when L2 was cached"), Stats.Evictions - Baseline.Evictions, 1LL);
+    TestEqual(TEXT("Pinned L1 and active L2 stay cached"), Stats.CachedLODs, 2);
+    TestTrue(TEXT("Budget reported in bytes"), Stats.BudgetBytes > 0);
+
+    ShowLOD(1); // Pinned neighbor: served from the cache.
+    FLODCacheMemoryStats AfterHit;
+    Controller->GetCacheStats(AfterHit);
+    TestEqual(TEXT("Pinned neighbor is a cache hit"), AfterHit.Hits - Stats.Hits, 1LL);
+    TestEqual(TEXT("Cache hit does not miss"), AfterHit.Misses, Stats.Misses);
+
+    ShowLOD(0); // Evicted earlier: rebuilt, and L2 (outside L0's neighborhood) is now the LRU victim.
+    FLODCacheMemoryStats AfterRebuild;
+    Controller->GetCacheStats(AfterRebuild);
+    TestEqual(TEXT("Evicted LOD misses again"), AfterRebuild.Misses - AfterHit.Misses, 1LL);
+    TestEqual(TEXT("L2 evicted once L0 is active"), AfterRebuild.Evictions - AfterHit.Evictions, 1LL);
+    TestEqual(TEXT("L0 and pinned L1 remain"), AfterRebuild.CachedLODs, 2);
+
+    // Unlimited budget keeps every entry.
+    BudgetCVar->Set(0.0f, ECVF_SetByCode);
+    ShowLOD(2);
+    FLODCacheMemoryStats Unlimited;
+    Controller->GetCacheStats(Unlimited);
+    TestEqual(TEXT("No evictions without a budget"), Unlimited.Evictions, AfterRebuild.Evictions);
+    TestEqual(TEXT("All three LODs cached without a budget"), Unlimited.CachedLODs, 3);
+    TestEqual(TEXT("Unlimited budget reports zero"), Unlimited.BudgetBytes, 0LL);
+
+    AddInfo(FString::Printf(TEXT("[LODCacheBudget] hits %lld, misses %lld, evictions %lld, resident %.1f KB + snapshots %.1f KB"),
+        Unlimited.Hits, Unlimited.Misses, Unlimited.Evictions,
+        Unlimited.ResidentBytes / 1024.0, Unlimited.SnapshotBytes / 1024.0));
+
+    return true;
+}
@@ -0,0 +1,110 @@
+// Plate metadata and incremental split/merge candidates: areas come from the cached table, an unchanged boundary set
+// re-evaluates nothing, and editing one boundary re-evaluates only that boundary and moves it to the top of its queue.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlateTopologyCandidatesTest,
+    "PlanetaryCreation.Milestone4.PlateTopologyCandidates",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPlateTopologyCandidatesTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    // Equal icosahedron faces: ratio 1.0 passes a 1.01 area threshold. No step has accumulated stress and the split
+    // velocity threshold is out of reach, so only the edited boundaries qualify.
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 2;
+    Params.bEnablePlateTopologyChanges = true;
+    Params.bEnableRiftPropagation = false;
+    Params.MergeStressThreshold = 500.0;
+    Params.MergeAreaRatioThreshold = 1.01;
+    Params.SplitVelocityThreshold = 1.0e6;
+    Service->SetParameters(Params);
+
+    // Metadata table
+    const FPlateMetadataTable& Metadata = Service->GetPlateMetadata();
+    const TArray<FTectonicPlate>& Plates = Service->GetPlates();
+    TestEqual(TEXT("One metadata row per plate"), Metadata.AreaSteradians.Num(), Plates.Num());
+
+    double TotalArea = 0.0;
+    bool bIndexConsistent = true;
+    for (int32 PlateIdx = 0; PlateIdx < Plates.Num(); ++PlateIdx)
+    {
+        bIndexConsistent &= Metadata.FindIndex(Plates[PlateIdx].PlateID) == PlateIdx;
+        bIndexConsistent &= Metadata.CrustTypes[PlateIdx] == Plates[PlateIdx].CrustType;
+        TotalArea += Metadata.AreaSteradians[PlateIdx];
+    }
+    TestTrue(TEXT("Metadata index and crust types match plates"), bIndexConsistent);
+    TestTrue(TEXT("Plate areas tile the sphere"), FMath::IsNearlyEqual(TotalArea, 4.0 * PI, 1e-6));
+
+    // Candidates
+    Service->RefreshPlateTopologyCandidates();
+    const FPlateTopologyCandidateTracker& Tracker = Service->GetPlateTopologyCandidates();
+    TestEqual(TEXT("First refresh evaluates every boundary"), Tracker.LastEvaluatedBoundaries, Service->GetBoundaries().Num());
+    TestNull(TEXT("No natural merge candidate"), Tracker.Merges.Peek());
+    TestNull(TEXT("No natural split candidate"), Tracker.Splits.Peek());
+
+    Service->RefreshPlateTopologyCandidates();
+    TestEqual(TEXT("Unchanged boundaries are not re-evaluated"), Tracker.LastEvaluatedBoundaries, 0);
+
+    TMap<TPair<int32, int32>, FPlateBoundary>& Boundaries = const_cast<TMap<TPair<int32, int32>, FPlateBoundary>&>(Service->GetBoundaries());
+    TArray<TPair<int32, int32>> Keys;
+    Boundaries.GenerateKeyArray(Keys);
+    if (Keys.Num() < 2)
+    {
+        AddError(TEXT("Expected at least two boundaries"));
+        return false;
+    }
+
+    FPlateBoundary& MergeBoundary = Boundaries[Keys[0]];
+    MergeBoundary.BoundaryType = EBoundaryType::Convergent;
+    MergeBoundary.AccumulatedStress = 1000.0;
+
+    FPlateBoundary& SplitBoundary = Boundaries[Keys[1]];
+    SplitBoundary.BoundaryType = EBoundaryType::Divergent;
+    SplitBoundary.RelativeVelocity = 2.0e6;
+    SplitBoundary.DivergentDurationMy = Params.SplitDurationThreshold + 10.0;
+
+    Service->RefreshPlateTopologyCandidates();
+    TestEqual(TEXT("Only the edited boundaries are re-evaluated"), Tracker.LastEvaluatedBoundaries, 2);
+
+    const FPlateTopologyCandidate* Merge = Tracker.Merges.Peek();
+    TestTrue(TEXT("Edited convergent boundary is the best merge candidate"), Merge && Merge->BoundaryKey == Keys[0]);
+    const FPlateTopologyCandidate* Split = Tracker.Splits.Peek();
+    TestTrue(TEXT("Edited divergent boundary is the best split candidate"), Split && Split->BoundaryKey == Keys[1]);
+    if (Split)
+    {
+        TestEqual(TEXT("Split picks the lower plate ID"), Split->PlateA, FMath::Min(Keys[1].Key, Keys[1].Value));
+    }
+
+    // Relaxing the boundary retires its candidate.
+    MergeBoundary.AccumulatedStress = 0.0;
+    Service->RefreshPlateTopologyCandidates();
+    TestEqual(TEXT("Relaxed boundary re-evaluated alone"), Tracker.LastEvaluatedBoundaries, 1);
+    TestNull(TEXT("Relaxed boundary leaves the merge queue"), Tracker.Merges.Peek());
+
+    // A plate change drops every tracked candidate.
+    Service->InvalidatePlateMetadata();
+    Service->RefreshPlateTopologyCandidates();
+    TestEqual(TEXT("Plate change re-evaluates every boundary"), Tracker.LastEvaluatedBoundaries, Boundaries.Num());
+
+    return true;
+}
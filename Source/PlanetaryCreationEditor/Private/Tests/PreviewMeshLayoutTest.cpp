@@ -0,0 +1,130 @@
+// Preview mesh layout: MeshOptimizer reordering must keep the same triangles, improve simulated post-transform cache
+// metrics (ACMR/ATVR, no GPU needed) and be applied by the controller's mesh build.
+
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/PreviewMeshLayout.h"
+#include "Simulation/TectonicSimulationController.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPreviewMeshLayoutTest,
+    "PlanetaryCreation.Milestone4.PreviewMeshLayout",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPreviewMeshLayoutTest::RunTest(const FString& Parameters)
+{
+    // Synthetic grid with triangles in shuffled order: a worst case for the post-transform cache.
+    {
+        constexpr int32 GridSize = 64;
+        const int32 VertexCount = (GridSize + 1) * (GridSize + 1);
+
+        TArray<uint32> Indices;
+        for (int32 Row = 0; Row < GridSize; ++Row)
+        {
+            for (int32 Column = 0; Column < GridSize; ++Column)
+            {
+                const uint32 A = Row * (GridSize + 1) + Column;
+                const uint32 B = A + GridSize + 1;
+                Indices.Append({ A, B, A + 1, A + 1, B, B + 1 });
+            }
+        }
+
+        const int32 TriangleCount = Indices.Num() / 3;
+        FRandomStream Random(1337);
+        for (int32 Triangle = TriangleCount - 1; Triangle > 0; --Triangle)
+        {
+            const int32 Other = Random.RandRange(0, Triangle);
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                Swap(Indices[Triangle * 3 + Corner], Indices[Other * 3 + Corner]);
+            }
+        }
+
+        FPreviewMeshLayout Layout;
+        Layout.Build(Indices, VertexCount, VertexCount);
+
+        TestTrue(TEXT("Layout matches its input sizes"), Layout.Matches(VertexCount, VertexCount, Indices.Num()));
+        TestTrue(TEXT("Optimized ACMR beats shuffled order"), Layout.OptimizedMetrics.ACMR < Layout.BaselineMetrics.ACMR);
+        TestTrue(TEXT("Optimized ATVR beats shuffled order"), Layout.OptimizedMetrics.ATVR < Layout.BaselineMetrics.ATVR);
+        TestTrue(TEXT("Optimized ATVR is at least one transform per vertex"), Layout.OptimizedMetrics.ATVR >= 1.0);
+        TestTrue(TEXT("Fetch overfetch does not regress"), Layout.OptimizedMetrics.Overfetch <= Layout.BaselineMetrics.Overfetch + 1.0e-6);
+
+        // NewToBuild is a permutation and the remapped triangles are the original set.
+        TBitArray<> Seen(false, VertexCount);
+        bool bPermutation = true;
+        for (const int32 BuildIndex : Layout.NewToBuild)
+        {
+            bPermutation &= !Seen[BuildIndex];
+            Seen[BuildIndex] = true;
+        }
+        TestTrue(TEXT("Vertex order is a permutation"), bPermutation);
+
+        auto CanonicalTriangles = [](const TArray<uint32>& TriangleIndices, TFunctionRef<uint32(uint32)> MapVertex)
+        {
+            TArray<FIntVector> Triangles;
+            for (int32 Base = 0; Base < TriangleIndices.Num(); Base += 3)
+            {
+                // Rotate so the smallest index leads; winding is preserved.
+                const uint32 V[3] = { MapVertex(TriangleIndices[Base]), MapVertex(TriangleIndices[Base + 1]), MapVertex(TriangleIndices[Base + 2]) };
+                const int32 Lead = (V[0] <= V[1] && V[0] <= V[2]) ? 0 : (V[1] <= V[2] ? 1 : 2);
+                Triangles.Add(FIntVector(V[Lead], V[(Lead + 1) % 3], V[(Lead + 2) % 3]));
+            }
+            Triangles.Sort([](const FIntVector& A, const FIntVector& B)
+            {
+                return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z);
+            });
+            return Triangles;
+        };
+
+        const TArray<FIntVector> Original = CanonicalTriangles(Indices, [](uint32 Vertex) { return Vertex; });
+        const TArray<FIntVector> Remapped = CanonicalTriangles(Layout.Indices, [&Layout](uint32 Vertex) { return static_cast<uint32>(Layout.NewToBuild[Vertex]); });
+        TestTrue(TEXT("Optimized buffer holds the same triangles with the same winding"), Original == Remapped);
+
+        AddInfo(FString::Printf(TEXT("[PreviewMeshLayout] Grid %d tris: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, overfetch %.3f -> %.3f"),
+            TriangleCount, Layout.BaselineMetrics.ACMR, Layout.OptimizedMetrics.ACMR,
+            Layout.BaselineMetrics.ATVR, Layout.OptimizedMetrics.ATVR,
+            Layout.BaselineMetrics.Overfetch, Layout.OptimizedMetrics.Overfetch));
+    }
+
+    // Controller mesh build applies the cached layout.
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 4242;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 2; // Synchronous mesh build path
+    Params.LloydIterations = 0;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+
+    TSharedPtr<FTectonicSimulationController> Controller = MakeShared<FTectonicSimulationController>();
+    Controller->Initialize();
+    Controller->StepSimulation(1);
+
+    const FMeshBuildStats Stats = Controller->GetLastMeshBuildStats();
+    TestEqual(TEXT("Mesh build recorded for the render LOD"), Stats.LODLevel, Params.RenderSubdivisionLevel);
+    TestTrue(TEXT("Mesh build used the optimized layout"), Stats.bOptimizedLayout);
+    TestTrue(TEXT("Optimized ACMR does not exceed subdivision order"),
+        Stats.OptimizedIndexMetrics.ACMR <= Stats.BaselineIndexMetrics.ACMR + 1.0e-6);
+    TestTrue(TEXT("Optimized ATVR does not exceed subdivision order"),
+        Stats.OptimizedIndexMetrics.ATVR <= Stats.BaselineIndexMetrics.ATVR + 1.0e-6);
+
+    AddInfo(FString::Printf(TEXT("[PreviewMeshLayout] L%d %d verts: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (layout %.2f ms)"),
+        Stats.LODLevel, Stats.VertexCount,
+        Stats.BaselineIndexMetrics.ACMR, Stats.OptimizedIndexMetrics.ACMR,
+        Stats.BaselineIndexMetrics.ATVR, Stats.OptimizedIndexMetrics.ATVR, Stats.LayoutMs));
+
+    Controller->Shutdown();
+    Service->SetParameters(OriginalParams);
+    Service->ResetSimulation();
+    return true;
+}
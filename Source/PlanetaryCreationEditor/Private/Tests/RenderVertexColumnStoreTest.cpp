@@ -0,0 +1,176 @@
+// Render vertex column store: bulk compact/permute/snapshot must match field-by-field results, and undo must
+// restore every registered per-vertex array.
+
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/RenderVertexColumnStore.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRenderVertexColumnStoreTest,
+    "PlanetaryCreation.Milestone5.RenderVertexColumnStore",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRenderVertexColumnStoreTest::RunTest(const FString& Parameters)
+{
+    // Standalone store over local arrays.
+    {
+        constexpr int32 Count = 10;
+        TArray<FVector3d> Positions;
+        TArray<double> Elevation;
+        TArray<int32> Plates;
+        TArray<float> Derived;
+        TArray<double> Stale;
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Positions.Add(FVector3d(Index, 0.0, 0.0));
+            Elevation.Add(Index * 10.0);
+            Plates.Add(Index % 3);
+            Derived.Add(static_cast<float>(Index));
+        }
+        Stale.Init(1.0, 3);
+
+        FRenderVertexColumnStore Store;
+        const FRenderVertexColumnStore::FColumnId PositionColumn = Store.RegisterColumn(TEXT("Positions"), Positions, ERenderVertexColumnFlags::Topology | ERenderVertexColumnFlags::History);
+        Store.SetPrimaryColumn(PositionColumn);
+        const FRenderVertexColumnStore::FColumnId ElevationColumn = Store.RegisterColumn(TEXT("Elevation"), Elevation, ERenderVertexColumnFlags::Topology | ERenderVertexColumnFlags::History);
+        Store.RegisterColumn(TEXT("Plates"), Plates, ERenderVertexColumnFlags::Topology | ERenderVertexColumnFlags::KeepSized);
+        Store.RegisterColumn(TEXT("Derived"), Derived, ERenderVertexColumnFlags::History);
+        Store.RegisterColumn(TEXT("Stale"), Stale, ERenderVertexColumnFlags::Topology);
+
+        TestEqual(TEXT("Store reports primary column count"), Store.Num(), Count);
+        TestTrue(TEXT("Column types are explicit"), Store.GetColumnType(ElevationColumn) == ERenderVertexColumnType::Double);
+        TestTrue(TEXT("Vector columns are typed"), Store.GetColumnType(PositionColumn) == ERenderVertexColumnType::Vector3d);
+
+        // Snapshot before edits.
+        FRenderVertexColumnSnapshot Snapshot;
+        Store.CaptureSnapshot(Snapshot, ERenderVertexColumnFlags::History);
+        TestEqual(TEXT("Snapshot captures History columns only"), Snapshot.Columns.Num(), 3);
+        TestEqual(TEXT("Snapshot vertex count"), Snapshot.VertexCount, Count);
+
+        // Compact: drop vertices 1, 4, 9.
+        TBitArray<> RemovalMask(false, Count);
+        RemovalMask[1] = true;
+        RemovalMask[4] = true;
+        RemovalMask[9] = true;
+
+        const uint64 VersionBefore = Store.GetColumnVersion(ElevationColumn);
+        TArray<int32> OldToNew;
+        const int32 NewCount = Store.Compact(RemovalMask, OldToNew);
+
+        TestEqual(TEXT("Compact returns kept count"), NewCount, Count - 3);
+        TestEqual(TEXT("Positions compacted"), Positions.Num(), NewCount);
+        TestEqual(TEXT("Elevation compacted"), Elevation.Num(), NewCount);
+        TestEqual(TEXT("Plates compacted"), Plates.Num(), NewCount);
+        TestEqual(TEXT("Non-topology column untouched"), Derived.Num(), Count);
+        TestEqual(TEXT("Stale topology column reset"), Stale.Num(), 0);
+        TestEqual(TEXT("Removed vertex maps to INDEX_NONE"), OldToNew[4], static_cast<int32>(INDEX_NONE));
+        TestTrue(TEXT("Compaction bumps column versions"), Store.GetColumnVersion(ElevationColumn) > VersionBefore);
+
+        bool bCompactMatches = true;
+        for (int32 OldIndex = 0; OldIndex < Count; ++OldIndex)
+        {
+            const int32 NewIndex = OldToNew[OldIndex];
+            if (NewIndex == INDEX_NONE)
+            {
+                continue;
+            }
+            bCompactMatches &= Positions[NewIndex].X == static_cast<double>(OldIndex);
+            bCompactMatches &= Elevation[NewIndex] == OldIndex * 10.0;
+            bCompactMatches &= Plates[NewIndex] == OldIndex % 3;
+        }
+        TestTrue(TEXT("Compacted columns stay aligned with OldToNew"), bCompactMatches);
+
+        // Permute: reverse order.
+        TArray<int32> NewToOld;
+        for (int32 Index = NewCount - 1; Index >= 0; --Index)
+        {
+            NewToOld.Add(Index);
+        }
+        const TArray<double> ElevationBeforePermute = Elevation;
+        Store.Permute(NewToOld);
+
+        bool bPermuteMatches = true;
+        for (int32 Index = 0; Index < NewCount; ++Index)
+        {
+            bPermuteMatches &= Elevation[Index] == ElevationBeforePermute[NewToOld[Index]];
+        }
+        TestTrue(TEXT("Permute gathers every topology column"), bPermuteMatches);
+
+        // Restore the pre-edit snapshot.
+        Store.RestoreSnapshot(Snapshot);
+        TestEqual(TEXT("Restore brings back vertex count"), Positions.Num(), Count);
+        TestEqual(TEXT("Restore brings back elevation"), Elevation[7], 70.0);
+        TestEqual(TEXT("Restore leaves non-history columns alone"), Plates.Num(), NewCount);
+    }
+
+    // Service integration: undo restores every history column byte-for-byte.
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 13579;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.LloydIterations = 0;
+    Params.bEnableAutomaticLOD = false;
+
+    Service->SetParameters(Params);
+    Service->ResetSimulation();
+    Service->AdvanceSteps(2);
+
+    TestTrue(TEXT("Service registers render vertex columns"), Service->GetRenderVertexColumns().NumColumns() > 0);
+    TestEqual(TEXT("Store count tracks render vertices"), Service->GetRenderVertexColumns().Num(), Service->GetRenderVertices().Num());
+
+    const TArray<FVector3d> Positions = Service->GetRenderVertices();
+    const TArray<int32> PlateAssignments = Service->GetVertexPlateAssignments();
+    const TArray<double> Elevation = Service->GetVertexElevationValues();
+    const TArray<double> CrustAge = Service->GetVertexCrustAge();
+    const TArray<FVector3d> RidgeDirections = Service->GetVertexRidgeDirections();
+    const double TimeMy = Service->GetCurrentTimeMy();
+
+    const FRenderVertexColumnStore& Columns = Service->GetRenderVertexColumns();
+    const uint64 PositionVersion = Columns.GetColumnVersion(0);
+    const int32 HistoryIndex = Service->GetHistoryIndex();
+
+    // History is captured per step; step forward then undo back to the captured index.
+    Service->AdvanceSteps(3);
+    TestTrue(TEXT("Undo succeeds"), Service->Undo());
+    TestTrue(TEXT("Jump back succeeds"), Service->JumpToHistoryIndex(HistoryIndex));
+    TestTrue(TEXT("Undo restores time"), FMath::IsNearlyEqual(Service->GetCurrentTimeMy(), TimeMy));
+    TestTrue(TEXT("Undo restores positions"), Service->GetRenderVertices() == Positions);
+    TestTrue(TEXT("Undo restores plate assignments"), Service->GetVertexPlateAssignments() == PlateAssignments);
+    TestTrue(TEXT("Undo restores elevation"), Service->GetVertexElevationValues() == Elevation);
+    TestTrue(TEXT("Undo restores crust age"), Service->GetVertexCrustAge() == CrustAge);
+    TestEqual(TEXT("Undo restores ridge direction count"), Service->GetVertexRidgeDirections().Num(), RidgeDirections.Num());
+
+    TestTrue(TEXT("Undo bumps the position column version"), Columns.GetColumnVersion(0) != PositionVersion);
+
+    const TArray<float>* PositionX = nullptr;
+    const TArray<float>* PositionY = nullptr;
+    const TArray<float>* PositionZ = nullptr;
+    const TArray<float>* NormalX = nullptr;
+    const TArray<float>* NormalY = nullptr;
+    const TArray<float>* NormalZ = nullptr;
+    const TArray<float>* TangentX = nullptr;
+    const TArray<float>* TangentY = nullptr;
+    const TArray<float>* TangentZ = nullptr;
+    Service->GetRenderVertexFloatSoA(PositionX, PositionY, PositionZ, NormalX, NormalY, NormalZ, TangentX, TangentY, TangentZ);
+    TestTrue(TEXT("Float view rebuilt for restored positions"), PositionX && PositionX->Num() == Positions.Num());
+    if (PositionX && PositionX->Num() > 0 && Positions.Num() > 0)
+    {
+        TestEqual(TEXT("Float view matches restored positions"), (*PositionX)[0], static_cast<float>(Positions[0].X));
+    }
+
+    Service->SetParameters(OriginalParams);
+    Service->ResetSimulation();
+    return true;
+}
@@ -0,0 +1,121 @@
+// Incremental re-tessellation: a sliver pair on a plate boundary is flipped back by the boundary refinement, the
+// journal validates locally, and rolling the journal back restores exactly the triangles it rewrote.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRetessellationIncrementalTest,
+    "PlanetaryCreation.Milestone4.RetessellationIncremental",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRetessellationIncrementalTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.bEnableDynamicRetessellation = false;
+    Params.RetessellationMinTriangleAngleDegrees = 35.0; // icosphere triangles stay above, a flipped rhombus (30°) does not
+    Service->SetParameters(Params);
+
+    TArray<int32>& Triangles = const_cast<TArray<int32>&>(Service->GetRenderTriangles());
+    const TArray<int32>& Assignments = Service->GetVertexPlateAssignments();
+    const int32 TriangleCount = Triangles.Num() / 3;
+
+    // Pick the first boundary triangle (A, B, C) and its neighbor (B, A, D) across AB.
+    int32 T1 = INDEX_NONE;
+    int32 T2 = INDEX_NONE;
+    int32 A = INDEX_NONE, B = INDEX_NONE, C = INDEX_NONE, D = INDEX_NONE;
+    for (int32 TriIdx = 0; TriIdx < TriangleCount && T1 == INDEX_NONE; ++TriIdx)
+    {
+        const int32 P0 = Assignments[Triangles[TriIdx * 3]];
+        if (P0 == Assignments[Triangles[TriIdx * 3 + 1]] && P0 == Assignments[Triangles[TriIdx * 3 + 2]])
+        {
+            continue;
+        }
+
+        A = Triangles[TriIdx * 3];
+        B = Triangles[TriIdx * 3 + 1];
+        C = Triangles[TriIdx * 3 + 2];
+        for (int32 Other = 0; Other < TriangleCount && T2 == INDEX_NONE; ++Other)
+        {
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                if (Triangles[Other * 3 + Corner] == B && Triangles[Other * 3 + (Corner + 1) % 3] == A)
+                {
+                    T2 = Other;
+                    D = Triangles[Other * 3 + (Corner + 2) % 3];
+                    break;
+                }
+            }
+        }
+        T1 = TriIdx;
+    }
+    TestTrue(TEXT("Found a boundary triangle pair"), T1 != INDEX_NONE && T2 != INDEX_NONE);
+    if (T1 == INDEX_NONE || T2 == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Degrade the pair by flipping AB to the long diagonal CD.
+    Triangles[T1 * 3] = A; Triangles[T1 * 3 + 1] = D; Triangles[T1 * 3 + 2] = C;
+    Triangles[T2 * 3] = D; Triangles[T2 * 3 + 1] = B; Triangles[T2 * 3 + 2] = C;
+    Service->BuildRenderVertexTriangleIncidence();
+    const TArray<int32> DegradedTriangles = Triangles;
+
+    const int32 BadBefore = Service->ComputeRetessellationAnalysis().BadTriangleCount;
+    TestTrue(TEXT("Degraded pair is below the angle threshold"), BadBefore >= 2);
+
+    TArray<int32> AllPlateIDs;
+    for (const FTectonicPlate& Plate : Service->GetPlates())
+    {
+        AllPlateIDs.Add(Plate.PlateID);
+    }
+
+    UTectonicSimulationService::FRetessellationJournal Journal;
+    const int32 Flips = Service->RefineDriftedPlateBoundaries(AllPlateIDs, Journal);
+
+    TestTrue(TEXT("Refinement flipped the sliver pair"), Flips >= 1);
+    TestTrue(TEXT("Journal covers the rewritten pair"), Journal.JournaledTriangles.Contains(T1) && Journal.JournaledTriangles.Contains(T2));
+    TestTrue(TEXT("Only boundary triangles were touched"), Journal.TrianglesTouched > 0 && Journal.TrianglesTouched < TriangleCount);
+    TestEqual(TEXT("Triangle count preserved"), Triangles.Num() / 3, TriangleCount);
+    TestEqual(TEXT("No bad triangles remain"), Service->ComputeRetessellationAnalysis().BadTriangleCount, 0);
+    TestTrue(TEXT("Journal validates"), Service->ValidateRetessellationJournal(Journal));
+
+    // The CSR adjacency was patched for the flipped corners: A and B are neighbors again, C and D are not.
+    const TArray<int32>& Offsets = Service->GetRenderVertexAdjacencyOffsets();
+    const TArray<int32>& Adjacency = Service->GetRenderVertexAdjacency();
+    auto AreNeighbors = [&](int32 From, int32 To)
+    {
+        for (int32 Offset = Offsets[From]; Offset < Offsets[From + 1]; ++Offset)
+        {
+            if (Adjacency[Offset] == To)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    TestTrue(TEXT("Adjacency follows the flip"), AreNeighbors(A, B) && AreNeighbors(B, A) && !AreNeighbors(C, D));
+
+    Service->RollbackRetessellationJournal(Journal);
+    TestTrue(TEXT("Rollback restores the journaled triangles"), Triangles == DegradedTriangles);
+
+    return true;
+}
@@ -0,0 +1,121 @@
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRidgeDirectionParallelTest,
+    "PlanetaryCreation.StageB.RidgeDirectionParallel",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRidgeDirectionParallelTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor->GetEditorSubsystem<UTectonicSimulationService>();
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    Service->ResetSimulation();
+    Service->ProcessPendingOceanicGPUReadbacks(true);
+    Service->ProcessPendingContinentalGPUReadbacks(true);
+
+    // Each pass starts from a cleared ridge cache and zeroed stored tangents, so the comparison isolates scheduling
+    // rather than state carried over from the previous pass.
+    auto RunIsolatedPass = [Service]()
+    {
+        Service->InvalidateRidgeDirectionCache();
+        TArray<FVector3f>& Tangents = const_cast<TArray<FVector3f>&>(Service->GetVertexRidgeTangents());
+        for (FVector3f& Tangent : Tangents)
+        {
+            Tangent = FVector3f::ZeroVector;
+        }
+
+        Service->BuildRenderVertexBoundaryCache();
+        Service->MarkAllRidgeDirectionsDirty();
+
+        const double Start = FPlatformTime::Seconds();
+        Service->ForceRidgeRecomputeForTest();
+        return (FPlatformTime::Seconds() - Start) * 1000.0;
+    };
+
+    const double FirstMs = RunIsolatedPass();
+
+    const TArray<FVector3d> FirstDirections = Service->GetVertexRidgeDirections();
+    const TArray<FVector3f> FirstTangents = Service->GetVertexRidgeTangents();
+    const int32 FirstCacheHits = Service->GetLastRidgeCacheHitCount();
+    const int32 FirstSegmentHits = Service->GetLastRidgeSegmentIndexHitCount();
+
+    const double SecondMs = RunIsolatedPass();
+
+    const TArray<FVector3d>& SecondDirections = Service->GetVertexRidgeDirections();
+    TestEqual(TEXT("Ridge direction array size is stable"), SecondDirections.Num(), FirstDirections.Num());
+    TestEqual(TEXT("Cache hit count is deterministic"), Service->GetLastRidgeCacheHitCount(), FirstCacheHits);
+    TestEqual(TEXT("Segment index hit count is deterministic"), Service->GetLastRidgeSegmentIndexHitCount(), FirstSegmentHits);
+
+    int32 Mismatches = 0;
+    const int32 Count = FMath::Min(FirstDirections.Num(), SecondDirections.Num());
+    for (int32 VertexIdx = 0; VertexIdx < Count; ++VertexIdx)
+    {
+        if (!FirstDirections[VertexIdx].Equals(SecondDirections[VertexIdx], 0.0))
+        {
+            ++Mismatches;
+        }
+    }
+    TestEqual(TEXT("Parallel ridge pass is deterministic"), Mismatches, 0);
+    TestTrue(TEXT("Stored ridge tangents are deterministic"), Service->GetVertexRidgeTangents() == FirstTangents);
+
+    // Segment index results are re-projected into the tangent plane of the receiving vertex; plates without divergent
+    // seeds take the (tangent) age gradient. Young crust may take the unprojected plate-average fallback instead, so skip it.
+    const TArray<FVector3d>& RenderVertices = Service->GetRenderVertices();
+    const TArray<int32>& PlateAssignments = Service->GetVertexPlateAssignments();
+    const TArray<UTectonicSimulationService::FRenderVertexBoundaryInfo>& BoundaryCache = Service->GetRenderVertexBoundaryCache();
+    const TArray<FTectonicPlate>& Plates = Service->GetPlates();
+    const TArray<double>& CrustAge = Service->GetVertexCrustAge();
+
+    int32 IndexedVertices = 0;
+    int32 TangentVertices = 0;
+    for (int32 VertexIdx = 0; VertexIdx < Count; ++VertexIdx)
+    {
+        if (!PlateAssignments.IsValidIndex(VertexIdx) || !BoundaryCache.IsValidIndex(VertexIdx))
+        {
+            continue;
+        }
+
+        const int32 PlateId = PlateAssignments[VertexIdx];
+        if (!Plates.IsValidIndex(PlateId) || Plates[PlateId].CrustType != ECrustType::Oceanic)
+        {
+            continue;
+        }
+
+        const UTectonicSimulationService::FRenderVertexBoundaryInfo& Info = BoundaryCache[VertexIdx];
+        if (Info.bHasBoundary && Info.bIsDivergent && Info.SourcePlateID == PlateId)
+        {
+            continue;
+        }
+
+        if (!CrustAge.IsValidIndex(VertexIdx) || CrustAge[VertexIdx] <= 15.0)
+        {
+            continue;
+        }
+
+        ++IndexedVertices;
+        const FVector3d Normal = RenderVertices[VertexIdx].GetSafeNormal();
+        if (FMath::Abs(SecondDirections[VertexIdx] | Normal) < 1.0e-3)
+        {
+            ++TangentVertices;
+        }
+    }
+
+    // Pole vertices fall back to +Z when Cross(Normal, Up) degenerates, so allow a handful of exceptions.
+    TestTrue(TEXT("Oceanic ridge directions outside the propagated cache stay tangent"),
+        IndexedVertices == 0 || static_cast<double>(TangentVertices) / static_cast<double>(IndexedVertices) >= 0.99);
+
+    AddInfo(FString::Printf(TEXT("[RidgeDirectionParallelTest] Vertices=%d CacheHits=%d SegmentIndexHits=%d First=%.2f ms Second=%.2f ms"),
+        Count,
+        FirstCacheHits,
+        FirstSegmentHits,
+        FirstMs,
+        SecondMs));
+
+    return true;
+}
@@ -0,0 +1,94 @@
+// Stage B ridge factors from the bounded boundary cache must match an unbounded build inside the radius and hold exp(-R / 8 deg) past it.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRidgeFactorBoundedCacheTest,
+    "PlanetaryCreation.StageB.RidgeFactorBoundedCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRidgeFactorBoundedCacheTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor->GetEditorSubsystem<UTectonicSimulationService>();
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    Service->ResetSimulation();
+
+    FTectonicSimulationParameters& MutableParams = const_cast<FTectonicSimulationParameters&>(Service->GetParameters());
+    const double OriginalRadius = MutableParams.RidgeBoundaryInfluenceRadians;
+    ON_SCOPE_EXIT
+    {
+        MutableParams.RidgeBoundaryInfluenceRadians = OriginalRadius;
+        Service->BuildRenderVertexBoundaryCache();
+    };
+
+    const double CacheRadius = FMath::DegreesToRadians(25.0);
+    const double FactorAtRadius = FMath::Exp(-CacheRadius / FMath::DegreesToRadians(8.0));
+    const int32 VertexCount = Service->GetRenderVertices().Num();
+
+    // Reference: radius 0 disables the propagation bound.
+    MutableParams.RidgeBoundaryInfluenceRadians = 0.0;
+    Service->BuildRenderVertexBoundaryCache();
+    const TArray<UTectonicSimulationService::FRenderVertexBoundaryInfo> UnboundedCache = Service->GetRenderVertexBoundaryCache();
+    TArray<double> UnboundedFactors;
+    UnboundedFactors.SetNumUninitialized(VertexCount);
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        UnboundedFactors[VertexIdx] = Service->ComputeOceanicRidgeFactor(VertexIdx);
+    }
+
+    MutableParams.RidgeBoundaryInfluenceRadians = CacheRadius;
+    Service->BuildRenderVertexBoundaryCache();
+    const TArray<UTectonicSimulationService::FRenderVertexBoundaryInfo>& BoundedCache = Service->GetRenderVertexBoundaryCache();
+    TestEqual(TEXT("Both builds cover every render vertex"), BoundedCache.Num(), UnboundedCache.Num());
+    if (BoundedCache.Num() != VertexCount || UnboundedCache.Num() != VertexCount)
+    {
+        return false;
+    }
+
+    int32 InsideCount = 0;
+    int32 InsideMismatches = 0;
+    int32 BeyondCount = 0;
+    int32 BeyondMismatches = 0;
+    int32 NoBoundaryMismatches = 0;
+    double MaxBeyondDelta = 0.0;
+
+    for (int32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+    {
+        const UTectonicSimulationService::FRenderVertexBoundaryInfo& Reference = UnboundedCache[VertexIdx];
+        const double BoundedFactor = Service->ComputeOceanicRidgeFactor(VertexIdx);
+        const double ReferenceFactor = UnboundedFactors[VertexIdx];
+
+        if (!Reference.bHasBoundary || !Reference.bIsDivergent)
+        {
+            NoBoundaryMismatches += BoundedFactor != ReferenceFactor ? 1 : 0;
+        }
+        else if (static_cast<double>(Reference.DistanceRadians) <= CacheRadius)
+        {
+            ++InsideCount;
+            InsideMismatches += FMath::IsNearlyEqual(BoundedFactor, ReferenceFactor, 1.0e-6) ? 0 : 1;
+        }
+        else
+        {
+            ++BeyondCount;
+            BeyondMismatches += FMath::IsNearlyEqual(BoundedFactor, FactorAtRadius, 1.0e-9) ? 0 : 1;
+            MaxBeyondDelta = FMath::Max(MaxBeyondDelta, BoundedFactor - ReferenceFactor);
+        }
+    }
+
+    TestTrue(TEXT("Divergent vertices inside the radius exist"), InsideCount > 0);
+    TestEqual(TEXT("Inside the radius the bounded cache keeps the baseline exp falloff"), InsideMismatches, 0);
+    TestEqual(TEXT("Past the radius divergent-plate vertices hold exp(-R / 8 deg)"), BeyondMismatches, 0);
+    TestEqual(TEXT("Vertices without a divergent boundary keep their baseline factor"), NoBoundaryMismatches, 0);
+    TestTrue(TEXT("Past the radius the factor never exceeds the value at the radius"), MaxBeyondDelta <= FactorAtRadius + UE_DOUBLE_SMALL_NUMBER);
+
+    AddInfo(FString::Printf(TEXT("[RidgeFactorBoundedCacheTest] Inside=%d Beyond=%d FactorAtRadius=%.4f MaxBeyondDelta=%.4f"),
+        InsideCount, BeyondCount, FactorAtRadius, MaxBeyondDelta));
+    return true;
+}
@@ -123,5 +123,36 @@ bool FRiftingIntegrationTest::RunTest(const FString& Parameters)
     }
     TestTrue(TEXT("deterministic assignments"), same);
 
+    // Membership path: split in place, same assignments, and fragment lists/centroids that agree with the assignments
+    Rifting::FPlateVertexMembership Membership;
+    Membership.Build(Assign);
+    TArray<int32> AssignInPlace = Assign;
+    TArray<FVector3d> DriftDirs3, FragCentroids;
+    Rifting::FRiftingMetrics RM3{};
+    TestTrue(TEXT("membership rift performed"),
+        Rifting::PerformRifting(Evt, Points, Membership, AssignInPlace, DriftDirs3, FragCentroids, RM3));
+    TestTrue(TEXT("membership path matches"), AssignInPlace == AssignOut);
+
+    bool membershipOK = FragCentroids.Num() == Evt.FragmentCount;
+    int32 members = 0;
+    for (const TPair<int32, TArray<int32>>& Entry : Membership.VerticesByPlate)
+    {
+        for (int32 i = 0; i < Entry.Value.Num(); ++i)
+        {
+            membershipOK &= AssignInPlace[Entry.Value[i]] == Entry.Key && (i == 0 || Entry.Value[i - 1] < Entry.Value[i]);
+        }
+        members += Entry.Value.Num();
+    }
+    TestTrue(TEXT("membership follows assignments"), membershipOK && members == N);
+
+    bool centroidsOK = true;
+    for (int32 k = 0; k < FragCentroids.Num() && k < FragRatios.Num(); ++k)
+    {
+        FVector3d sum = FVector3d::ZeroVector;
+        for (int32 v = 0; v < N; ++v) if (AssignInPlace[v] == FragRatios[k].Key) { sum += Points[v]; }
+        centroidsOK &= FragCentroids[k].Equals(sum.GetSafeNormal(), 1e-9);
+    }
+    TestTrue(TEXT("fused fragment centroids"), centroidsOK);
+
     return true;
 }
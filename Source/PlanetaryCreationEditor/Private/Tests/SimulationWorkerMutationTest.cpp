@@ -0,0 +1,129 @@
+// Edits queued on the simulation worker must run in request order relative to steps and publish a frame whose UI state matches.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Simulation/TectonicSimulationWorker.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimulationWorkerMutationTest,
+    "PlanetaryCreation.Milestone5.SimulationWorkerMutation",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSimulationWorkerMutationTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    const bool bOriginalHighlightSeaLevel = Service->IsHighlightSeaLevelEnabled();
+    ON_SCOPE_EXIT
+    {
+        Service->SetHighlightSeaLevel(bOriginalHighlightSeaLevel);
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 13579;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.LloydIterations = 0;
+    Params.bEnableAutomaticLOD = false;
+    Params.bEnableOceanicAmplification = false;
+    Params.bEnableContinentalAmplification = false;
+    Params.bEnableSedimentTransport = false;
+
+    Service->SetHighlightSeaLevel(false);
+    Service->SetParameters(Params);
+    Service->ResetSimulation();
+
+    FTectonicSimulationFramePtr Frame;
+    int32 MutationsRun = 0;
+    {
+        FTectonicSimulationWorker Worker(*Service);
+        TestTrue(TEXT("Worker thread started"), Worker.Start());
+
+        // Undo queued behind three steps lands on step two; the highlight edit after it is seen by the capture.
+        Worker.RequestSteps(3, EElevationMode::Flat);
+        Worker.EnqueueMutation([&MutationsRun](UTectonicSimulationService& QueuedService)
+        {
+            ++MutationsRun;
+            return QueuedService.Undo();
+        }, EElevationMode::Flat);
+        Worker.EnqueueMutation([&MutationsRun](UTectonicSimulationService& QueuedService)
+        {
+            ++MutationsRun;
+            QueuedService.SetHighlightSeaLevel(true);
+            return true;
+        }, EElevationMode::Displaced);
+
+        TestTrue(TEXT("Queued steps and edits completed"), Worker.WaitUntilIdle());
+        TestFalse(TEXT("Worker idle after wait"), Worker.IsBusy());
+        TestTrue(TEXT("Latest frame available"), Worker.ConsumeLatestFrame(Frame));
+
+        // An edit that reports no change must not publish a frame.
+        const int32 FramesBefore = Worker.GetPublishedFrameCount();
+        Worker.EnqueueMutation([&MutationsRun](UTectonicSimulationService&)
+        {
+            ++MutationsRun;
+            return false;
+        }, EElevationMode::Displaced);
+        TestTrue(TEXT("No-op edit completed"), Worker.WaitUntilIdle());
+        TestEqual(TEXT("No-op edit publishes no frame"), Worker.GetPublishedFrameCount(), FramesBefore);
+    }
+
+    TestEqual(TEXT("Every queued edit ran once"), MutationsRun, 3);
+    if (!Frame.IsValid())
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Undo ran after the queued steps"), Service->GetCurrentTimeMy(), 4.0);
+    TestEqual(TEXT("History index after steps + undo"), Service->GetHistoryIndex(), 2);
+    TestTrue(TEXT("Sea level highlight applied by the worker"), Service->IsHighlightSeaLevelEnabled());
+
+    TestEqual(TEXT("Frame UI time matches service"), Frame->UIState.CurrentTimeMy, Service->GetCurrentTimeMy());
+    TestEqual(TEXT("Frame UI history index matches service"), Frame->UIState.HistoryIndex, Service->GetHistoryIndex());
+    TestEqual(TEXT("Frame UI history size matches service"), Frame->UIState.HistorySize, Service->GetHistorySize());
+    TestEqual(TEXT("Frame UI redo state matches service"), Frame->UIState.bCanRedo, Service->CanRedo());
+    TestTrue(TEXT("Frame UI carries the highlight edit"), Frame->UIState.bHighlightSeaLevel);
+    TestEqual(TEXT("Frame UI seed matches service"), Frame->UIState.Parameters.Seed, Service->GetParameters().Seed);
+    TestEqual(TEXT("Frame surface version includes the highlight bump"), Frame->SurfaceDataVersion, Service->GetSurfaceDataVersion());
+    TestTrue(TEXT("Snapshot carries the latest requested elevation mode"), Frame->Snapshot.ElevationMode == EElevationMode::Displaced);
+
+    // Edit -> steps -> edit: the steps must land between the two edits, not ahead of the first.
+    const double TimeAtEnqueue = Service->GetCurrentTimeMy();
+    double TimeSeenBeforeSteps = -1.0;
+    double TimeSeenAfterSteps = -1.0;
+    {
+        FTectonicSimulationWorker Worker(*Service);
+        TestTrue(TEXT("Second worker thread started"), Worker.Start());
+
+        Worker.EnqueueMutation([&TimeSeenBeforeSteps](UTectonicSimulationService& QueuedService)
+        {
+            TimeSeenBeforeSteps = QueuedService.GetCurrentTimeMy();
+            return false;
+        }, EElevationMode::Flat);
+        Worker.RequestSteps(2, EElevationMode::Flat);
+        Worker.EnqueueMutation([&TimeSeenAfterSteps](UTectonicSimulationService& QueuedService)
+        {
+            TimeSeenAfterSteps = QueuedService.GetCurrentTimeMy();
+            return false;
+        }, EElevationMode::Flat);
+        TestTrue(TEXT("Ordered edits and steps completed"), Worker.WaitUntilIdle());
+    }
+
+    TestEqual(TEXT("Edit queued before the steps sees the pre-step time"), TimeSeenBeforeSteps, TimeAtEnqueue);
+    TestEqual(TEXT("Edit queued after the steps sees both steps"), TimeSeenAfterSteps, TimeAtEnqueue + 4.0);
+
+    AddInfo(FString::Printf(TEXT("[SimulationWorkerMutationTest] Frame %d: %.1f My, history %d/%d"),
+        Frame->FrameSerial, Frame->UIState.CurrentTimeMy, Frame->UIState.HistoryIndex + 1, Frame->UIState.HistorySize));
+    return true;
+}
@@ -0,0 +1,94 @@
+// Simulation worker must publish frames that match the service and stay deterministic against game-thread stepping.
+
+#include "Misc/AutomationTest.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Simulation/TectonicSimulationWorker.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimulationWorkerTest,
+    "PlanetaryCreation.Milestone5.SimulationWorker",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSimulationWorkerTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 24680;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 4;
+    Params.LloydIterations = 0;
+    Params.bEnableAutomaticLOD = false;
+    Params.bEnableOceanicAmplification = false;
+    Params.bEnableContinentalAmplification = false;
+
+    constexpr int32 Steps = 4;
+
+    // Reference: game-thread stepping.
+    Service->SetParameters(Params);
+    Service->ResetSimulation();
+    Service->AdvanceSteps(Steps);
+    const TArray<double> ReferenceElevation = Service->GetVertexElevationValues();
+    const TArray<int32> ReferencePlates = Service->GetVertexPlateAssignments();
+    const double ReferenceTimeMy = Service->GetCurrentTimeMy();
+
+    // Worker: the same steps split across two requests.
+    Service->SetParameters(Params);
+    Service->ResetSimulation();
+
+    FTectonicSimulationFramePtr Frame;
+    {
+        FTectonicSimulationWorker Worker(*Service);
+        TestTrue(TEXT("Worker thread started"), Worker.Start());
+
+        Worker.RequestSteps(Steps / 2, EElevationMode::Displaced);
+        TestTrue(TEXT("First batch completed"), Worker.WaitUntilIdle());
+        Worker.RequestSteps(Steps - Steps / 2, EElevationMode::Displaced);
+        TestTrue(TEXT("Second batch completed"), Worker.WaitUntilIdle());
+
+        TestFalse(TEXT("Worker idle after wait"), Worker.IsBusy());
+        TestTrue(TEXT("Worker published at least one frame"), Worker.GetPublishedFrameCount() >= 1);
+        TestTrue(TEXT("Latest frame available"), Worker.ConsumeLatestFrame(Frame));
+
+        FTectonicSimulationFramePtr Stale;
+        TestFalse(TEXT("Frame is consumed only once"), Worker.ConsumeLatestFrame(Stale));
+    }
+
+    if (!Frame.IsValid())
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+        return false;
+    }
+
+    TestTrue(TEXT("Frame serial is assigned"), Frame->FrameSerial >= 1);
+    TestEqual(TEXT("Frame topology version matches service"), Frame->TopologyVersion, Service->GetTopologyVersion());
+    TestEqual(TEXT("Frame surface version matches service"), Frame->SurfaceDataVersion, Service->GetSurfaceDataVersion());
+    TestEqual(TEXT("Frame time matches service"), Frame->CurrentTimeMy, Service->GetCurrentTimeMy());
+    TestEqual(TEXT("Frame vertex count matches service"), Frame->RenderVertexCount, Service->GetRenderVertices().Num());
+    TestEqual(TEXT("Frame plate count matches service"), Frame->PlateCount, Service->GetPlates().Num());
+    TestTrue(TEXT("Snapshot carries requested elevation mode"), Frame->Snapshot.ElevationMode == EElevationMode::Displaced);
+    TestFalse(TEXT("Worker snapshots never read live service SoA"), Frame->Snapshot.bAllowServiceSoA);
+    TestTrue(TEXT("Snapshot elevations match published frame"), Frame->Snapshot.VertexElevationValues == Service->GetVertexElevationValues());
+
+    // Determinism: worker stepping must match game-thread stepping bit for bit.
+    TestEqual(TEXT("Worker time matches game-thread time"), Service->GetCurrentTimeMy(), ReferenceTimeMy);
+    TestTrue(TEXT("Worker plate assignments match game-thread run"), Service->GetVertexPlateAssignments() == ReferencePlates);
+    TestTrue(TEXT("Worker elevations match game-thread run"), Service->GetVertexElevationValues() == ReferenceElevation);
+
+    AddInfo(FString::Printf(TEXT("[SimulationWorkerTest] Frame %d: %d verts, %d plates, %.1f My, step %.2f ms"),
+        Frame->FrameSerial, Frame->RenderVertexCount, Frame->PlateCount, Frame->CurrentTimeMy, Frame->LastStepTimeMs));
+
+    Service->SetParameters(OriginalParams);
+    Service->ResetSimulation();
+    return true;
+}
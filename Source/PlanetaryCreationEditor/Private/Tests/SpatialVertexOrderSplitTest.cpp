@@ -0,0 +1,100 @@
+// Hilbert vertex ordering across a same-level mesh regeneration: a plate split must not renumber per-vertex state that is
+// already in curve order, so elevation and crust age stay attached to their positions.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "HAL/IConsoleManager.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpatialVertexOrderSplitTest,
+    "PlanetaryCreation.Milestone5.SpatialVertexOrderSplit",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSpatialVertexOrderSplitTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    IConsoleVariable* OrderCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.PlanetaryCreation.SpatialVertexOrder"));
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    TestNotNull(TEXT("r.PlanetaryCreation.SpatialVertexOrder must exist"), OrderCVar);
+    if (!Service || !OrderCVar)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    const int32 OriginalOrder = OrderCVar->GetInt();
+    ON_SCOPE_EXIT
+    {
+        OrderCVar->Set(OriginalOrder, ECVF_SetByCode);
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    OrderCVar->Set(1, ECVF_SetByCode);
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.LloydIterations = 0;
+    Params.bEnableDynamicRetessellation = false;
+    Service->SetParameters(Params);
+    Service->AdvanceSteps(3);
+
+    struct FVertexState
+    {
+        int32 PlateID = INDEX_NONE;
+        double Elevation = 0.0;
+        double CrustAge = 0.0;
+    };
+
+    const TArray<FVector3d>& Vertices = Service->GetRenderVertices();
+    const TArray<int32>& Assignments = Service->GetVertexPlateAssignments();
+    const TArray<double>& Elevations = Service->GetVertexElevationValues();
+    const TArray<double>& CrustAges = Service->GetVertexCrustAge();
+
+    TMap<FVector3d, FVertexState> StateByPosition;
+    for (int32 VertexIdx = 0; VertexIdx < Vertices.Num(); ++VertexIdx)
+    {
+        StateByPosition.Add(Vertices[VertexIdx], { Assignments[VertexIdx], Elevations[VertexIdx], CrustAges[VertexIdx] });
+    }
+
+    TArray<TPair<int32, int32>> BoundaryKeys;
+    Service->GetBoundaries().GetKeys(BoundaryKeys);
+    TestTrue(TEXT("Boundaries exist"), BoundaryKeys.Num() > 0);
+    if (BoundaryKeys.Num() == 0)
+    {
+        return false;
+    }
+
+    const int32 VertexCount = Vertices.Num();
+    TestTrue(TEXT("Split succeeded"), Service->ForceSplitPlateForTest(BoundaryKeys[0]));
+    TestEqual(TEXT("Same-level regeneration keeps the vertex count"), Service->GetRenderVertices().Num(), VertexCount);
+
+    // Vertices that stayed on their plate keep their state; reassigned ones, and any the Voronoi remap snapped back to a
+    // crust baseline, may legitimately change.
+    int32 Compared = 0;
+    int32 Mismatched = 0;
+    for (int32 VertexIdx = 0; VertexIdx < Vertices.Num(); ++VertexIdx)
+    {
+        const FVertexState* Before = StateByPosition.Find(Vertices[VertexIdx]);
+        if (!Before || Before->PlateID != Assignments[VertexIdx] ||
+            Elevations[VertexIdx] == PaperElevationConstants::AbyssalPlainDepth_m ||
+            Elevations[VertexIdx] == PaperElevationConstants::ContinentalBaseline_m)
+        {
+            continue;
+        }
+
+        ++Compared;
+        if (Elevations[VertexIdx] != Before->Elevation || CrustAges[VertexIdx] != Before->CrustAge)
+        {
+            ++Mismatched;
+        }
+    }
+
+    TestTrue(TEXT("Most vertices kept their plate"), Compared > VertexCount / 2);
+    TestEqual(TEXT("Elevation and crust age still match their positions"), Mismatched, 0);
+
+    return true;
+}
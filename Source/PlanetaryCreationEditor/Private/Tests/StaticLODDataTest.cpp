@@ -0,0 +1,101 @@
+// Static LOD data: entries patched from a previous vertex set (compaction, appends, reordering) must match a full
+// rebuild exactly while only evaluating new vertices, and the disk cache must round-trip.
+
+#include "Misc/AutomationTest.h"
+#include "Algo/Reverse.h"
+#include "HAL/FileManager.h"
+#include "Simulation/StaticLODData.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStaticLODDataTest,
+    "PlanetaryCreation.Milestone4.StaticLODData",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStaticLODDataTest::RunTest(const FString& Parameters)
+{
+    FRandomStream Random(20251018);
+    auto RandomUnitVector = [&Random]()
+    {
+        return FVector3d(Random.VRand()).GetSafeNormal();
+    };
+
+    auto BuildData = [](const TArray<FVector3d>& Vertices, const FStaticLODVertexData* Base, FStaticLODVertexData& OutData)
+    {
+        TArray<uint64> Hashes;
+        uint64 SetHash = 0;
+        FStaticLODVertexData::HashVertexSet(Vertices, Hashes, SetHash);
+        return OutData.Build(Vertices, MoveTemp(Hashes), SetHash, Base, nullptr, nullptr, nullptr);
+    };
+
+    auto StreamsEqual = [](const FStaticLODVertexData& A, const FStaticLODVertexData& B)
+    {
+        return A.UnitNormals == B.UnitNormals && A.UVs == B.UVs && A.TangentX == B.TangentX && A.VertexHashes == B.VertexHashes;
+    };
+
+    constexpr int32 VertexCount = 20000;
+    TArray<FVector3d> Vertices;
+    for (int32 Index = 0; Index < VertexCount; ++Index)
+    {
+        Vertices.Add(RandomUnitVector());
+    }
+
+    FStaticLODVertexData Original;
+    TestEqual(TEXT("Fresh build reuses nothing"), BuildData(Vertices, nullptr, Original), 0);
+    TestEqual(TEXT("Fresh build covers every vertex"), Original.Num(), VertexCount);
+
+    // Terrane surgery shape: order-preserving compaction plus appended vertices at the tail.
+    TArray<FVector3d> Compacted;
+    int32 Removed = 0;
+    for (int32 Index = 0; Index < VertexCount; ++Index)
+    {
+        if (Index % 7 == 3)
+        {
+            ++Removed;
+            continue;
+        }
+        Compacted.Add(Vertices[Index]);
+    }
+    constexpr int32 Appended = 250;
+    for (int32 Index = 0; Index < Appended; ++Index)
+    {
+        Compacted.Add(RandomUnitVector());
+    }
+
+    FStaticLODVertexData Patched;
+    const int32 PatchedReuse = BuildData(Compacted, &Original, Patched);
+    TestEqual(TEXT("Compaction reuses every surviving vertex"), PatchedReuse, VertexCount - Removed);
+    TestNotEqual(TEXT("Compacted set has a new identity"), Patched.VertexSetHash, Original.VertexSetHash);
+
+    FStaticLODVertexData PatchedReference;
+    BuildData(Compacted, nullptr, PatchedReference);
+    TestTrue(TEXT("Patched streams match a full rebuild"), StreamsEqual(Patched, PatchedReference));
+    TestEqual(TEXT("Vertex set hash independent of base"), Patched.VertexSetHash, PatchedReference.VertexSetHash);
+
+    // Reordered set (e.g. locality renumbering) falls back to the hash lookup.
+    TArray<FVector3d> Reversed = Compacted;
+    Algo::Reverse(Reversed);
+    FStaticLODVertexData Reordered;
+    TestEqual(TEXT("Reordered set reuses every vertex"), BuildData(Reversed, &Patched, Reordered), Compacted.Num());
+    FStaticLODVertexData ReorderedReference;
+    BuildData(Reversed, nullptr, ReorderedReference);
+    TestTrue(TEXT("Reordered streams match a full rebuild"), StreamsEqual(Reordered, ReorderedReference));
+
+    // Disk round trip (out-of-range level so real cache files are untouched).
+    constexpr int32 TestLODLevel = 99;
+    const FString CachePath = FStaticLODVertexData::GetDiskCachePath(TestLODLevel, Original.VertexSetHash);
+    TestTrue(TEXT("Disk cache saves"), Original.SaveToDisk(TestLODLevel));
+
+    FStaticLODVertexData Loaded;
+    TestTrue(TEXT("Disk cache loads"), Loaded.LoadFromDisk(TestLODLevel, Original.VertexSetHash, VertexCount));
+    TestTrue(TEXT("Loaded normals match"), Loaded.UnitNormals == Original.UnitNormals);
+    TestTrue(TEXT("Loaded UVs match"), Loaded.UVs == Original.UVs);
+    TestTrue(TEXT("Loaded tangents match"), Loaded.TangentX == Original.TangentX);
+
+    FStaticLODVertexData WrongCount;
+    TestFalse(TEXT("Disk cache rejects a vertex count mismatch"), WrongCount.LoadFromDisk(TestLODLevel, Original.VertexSetHash, VertexCount + 1));
+    IFileManager::Get().Delete(*CachePath);
+
+    TestEqual(TEXT("Icosphere L0 vertex count"), FStaticLODVertexData::GetIcosphereVertexCount(0), 12);
+    TestEqual(TEXT("Icosphere L7 vertex count"), FStaticLODVertexData::GetIcosphereVertexCount(7), 163842);
+
+    return true;
+}
@@ -0,0 +1,180 @@
+// Batched terrane reattachment: two terranes spliced back in one ReattachTerranes call advance TopologyVersion once
+// and leave a valid mesh, with the first terrane's cap indices following the second extraction's compaction.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+#include "Containers/Queue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTerraneBatchReattachmentTest,
+    "PlanetaryCreation.Milestone6.Terrane.BatchReattachment",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTerraneBatchReattachmentTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params = OriginalParams;
+    Params.Seed = 42;
+    Params.RenderSubdivisionLevel = 4;
+    Params.bEnableDynamicRetessellation = false;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+    Service->BuildRenderVertexAdjacency();
+
+    // Largest continental plate, so two separated terranes fit on it.
+    const TArray<int32>& InitialAssignments = Service->GetVertexPlateAssignments();
+    int32 ContinentalPlateID = INDEX_NONE;
+    int32 BestPlateVertexCount = 0;
+    for (const FTectonicPlate& Plate : Service->GetPlates())
+    {
+        if (Plate.CrustType != ECrustType::Continental)
+        {
+            continue;
+        }
+
+        int32 PlateVertexCount = 0;
+        for (const int32 PlateID : InitialAssignments)
+        {
+            PlateVertexCount += PlateID == Plate.PlateID ? 1 : 0;
+        }
+        if (PlateVertexCount > BestPlateVertexCount)
+        {
+            BestPlateVertexCount = PlateVertexCount;
+            ContinentalPlateID = Plate.PlateID;
+        }
+    }
+    TestTrue(TEXT("Found continental plate"), ContinentalPlateID != INDEX_NONE);
+    if (ContinentalPlateID == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Grow a 16-vertex patch from the best-surrounded plate vertex at least ~60 degrees from Avoid (if any).
+    auto GrowTerrane = [Service, ContinentalPlateID](const FVector3d& Avoid, FVector3d& OutSeedPosition)
+    {
+        const TArray<FVector3d>& Vertices = Service->GetRenderVertices();
+        const TArray<int32>& Assignments = Service->GetVertexPlateAssignments();
+        const TArray<int32>& Offsets = Service->GetRenderVertexAdjacencyOffsets();
+        const TArray<int32>& Adjacency = Service->GetRenderVertexAdjacency();
+
+        int32 SeedIndex = INDEX_NONE;
+        int32 BestInterior = -1;
+        for (int32 VertexIdx = 0; VertexIdx < Assignments.Num(); ++VertexIdx)
+        {
+            if (Assignments[VertexIdx] != ContinentalPlateID ||
+                (!Avoid.IsZero() && (Vertices[VertexIdx].GetSafeNormal() | Avoid) > 0.5))
+            {
+                continue;
+            }
+
+            int32 Interior = 0;
+            for (int32 Offset = Offsets[VertexIdx]; Offset < Offsets[VertexIdx + 1]; ++Offset)
+            {
+                Interior += Assignments[Adjacency[Offset]] == ContinentalPlateID ? 1 : 0;
+            }
+            if (Interior > BestInterior)
+            {
+                BestInterior = Interior;
+                SeedIndex = VertexIdx;
+            }
+        }
+
+        TArray<int32> TerraneVertices;
+        if (SeedIndex == INDEX_NONE)
+        {
+            return TerraneVertices;
+        }
+
+        OutSeedPosition = Vertices[SeedIndex].GetSafeNormal();
+        TSet<int32> Visited;
+        TQueue<int32> Frontier;
+        Frontier.Enqueue(SeedIndex);
+        Visited.Add(SeedIndex);
+        while (!Frontier.IsEmpty() && TerraneVertices.Num() < 16)
+        {
+            int32 Current = INDEX_NONE;
+            Frontier.Dequeue(Current);
+            TerraneVertices.Add(Current);
+            for (int32 Offset = Offsets[Current]; Offset < Offsets[Current + 1]; ++Offset)
+            {
+                const int32 Neighbor = Adjacency[Offset];
+                if (!Visited.Contains(Neighbor) && Assignments[Neighbor] == ContinentalPlateID)
+                {
+                    Visited.Add(Neighbor);
+                    Frontier.Enqueue(Neighbor);
+                }
+            }
+        }
+        return TerraneVertices;
+    };
+
+    const int32 VertexCountBefore = Service->GetRenderVertices().Num();
+
+    FVector3d FirstSeed = FVector3d::ZeroVector;
+    int32 FirstTerraneID = INDEX_NONE;
+    TestTrue(TEXT("First terrane extracted"),
+        Service->ExtractTerrane(ContinentalPlateID, GrowTerrane(FVector3d::ZeroVector, FirstSeed), FirstTerraneID));
+
+    FVector3d SecondSeed = FVector3d::ZeroVector;
+    const TArray<int32> SecondVertices = GrowTerrane(FirstSeed, SecondSeed);
+    if (SecondVertices.Num() < 16)
+    {
+        AddInfo(TEXT("Continental plate too small for a second separated terrane; skipping batch checks"));
+        return true;
+    }
+
+    int32 SecondTerraneID = INDEX_NONE;
+    TestTrue(TEXT("Second terrane extracted"), Service->ExtractTerrane(ContinentalPlateID, SecondVertices, SecondTerraneID));
+    TestEqual(TEXT("Two terranes in flight"), Service->GetTerranes().Num(), 2);
+    if (Service->GetTerranes().Num() != 2)
+    {
+        return false;
+    }
+
+    // The first terrane's cap must still address live vertices after the second extraction compacted the mesh.
+    const int32 VertexCountDetached = Service->GetRenderVertices().Num();
+    bool bCapIndicesValid = true;
+    for (const FContinentalTerrane& Terrane : Service->GetTerranes())
+    {
+        for (const int32 Index : Terrane.PatchTriangles)
+        {
+            bCapIndicesValid &= Index >= 0 && Index < VertexCountDetached;
+        }
+    }
+    TestTrue(TEXT("Cap indices of in-flight terranes follow compaction"), bCapIndicesValid);
+
+    const int32 TopologyVersionBefore = Service->GetTopologyVersion();
+
+    TArray<TPair<int32, int32>> TerraneTargets;
+    TerraneTargets.Emplace(FirstTerraneID, ContinentalPlateID);
+    TerraneTargets.Emplace(SecondTerraneID, ContinentalPlateID);
+    TestEqual(TEXT("Both terranes reattached in one batch"), Service->ReattachTerranes(TerraneTargets), 2);
+
+    TestEqual(TEXT("Batch advances TopologyVersion once"), Service->GetTopologyVersion(), TopologyVersionBefore + 1);
+    TestEqual(TEXT("No terranes left in flight"), Service->GetTerranes().Num(), 0);
+    TestEqual(TEXT("Vertex count restored"), Service->GetRenderVertices().Num(), VertexCountBefore);
+
+    FString ValidationError;
+    TestTrue(TEXT("Topology valid after batched reattachment"), Service->ValidateTopology(ValidationError));
+    if (!ValidationError.IsEmpty())
+    {
+        AddInfo(ValidationError);
+    }
+
+    return true;
+}
@@ -0,0 +1,183 @@
+// Terrane transport moves only the bounding cap (payload positions are materialized lazily), and collision detection
+// through the convergent segment index picks the same target plate as a brute-force scan of every boundary.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTerraneCollisionIndexTest,
+    "PlanetaryCreation.Milestone6.Terrane.CollisionIndex",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTerraneCollisionIndexTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params = OriginalParams;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.LloydIterations = 2;
+    Params.bEnableDynamicRetessellation = false;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+    Service->BuildRenderVertexAdjacency();
+
+    int32 ContinentalPlateID = INDEX_NONE;
+    for (const FTectonicPlate& Plate : Service->GetPlates())
+    {
+        if (Plate.CrustType == ECrustType::Continental)
+        {
+            ContinentalPlateID = Plate.PlateID;
+            break;
+        }
+    }
+    TestTrue(TEXT("Found continental plate"), ContinentalPlateID != INDEX_NONE);
+    if (ContinentalPlateID == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // A vertex of the plate plus its same-plate one-ring.
+    const TArray<int32>& Assignments = Service->GetVertexPlateAssignments();
+    const TArray<int32>& Offsets = Service->GetRenderVertexAdjacencyOffsets();
+    const TArray<int32>& Adjacency = Service->GetRenderVertexAdjacency();
+    TArray<int32> TerraneVertices;
+    for (int32 VertexIdx = 0; VertexIdx < Assignments.Num() && TerraneVertices.Num() == 0; ++VertexIdx)
+    {
+        if (Assignments[VertexIdx] != ContinentalPlateID)
+        {
+            continue;
+        }
+
+        bool bInterior = true;
+        for (int32 Offset = Offsets[VertexIdx]; Offset < Offsets[VertexIdx + 1]; ++Offset)
+        {
+            bInterior &= Assignments[Adjacency[Offset]] == ContinentalPlateID;
+        }
+        if (bInterior)
+        {
+            TerraneVertices.Add(VertexIdx);
+            for (int32 Offset = Offsets[VertexIdx]; Offset < Offsets[VertexIdx + 1]; ++Offset)
+            {
+                TerraneVertices.Add(Adjacency[Offset]);
+            }
+        }
+    }
+
+    int32 TerraneID = INDEX_NONE;
+    TestTrue(TEXT("Terrane extracted"), Service->ExtractTerrane(ContinentalPlateID, TerraneVertices, TerraneID));
+    TArray<FContinentalTerrane>& Terranes = const_cast<TArray<FContinentalTerrane>&>(Service->GetTerranes());
+    if (Terranes.Num() != 1 || Terranes[0].State != ETerraneState::Transporting)
+    {
+        AddError(TEXT("Expected one transporting terrane"));
+        return false;
+    }
+
+    // Transport: the cap moves, the payload waits.
+    const TArray<FTerraneVertexRecord> PayloadBefore = Terranes[0].VertexPayload;
+    const FVector3d CentroidBefore = Terranes[0].Centroid;
+    TestTrue(TEXT("Bounding cap covers the payload"), Terranes[0].BoundingRadiusRad > 0.0);
+
+    Service->UpdateTerranePositions(2.0);
+    Service->UpdateTerranePositions(2.0);
+
+    FContinentalTerrane& Terrane = Terranes[0];
+    bool bPayloadUntouched = true;
+    for (int32 Index = 0; Index < PayloadBefore.Num(); ++Index)
+    {
+        bPayloadUntouched &= Terrane.VertexPayload[Index].Position == PayloadBefore[Index].Position;
+    }
+    TestTrue(TEXT("Transport leaves payload positions untouched"), bPayloadUntouched);
+    TestTrue(TEXT("Centroid moved with the carrier"), (Terrane.Centroid | CentroidBefore) < 1.0 - 1e-12);
+
+    FContinentalTerrane Materialized = Terrane;
+    Service->MaterializeTerranePayload(Materialized);
+    FVector3d MaterializedCentroid = FVector3d::ZeroVector;
+    bool bInsideCap = true;
+    for (const FTerraneVertexRecord& Record : Materialized.VertexPayload)
+    {
+        MaterializedCentroid += Record.Position;
+        bInsideCap &= FMath::Acos(FMath::Clamp(Record.Position | Terrane.Centroid, -1.0, 1.0)) <= Terrane.BoundingRadiusRad + 1e-9;
+    }
+    TestTrue(TEXT("Materialized payload centroid matches the transported cap"),
+        (MaterializedCentroid.GetSafeNormal() - Terrane.Centroid).Length() < 1e-9);
+    TestTrue(TEXT("Materialized payload stays inside the bounding cap"), bInsideCap);
+    TestTrue(TEXT("Materialization consumes the pending rotation"), Materialized.PendingPayloadRotation.Equals(FQuat4d::Identity, 0.0));
+
+    // Collision: drop the terrane on every coarse boundary point and compare against the brute-force scan.
+    const double ThresholdRad = 500.0 / (Service->GetParameters().PlanetRadius / 1000.0);
+    const TArray<FVector3d>& SharedVertices = Service->GetSharedVertices();
+
+    auto FindReferenceTarget = [&](const FVector3d& Centroid)
+    {
+        for (const FTectonicPlate& Plate : Service->GetPlates())
+        {
+            if (Plate.CrustType != ECrustType::Continental || Plate.PlateID == Terrane.SourcePlateID)
+            {
+                continue;
+            }
+
+            const TPair<int32, int32> Key = Terrane.CarrierPlateID < Plate.PlateID
+                ? MakeTuple(Terrane.CarrierPlateID, Plate.PlateID)
+                : MakeTuple(Plate.PlateID, Terrane.CarrierPlateID);
+            const FPlateBoundary* Boundary = Service->GetBoundaries().Find(Key);
+            if (!Boundary || Boundary->BoundaryType != EBoundaryType::Convergent)
+            {
+                continue;
+            }
+
+            for (const int32 SharedIdx : Boundary->SharedEdgeVertices)
+            {
+                if (SharedVertices.IsValidIndex(SharedIdx) &&
+                    FMath::Acos(FMath::Clamp(Centroid | SharedVertices[SharedIdx].GetSafeNormal(), -1.0, 1.0)) < ThresholdRad)
+                {
+                    return Plate.PlateID;
+                }
+            }
+        }
+        return static_cast<int32>(INDEX_NONE);
+    };
+
+    const int32 CarrierPlateID = Terrane.CarrierPlateID;
+    int32 Mismatches = 0;
+    int32 Collisions = 0;
+    for (const FVector3d& Probe : SharedVertices)
+    {
+        Terrane.State = ETerraneState::Transporting;
+        Terrane.TargetPlateID = INDEX_NONE;
+        Terrane.CarrierPlateID = CarrierPlateID;
+        Terrane.Centroid = Probe.GetSafeNormal();
+
+        Service->DetectTerraneCollisions();
+
+        const int32 Expected = FindReferenceTarget(Terrane.Centroid);
+        const int32 Actual = Terrane.State == ETerraneState::Colliding ? Terrane.TargetPlateID : INDEX_NONE;
+        Mismatches += Expected != Actual ? 1 : 0;
+        Collisions += Actual != INDEX_NONE ? 1 : 0;
+    }
+    TestEqual(TEXT("Indexed collision detection matches brute force"), Mismatches, 0);
+
+    // Park the terrane so the scope exit reset does not see a half-edited state.
+    Terrane.State = ETerraneState::Transporting;
+    Terrane.TargetPlateID = INDEX_NONE;
+
+    const FTerraneCollisionIndex& Index = Service->GetTerraneCollisionIndex();
+    AddInfo(FString::Printf(TEXT("[TerraneCollisionIndex] %d convergent segments, %d/%d probes collided, last pass %d cap hits of %d visited"),
+        Index.Segments.Num(), Collisions, SharedVertices.Num(), Index.LastCapHits, Index.LastSegmentsVisited));
+
+    return true;
+}
@@ -0,0 +1,141 @@
+// Localized terrane surgery: the CSR adjacency patched by ExtractTerrane must match a full rebuild exactly, and the
+// recomputed one-rings must stay confined to the terrane rim.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+#include "Containers/Queue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTerraneLocalSurgeryTest,
+    "PlanetaryCreation.Milestone6.Terrane.LocalSurgery",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTerraneLocalSurgeryTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params = OriginalParams;
+    Params.Seed = 42;
+    Params.RenderSubdivisionLevel = 4;
+    Params.bEnableDynamicRetessellation = false;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+    Service->BuildRenderVertexAdjacency();
+
+    int32 ContinentalPlateID = INDEX_NONE;
+    for (const FTectonicPlate& Plate : Service->GetPlates())
+    {
+        if (Plate.CrustType == ECrustType::Continental)
+        {
+            ContinentalPlateID = Plate.PlateID;
+            break;
+        }
+    }
+    TestTrue(TEXT("Found continental plate"), ContinentalPlateID != INDEX_NONE);
+    if (ContinentalPlateID == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Grow a connected patch from the plate vertex with the most same-plate neighbors.
+    const TArray<int32>& Assignments = Service->GetVertexPlateAssignments();
+    const TArray<int32>& Offsets = Service->GetRenderVertexAdjacencyOffsets();
+    const TArray<int32>& Adjacency = Service->GetRenderVertexAdjacency();
+
+    int32 SeedIndex = INDEX_NONE;
+    int32 BestInterior = -1;
+    for (int32 VertexIdx = 0; VertexIdx < Assignments.Num(); ++VertexIdx)
+    {
+        if (Assignments[VertexIdx] != ContinentalPlateID)
+        {
+            continue;
+        }
+
+        int32 Interior = 0;
+        for (int32 Offset = Offsets[VertexIdx]; Offset < Offsets[VertexIdx + 1]; ++Offset)
+        {
+            Interior += Assignments[Adjacency[Offset]] == ContinentalPlateID ? 1 : 0;
+        }
+        if (Interior > BestInterior)
+        {
+            BestInterior = Interior;
+            SeedIndex = VertexIdx;
+        }
+    }
+
+    TArray<int32> TerraneVertices;
+    TSet<int32> Visited;
+    TQueue<int32> Frontier;
+    Frontier.Enqueue(SeedIndex);
+    Visited.Add(SeedIndex);
+    while (!Frontier.IsEmpty() && TerraneVertices.Num() < 32)
+    {
+        int32 Current = INDEX_NONE;
+        Frontier.Dequeue(Current);
+        TerraneVertices.Add(Current);
+        for (int32 Offset = Offsets[Current]; Offset < Offsets[Current + 1]; ++Offset)
+        {
+            const int32 Neighbor = Adjacency[Offset];
+            if (!Visited.Contains(Neighbor) && Assignments[Neighbor] == ContinentalPlateID)
+            {
+                Visited.Add(Neighbor);
+                Frontier.Enqueue(Neighbor);
+            }
+        }
+    }
+
+    const int32 VertexCountBefore = Service->GetRenderVertices().Num();
+    int32 TerraneID = INDEX_NONE;
+    const bool bExtracted = Service->ExtractTerrane(ContinentalPlateID, TerraneVertices, TerraneID);
+    TestTrue(TEXT("Terrane extraction succeeded"), bExtracted);
+    if (!bExtracted)
+    {
+        return false;
+    }
+
+    const UTectonicSimulationService::FTerraneSurgeryStats& Stats = Service->GetLastTerraneSurgeryStats();
+    const int32 VertexCountAfter = Service->GetRenderVertices().Num();
+    TestTrue(TEXT("Adjacency patched in place"), Stats.bPatchedAdjacency);
+    TestEqual(TEXT("Vertex count follows removed/added vertices"),
+        VertexCountAfter, VertexCountBefore - Stats.RemovedVertexCount + Stats.AddedVertexCount);
+    TestTrue(TEXT("Recomputed one-rings stay local to the terrane"), Stats.PatchedAdjacencyVertexCount < VertexCountAfter / 8);
+
+    FString ValidationError;
+    TestTrue(TEXT("Topology valid after localized surgery"), Service->ValidateTopology(ValidationError));
+
+    const TArray<int32> PatchedOffsets = Service->GetRenderVertexAdjacencyOffsets();
+    const TArray<int32> PatchedAdjacency = Service->GetRenderVertexAdjacency();
+    const TArray<float> PatchedWeights = Service->GetRenderVertexAdjacencyWeights();
+    const TArray<int32> PatchedReverse = Service->GetRenderVertexReverseAdjacency();
+    const TArray<uint8> PatchedFlags = Service->GetConvergentNeighborFlags();
+
+    Service->BuildRenderVertexAdjacency();
+
+    TestTrue(TEXT("Patched offsets match a full rebuild"), PatchedOffsets == Service->GetRenderVertexAdjacencyOffsets());
+    TestTrue(TEXT("Patched neighbor lists match a full rebuild"), PatchedAdjacency == Service->GetRenderVertexAdjacency());
+    TestTrue(TEXT("Patched weights match a full rebuild"), PatchedWeights == Service->GetRenderVertexAdjacencyWeights());
+    TestTrue(TEXT("Patched reverse adjacency matches a full rebuild"), PatchedReverse == Service->GetRenderVertexReverseAdjacency());
+    TestTrue(TEXT("Patched convergent flags match a full rebuild"), PatchedFlags == Service->GetConvergentNeighborFlags());
+
+    TestTrue(TEXT("Terrane reattaches after localized extraction"), Service->ReattachTerrane(TerraneID, ContinentalPlateID));
+
+    AddInfo(FString::Printf(TEXT("[TerraneLocalSurgery] %d verts removed, %d added, %d rim triangles, %d one-rings recomputed of %d (%.2f ms)"),
+        Stats.RemovedVertexCount, Stats.AddedVertexCount, Stats.RimTriangleCount, Stats.PatchedAdjacencyVertexCount,
+        VertexCountAfter, Stats.SurgeryMs));
+
+    return true;
+}
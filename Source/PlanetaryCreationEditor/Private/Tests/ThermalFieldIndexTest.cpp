@@ -0,0 +1,123 @@
+// Spatially indexed thermal field: the bucketed pass matches a brute-force evaluation of every hotspot and subduction
+// source, and moving a hotspot only revisits the grid cells its old and new caps reach.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+namespace
+{
+    /** Reference field: every vertex against every source with the analytic falloffs. */
+    TArray<double> ComputeBruteForceThermalField(const UTectonicSimulationService& Service)
+    {
+        const TArray<FVector3d>& Vertices = Service.GetRenderVertices();
+        const TArray<FTectonicPlate>& Plates = Service.GetPlates();
+
+        TArray<double> Result;
+        Result.SetNum(Vertices.Num());
+        for (int32 VertexIdx = 0; VertexIdx < Vertices.Num(); ++VertexIdx)
+        {
+            const FVector3d& VertexPos = Vertices[VertexIdx];
+            double Temperature = 1600.0;
+            for (const FMantleHotspot& Hotspot : Service.GetHotspots())
+            {
+                const double Distance = FMath::Acos(FMath::Clamp(VertexPos.Dot(Hotspot.Position), -1.0, 1.0));
+                if (Distance <= Hotspot.InfluenceRadius)
+                {
+                    const double Sigma = Hotspot.InfluenceRadius / 2.0;
+                    Temperature += 400.0 * Hotspot.ThermalOutput * FMath::Exp(-FMath::Square(Distance) / FMath::Square(Sigma));
+                }
+            }
+
+            double SubductionHeat = 0.0;
+            for (const auto& BoundaryPair : Service.GetBoundaries())
+            {
+                const FPlateBoundary& Boundary = BoundaryPair.Value;
+                if (Boundary.BoundaryType != EBoundaryType::Convergent || Boundary.AccumulatedStress < 50.0 ||
+                    !Plates.IsValidIndex(BoundaryPair.Key.Key) || !Plates.IsValidIndex(BoundaryPair.Key.Value))
+                {
+                    continue;
+                }
+
+                const FVector3d BoundaryPos = ((Plates[BoundaryPair.Key.Key].Centroid + Plates[BoundaryPair.Key.Value].Centroid) * 0.5).GetSafeNormal();
+                const double Distance = FMath::Acos(FMath::Clamp(VertexPos.Dot(BoundaryPos), -1.0, 1.0));
+                if (Distance < 0.1)
+                {
+                    SubductionHeat += Boundary.AccumulatedStress * 2.0 * (1.0 - Distance / 0.1);
+                }
+            }
+
+            Result[VertexIdx] = FMath::Clamp(Temperature + SubductionHeat, 0.0, 3000.0);
+        }
+        return Result;
+    }
+
+    double MaxDifference(const TArray<double>& A, const TArray<double>& B)
+    {
+        double MaxDiff = A.Num() == B.Num() ? 0.0 : TNumericLimits<double>::Max();
+        for (int32 Index = 0; Index < FMath::Min(A.Num(), B.Num()); ++Index)
+        {
+            MaxDiff = FMath::Max(MaxDiff, FMath::Abs(A[Index] - B[Index]));
+        }
+        return MaxDiff;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FThermalFieldIndexTest,
+    "PlanetaryCreation.Milestone4.ThermalFieldIndex",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FThermalFieldIndexTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 4;
+    Params.LloydIterations = 0;
+    Params.bEnableHotspots = true;
+    Service->SetParameters(Params);
+    Service->AdvanceSteps(5);
+
+    const TArray<double>& Temperatures = Service->GetVertexTemperatureValues();
+    const int32 VertexCount = Service->GetRenderVertices().Num();
+    TestTrue(TEXT("Hotspots present"), Service->GetHotspots().Num() > 0);
+    TestTrue(TEXT("Indexed field matches brute force"), MaxDifference(Temperatures, ComputeBruteForceThermalField(*Service)) < 1.0e-6);
+
+    // Nothing moved: no vertex is rewritten.
+    Service->ComputeThermalField();
+    TestTrue(TEXT("Unchanged sources skip the pass"), Service->GetThermalFieldIndex().bLastUpdateIncremental);
+    TestEqual(TEXT("Unchanged sources write no vertices"), Service->GetThermalFieldIndex().LastVerticesUpdated, 0);
+
+    // Drift one hotspot: only the cells around its old and new positions are revisited.
+    TArray<FMantleHotspot>& Hotspots = const_cast<TArray<FMantleHotspot>&>(Service->GetHotspots());
+    FMantleHotspot& Moved = Hotspots[0];
+    FVector3d Tangent = FVector3d::CrossProduct(Moved.Position, FVector3d::UpVector).GetSafeNormal();
+    if (Tangent.IsNearlyZero())
+    {
+        Tangent = FVector3d::CrossProduct(Moved.Position, FVector3d::ForwardVector).GetSafeNormal();
+    }
+    Moved.Position = (Moved.Position + Tangent * 0.05).GetSafeNormal();
+
+    Service->ComputeThermalField();
+    const FThermalFieldIndex& Index = Service->GetThermalFieldIndex();
+    TestTrue(TEXT("Hotspot drift updates incrementally"), Index.bLastUpdateIncremental);
+    TestTrue(TEXT("Incremental update touches a subset of vertices"), Index.LastVerticesUpdated > 0 && Index.LastVerticesUpdated < VertexCount);
+    TestTrue(TEXT("Incremental field matches brute force"), MaxDifference(Temperatures, ComputeBruteForceThermalField(*Service)) < 1.0e-6);
+
+    return true;
+}
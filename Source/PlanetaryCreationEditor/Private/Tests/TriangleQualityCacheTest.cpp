@@ -0,0 +1,69 @@
+// Triangle quality cache: the first cadence analysis fills every entry, repeated analyses reuse them, and the cached
+// bad count matches a brute-force scan of the render mesh.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Simulation/TectonicSimulationService.h"
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTriangleQualityCacheTest,
+    "PlanetaryCreation.Milestone4.TriangleQualityCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTriangleQualityCacheTest::RunTest(const FString& Parameters)
+{
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    ON_SCOPE_EXIT
+    {
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.bEnableDynamicRetessellation = false;
+    Params.RetessellationMinTriangleAngleDegrees = 55.0; // geodesic triangles are uneven, so some fall below
+    Service->SetParameters(Params);
+
+    const TArray<FVector3d>& Vertices = Service->GetRenderVertices();
+    const TArray<int32>& Triangles = Service->GetRenderTriangles();
+    const int32 TriangleCount = Triangles.Num() / 3;
+
+    int32 ExpectedBad = 0;
+    for (int32 TriIdx = 0; TriIdx < TriangleCount; ++TriIdx)
+    {
+        const FVector3d& A = Vertices[Triangles[TriIdx * 3]];
+        const FVector3d& B = Vertices[Triangles[TriIdx * 3 + 1]];
+        const FVector3d& C = Vertices[Triangles[TriIdx * 3 + 2]];
+        const auto Angle = [](const FVector3d& At, const FVector3d& P, const FVector3d& Q)
+        {
+            return FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp((P - At).GetSafeNormal().Dot((Q - At).GetSafeNormal()), -1.0, 1.0)));
+        };
+        const double MinAngle = FMath::Min3(Angle(A, B, C), Angle(B, C, A), Angle(C, A, B));
+        ExpectedBad += static_cast<double>(static_cast<float>(MinAngle)) < Params.RetessellationMinTriangleAngleDegrees ? 1 : 0;
+    }
+
+    const int32 FirstBad = Service->ComputeRetessellationAnalysis().BadTriangleCount;
+    TestEqual(TEXT("First analysis fills every entry"), Service->GetTriangleQualityCache().LastUpdatedCount, TriangleCount);
+    TestEqual(TEXT("Cached bad count matches brute force"), FirstBad, ExpectedBad);
+
+    const int32 SecondBad = Service->ComputeRetessellationAnalysis().BadTriangleCount;
+    TestEqual(TEXT("Second analysis reuses the cache"), Service->GetTriangleQualityCache().LastUpdatedCount, 0);
+    TestEqual(TEXT("Bad count is stable"), SecondBad, FirstBad);
+
+    // A threshold change recounts from the cached angles without recomputing them.
+    const_cast<FTectonicSimulationParameters&>(Service->GetParameters()).RetessellationMinTriangleAngleDegrees = 1.0;
+    TestEqual(TEXT("Lower threshold leaves no bad triangles"), Service->ComputeRetessellationAnalysis().BadTriangleCount, 0);
+    TestEqual(TEXT("Threshold change does not recompute entries"), Service->GetTriangleQualityCache().LastUpdatedCount, 0);
+
+    return true;
+}
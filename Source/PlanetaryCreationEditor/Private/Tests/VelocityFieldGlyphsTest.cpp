@@ -0,0 +1,124 @@
+// Velocity overlay glyphs: arrows are sampled on a fixed cube-sphere grid (one per cell, stable across rebuilds), the
+// grid refines with the LOD band up to the arrow budget, and the controller redraws only when the glyph inputs change.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Utilities/PlanetaryCreationLogging.h"
+#include "Simulation/VelocityFieldGlyphs.h"
+#include "Simulation/TectonicSimulationController.h"
+#include "Simulation/TectonicSimulationService.h"
+
+#include "Editor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVelocityFieldGlyphsTest,
+    "PlanetaryCreation.Milestone4.VelocityFieldGlyphs",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVelocityFieldGlyphsTest::RunTest(const FString& Parameters)
+{
+    // Grid: every cell center maps back to its own cell, and the budget caps the cell count.
+    {
+        constexpr int32 Cells = 5;
+        bool bRoundTrip = true;
+        for (int32 Cell = 0; Cell < 6 * Cells * Cells; ++Cell)
+        {
+            bRoundTrip &= FVelocityFieldGlyphs::GetCubeSphereCell(FVelocityFieldGlyphs::GetCubeSphereCellCenter(Cell, Cells), Cells) == Cell;
+        }
+        TestTrue(TEXT("Cell centers round-trip"), bRoundTrip);
+
+        TestEqual(TEXT("LOD band sets grid resolution"), FVelocityFieldGlyphs::GetCellsPerFaceEdge(2, 0), 6);
+        TestTrue(TEXT("Finer grid for higher band"),
+            FVelocityFieldGlyphs::GetCellsPerFaceEdge(5, 0) > FVelocityFieldGlyphs::GetCellsPerFaceEdge(2, 0));
+        const int32 Capped = FVelocityFieldGlyphs::GetCellsPerFaceEdge(7, 600);
+        TestTrue(TEXT("Arrow budget caps the grid"), 6 * Capped * Capped <= 600);
+    }
+
+    UTectonicSimulationService* Service = GEditor ? GEditor->GetEditorSubsystem<UTectonicSimulationService>() : nullptr;
+    TestNotNull(TEXT("TectonicSimulationService must exist"), Service);
+    if (!Service)
+    {
+        return false;
+    }
+
+    const FTectonicSimulationParameters OriginalParams = Service->GetParameters();
+    const ETectonicVisualizationMode OriginalMode = Service->GetVisualizationMode();
+
+    FTectonicSimulationParameters Params;
+    Params.Seed = 42;
+    Params.SubdivisionLevel = 0;
+    Params.RenderSubdivisionLevel = 3;
+    Params.LloydIterations = 2;
+    Params.bEnableAutomaticLOD = false;
+    Service->SetParameters(Params);
+    Service->AdvanceSteps(2);
+
+    const TArray<FVector3d>& RenderVertices = Service->GetRenderVertices();
+    const TArray<FVector3d>& Velocities = Service->GetVertexVelocities();
+    const float RadiusUE = MetersToUE(Service->GetParameters().PlanetRadius);
+
+    const int32 CoarseCells = FVelocityFieldGlyphs::GetCellsPerFaceEdge(1, 0);
+    FVelocityFieldGlyphs Glyphs;
+    Glyphs.Build(1, 0, 1, CoarseCells, RadiusUE, 0.0f, RenderVertices, Velocities);
+
+    TestTrue(TEXT("Arrows sampled"), Glyphs.Arrows.Num() > 0);
+    TestTrue(TEXT("At most one arrow per cell"), Glyphs.Arrows.Num() <= 6 * CoarseCells * CoarseCells);
+    TestTrue(TEXT("Far fewer arrows than vertices"), Glyphs.Arrows.Num() < RenderVertices.Num());
+
+    bool bArrowsValid = true;
+    TSet<int32> UsedCells;
+    for (int32 Index = 0; Index < Glyphs.Arrows.Num(); ++Index)
+    {
+        const FVelocityFieldArrow& Arrow = Glyphs.Arrows[Index];
+        const FVector3d Tail(Arrow.Tail);
+        const FVector3d Shaft = FVector3d(Arrow.Tip) - Tail;
+        bArrowsValid &= FMath::Abs(FVector3d::DotProduct(Tail.GetSafeNormal(), Shaft.GetSafeNormal())) < 0.05;
+
+        bool bAlreadyUsed = false;
+        UsedCells.Add(FVelocityFieldGlyphs::GetCubeSphereCell(RenderVertices[Glyphs.SampleVertices[Index]], CoarseCells), &bAlreadyUsed);
+        bArrowsValid &= !bAlreadyUsed;
+    }
+    TestTrue(TEXT("Arrows are tangent and each sits in its own cell"), bArrowsValid);
+
+    FVelocityFieldGlyphs Rebuilt;
+    Rebuilt.Build(2, 0, 1, CoarseCells, RadiusUE, 0.0f, RenderVertices, Velocities);
+    TestTrue(TEXT("Sampling is stable across rebuilds"), Rebuilt.SampleVertices == Glyphs.SampleVertices);
+
+    FVelocityFieldGlyphs Fine;
+    Fine.Build(1, 0, 3, FVelocityFieldGlyphs::GetCellsPerFaceEdge(3, 0), RadiusUE, 0.0f, RenderVertices, Velocities);
+    TestTrue(TEXT("Higher band samples more arrows"), Fine.Arrows.Num() > Glyphs.Arrows.Num());
+
+    // Controller: a mesh refresh with unchanged surface data reuses the submitted arrows.
+    TSharedPtr<FTectonicSimulationController> Controller = MakeShared<FTectonicSimulationController>();
+    Controller->Initialize();
+
+    ON_SCOPE_EXIT
+    {
+        Controller->SetVisualizationMode(OriginalMode);
+        Controller->Shutdown();
+        Service->SetParameters(OriginalParams);
+        Service->ResetSimulation();
+    };
+
+    Controller->RebuildPreview();
+    Controller->SetVisualizationMode(ETectonicVisualizationMode::Velocity);
+
+    FVelocityFieldStats Shown;
+    Controller->GetVelocityFieldStats(Shown);
+    TestTrue(TEXT("Velocity arrows drawn"), Shown.ArrowCount > 0 && Shown.Draws > 0);
+
+    Controller->RebuildPreview();
+    FVelocityFieldStats Refreshed;
+    Controller->GetVelocityFieldStats(Refreshed);
+    TestEqual(TEXT("Unchanged surface data skips the rebuild"), Refreshed.Builds, Shown.Builds);
+    TestEqual(TEXT("Unchanged surface data skips the redraw"), Refreshed.Draws, Shown.Draws);
+
+    Controller->StepSimulation(1);
+    FVelocityFieldStats Stepped;
+    Controller->GetVelocityFieldStats(Stepped);
+    TestTrue(TEXT("A step rebuilds the arrows"), Stepped.Builds > Refreshed.Builds);
+
+    AddInfo(FString::Printf(TEXT("[VelocityFieldGlyphs] %d verts -> %d arrows (coarse), %d (fine); controller %d arrows on %d cells/edge"),
+        RenderVertices.Num(), Glyphs.Arrows.Num(), Fine.Arrows.Num(), Stepped.ArrowCount, Stepped.CellsPerFaceEdge));
+
+    return true;
+}
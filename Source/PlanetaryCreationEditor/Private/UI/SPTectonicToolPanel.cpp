@@ -5,6 +5,7 @@
 #include "Simulation/TectonicSimulationController.h"
 #include "Simulation/TectonicSimulationService.h"
 #include "Simulation/TectonicPlaybackController.h"
+#include "Simulation/TectonicSimulationWorker.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/FileManager.h"
@@ -31,18 +32,6 @@ SPTectonicToolPanel::~SPTectonicToolPanel()
     {
         PlaybackController->Shutdown();
     }
-
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            if (StageBReadyDelegateHandle.IsValid())
-            {
-                Service->OnStageBAmplificationReadyChanged().Remove(StageBReadyDelegateHandle);
-                StageBReadyDelegateHandle = FDelegateHandle();
-            }
-        }
-    }
 }
 
 void SPTectonicToolPanel::Construct(const FArguments& InArgs)
@@ -56,20 +45,14 @@ void SPTectonicToolPanel::Construct(const FArguments& InArgs)
         PlaybackController->Initialize(Controller);
     }
 
-    // Initialize cached parameters from service
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    // Initialize cached parameters from the published simulation state
+    RefreshSimulationUIState();
+    if (bHasSimulationUIState)
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            CachedSeed = Service->GetParameters().Seed;
-            CachedSubdivisionLevel = Service->GetParameters().RenderSubdivisionLevel;
-            CachedPaletteMode = Service->GetHeightmapPaletteMode();
-        }
+        CachedSeed = SimulationUIState.Parameters.Seed;
+        CachedSubdivisionLevel = SimulationUIState.Parameters.RenderSubdivisionLevel;
     }
 
-    RefreshStageBReadinessFromService();
-    BindStageBReadyDelegate();
-
     InitializeVisualizationOptions();
     RefreshSelectedVisualizationOption();
 
@@ -212,6 +195,14 @@ TSharedRef<SWidget> SPTectonicToolPanel::BuildStatsHeader()
         ]
         + SVerticalBox::Slot()
         .AutoHeight()
+        [
+            SNew(STextBlock)
+            .Text(this, &SPTectonicToolPanel::GetLODCacheStatsLabel)
+            .Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+            .ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
+        ]
+        + SVerticalBox::Slot()
+        .AutoHeight()
         [
             SNew(STextBlock)
             .Text(this, &SPTectonicToolPanel::GetRetessellationStatsLabel)
@@ -862,17 +853,17 @@ FReply SPTectonicToolPanel::HandleRegenerateClicked()
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        // Runs between worker batches when a step is in flight; the preview refreshes without advancing time.
+        const int32 Seed = CachedSeed;
+        Controller->ApplySimulationMutation([Seed](UTectonicSimulationService& Service)
         {
-            FTectonicSimulationParameters NewParams = Service->GetParameters();
-            NewParams.Seed = CachedSeed;
-            Service->SetParameters(NewParams);
-
-            // Refresh preview mesh without advancing time
-            Controller->RebuildPreview(); // warm preview mesh after reset
+            FTectonicSimulationParameters NewParams = Service.GetParameters();
+            NewParams.Seed = Seed;
+            Service.SetParameters(NewParams);
 
-            UE_LOG(LogPlanetaryCreation, Log, TEXT("Regenerated plates with seed %d"), CachedSeed);
-        }
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("Regenerated plates with seed %d"), Seed);
+            return true;
+        });
     }
     return FReply::Handled();
 }
@@ -892,6 +883,13 @@ FText SPTectonicToolPanel::GetPlateCountLabel() const
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
+        // While the simulation worker is stepping, read the last published frame instead of live service state.
+        const FTectonicSimulationFramePtr Frame = Controller->IsSimulationWorkerBusy() ? Controller->GetLatestSimulationFrame() : FTectonicSimulationFramePtr();
+        if (Frame.IsValid())
+        {
+            return FText::Format(NSLOCTEXT("PlanetaryCreation", "PlateCountLabel", "Plates: {0}"), FText::AsNumber(Frame->PlateCount));
+        }
+
         if (UTectonicSimulationService* Service = Controller->GetSimulationService())
         {
             const int32 PlateCount = Service->GetPlates().Num();
@@ -906,15 +904,20 @@ FText SPTectonicToolPanel::GetPerformanceStatsLabel() const
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        const FTectonicSimulationFramePtr Frame = Controller->IsSimulationWorkerBusy() ? Controller->GetLatestSimulationFrame() : FTectonicSimulationFramePtr();
+        UTectonicSimulationService* Service = Controller->GetSimulationService();
+        if (Frame.IsValid() || Service)
         {
-            const double StepTimeMs = Service->GetLastStepTimeMs();
-            const int32 VertexCount = Service->GetRenderVertices().Num();
-            const int32 TriangleCount = Service->GetRenderTriangles().Num() / 3;
+            const double StepTimeMs = Frame.IsValid() ? Frame->LastStepTimeMs : Service->GetLastStepTimeMs();
+            const int32 VertexCount = Frame.IsValid() ? Frame->RenderVertexCount : Service->GetRenderVertices().Num();
+            const int32 TriangleCount = Frame.IsValid() ? Frame->RenderTriangleCount : Service->GetRenderTriangles().Num() / 3;
+
+            const FMeshBuildStats MeshStats = Controller->GetLastMeshBuildStats();
 
             return FText::Format(
-                NSLOCTEXT("PlanetaryCreation", "PerfStatsLabel", "Step: {0}ms | Verts: {1} | Tris: {2}"),
+                NSLOCTEXT("PlanetaryCreation", "PerfStatsLabel", "Step: {0}ms | Mesh: {1}ms | Verts: {2} | Tris: {3}"),
                 FText::AsNumber(FMath::RoundToInt(StepTimeMs)),
+                FText::AsNumber(FMath::RoundToInt(MeshStats.TotalMs)),
                 FText::AsNumber(VertexCount),
                 FText::AsNumber(TriangleCount)
             );
@@ -924,13 +927,43 @@ FText SPTectonicToolPanel::GetPerformanceStatsLabel() const
     return NSLOCTEXT("PlanetaryCreation", "PerfStatsUnavailable", "Performance: n/a");
 }
 
+FText SPTectonicToolPanel::GetLODCacheStatsLabel() const
+{
+    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    {
+        FLODCacheMemoryStats Stats;
+        Controller->GetCacheStats(Stats);
+
+        const double UsedMB = (Stats.ResidentBytes + Stats.SnapshotBytes) / (1024.0 * 1024.0);
+        const FText BudgetText = Stats.BudgetBytes > 0
+            ? FText::FromString(FString::Printf(TEXT("%.0f"), Stats.BudgetBytes / (1024.0 * 1024.0)))
+            : NSLOCTEXT("PlanetaryCreation", "LODCacheUnlimited", "unlimited");
+
+        return FText::Format(
+            NSLOCTEXT("PlanetaryCreation", "LODCacheStatsLabel", "LOD Cache: {0} LODs, {1}/{2} MB | Hit {3} | Miss {4} | Evict {5} | Prewarm cancel {6}"),
+            FText::AsNumber(Stats.CachedLODs),
+            FText::FromString(FString::Printf(TEXT("%.1f"), UsedMB)),
+            BudgetText,
+            FText::AsNumber(Stats.Hits),
+            FText::AsNumber(Stats.Misses),
+            FText::AsNumber(Stats.Evictions),
+            FText::AsNumber(Stats.CancelledPrewarms)
+        );
+    }
+
+    return NSLOCTEXT("PlanetaryCreation", "LODCacheStatsUnavailable", "LOD Cache: n/a");
+}
+
 FText SPTectonicToolPanel::GetRetessellationStatsLabel() const
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        const FTectonicSimulationFramePtr Frame = Controller->IsSimulationWorkerBusy() ? Controller->GetLatestSimulationFrame() : FTectonicSimulationFramePtr();
+        UTectonicSimulationService* Service = Controller->GetSimulationService();
+        if (Frame.IsValid() || Service)
         {
-            const UTectonicSimulationService::FRetessellationCadenceStats& Stats = Service->GetRetessellationCadenceStats();
+            const UTectonicSimulationService::FRetessellationCadenceStats& Stats =
+                Frame.IsValid() ? Frame->RetessellationCadenceStats : Service->GetRetessellationCadenceStats();
 
             if (Stats.StepsObserved == 0)
             {
@@ -949,12 +982,17 @@ FText SPTectonicToolPanel::GetRetessellationStatsLabel() const
             const int32 SinceLast = FMath::Clamp(Stats.StepsSinceLastTrigger, 0, 999999);
             const int32 CooldownSteps = FMath::Clamp(Stats.LastCooldownDuration, 0, 999999);
 
+            const FString CostString = bHasTriggerSample
+                ? FString::Printf(TEXT("%.1f ms / %d tris"), Stats.LastRetessellationMs, Stats.LastTrianglesTouched)
+                : TEXT("--");
+
             const FString LabelString = FString::Printf(
-                TEXT("Retess: auto %d | eval %d | last %s° / %s%% | since %d | cool %d"),
+                TEXT("Retess: auto %d | eval %d | last %s° / %s%% | %s | since %d | cool %d"),
                 Stats.TriggerCount,
                 Stats.EvaluationCount,
                 *DriftString,
                 *BadTriString,
+                *CostString,
                 SinceLast,
                 CooldownSteps);
 
@@ -979,10 +1017,11 @@ FReply SPTectonicToolPanel::HandleExportMetricsClicked()
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        Controller->ApplySimulationMutation([](UTectonicSimulationService& Service)
         {
-            Service->ExportMetricsToCSV();
-        }
+            Service.ExportMetricsToCSV();
+            return false;
+        }, false);
     }
     return FReply::Handled();
 }
@@ -991,10 +1030,11 @@ FReply SPTectonicToolPanel::HandleExportTerranesClicked()
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        Controller->ApplySimulationMutation([](UTectonicSimulationService& Service)
         {
-            Service->ExportTerranesToCSV();
-        }
+            Service.ExportTerranesToCSV();
+            return false;
+        }, false);
     }
     return FReply::Handled();
 }
@@ -1121,17 +1161,16 @@ void SPTectonicToolPanel::OnSubdivisionValueCommitted(int32 NewValue, ETextCommi
     // Apply the new subdivision level
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        const int32 RenderLevel = CachedSubdivisionLevel;
+        Controller->ApplySimulationMutation([RenderLevel](UTectonicSimulationService& Service)
         {
-            FTectonicSimulationParameters NewParams = Service->GetParameters();
-            NewParams.RenderSubdivisionLevel = CachedSubdivisionLevel;
-            Service->SetParameters(NewParams);
-
-            // Refresh preview mesh
-            Controller->RebuildPreview(); // warm preview mesh after reset
+            FTectonicSimulationParameters NewParams = Service.GetParameters();
+            NewParams.RenderSubdivisionLevel = RenderLevel;
+            Service.SetParameters(NewParams);
 
-            UE_LOG(LogPlanetaryCreation, Log, TEXT("Updated render subdivision level to %d"), CachedSubdivisionLevel);
-        }
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("Updated render subdivision level to %d"), RenderLevel);
+            return true;
+        });
     }
 }
 
@@ -1226,12 +1265,9 @@ EVisibility SPTectonicToolPanel::GetBoundaryModeRowVisibility() const
 
 ECheckBoxState SPTectonicToolPanel::GetAutomaticLODState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    if (bHasSimulationUIState)
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableAutomaticLOD ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
+        return SimulationUIState.Parameters.bEnableAutomaticLOD ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
     }
     return ECheckBoxState::Checked; // Default to checked
 }
@@ -1240,12 +1276,13 @@ void SPTectonicToolPanel::OnAutomaticLODChanged(ECheckBoxState NewState)
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        const bool bEnabled = (NewState == ECheckBoxState::Checked);
+        Controller->ApplySimulationMutation([bEnabled](UTectonicSimulationService& Service)
         {
-            const bool bEnabled = (NewState == ECheckBoxState::Checked);
-            Service->SetAutomaticLODEnabled(bEnabled);
-            UE_LOG(LogPlanetaryCreation, Log, TEXT("Automatic LOD %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
-        }
+            Service.SetAutomaticLODEnabled(bEnabled);
+            return false;
+        }, false);
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("Automatic LOD %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
     }
 }
 
@@ -1284,10 +1321,13 @@ void SPTectonicToolPanel::OnNormalizedPaletteChanged(ECheckBoxState NewState)
 
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        // Applied now, the service refreshes preview colors itself; queued, the worker frame carries the new palette.
+        const EHeightmapPaletteMode PaletteMode = CachedPaletteMode;
+        Controller->ApplySimulationMutation([PaletteMode](UTectonicSimulationService& Service)
         {
-            Service->SetHeightmapPaletteMode(CachedPaletteMode);
-        }
+            Service.SetHeightmapPaletteMode(PaletteMode);
+            return true;
+        }, false);
     }
 }
 
@@ -1337,14 +1377,7 @@ void SPTectonicToolPanel::OnPBRShadingChanged(ECheckBoxState NewState)
 
 ECheckBoxState SPTectonicToolPanel::GetContinentalErosionState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableContinentalErosion ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.Parameters.bEnableContinentalErosion) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnContinentalErosionChanged(ECheckBoxState NewState)
@@ -1365,14 +1398,7 @@ void SPTectonicToolPanel::OnContinentalErosionChanged(ECheckBoxState NewState)
 
 ECheckBoxState SPTectonicToolPanel::GetSedimentTransportState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableSedimentTransport ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.Parameters.bEnableSedimentTransport) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnSedimentTransportChanged(ECheckBoxState NewState)
@@ -1393,14 +1419,7 @@ void SPTectonicToolPanel::OnSedimentTransportChanged(ECheckBoxState NewState)
 
 ECheckBoxState SPTectonicToolPanel::GetHydraulicErosionState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableHydraulicErosion ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.Parameters.bEnableHydraulicErosion) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnHydraulicErosionChanged(ECheckBoxState NewState)
@@ -1421,14 +1440,7 @@ void SPTectonicToolPanel::OnHydraulicErosionChanged(ECheckBoxState NewState)
 
 ECheckBoxState SPTectonicToolPanel::GetOceanicDampeningState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableOceanicDampening ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.Parameters.bEnableOceanicDampening) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnOceanicDampeningChanged(ECheckBoxState NewState)
@@ -1449,14 +1461,7 @@ void SPTectonicToolPanel::OnOceanicDampeningChanged(ECheckBoxState NewState)
 
 ECheckBoxState SPTectonicToolPanel::GetOceanicAmplificationState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableOceanicAmplification ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.Parameters.bEnableOceanicAmplification) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnOceanicAmplificationChanged(ECheckBoxState NewState)
@@ -1477,14 +1482,7 @@ void SPTectonicToolPanel::OnOceanicAmplificationChanged(ECheckBoxState NewState)
 
 ECheckBoxState SPTectonicToolPanel::GetContinentalAmplificationState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->GetParameters().bEnableContinentalAmplification ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.Parameters.bEnableContinentalAmplification) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnContinentalAmplificationChanged(ECheckBoxState NewState)
@@ -1503,24 +1501,24 @@ void SPTectonicToolPanel::OnContinentalAmplificationChanged(ECheckBoxState NewSt
         TEXT("Continental amplification"));
 }
 
-void SPTectonicToolPanel::ApplySurfaceProcessMutation(TFunctionRef<bool(FTectonicSimulationParameters&)> Mutator, const TCHAR* ChangeLabel) const
+void SPTectonicToolPanel::ApplySurfaceProcessMutation(TFunction<bool(FTectonicSimulationParameters&)> Mutator, const TCHAR* ChangeLabel) const
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        // Parameters are read when the edit runs, so toggles queued behind a worker batch stack instead of clobbering each other.
+        Controller->ApplySimulationMutation([Mutator = MoveTemp(Mutator), Label = FString(ChangeLabel)](UTectonicSimulationService& Service)
         {
-            FTectonicSimulationParameters Params = Service->GetParameters();
+            FTectonicSimulationParameters Params = Service.GetParameters();
             if (!Mutator(Params))
             {
-                return;
+                return false;
             }
 
-            Service->SetParameters(Params);
-
-            Controller->RebuildPreview(); // warm preview mesh after reset
+            Service.SetParameters(Params);
 
-            UE_LOG(LogPlanetaryCreation, Log, TEXT("%s toggled, simulation reset."), ChangeLabel);
-        }
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("%s toggled, simulation reset."), *Label);
+            return true;
+        });
     }
 }
 
@@ -1553,8 +1551,8 @@ FReply SPTectonicToolPanel::HandleExportHeightmapClicked()
 		return FReply::Handled();
 	}
 
-	UTectonicSimulationService* Service = Controller->GetSimulationService();
-	if (!Service)
+	RefreshSimulationUIState();
+	if (!bHasSimulationUIState)
 	{
 		UE_LOG(LogPlanetaryCreation, Error, TEXT("[HeightmapExport] Simulation service unavailable."));
 		return FReply::Handled();
@@ -1599,7 +1597,7 @@ FReply SPTectonicToolPanel::HandleExportHeightmapClicked()
 		FPlatformMisc::SetEnvironmentVar(Name, *Value);
 	};
 
-	const int32 RenderSubdivisionLevel = Service->GetParameters().RenderSubdivisionLevel;
+	const int32 RenderSubdivisionLevel = SimulationUIState.Parameters.RenderSubdivisionLevel;
 	OverrideEnvVar(TEXT("PLANETARY_STAGEB_FORCE_CPU"), TEXT("1"));
 	OverrideEnvVar(TEXT("PLANETARY_STAGEB_FORCE_EXEMPLAR"), TEXT("O01"));
 	OverrideEnvVar(TEXT("PLANETARY_STAGEB_DISABLE_RANDOM_OFFSET"), TEXT("1"));
@@ -1657,6 +1655,9 @@ bool SPTectonicToolPanel::ApplyPaperReadyPreset()
         return false;
     }
 
+    // The preset drives Stage B GPU readbacks on the game thread; take the service back from the worker first.
+    Controller->ShutdownSimulationWorker();
+
     // Target the published paper defaults for deterministic captures.
     FTectonicSimulationParameters Params = Service->GetParameters();
 
@@ -1714,8 +1715,7 @@ bool SPTectonicToolPanel::ApplyPaperReadyPreset()
     }
 
     Controller->RebuildPreview();
-    RefreshStageBReadinessFromService();
-    RefreshCachedPaletteMode();
+    RefreshSimulationUIState();
 
     const bool bStageBReady = Service->IsStageBAmplificationReady();
     bPaperReadyApplied = bStageBReady;
@@ -1732,26 +1732,29 @@ FReply SPTectonicToolPanel::HandlePrimeGPUStageBClicked()
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        if (Controller->GetSimulationService())
         {
-            FTectonicSimulationParameters Params = Service->GetParameters();
-            const bool bOriginalOceanic = Params.bEnableOceanicAmplification;
-            const bool bOriginalContinental = Params.bEnableContinentalAmplification;
-            const bool bOriginalSkip = Params.bSkipCPUAmplification;
-
-            Params.bEnableOceanicAmplification = true;
-            Params.bEnableContinentalAmplification = true;
-            Params.bSkipCPUAmplification = false;
-
-            const bool bParamsChanged = (bOriginalOceanic != Params.bEnableOceanicAmplification) ||
-                (bOriginalContinental != Params.bEnableContinentalAmplification) ||
-                (bOriginalSkip != Params.bSkipCPUAmplification);
-
-            if (bParamsChanged)
+            Controller->ApplySimulationMutation([](UTectonicSimulationService& Service)
             {
-                Service->SetParameters(Params);
-                Controller->RebuildPreview();
-            }
+                FTectonicSimulationParameters Params = Service.GetParameters();
+                const bool bOriginalOceanic = Params.bEnableOceanicAmplification;
+                const bool bOriginalContinental = Params.bEnableContinentalAmplification;
+                const bool bOriginalSkip = Params.bSkipCPUAmplification;
+
+                Params.bEnableOceanicAmplification = true;
+                Params.bEnableContinentalAmplification = true;
+                Params.bSkipCPUAmplification = false;
+
+                const bool bParamsChanged = (bOriginalOceanic != Params.bEnableOceanicAmplification) ||
+                    (bOriginalContinental != Params.bEnableContinentalAmplification) ||
+                    (bOriginalSkip != Params.bSkipCPUAmplification);
+
+                if (bParamsChanged)
+                {
+                    Service.SetParameters(Params);
+                }
+                return bParamsChanged;
+            });
 
             if (IConsoleVariable* UseGPU = IConsoleManager::Get().FindConsoleVariable(TEXT("r.PlanetaryCreation.UseGPUAmplification")))
             {
@@ -1763,7 +1766,7 @@ FReply SPTectonicToolPanel::HandlePrimeGPUStageBClicked()
             }
 
             UE_LOG(LogPlanetaryCreation, Log, TEXT("[StageB] GPU pipeline primed: oceanic+continental amplification enabled, CPU fallback active, GPU amplification cvar set."));
-            RefreshStageBReadinessFromService();
+            RefreshSimulationUIState();
         }
     }
 
@@ -1863,62 +1866,54 @@ void SPTectonicToolPanel::OnTimelineScrubbed(float NewValue)
     // Milestone 5 Task 1.3: Timeline scrubbing via history system
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        const int32 TargetIndex = FMath::RoundToInt(NewValue);
+        Controller->ApplySimulationMutation([TargetIndex](UTectonicSimulationService& Service)
         {
-            const int32 TargetIndex = FMath::RoundToInt(NewValue);
-            if (Service->JumpToHistoryIndex(TargetIndex))
+            if (!Service.JumpToHistoryIndex(TargetIndex))
             {
-                // Rebuild mesh to reflect the jumped-to state
-                Controller->RebuildPreview(); // warm preview mesh after reset
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("Timeline scrubbed to step %d (%.1f My)"),
-                    TargetIndex, Service->GetCurrentTimeMy());
+                return false;
             }
-        }
+
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("Timeline scrubbed to step %d (%.1f My)"),
+                TargetIndex, Service.GetCurrentTimeMy());
+            return true;
+        });
     }
 }
 
 float SPTectonicToolPanel::GetTimelineValue() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    if (bHasSimulationUIState)
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            // Each step is 2 My, so step count = time / 2
-            return static_cast<float>(Service->GetCurrentTimeMy() / 2.0);
-        }
+        // Each step is 2 My, so step count = time / 2
+        return static_cast<float>(SimulationUIState.CurrentTimeMy / 2.0);
     }
     return 0.0f;
 }
 
 float SPTectonicToolPanel::GetTimelineMaxValue() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    if (bHasSimulationUIState)
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            // Return current step as max for now; will be history size once rollback is implemented
-            // Each step is 2 My, so step count = time / 2
-            return FMath::Max(1.0f, static_cast<float>(Service->GetCurrentTimeMy() / 2.0));
-        }
+        // Return current step as max for now; will be history size once rollback is implemented
+        // Each step is 2 My, so step count = time / 2
+        return FMath::Max(1.0f, static_cast<float>(SimulationUIState.CurrentTimeMy / 2.0));
     }
     return 1.0f;
 }
 
 FText SPTectonicToolPanel::GetTimelineLabel() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    if (bHasSimulationUIState)
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            const double CurrentTime = Service->GetCurrentTimeMy();
-            // Each step is 2 My, so step count = time / 2
-            const int32 CurrentStep = FMath::FloorToInt(CurrentTime / 2.0);
-            return FText::Format(
-                NSLOCTEXT("PlanetaryCreation", "TimelineLabel", "Timeline: Step {0} ({1} My)"),
-                FText::AsNumber(CurrentStep),
-                FText::AsNumber(FMath::RoundToInt(CurrentTime))
-            );
-        }
+        const double CurrentTime = SimulationUIState.CurrentTimeMy;
+        // Each step is 2 My, so step count = time / 2
+        const int32 CurrentStep = FMath::FloorToInt(CurrentTime / 2.0);
+        return FText::Format(
+            NSLOCTEXT("PlanetaryCreation", "TimelineLabel", "Timeline: Step {0} ({1} My)"),
+            FText::AsNumber(CurrentStep),
+            FText::AsNumber(FMath::RoundToInt(CurrentTime))
+        );
     }
     return NSLOCTEXT("PlanetaryCreation", "TimelineUnavailable", "Timeline: n/a");
 }
@@ -1931,15 +1926,17 @@ FReply SPTectonicToolPanel::HandleUndoClicked()
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        Controller->ApplySimulationMutation([](UTectonicSimulationService& Service)
         {
-            if (Service->Undo())
+            if (!Service.Undo())
             {
-                // Rebuild mesh to reflect restored state
-                Controller->RebuildPreview(); // warm preview mesh after reset
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("Undo successful, mesh rebuilt"));
+                return false;
             }
-        }
+
+            // Rebuild mesh to reflect restored state
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("Undo successful, rebuilding mesh"));
+            return true;
+        });
     }
     return FReply::Handled();
 }
@@ -1948,57 +1945,40 @@ FReply SPTectonicToolPanel::HandleRedoClicked()
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        Controller->ApplySimulationMutation([](UTectonicSimulationService& Service)
         {
-            if (Service->Redo())
+            if (!Service.Redo())
             {
-                // Rebuild mesh to reflect restored state
-                Controller->RebuildPreview(); // warm preview mesh after reset
-                UE_LOG(LogPlanetaryCreation, Log, TEXT("Redo successful, mesh rebuilt"));
+                return false;
             }
-        }
+
+            // Rebuild mesh to reflect restored state
+            UE_LOG(LogPlanetaryCreation, Log, TEXT("Redo successful, rebuilding mesh"));
+            return true;
+        });
     }
     return FReply::Handled();
 }
 
 bool SPTectonicToolPanel::IsUndoEnabled() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->CanUndo();
-        }
-    }
-    return false;
+    return bHasSimulationUIState && SimulationUIState.bCanUndo;
 }
 
 bool SPTectonicToolPanel::IsRedoEnabled() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->CanRedo();
-        }
-    }
-    return false;
+    return bHasSimulationUIState && SimulationUIState.bCanRedo;
 }
 
 FText SPTectonicToolPanel::GetHistoryStatusText() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    if (bHasSimulationUIState)
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            const int32 CurrentIndex = Service->GetHistoryIndex();
-            const int32 HistorySize = Service->GetHistorySize();
-            return FText::Format(
-                NSLOCTEXT("PlanetaryCreation", "HistoryStatus", "History: {0}/{1}"),
-                FText::AsNumber(CurrentIndex + 1),
-                FText::AsNumber(HistorySize)
-            );
-        }
+        return FText::Format(
+            NSLOCTEXT("PlanetaryCreation", "HistoryStatus", "History: {0}/{1}"),
+            FText::AsNumber(SimulationUIState.HistoryIndex + 1),
+            FText::AsNumber(SimulationUIState.HistorySize)
+        );
     }
     return NSLOCTEXT("PlanetaryCreation", "HistoryUnavailable", "History: n/a");
 }
@@ -2011,7 +1991,7 @@ void SPTectonicToolPanel::Tick(const FGeometry& AllottedGeometry, const double I
 {
     SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 
-    RefreshCachedPaletteMode();
+    RefreshSimulationUIState();
 
     // Update camera controller every frame
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
@@ -2108,14 +2088,25 @@ FText SPTectonicToolPanel::GetCameraStatusText() const
     return NSLOCTEXT("PlanetaryCreation", "CameraUnavailable", "Camera: n/a");
 }
 
-void SPTectonicToolPanel::RefreshStageBReadinessFromService()
+void SPTectonicToolPanel::RefreshSimulationUIState()
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
+    // Frame state while the simulation worker is stepping, live service state otherwise; getters read only this copy.
+    const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin();
+    if (!Controller || !Controller->GetSimulationUIState(SimulationUIState))
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            HandleStageBReadyChanged(Service->IsStageBAmplificationReady(), Service->GetStageBAmplificationNotReadyReason());
-        }
+        return;
+    }
+
+    const bool bFirstState = !bHasSimulationUIState;
+    bHasSimulationUIState = true;
+    CachedPaletteMode = SimulationUIState.HeightmapPaletteMode;
+
+    // Polled rather than bound to OnStageBAmplificationReadyChanged, which fires on the worker thread mid-step.
+    if (bFirstState
+        || SimulationUIState.bStageBReady != bCachedStageBReady
+        || SimulationUIState.StageBNotReadyReason != CachedStageBReason)
+    {
+        HandleStageBReadyChanged(SimulationUIState.bStageBReady, SimulationUIState.StageBNotReadyReason);
     }
 }
 
@@ -2141,63 +2132,27 @@ void SPTectonicToolPanel::HandleStageBReadyChanged(bool bReady, EStageBAmplifica
     }
 }
 
-void SPTectonicToolPanel::RefreshCachedPaletteMode()
-{
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            CachedPaletteMode = Service->GetHeightmapPaletteMode();
-        }
-    }
-}
-
-void SPTectonicToolPanel::BindStageBReadyDelegate()
-{
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            if (StageBReadyDelegateHandle.IsValid())
-            {
-                Service->OnStageBAmplificationReadyChanged().Remove(StageBReadyDelegateHandle);
-                StageBReadyDelegateHandle = FDelegateHandle();
-            }
-
-            StageBReadyDelegateHandle = Service->OnStageBAmplificationReadyChanged()
-                .AddSP(this, &SPTectonicToolPanel::HandleStageBReadyChanged);
-
-            HandleStageBReadyChanged(Service->IsStageBAmplificationReady(), Service->GetStageBAmplificationNotReadyReason());
-        }
-    }
-}
-
 ECheckBoxState SPTectonicToolPanel::GetSeaLevelHighlightState() const
 {
-    if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
-    {
-        if (const UTectonicSimulationService* Service = Controller->GetSimulationService())
-        {
-            return Service->IsHighlightSeaLevelEnabled() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
-        }
-    }
-    return ECheckBoxState::Unchecked;
+    return (bHasSimulationUIState && SimulationUIState.bHighlightSeaLevel) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SPTectonicToolPanel::OnSeaLevelHighlightChanged(ECheckBoxState NewState)
 {
     if (const TSharedPtr<FTectonicSimulationController> Controller = ControllerWeak.Pin())
     {
-        if (UTectonicSimulationService* Service = Controller->GetSimulationService())
+        const bool bEnabled = (NewState == ECheckBoxState::Checked);
+        const bool bAppliedNow = Controller->ApplySimulationMutation([bEnabled](UTectonicSimulationService& Service)
         {
-            const bool bEnabled = (NewState == ECheckBoxState::Checked);
-            Service->SetHighlightSeaLevel(bEnabled);
-            UE_LOG(LogPlanetaryCreation, Log, TEXT("Sea level highlight %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+            Service.SetHighlightSeaLevel(bEnabled);
+            return true;
+        }, false);
+        UE_LOG(LogPlanetaryCreation, Log, TEXT("Sea level highlight %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
 
-            if (!Controller->RefreshPreviewColors())
-            {
-                Controller->RebuildPreview(); // warm preview mesh after reset
-            }
+        // A queued toggle bumps the surface version, so the worker frame published for it remeshes the colors.
+        if (bAppliedNow && !Controller->RefreshPreviewColors())
+        {
+            Controller->RebuildPreview(); // warm preview mesh after reset
         }
     }
 }
@@ -0,0 +1,11 @@
+// Compiles the MeshOptimizer sources the preview mesh pipeline uses into this module: half quantization and the
+// vertex/index codecs (LOD cache compaction), vertex cache/fetch optimizers and analyzers (preview mesh layout).
+// RealtimeMeshExt builds the same files but does not export them. Mirrors RealtimeMeshExt's MeshOptimizerLibModule.cpp.
+
+#include "MeshOptimizer/indexcodec.cpp"
+#include "MeshOptimizer/quantization.cpp"
+#include "MeshOptimizer/vcacheanalyzer.cpp"
+#include "MeshOptimizer/vcacheoptimizer.cpp"
+#include "MeshOptimizer/vertexcodec.cpp"
+#include "MeshOptimizer/vfetchanalyzer.cpp"
+#include "MeshOptimizer/vfetchoptimizer.cpp"
@@ -3,6 +3,7 @@
 #include "Utilities/PlanetaryCreationLogging.h"
 #include "Simulation/TectonicSimulationController.h"
 #include "Simulation/TectonicSimulationService.h"
+#include "Simulation/BoundaryOverlaySet.h"
 #include "RealtimeMeshComponent/Public/RealtimeMeshSimple.h"
 #include "RealtimeMeshComponent/Public/Interface/Core/RealtimeMeshBuilder.h"
 #include "RealtimeMeshComponent/Public/Interface/Core/RealtimeMeshSectionConfig.h"
@@ -10,6 +11,7 @@
 #include "Editor.h"
 #include "Engine/World.h"
 #include "Components/LineBatchComponent.h"
+#include "Hash/CityHash.h"
 
 using namespace RealtimeMesh;
 
@@ -45,8 +47,8 @@ static constexpr int32 GHighResBoundarySimplifierMaxWarnings = 5;
 void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
 {
 #if WITH_EDITOR
-    // Clear legacy batched lines so stale overlays from older builds disappear
-    if (GEditor)
+    // Clear legacy batched lines once so stale overlays from older builds disappear
+    if (!bLegacyBoundaryBatchCleared && GEditor)
     {
         if (UWorld* World = GEditor->GetEditorWorldContext().World())
         {
@@ -55,6 +57,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
                 constexpr uint32 HighResBoundaryBatchId = 0x48524253; // 'HRBS'
                 LineBatcher->ClearBatch(HighResBoundaryBatchId);
             }
+            bLegacyBoundaryBatchCleared = true;
         }
     }
 
@@ -73,6 +76,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
         {
             Mesh->SetSectionVisibility(OverlaySectionKey, false);
         }
+        BoundaryOverlayGeometryHash = 0; // Showing again re-uploads
     };
 
     if (!bShowBoundaries)
@@ -99,93 +103,19 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
         return;
     }
 
-    struct FBoundaryEdge
+    // Seams depend only on topology and plate assignments; rebuild them only when either changed.
+    const int32 TopologyVersion = Service->GetTopologyVersion();
+    const uint64 AssignmentHash = FBoundaryOverlaySet::HashAssignments(VertexPlateAssignments);
+    if (!BoundaryOverlaySet.Matches(TopologyVersion, RenderVertices.Num(), RenderTriangles.Num() / 3, AssignmentHash))
     {
-        int32 V0 = INDEX_NONE;
-        int32 V1 = INDEX_NONE;
-        int32 PlateA = INDEX_NONE;
-        int32 PlateB = INDEX_NONE;
-        EBoundaryType BoundaryType = EBoundaryType::Transform;
-        EBoundaryState BoundaryState = EBoundaryState::Nascent;
-        double Stress = 0.0;
-        double RiftWidth = 0.0;
-    };
-
-    struct FBoundaryPolyline
-    {
-        TArray<int32> Vertices;
-        TArray<FBoundaryEdge> Segments;
-        FBoundaryEdge Representative;
-    };
-
-    auto SortedEdgeKey = [](int32 A, int32 B)
-    {
-        return FIntPoint(FMath::Min(A, B), FMath::Max(A, B));
-    };
-
-    TArray<FBoundaryEdge> BoundaryEdges;
-    BoundaryEdges.Reserve(RenderTriangles.Num() / 2); // Rough upper bound
-
-    TSet<TPair<int32, int32>> ProcessedEdges;
-    ProcessedEdges.Reserve(RenderTriangles.Num());
-    TMap<FIntPoint, FBoundaryEdge> EdgeLookup;
-    TMap<TPair<int32, int32>, TArray<FBoundaryEdge>> BoundaryMap;
-
-    for (int32 TriIdx = 0; TriIdx < RenderTriangles.Num(); TriIdx += 3)
-    {
-        const int32 V0 = RenderTriangles[TriIdx];
-        const int32 V1 = RenderTriangles[TriIdx + 1];
-        const int32 V2 = RenderTriangles[TriIdx + 2];
-
-        if (!VertexPlateAssignments.IsValidIndex(V0) ||
-            !VertexPlateAssignments.IsValidIndex(V1) ||
-            !VertexPlateAssignments.IsValidIndex(V2))
-        {
-            continue;
-        }
-
-        const int32 Plate0 = VertexPlateAssignments[V0];
-        const int32 Plate1 = VertexPlateAssignments[V1];
-        const int32 Plate2 = VertexPlateAssignments[V2];
-
-        auto TryAddEdge = [&](int32 VA, int32 VB, int32 PlateA, int32 PlateB)
-        {
-            if (PlateA == PlateB || PlateA == INDEX_NONE || PlateB == INDEX_NONE)
-            {
-                return;
-            }
-
-            const TPair<int32, int32> EdgeKey(FMath::Min(VA, VB), FMath::Max(VA, VB));
-            if (ProcessedEdges.Contains(EdgeKey))
-            {
-                return;
-            }
-
-            ProcessedEdges.Add(EdgeKey);
-
-            const TPair<int32, int32> BoundaryKey(FMath::Min(PlateA, PlateB), FMath::Max(PlateA, PlateB));
-            const FPlateBoundary* Boundary = Boundaries.Find(BoundaryKey);
-
-            FBoundaryEdge Edge;
-            Edge.V0 = VA;
-            Edge.V1 = VB;
-            Edge.PlateA = BoundaryKey.Key;
-            Edge.PlateB = BoundaryKey.Value;
-            Edge.BoundaryType = Boundary ? Boundary->BoundaryType : EBoundaryType::Transform;
-            Edge.BoundaryState = Boundary ? Boundary->BoundaryState : EBoundaryState::Nascent;
-            Edge.Stress = Boundary ? Boundary->AccumulatedStress : 0.0;
-            Edge.RiftWidth = Boundary ? Boundary->RiftWidthMeters : 0.0;
-
-            BoundaryEdges.Add(Edge);
-            EdgeLookup.Add(SortedEdgeKey(Edge.V0, Edge.V1), Edge);
-            BoundaryMap.FindOrAdd(BoundaryKey).Add(Edge);
-        };
-
-        TryAddEdge(V0, V1, Plate0, Plate1);
-        TryAddEdge(V1, V2, Plate1, Plate2);
-        TryAddEdge(V2, V0, Plate2, Plate0);
+        BoundaryOverlaySet.Build(TopologyVersion, Service->GetRenderVertexAdjacencyOffsets(), Service->GetRenderVertexAdjacency(),
+            RenderTriangles, VertexPlateAssignments, AssignmentHash);
+        ++BoundaryOverlaySetBuilds;
     }
 
+    const TArray<FBoundaryOverlayEdge>& BoundaryEdges = BoundaryOverlaySet.Edges;
+    const TArray<FBoundaryOverlayGroup>& BoundaryGroups = BoundaryOverlaySet.Groups;
+
     if (BoundaryEdges.Num() == 0)
     {
         HideOverlaySection();
@@ -211,7 +141,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
     const bool bSimplifiedMode = OverlayMode == 1;
     const float SimplifiedHalfWidthUE = MetersToUE(400.0); // ~0.8 km total width for seam polylines
 
-    auto GetBoundaryColor = [](EBoundaryType Type, EBoundaryState State, double Stress) -> FColor
+    auto GetBoundaryColor = [](EBoundaryType Type, EBoundaryState State) -> FColor
     {
         FColor BaseColor;
         switch (Type)
@@ -246,9 +176,53 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
         {
             WidthMeters += FMath::Clamp(RiftWidth * 0.02, 0.0, 10000.0); // widen rifts proportionally (max +10 km)
         }
+        // 250 m steps: accumulating stress should not force a re-upload every step
+        WidthMeters = FMath::RoundToDouble(WidthMeters / 250.0) * 250.0;
         return MetersToUE(WidthMeters);
     };
 
+    // Style per plate pair, from the service boundary state
+    struct FBoundaryStyle
+    {
+        FColor Color = FColor::White;
+        float HalfWidthUE = 0.0f;
+    };
+
+    TArray<FBoundaryStyle> GroupStyles;
+    GroupStyles.SetNum(BoundaryGroups.Num());
+
+    TArray<uint32> GeometrySignature;
+    GeometrySignature.Reserve(8 + BoundaryGroups.Num() * 2);
+    GeometrySignature.Add(static_cast<uint32>(OverlayMode));
+    GeometrySignature.Add(GetTypeHash(RadiusUE));
+    GeometrySignature.Add(static_cast<uint32>(TopologyVersion));
+    GeometrySignature.Add(static_cast<uint32>(RenderVertices.Num()));
+    GeometrySignature.Add(static_cast<uint32>(AssignmentHash));
+    GeometrySignature.Add(static_cast<uint32>(AssignmentHash >> 32));
+
+    for (int32 GroupIdx = 0; GroupIdx < BoundaryGroups.Num(); ++GroupIdx)
+    {
+        const FPlateBoundary* Boundary = Boundaries.Find(BoundaryGroups[GroupIdx].PlateKey);
+        FBoundaryStyle& Style = GroupStyles[GroupIdx];
+        Style.Color = GetBoundaryColor(
+            Boundary ? Boundary->BoundaryType : EBoundaryType::Transform,
+            Boundary ? Boundary->BoundaryState : EBoundaryState::Nascent);
+        Style.HalfWidthUE = bSimplifiedMode
+            ? SimplifiedHalfWidthUE
+            : FMath::Max(ComputeHalfWidthUE(Boundary ? Boundary->AccumulatedStress : 0.0, Boundary ? Boundary->RiftWidthMeters : 0.0), BaseHalfWidthUE);
+
+        GeometrySignature.Add(Style.Color.DWColor());
+        GeometrySignature.Add(GetTypeHash(Style.HalfWidthUE));
+    }
+
+    // Same seams drawn the same way: the uploaded section is still current.
+    const uint64 GeometryHash = CityHash64(reinterpret_cast<const char*>(GeometrySignature.GetData()), GeometrySignature.Num() * sizeof(uint32));
+    if (bBoundaryOverlayInitialized && GeometryHash == BoundaryOverlayGeometryHash)
+    {
+        ++BoundaryOverlaySkippedUploads;
+        return;
+    }
+
     RealtimeMesh::FRealtimeMeshStreamSet OverlayStreams;
     TRealtimeMeshBuilderLocal<uint32, FPackedNormal, FVector2DHalf, 1> Builder(OverlayStreams);
     Builder.EnableTangents();
@@ -259,7 +233,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
     int32 TriangleCount = 0;
     int32 SegmentCount = 0;
 
-    auto AddRibbonSegment = [&](int32 VStart, int32 VEnd, const FBoundaryEdge& Edge)
+    auto AddRibbonSegment = [&](int32 VStart, int32 VEnd, const FBoundaryStyle& Style)
     {
         if (VStart == VEnd)
         {
@@ -301,9 +275,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
         const FVector3d Base1 = Pos1 * static_cast<double>(RadiusUE);
         const double SegmentLengthUE = (Base1 - Base0).Length();
 
-        float HalfWidthUE = bSimplifiedMode
-            ? SimplifiedHalfWidthUE
-            : FMath::Max(ComputeHalfWidthUE(Edge.Stress, Edge.RiftWidth), BaseHalfWidthUE);
+        float HalfWidthUE = Style.HalfWidthUE;
 
         if (SegmentLengthUE > KINDA_SMALL_NUMBER)
         {
@@ -327,7 +299,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
 
         const FVector3f Normal = FVector3f(FaceNormal);
         const FVector3f Tangent = FVector3f(EdgeDirection);
-        const FColor OverlayColor = GetBoundaryColor(Edge.BoundaryType, Edge.BoundaryState, Edge.Stress);
+        const FColor OverlayColor = Style.Color;
 
         const int32 V0Index = Builder.AddVertex(FVector3f(P0))
             .SetNormalAndTangent(Normal, Tangent)
@@ -358,11 +330,9 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
     };
 
     // Continuous ribbon strip for simplified mode - renders entire polyline as connected strip
-    auto AddRibbonStrip = [&](const FBoundaryPolyline& Polyline)
+    auto AddRibbonStrip = [&](const FBoundaryOverlayPolyline& Polyline, const FBoundaryStyle& Style)
     {
         const TArray<int32>& PolylineVertices = Polyline.Vertices;
-        const TArray<FBoundaryEdge>& SegmentEdges = Polyline.Segments;
-        const FBoundaryEdge& Representative = Polyline.Representative;
 
         if (PolylineVertices.Num() < 2)
         {
@@ -384,7 +354,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
             }
         }
 
-        const float HalfWidthUE = SimplifiedHalfWidthUE;
+        const float HalfWidthUE = Style.HalfWidthUE;
 
         struct FRibbonVertexData
         {
@@ -485,15 +455,7 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
                 break;
             }
 
-            const int32 SegmentIndex = SegmentEdges.Num() > 0
-                ? FMath::Clamp(i, 0, SegmentEdges.Num() - 1)
-                : 0;
-
-            const FBoundaryEdge& SegmentEdge = SegmentEdges.IsValidIndex(SegmentIndex)
-                ? SegmentEdges[SegmentIndex]
-                : Representative;
-
-            const FColor OverlayColor = GetBoundaryColor(SegmentEdge.BoundaryType, SegmentEdge.BoundaryState, SegmentEdge.Stress);
+            const FColor OverlayColor = Style.Color;
 
             const FVector3d NormalOffset = FaceNormal * static_cast<double>(OverlayOffsetUE);
             const FVector3d WidthOffset = RibbonRight * static_cast<double>(HalfWidthUE);
@@ -559,152 +521,47 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
         ++SegmentCount;
     };
 
-    if (OverlayMode == 1)
+    if (bSimplifiedMode)
     {
-        TArray<FBoundaryPolyline> Polylines;
-
-        for (const TPair<TPair<int32, int32>, TArray<FBoundaryEdge>>& Entry : BoundaryMap)
+        // Render each traced polyline as a continuous ribbon strip for smooth connected appearance
+        for (int32 GroupIdx = 0; GroupIdx < BoundaryGroups.Num(); ++GroupIdx)
         {
-            const TArray<FBoundaryEdge>& EdgesForBoundary = Entry.Value;
-            if (EdgesForBoundary.Num() == 0)
-            {
-                continue;
-            }
-
-            TMap<int32, TArray<int32>> Adjacency;
-            TSet<FIntPoint> RemainingEdges;
-
-            for (const FBoundaryEdge& Edge : EdgesForBoundary)
-            {
-                Adjacency.FindOrAdd(Edge.V0).Add(Edge.V1);
-                Adjacency.FindOrAdd(Edge.V1).Add(Edge.V0);
-                RemainingEdges.Add(SortedEdgeKey(Edge.V0, Edge.V1));
-            }
-
-            int32 BranchVertex = INDEX_NONE;
-            int32 BranchDegree = 0;
-            if (PlanetaryCreation::OverlayDiagnostics::DetectNonManifoldAdjacency(Adjacency, BranchVertex, BranchDegree))
+            const FBoundaryOverlayGroup& Group = BoundaryGroups[GroupIdx];
+            if (Group.BranchVertex != INDEX_NONE)
             {
                 if (GHighResBoundarySimplifierBranchWarnings < GHighResBoundarySimplifierMaxWarnings)
                 {
                     ++GHighResBoundarySimplifierBranchWarnings;
                     UE_LOG(LogPlanetaryCreation, Warning,
                         TEXT("[HighResBoundary] Simplified overlay fallback for boundary %d/%d due to branching vertex %d (degree %d). Using detailed ribbons."),
-                        Entry.Key.Key,
-                        Entry.Key.Value,
-                        BranchVertex,
-                        BranchDegree);
+                        Group.PlateKey.Key,
+                        Group.PlateKey.Value,
+                        Group.BranchVertex,
+                        Group.BranchDegree);
                 }
 
-                for (const FBoundaryEdge& Edge : EdgesForBoundary)
+                for (int32 EdgeIdx = Group.FirstEdge; EdgeIdx < Group.FirstEdge + Group.NumEdges; ++EdgeIdx)
                 {
-                    AddRibbonSegment(Edge.V0, Edge.V1, Edge);
+                    AddRibbonSegment(BoundaryEdges[EdgeIdx].V0, BoundaryEdges[EdgeIdx].V1, GroupStyles[GroupIdx]);
                 }
                 continue;
             }
 
-            // Trace polylines from remaining edges
-            // Each iteration builds one polyline chain or loop
-            while (RemainingEdges.Num() > 0)
-            {
-                // Pick any remaining edge as starting point
-                const FIntPoint FirstEdge = *RemainingEdges.CreateConstIterator();
-                RemainingEdges.Remove(FirstEdge);
-
-                FBoundaryPolyline Polyline;
-                Polyline.Vertices.Add(FirstEdge.X);
-                Polyline.Vertices.Add(FirstEdge.Y);
-
-                if (const FBoundaryEdge* FirstEdgeData = EdgeLookup.Find(FirstEdge))
-                {
-                    Polyline.Representative = *FirstEdgeData;
-                    Polyline.Segments.Add(*FirstEdgeData);
-                }
-                else
-                {
-                    Polyline.Representative = EdgesForBoundary[0];
-                    Polyline.Segments.Add(Polyline.Representative);
-                }
-
-                // Try to extend the polyline in both directions
-                for (int32 Direction = 0; Direction < 2; ++Direction)
-                {
-                    bool bExtended = true;
-                    while (bExtended)
-                    {
-                        bExtended = false;
-
-                        // Get the endpoint we're trying to extend from
-                        const int32 EndpointIdx = (Direction == 0) ? 0 : Polyline.Vertices.Num() - 1;
-                        const int32 Endpoint = Polyline.Vertices[EndpointIdx];
-
-                        // Look for an edge connected to this endpoint
-                        const TArray<int32>* Neighbors = Adjacency.Find(Endpoint);
-                        if (!Neighbors)
-                        {
-                            continue;
-                        }
-
-                        for (int32 Neighbor : *Neighbors)
-                        {
-                            const FIntPoint EdgeKey = SortedEdgeKey(Endpoint, Neighbor);
-                            if (RemainingEdges.Contains(EdgeKey))
-                            {
-                                // Found an edge to extend with
-                                RemainingEdges.Remove(EdgeKey);
-
-                                if (Direction == 0)
-                                {
-                                    // Extending from the front
-                                    Polyline.Vertices.Insert(Neighbor, 0);
-                                    if (const FBoundaryEdge* EdgeData = EdgeLookup.Find(EdgeKey))
-                                    {
-                                        Polyline.Segments.Insert(*EdgeData, 0);
-                                    }
-                                    else
-                                    {
-                                        Polyline.Segments.Insert(Polyline.Representative, 0);
-                                    }
-                                }
-                                else
-                                {
-                                    // Extending from the back
-                                    Polyline.Vertices.Add(Neighbor);
-                                    if (const FBoundaryEdge* EdgeData = EdgeLookup.Find(EdgeKey))
-                                    {
-                                        Polyline.Segments.Add(*EdgeData);
-                                    }
-                                    else
-                                    {
-                                        Polyline.Segments.Add(Polyline.Representative);
-                                    }
-                                }
-
-                                bExtended = true;
-                                break; // Found one edge, continue extending
-                            }
-                        }
-                    }
-                }
-
-                if (Polyline.Vertices.Num() >= 2)
-                {
-                    Polylines.Add(MoveTemp(Polyline));
-                }
-            }
-        }
-
-            // Render each polyline as a continuous ribbon strip for smooth connected appearance
-            for (const FBoundaryPolyline& Polyline : Polylines)
+            for (const FBoundaryOverlayPolyline& Polyline : Group.Polylines)
             {
-                AddRibbonStrip(Polyline);
+                AddRibbonStrip(Polyline, GroupStyles[GroupIdx]);
             }
         }
+    }
     else
     {
-        for (const FBoundaryEdge& Edge : BoundaryEdges)
+        for (int32 GroupIdx = 0; GroupIdx < BoundaryGroups.Num(); ++GroupIdx)
         {
-            AddRibbonSegment(Edge.V0, Edge.V1, Edge);
+            const FBoundaryOverlayGroup& Group = BoundaryGroups[GroupIdx];
+            for (int32 EdgeIdx = Group.FirstEdge; EdgeIdx < Group.FirstEdge + Group.NumEdges; ++EdgeIdx)
+            {
+                AddRibbonSegment(BoundaryEdges[EdgeIdx].V0, BoundaryEdges[EdgeIdx].V1, GroupStyles[GroupIdx]);
+            }
         }
     }
 
@@ -737,6 +594,8 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
     const FRealtimeMeshStreamRange Range(0, VertexCount, 0, TriangleCount * 3);
     Mesh->UpdateSectionRange(OverlaySectionKey, Range);
     Mesh->SetSectionVisibility(OverlaySectionKey, true);
+    BoundaryOverlayGeometryHash = GeometryHash;
+    ++BoundaryOverlayUploads;
 
     if (OverlayMode == 1)
     {
@@ -748,3 +607,17 @@ void FTectonicSimulationController::DrawHighResolutionBoundaryOverlay()
     }
 #endif
 }
+
+void FTectonicSimulationController::GetBoundaryOverlayStats(FBoundaryOverlayStats& OutStats) const
+{
+    OutStats = FBoundaryOverlayStats();
+    OutStats.EdgeCount = BoundaryOverlaySet.Edges.Num();
+    OutStats.BoundaryCount = BoundaryOverlaySet.Groups.Num();
+    for (const FBoundaryOverlayGroup& Group : BoundaryOverlaySet.Groups)
+    {
+        OutStats.PolylineCount += Group.Polylines.Num();
+    }
+    OutStats.SetBuilds = BoundaryOverlaySetBuilds;
+    OutStats.Uploads = BoundaryOverlayUploads;
+    OutStats.SkippedUploads = BoundaryOverlaySkippedUploads;
+}
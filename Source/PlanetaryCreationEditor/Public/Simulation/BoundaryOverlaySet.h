@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// BoundaryOverlaySet.h
+// Render mesh seams between plates for the high-resolution boundary overlay: every render edge whose endpoints belong
+// to different plates, grouped per plate pair and traced into polylines. The set depends only on topology and plate
+// assignments, so the controller rebuilds it when TopologyVersion or the assignment fingerprint changes and otherwise
+// reuses it across overlay redraws.
+
+/** Render edge on a plate seam (V0 < V1). */
+struct FBoundaryOverlayEdge
+{
+    int32 V0 = INDEX_NONE;
+    int32 V1 = INDEX_NONE;
+};
+
+struct FBoundaryOverlayPolyline
+{
+    TArray<int32> Vertices;
+    bool bClosed = false;
+};
+
+/** Seam edges shared by one plate pair. */
+struct FBoundaryOverlayGroup
+{
+    /** (lower plate ID, higher plate ID), the service boundary map key. */
+    TPair<int32, int32> PlateKey;
+    int32 FirstEdge = 0;
+    int32 NumEdges = 0;
+
+    /** Chains and loops for the simplified overlay; empty when the seam branches. */
+    TArray<FBoundaryOverlayPolyline> Polylines;
+    int32 BranchVertex = INDEX_NONE;
+    int32 BranchDegree = 0;
+};
+
+struct PLANETARYCREATIONEDITOR_API FBoundaryOverlaySet
+{
+    int32 TopologyVersion = INDEX_NONE;
+    int32 VertexCount = 0;
+    int32 TriangleCount = 0;
+    uint64 AssignmentHash = 0;
+
+    /** Seam edges ordered by plate pair, then by vertex; each group owns a contiguous range. */
+    TArray<FBoundaryOverlayEdge> Edges;
+    TArray<FBoundaryOverlayGroup> Groups;
+
+    bool Matches(int32 InTopologyVersion, int32 InVertexCount, int32 InTriangleCount, uint64 InAssignmentHash) const
+    {
+        return TopologyVersion == InTopologyVersion && VertexCount == InVertexCount &&
+            TriangleCount == InTriangleCount && AssignmentHash == InAssignmentHash;
+    }
+
+    void Reset();
+
+    /** Fingerprint of the vertex -> plate assignments (stands in for a serial; assignments are written in many places). */
+    static uint64 HashAssignments(const TArray<int32>& VertexPlateAssignments);
+
+    /**
+     * Extract seams in one parallel pass over the render vertex CSR adjacency (rebuilt from RenderTriangles when the
+     * CSR does not match the vertex count), then group and trace them per plate pair.
+     */
+    void Build(int32 InTopologyVersion, const TArray<int32>& AdjacencyOffsets, const TArray<int32>& Adjacency,
+        const TArray<int32>& RenderTriangles, const TArray<int32>& VertexPlateAssignments, uint64 InAssignmentHash);
+};
@@ -12,6 +12,12 @@ namespace Collision
         int32 CarrierPlateId = INDEX_NONE;
         int32 TargetPlateId = INDEX_NONE;
         double PeakGuardrail_m = 0.0; // 0 disables guardrail
+
+        // Surge region precomputed by DetectCollisions (BuildAffectedRegion): vertices within RadiusRad of CenterUnit
+        // in ascending order, and the smallest dot(P, CenterUnit) among them, where the quartic reaches zero.
+        double RadiusRad = 0.0;
+        TArray<int32> AffectedVertexIndices;
+        double AffectedMinDot = 1.0;
     };
 
     struct PLANETARYCREATIONEDITOR_API FCollisionMetrics
@@ -21,7 +27,8 @@ namespace Collision
         double ApplyMs = 0.0;
     };
 
-    // Detection is deterministic. Uses Boundary (Phase 3 results) to find continental-continental convergences.
+    // Detection is deterministic. Uses Boundary (Phase 3 results) to find continental-continental convergences; each
+    // event carries its surge radius and affected region (flood fill over the CSR adjacency, capped at CollisionDistance_km).
     PLANETARYCREATIONEDITOR_API bool DetectCollisions(
         const TArray<FVector3d>& Points,
         const TArray<int32>& PlateIdPerVertex,
@@ -32,6 +39,22 @@ namespace Collision
         const BoundaryField::FBoundaryFieldResults& Boundary,
         TArray<FCollisionEvent>& OutEvents);
 
+    // Bounded flood fill over CSR adjacency from SeedVertex, keeping vertices with dot(P, CenterUnit) >= cos(RadiusRad).
+    // Fills Event.AffectedVertexIndices (ascending) and Event.AffectedMinDot.
+    PLANETARYCREATIONEDITOR_API void BuildAffectedRegion(
+        const TArray<FVector3d>& Points,
+        const TArray<int32>& CSR_Offsets,
+        const TArray<int32>& CSR_Adj,
+        int32 SeedVertex,
+        FCollisionEvent& InOutEvent);
+
+    // Apply quartic collision surge once to the event's precomputed region in one parallel pass. Optionally set radial folds.
+    PLANETARYCREATIONEDITOR_API FCollisionMetrics ApplyCollisionSurge(
+        const TArray<FVector3d>& Points,
+        const FCollisionEvent& Event,
+        TArray<double>& InOutElevation_m,
+        TArray<FVector3d>* InOutFoldVectorsOrNull);
+
     // Apply quartic collision surge once to affected vertices. Optionally set radial folds.
     PLANETARYCREATIONEDITOR_API FCollisionMetrics ApplyCollisionSurge(
         const TArray<FVector3d>& Points,
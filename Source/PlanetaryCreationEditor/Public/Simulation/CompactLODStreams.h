@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// CompactLODStreams.h
+// Quantized storage for LOD cache entries that are not on screen. Positions become an octahedral unit direction plus a
+// half-float radial offset, normals/tangents are octahedral snorm16, UVs and Stage B heights are half floats, and the
+// index buffer drops to uint16 when the vertex count allows. Cold entries can additionally be run through the
+// MeshOptimizer vertex/index codecs.
+
+/** One quantized preview vertex (24 bytes; the float SoA layout is 56 bytes per vertex including the source index). */
+struct FCompactLODVertex
+{
+    int16 Direction[2] = { 0, 0 };
+    int16 Normal[2] = { 0, 0 };
+    int16 Tangent[2] = { 0, 0 };
+    /** Half-float radial offset from the base radius, in meters. */
+    uint16 RadialOffset = 0;
+    /** Half-float Stage B amplified height, in meters. */
+    uint16 AmplifiedHeight = 0;
+    uint16 UV[2] = { 0, 0 };
+    FColor Color = FColor::Black;
+};
+static_assert(sizeof(FCompactLODVertex) == 24, "MeshOptimizer vertex codec expects a 4-byte multiple stride");
+
+struct PLANETARYCREATIONEDITOR_API FCompactLODStreams
+{
+    int32 VertexCount = 0;
+    int32 IndexCount = 0;
+
+    /** Radius (UE units) the radial offsets are measured from, and UE units per stored meter. */
+    float BaseRadius = 0.0f;
+    float HeightUnit = 1.0f;
+
+    TArray<FCompactLODVertex> Vertices;
+    TArray<uint16> Indices16;
+    TArray<uint32> Indices32;
+
+    /** Source indices are identity for the first IdentitySourceCount vertices; only the seam tail is stored. */
+    int32 IdentitySourceCount = 0;
+    TArray<int32> SeamSourceIndices;
+
+    /** MeshOptimizer codec payloads (Vertices/Indices* are empty while encoded). */
+    TArray<uint8> EncodedVertices;
+    TArray<uint8> EncodedIndices;
+
+    bool IsValid() const { return VertexCount > 0; }
+    bool IsEncoded() const { return EncodedVertices.Num() > 0; }
+
+    void Reset();
+    SIZE_T GetAllocatedSize() const;
+
+    /** Quantize float SoA streams. Returns false (leaving this empty) when the stream sizes disagree. */
+    bool Quantize(float InBaseRadius, float InHeightUnit,
+        const TArray<float>& PositionX, const TArray<float>& PositionY, const TArray<float>& PositionZ,
+        const TArray<float>& NormalX, const TArray<float>& NormalY, const TArray<float>& NormalZ,
+        const TArray<float>& TangentX, const TArray<float>& TangentY, const TArray<float>& TangentZ,
+        const TArray<FColor>& Colors, const TArray<FVector2f>& UVs, const TArray<float>& AmplifiedHeights,
+        const TArray<uint32>& Indices, const TArray<int32>& SourceIndices);
+
+    /** Compress the quantized vertex and index arrays with the MeshOptimizer codecs. */
+    bool Encode();
+
+    /** Restore float SoA streams (decoding first if needed). */
+    bool Dequantize(
+        TArray<float>& PositionX, TArray<float>& PositionY, TArray<float>& PositionZ,
+        TArray<float>& NormalX, TArray<float>& NormalY, TArray<float>& NormalZ,
+        TArray<float>& TangentX, TArray<float>& TangentY, TArray<float>& TangentZ,
+        TArray<FColor>& Colors, TArray<FVector2f>& UVs, TArray<float>& AmplifiedHeights,
+        TArray<uint32>& Indices, TArray<int32>& SourceIndices) const;
+};
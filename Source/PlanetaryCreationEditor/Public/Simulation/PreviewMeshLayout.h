@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// PreviewMeshLayout.h
+// Triangle and vertex order for the seam-split preview mesh, optimized with MeshOptimizer for the GPU post-transform
+// cache (vcacheoptimizer) and vertex fetch locality (vfetchoptimizer). The layout depends only on topology, so the
+// controller builds it once per LOD/TopologyVersion and every later mesh build writes its streams in this order.
+
+/** Software-simulated cache metrics for an index buffer (no GPU required). */
+struct FPreviewIndexMetrics
+{
+    /** Average cache miss ratio: transformed vertices per triangle (0.5 is ideal for large grids, 3 is worst). */
+    double ACMR = 0.0;
+    /** Average transformed vertex ratio: transformed vertices per unique vertex (1 is ideal). */
+    double ATVR = 0.0;
+    /** Bytes fetched over vertex buffer size (1 is ideal). */
+    double Overfetch = 0.0;
+};
+
+struct PLANETARYCREATIONEDITOR_API FPreviewMeshLayout
+{
+    /** Size of one preview vertex on the GPU: float3 position, packed tangent frame, half2 UV, color. */
+    static constexpr int32 GPUVertexStride = 28;
+
+    int32 SourceVertexCount = 0;
+    int32 VertexCount = 0;
+
+    /** Optimized index buffer in final vertex numbering. */
+    TArray<uint32> Indices;
+
+    /** Final vertex -> vertex in build order (source vertices followed by seam duplicates). */
+    TArray<int32> NewToBuild;
+
+    FPreviewIndexMetrics BaselineMetrics;
+    FPreviewIndexMetrics OptimizedMetrics;
+
+    bool Matches(int32 InSourceVertexCount, int32 InVertexCount, int32 InIndexCount) const
+    {
+        return VertexCount > 0 && SourceVertexCount == InSourceVertexCount && VertexCount == InVertexCount &&
+            Indices.Num() == InIndexCount && NewToBuild.Num() == InVertexCount;
+    }
+
+    void Reset();
+
+    /** Optimize BuildOrderIndices (triangle list over InVertexCount build-order vertices). */
+    void Build(const TArray<uint32>& BuildOrderIndices, int32 InSourceVertexCount, int32 InVertexCount);
+
+    static FPreviewIndexMetrics Analyze(TConstArrayView<uint32> Indices, int32 VertexCount);
+};
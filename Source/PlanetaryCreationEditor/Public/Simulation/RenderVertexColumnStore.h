@@ -0,0 +1,169 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+// RenderVertexColumnStore.h
+// Registry + bulk compact/permute/snapshot for per-render-vertex state columns. The store does not own storage: the
+// service keeps its TArrays (default allocator, no alignment guarantee) and the store holds views over them, knows
+// each column's type and role, and runs the whole-mesh operations over all of them in one parallel pass instead of
+// field-by-field copies. Only snapshot blobs are 64-byte aligned.
+
+/** Storage type of a registered column. */
+enum class ERenderVertexColumnType : uint8
+{
+    Double,
+    Float,
+    Int32,
+    Vector3d,
+    Vector3f,
+    Byte,
+    Struct
+};
+
+enum class ERenderVertexColumnFlags : uint8
+{
+    None = 0,
+    /** Column follows render-vertex topology edits (compact/permute). */
+    Topology = 1 << 0,
+    /** Column is captured in undo/redo history snapshots. */
+    History = 1 << 1,
+    /** When not vertex-sized during compaction, resize (zero-filling) to the new count instead of resetting. */
+    KeepSized = 1 << 2
+};
+ENUM_CLASS_FLAGS(ERenderVertexColumnFlags);
+
+template <typename T>
+struct TRenderVertexColumnType
+{
+    static constexpr ERenderVertexColumnType Value = (sizeof(T) == 1) ? ERenderVertexColumnType::Byte : ERenderVertexColumnType::Struct;
+};
+template <> struct TRenderVertexColumnType<double> { static constexpr ERenderVertexColumnType Value = ERenderVertexColumnType::Double; };
+template <> struct TRenderVertexColumnType<float> { static constexpr ERenderVertexColumnType Value = ERenderVertexColumnType::Float; };
+template <> struct TRenderVertexColumnType<int32> { static constexpr ERenderVertexColumnType Value = ERenderVertexColumnType::Int32; };
+template <> struct TRenderVertexColumnType<FVector3d> { static constexpr ERenderVertexColumnType Value = ERenderVertexColumnType::Vector3d; };
+template <> struct TRenderVertexColumnType<FVector3f> { static constexpr ERenderVertexColumnType Value = ERenderVertexColumnType::Vector3f; };
+
+/** Type-erased copy of a set of columns; each column blob is 64-byte aligned. */
+struct PLANETARYCREATIONEDITOR_API FRenderVertexColumnSnapshot
+{
+    struct FColumnBlob
+    {
+        FName Name;
+        int32 Num = 0;
+        int32 ElementSize = 0;
+        TArray<uint8, TAlignedHeapAllocator<64>> Bytes;
+    };
+
+    TArray<FColumnBlob> Columns;
+
+    /** Primary column (render vertex) count at capture time. */
+    int32 VertexCount = 0;
+
+    void Reset()
+    {
+        Columns.Reset();
+        VertexCount = 0;
+    }
+
+    SIZE_T GetAllocatedSize() const;
+};
+
+class PLANETARYCREATIONEDITOR_API FRenderVertexColumnStore
+{
+public:
+    using FColumnId = int32;
+
+    /** Register an owner array. The array must outlive the store and keep a stable address. */
+    template <typename T>
+    FColumnId RegisterColumn(FName Name, TArray<T>& Array, ERenderVertexColumnFlags Flags)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Render vertex columns are copied as raw bytes");
+
+        FColumn& Column = Columns.AddDefaulted_GetRef();
+        Column.Name = Name;
+        Column.Type = TRenderVertexColumnType<T>::Value;
+        Column.Flags = Flags;
+        Column.ElementSize = sizeof(T);
+        Column.Array = &Array;
+        Column.Ops = &GetColumnOps<T>();
+        Column.Version = ++VersionCounter;
+        return Columns.Num() - 1;
+    }
+
+    /** The primary column defines the vertex count (render vertex positions). */
+    void SetPrimaryColumn(FColumnId ColumnId) { PrimaryColumn = ColumnId; }
+
+    void Reset()
+    {
+        Columns.Reset();
+        PrimaryColumn = INDEX_NONE;
+    }
+
+    int32 Num() const;
+    int32 NumColumns() const { return Columns.Num(); }
+    FName GetColumnName(FColumnId ColumnId) const { return Columns[ColumnId].Name; }
+    ERenderVertexColumnType GetColumnType(FColumnId ColumnId) const { return Columns[ColumnId].Type; }
+
+    /**
+     * Column versions. Bulk operations bump every column they write. Writers outside the store only mark the
+     * render position column today (it keys the float position SoA and the thermal source grid); other columns'
+     * versions move only with bulk operations.
+     */
+    uint64 GetColumnVersion(FColumnId ColumnId) const { return Columns[ColumnId].Version; }
+    void MarkColumnChanged(FColumnId ColumnId) { Columns[ColumnId].Version = ++VersionCounter; }
+    void MarkAllColumnsChanged();
+
+    /**
+     * Remove flagged vertices from every Topology column. Columns that are not vertex-sized are reset (or
+     * resized to the new count when KeepSized). Returns the new vertex count.
+     */
+    int32 Compact(const TBitArray<>& RemovalMask, TArray<int32>& OutOldToNew);
+
+    /** Reorder every vertex-sized Topology column so that new index I reads old index NewToOld[I]. */
+    void Permute(TConstArrayView<int32> NewToOld);
+
+    /** Copy every column carrying RequiredFlags. */
+    void CaptureSnapshot(FRenderVertexColumnSnapshot& OutSnapshot, ERenderVertexColumnFlags RequiredFlags) const;
+
+    /** Restore the columns present in the snapshot (matched by name); other columns are left untouched. */
+    void RestoreSnapshot(const FRenderVertexColumnSnapshot& Snapshot);
+
+private:
+    struct FColumnOps
+    {
+        int32 (*Num)(const void* Array);
+        void (*SetNumUninitialized)(void* Array, int32 NewNum);
+        void (*SetNumZeroed)(void* Array, int32 NewNum);
+        void (*Reset)(void* Array);
+        uint8* (*Data)(void* Array);
+    };
+
+    struct FColumn
+    {
+        FName Name;
+        ERenderVertexColumnType Type = ERenderVertexColumnType::Struct;
+        ERenderVertexColumnFlags Flags = ERenderVertexColumnFlags::None;
+        int32 ElementSize = 0;
+        void* Array = nullptr;
+        const FColumnOps* Ops = nullptr;
+        uint64 Version = 0;
+    };
+
+    template <typename T>
+    static const FColumnOps& GetColumnOps()
+    {
+        static const FColumnOps Ops = {
+            [](const void* Array) { return static_cast<const TArray<T>*>(Array)->Num(); },
+            [](void* Array, int32 NewNum) { static_cast<TArray<T>*>(Array)->SetNumUninitialized(NewNum); },
+            [](void* Array, int32 NewNum) { static_cast<TArray<T>*>(Array)->SetNumZeroed(NewNum); },
+            [](void* Array) { static_cast<TArray<T>*>(Array)->Reset(); },
+            [](void* Array) { return reinterpret_cast<uint8*>(static_cast<TArray<T>*>(Array)->GetData()); }
+        };
+        return Ops;
+    }
+
+    TArray<FColumn> Columns;
+    FColumnId PrimaryColumn = INDEX_NONE;
+    uint64 VersionCounter = 0;
+};
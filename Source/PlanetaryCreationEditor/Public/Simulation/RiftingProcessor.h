@@ -20,6 +20,23 @@ namespace Rifting
         double ApplyMs = 0.0;
     };
 
+    // Plate ID -> member vertex indices (ascending), built in one pass over the assignments and updated in place as
+    // plates rift, so per-plate work touches only that plate's vertices.
+    struct PLANETARYCREATIONEDITOR_API FPlateVertexMembership
+    {
+        TMap<int32, TArray<int32>> VerticesByPlate;
+        int32 MaxPlateId = INDEX_NONE;
+
+        void Build(const TArray<int32>& PlateIdPerVertex);
+
+        const TArray<int32>* Find(int32 PlateId) const { return VerticesByPlate.Find(PlateId); }
+        int32 Num(int32 PlateId) const
+        {
+            const TArray<int32>* Vertices = VerticesByPlate.Find(PlateId);
+            return Vertices ? Vertices->Num() : 0;
+        }
+    };
+
     // Evaluate whether a plate should rift this cadence based on a simple probabilistic model.
     PLANETARYCREATIONEDITOR_API bool EvaluateRiftingProbability(
         int32 PlateId,
@@ -29,6 +46,19 @@ namespace Rifting
         double A0_km2,
         FRiftingEvent& OutEvent);
 
+    // Perform a plate split into FragmentCount fragments, updating assignments and membership in place and producing
+    // per-fragment drift directions and centroids (zero for an empty fragment). Fragment assignment and centroid sums
+    // run in one parallel pass over fixed vertex chunks, so results depend only on Event.Seed and the inputs.
+    PLANETARYCREATIONEDITOR_API bool PerformRifting(
+        const FRiftingEvent& Event,
+        const TArray<FVector3d>& Points,
+        FPlateVertexMembership& InOutMembership,
+        TArray<int32>& InOutPlateIdPerVertex,
+        TArray<FVector3d>& OutFragmentDriftDirections,
+        TArray<FVector3d>& OutFragmentCentroids,
+        FRiftingMetrics& InOutMetrics,
+        TArray<TPair<int32,double>>* OutFragmentPlateRatiosOrNull = nullptr);
+
     // Perform a plate split into FragmentCount fragments, updating assignments and producing per-fragment drift.
     PLANETARYCREATIONEDITOR_API bool PerformRifting(
         const FRiftingEvent& Event,
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// StaticLODData.h
+// Per-vertex preview data that depends only on render vertex positions (unit normal, equirectangular UV, tangent).
+// Entries are identified by the vertex set itself (a hash over per-vertex position hashes) rather than by
+// TopologyVersion, so plate split/merge reuses them untouched and terrane surgery (CompactRenderVertexData /
+// AppendRenderVertexFromRecord) patches only vertices that were added. Pure icosphere levels persist to disk.
+
+struct PLANETARYCREATIONEDITOR_API FStaticLODVertexData
+{
+    TArray<FVector3f> UnitNormals;
+    TArray<FVector2f> UVs;
+    TArray<FVector3f> TangentX;
+
+    /** Position hash per vertex; lets a later vertex set find the vertices it shares with this one. */
+    TArray<uint64> VertexHashes;
+
+    /** Identity of the vertex set (order-sensitive fold of VertexHashes). */
+    uint64 VertexSetHash = 0;
+
+    int32 Num() const { return UVs.Num(); }
+
+    /** Hash every position and fold them into the vertex set hash. */
+    static void HashVertexSet(const TArray<FVector3d>& RenderVertices, TArray<uint64>& OutVertexHashes, uint64& OutVertexSetHash);
+
+    /** Icosphere vertex count for a render subdivision level (10 * 4^L + 2). */
+    static int32 GetIcosphereVertexCount(int32 LODLevel);
+
+    /**
+     * Fill the streams for RenderVertices (hashes from HashVertexSet are adopted). Vertices whose position hash
+     * appears in Base are copied from it; the rest are evaluated, preferring the optional float SoA normals.
+     * Returns the number of vertices copied from Base.
+     */
+    int32 Build(const TArray<FVector3d>& RenderVertices, TArray<uint64>&& InVertexHashes, uint64 InVertexSetHash,
+        const FStaticLODVertexData* Base,
+        const TArray<float>* SoANormalX, const TArray<float>* SoANormalY, const TArray<float>* SoANormalZ);
+
+    /** Disk cache under Saved/PlanetaryCreation/StaticLODCache, keyed by level and vertex set hash (hashes are not stored). */
+    bool LoadFromDisk(int32 LODLevel, uint64 ExpectedVertexSetHash, int32 ExpectedVertexCount);
+    bool SaveToDisk(int32 LODLevel) const;
+    static FString GetDiskCachePath(int32 LODLevel, uint64 InVertexSetHash);
+
+    SIZE_T GetAllocatedSize() const
+    {
+        return UnitNormals.GetAllocatedSize() + UVs.GetAllocatedSize() + TangentX.GetAllocatedSize() + VertexHashes.GetAllocatedSize();
+    }
+};
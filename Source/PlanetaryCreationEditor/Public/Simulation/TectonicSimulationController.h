@@ -4,9 +4,18 @@
 #include "RealtimeMeshComponent/Public/Interface/Core/RealtimeMeshDataStream.h"
 #include "UI/OrbitCameraController.h"
 #include "Simulation/TectonicSimulationService.h"
+#include "Simulation/CompactLODStreams.h"
+#include "Simulation/PreviewMeshLayout.h"
+#include "Simulation/StaticLODData.h"
+#include "Simulation/BoundaryOverlaySet.h"
+#include "Simulation/VelocityFieldGlyphs.h"
+#include "Containers/Ticker.h"
 #include "UObject/StrongObjectPtr.h"
 
 class UTectonicSimulationService;
+class FTectonicSimulationWorker;
+struct FTectonicSimulationFrame;
+struct FTectonicSimulationUIState;
 class UTexture2D;
 class UMaterial;
 class UMaterialInstanceDynamic;
@@ -44,6 +53,21 @@ struct FMeshBuildSnapshot
 
     /** Profiling data captured for the most recent Stage B amplification pass. */
     FStageBProfile StageBProfile;
+
+    /**
+     * Allow mesh builds to read the service's cached render SoA (normals/tangents).
+     * Cleared for worker frames: the service may already be advancing the next step when they are meshed.
+     */
+    bool bAllowServiceSoA = true;
+
+    /** Bytes held by the snapshot's per-vertex arrays. */
+    SIZE_T GetAllocatedSize() const
+    {
+        return RenderVertices.GetAllocatedSize() + RenderTriangles.GetAllocatedSize() +
+            VertexPlateAssignments.GetAllocatedSize() + VertexVelocities.GetAllocatedSize() +
+            VertexStressValues.GetAllocatedSize() + VertexElevationValues.GetAllocatedSize() +
+            VertexAmplifiedElevation.GetAllocatedSize();
+    }
 };
 
 /** Milestone 4 Phase 4.2: Cached LOD mesh snapshot (snapshot of simulation state, not StreamSet). */
@@ -54,7 +78,7 @@ struct FCachedLODMesh
     int32 TriangleCount = 0;
     int32 TopologyVersion = 0;
     int32 SurfaceDataVersion = 0;
-    double CacheTimestamp = 0.0; // For LRU eviction if needed
+    double CacheTimestamp = 0.0; // Last use; least recently used unpinned entries are evicted first
 
     /** Precomputed vertex streams (SoA) captured after the initial build. */
     TArray<float> PositionX;
@@ -80,6 +104,86 @@ struct FCachedLODMesh
 
     /** Per-vertex amplified elevation (meters) replicated for seam duplicates. */
     TArray<float> AmplifiedHeights;
+
+    /** Quantized streams while the entry is cold; the float arrays above are empty while this is valid. */
+    FCompactLODStreams CompactStreams;
+
+    bool IsCompact() const { return CompactStreams.IsValid(); }
+
+    /** Move the float streams into CompactStreams (optionally MeshOptimizer-encoded). */
+    bool CompactFloatStreams(bool bEncode);
+
+    /** Restore the float streams from CompactStreams. */
+    bool ExpandFloatStreams();
+
+    /** Bytes held by the stream arrays (float or compact, whichever is resident). */
+    SIZE_T GetStreamAllocatedSize() const;
+
+    /** Bytes the float stream layout needs for this entry. */
+    SIZE_T GetExpandedStreamSize() const;
+
+    /** Bytes charged against the LOD cache budget (resident streams plus the embedded snapshot). */
+    SIZE_T GetBudgetedSize() const { return GetStreamAllocatedSize() + Snapshot.GetAllocatedSize(); }
+};
+
+/** LOD cache memory: resident stream bytes vs the same entries held as float streams, plus budget counters. */
+struct FLODCacheMemoryStats
+{
+    int32 CachedLODs = 0;
+    int32 CompactLODs = 0;
+    int64 ResidentBytes = 0;
+    int64 ExpandedBytes = 0;
+
+    /** Snapshot bytes embedded in the entries (counted against the budget with ResidentBytes). */
+    int64 SnapshotBytes = 0;
+    /** r.PlanetaryCreation.LODCacheBudgetMB in bytes (0 = unlimited). */
+    int64 BudgetBytes = 0;
+
+    int64 Hits = 0;
+    int64 Misses = 0;
+    int64 Evictions = 0;
+    int64 CancelledPrewarms = 0;
+};
+
+/** High-resolution boundary overlay: cached seam set and how often it was rebuilt or re-uploaded. */
+struct FBoundaryOverlayStats
+{
+    int32 EdgeCount = 0;
+    int32 BoundaryCount = 0;
+    int32 PolylineCount = 0;
+
+    int64 SetBuilds = 0;
+    int64 Uploads = 0;
+    int64 SkippedUploads = 0;
+};
+
+/** Velocity overlay: arrows currently sampled and how often they were rebuilt or resubmitted. */
+struct FVelocityFieldStats
+{
+    int32 ArrowCount = 0;
+    int32 CellsPerFaceEdge = 0;
+    int64 Builds = 0;
+    int64 Draws = 0;
+};
+
+/** Per-pass timings of the most recent BuildMeshFromSnapshot call. */
+struct FMeshBuildStats
+{
+    int32 LODLevel = INDEX_NONE;
+    int32 VertexCount = 0;
+    int32 TriangleCount = 0;
+    int32 SeamDuplicateCount = 0;
+    double SeamAllocationMs = 0.0;
+    double LayoutMs = 0.0;
+    double VertexStreamMs = 0.0;
+    double IndexStreamMs = 0.0;
+    double TotalMs = 0.0;
+
+    /** Whether the cached vertex-cache/fetch layout was applied, and whether it was reused from an earlier build. */
+    bool bOptimizedLayout = false;
+    bool bLayoutReused = false;
+    FPreviewIndexMetrics BaselineIndexMetrics;
+    FPreviewIndexMetrics OptimizedIndexMetrics;
 };
 
 /** Encapsulates higher-level control over the tectonic simulation and mesh conversion. */
@@ -146,6 +250,16 @@ public:
 
     /** Milestone 4 Phase 4.2: Get cache statistics for debugging. */
     void GetCacheStats(int32& OutCachedLODs, int32& OutTotalCacheSize) const;
+    void GetCacheStats(FLODCacheMemoryStats& OutStats) const;
+
+    /** Seam set and upload counters of the high-resolution boundary overlay. */
+    void GetBoundaryOverlayStats(FBoundaryOverlayStats& OutStats) const;
+
+    /** Arrow sampling and redraw counters of the velocity overlay. */
+    void GetVelocityFieldStats(FVelocityFieldStats& OutStats) const;
+
+    /** Timings of the most recent mesh stream build (seam allocation, vertex streams, index stream). */
+    FMeshBuildStats GetLastMeshBuildStats() const;
 
     /** Milestone 5 Task 1.2: Camera control methods. */
     void RotateCamera(float DeltaYaw, float DeltaPitch);
@@ -158,6 +272,34 @@ public:
     /** Milestone 3 Task 4.3: Create snapshot for async mesh build (public for testing). */
     FMeshBuildSnapshot CreateMeshBuildSnapshot() const;
 
+    /** Copy service render state into a snapshot (caller guarantees the service is not mid-step). */
+    static void CaptureMeshBuildSnapshot(const UTectonicSimulationService& Service, FMeshBuildSnapshot& OutSnapshot);
+
+    /** Most recent frame published by the simulation worker (null when the worker is disabled). */
+    TSharedPtr<FTectonicSimulationFrame, ESPMode::ThreadSafe> GetLatestSimulationFrame() const { return LatestSimulationFrame; }
+
+    /**
+     * True while the simulation worker owns the service (steps or edits queued or in flight). The worker mutates the
+     * live service, so while this is set, code outside the worker reads published frames or takes the state lock.
+     */
+    bool IsSimulationWorkerBusy() const;
+
+    /** True when steps are queued behind the batch currently being simulated. */
+    bool HasPendingSimulationSteps() const;
+
+    /**
+     * Run a service edit. With the worker idle (or disabled) it runs now under the state lock and, when it reports a
+     * change and bRebuildPreview is set, the preview is rebuilt; returns true. While the worker is busy the edit is
+     * queued in request order with the pending steps and the worker publishes a frame for it; returns false.
+     */
+    bool ApplySimulationMutation(TUniqueFunction<bool(UTectonicSimulationService&)>&& Mutation, bool bRebuildPreview = true);
+
+    /** UI-visible service state: the latest frame while the worker is busy, the live service otherwise. Returns false if neither is available. */
+    bool GetSimulationUIState(FTectonicSimulationUIState& OutState) const;
+
+    /** Drain and stop the simulation worker so the game thread owns the service; the next step restarts it if enabled. */
+    void ShutdownSimulationWorker();
+
 private:
     UTectonicSimulationService* GetService() const;
     void EnsurePreviewActor() const;
@@ -165,6 +307,14 @@ private:
     void BuildAndUpdateMesh();
     void DrawBoundaryLines();
 
+    /** Build a mesh for a snapshot that missed the LOD cache (sync for L0-2, async above). */
+    void DispatchMeshBuild(int32 RenderLevel, int32 TopologyVersion, int32 SurfaceDataVersion, FMeshBuildSnapshot&& Snapshot);
+
+    /** Simulation worker: start when r.PlanetaryCreation.SimulationWorker is set and the CPU preview path is active. */
+    bool EnsureSimulationWorker();
+    bool TickSimulationWorker(float DeltaTime);
+    void ApplySimulationFrame(FTectonicSimulationFrame& Frame);
+
     /** Milestone 4 Task 3.1: Draw high-resolution boundary overlay tracing render mesh seams. */
     void DrawHighResolutionBoundaryOverlay();
 
@@ -188,6 +338,22 @@ private:
     const FCachedLODMesh* GetCachedLOD(int32 LODLevel, int32 TopologyVersion, int32 SurfaceDataVersion) const;
     FCachedLODMesh* GetMutableCachedLOD(int32 LODLevel);
 
+    /** Expand the requested entry if it was compacted, then compact every other entry (only one LOD is on screen). */
+    FCachedLODMesh* AcquireCachedLOD(int32 LODLevel) const;
+    void CompactColdLODEntries(int32 ActiveLODLevel) const;
+
+    /** Evict least recently used entries until the cache fits r.PlanetaryCreation.LODCacheBudgetMB. */
+    void EnforceLODCacheBudget(int32 ActiveLODLevel);
+
+    /** LODs a camera move from LODLevel lands on next: the auto-LOD ladder neighbors (L4/L5/L7), else LODLevel +/- 1. */
+    static void GetNeighborLODLevels(int32 LODLevel, TArray<int32, TInlineAllocator<2>>& OutNeighbors);
+
+    /** The active LOD and its neighbors are never evicted. */
+    static bool IsLODPinned(int32 LODLevel, int32 ActiveLODLevel);
+
+    /** Drop the in-flight pre-warm when the camera moved to a LOD that no longer needs it. */
+    void CancelStalePrewarm(int32 NewTargetLODLevel);
+
     /** Milestone 4 Phase 4.2: Store built mesh snapshot in cache. */
     void CacheLODMesh(int32 LODLevel, int32 TopologyVersion, int32 SurfaceDataVersion,
         const FMeshBuildSnapshot& Snapshot, int32 VertexCount, int32 TriangleCount,
@@ -231,6 +397,23 @@ private:
     mutable TWeakObjectPtr<class URealtimeMeshSimple> PreviewMesh;
     mutable bool bPreviewInitialized = false;
     mutable bool bBoundaryOverlayInitialized = false;
+    bool bLegacyBoundaryBatchCleared = false;
+
+    /** Plate seams of the render mesh (rebuilt on topology or assignment change). */
+    FBoundaryOverlaySet BoundaryOverlaySet;
+    /** Signature of the uploaded overlay section (seams, mode and per-boundary style); 0 = nothing current. */
+    mutable uint64 BoundaryOverlayGeometryHash = 0;
+    int64 BoundaryOverlaySetBuilds = 0;
+    int64 BoundaryOverlayUploads = 0;
+    int64 BoundaryOverlaySkippedUploads = 0;
+
+    /** Velocity overlay arrows (rebuilt on surface/topology change or a new sampling grid) and their line batch state. */
+    FVelocityFieldGlyphs VelocityFieldGlyphs;
+    TWeakObjectPtr<class ULineBatchComponent> VelocityFieldLineBatcher;
+    bool bVelocityFieldDrawn = false;
+    bool bVelocityFieldCleared = false;
+    int64 VelocityFieldBuilds = 0;
+    int64 VelocityFieldDraws = 0;
 
     /** Milestone 3 Task 2.4: Elevation visualization mode. */
     EElevationMode CurrentElevationMode = EElevationMode::Flat;
@@ -247,6 +430,8 @@ private:
     mutable std::atomic<int32> ActiveAsyncTasks{0};
     mutable std::atomic<bool> bShutdownRequested{false};
     mutable double LastMeshBuildTimeMs = 0.0;
+    mutable FCriticalSection MeshBuildStatsLock;
+    FMeshBuildStats LastMeshBuildStats;
 
     /** Milestone 4 Phase 4.1: LOD state. */
     int32 CurrentLODLevel = 2;  // Start at Level 2 (current default)
@@ -256,6 +441,16 @@ private:
     /** Milestone 4 Phase 4.2: LOD mesh cache (key: LODLevel). */
     mutable TMap<int32, TUniquePtr<FCachedLODMesh>> LODCache;
 
+    /** LOD cache counters (game thread). */
+    int64 LODCacheHits = 0;
+    int64 LODCacheMisses = 0;
+    int64 LODCacheEvictions = 0;
+    int64 CancelledPrewarms = 0;
+
+    /** Pre-warm in flight (INDEX_NONE when idle); bumping PrewarmGeneration cancels it. */
+    int32 PendingPrewarmLOD = INDEX_NONE;
+    std::atomic<uint32> PrewarmGeneration{0};
+
     /** Milestone 4 Phase 4.2: Topology/surface version tracking for cache invalidation. */
     mutable int32 CachedTopologyVersion = 0;
     mutable int32 CachedSurfaceDataVersion = 0;
@@ -272,15 +467,39 @@ private:
     mutable TWeakObjectPtr<UMaterialInstanceDynamic> PreviewCPUInstance;
     mutable TWeakObjectPtr<UMaterialInstanceDynamic> PreviewGPUInstance;
 
-    struct FStaticLODData
+    /** Static per-vertex data for one LOD vertex set, plus the index layout for the topology last meshed with it. */
+    struct FStaticLODData : FStaticLODVertexData
     {
-        TArray<FVector3f> UnitNormals;
-        TArray<FVector2f> UVs;
-        TArray<FVector3f> TangentX;
-    };
+        /** Optimized triangle/vertex order of the seam-split preview mesh for LayoutTopologyVersion (swapped under LayoutLock). */
+        TSharedPtr<const FPreviewMeshLayout, ESPMode::ThreadSafe> MeshLayout;
+        int32 LayoutTopologyVersion = INDEX_NONE;
+        FCriticalSection LayoutLock;
 
-    uint64 MakeLODCacheKey(int32 LODLevel, int32 TopologyVersion) const;
-    const FStaticLODData& GetOrBuildStaticLODData(int32 LODLevel, int32 TopologyVersion, const TArray<FVector3d>& RenderVertices) const;
-
-    mutable TMap<uint64, TUniquePtr<FStaticLODData>> StaticLODDataCache;
+        double LastUsedTime = 0.0;
+    };
+    using FStaticLODDataRef = TSharedRef<FStaticLODData, ESPMode::ThreadSafe>;
+
+    /** Key: (LOD level, vertex set hash). */
+    using FStaticLODKey = TPair<int32, uint64>;
+
+    /**
+     * Static data for RenderVertices, found by vertex set identity. A new vertex set patches the most recently used
+     * entry of the same LOD (only changed vertices are evaluated); pure icosphere sets go through the disk cache.
+     */
+    FStaticLODDataRef GetOrBuildStaticLODData(int32 LODLevel, const TArray<FVector3d>& RenderVertices,
+        bool bReadServiceSoA = true) const;
+
+    /** Drop static data for LODLevel (all vertex sets). */
+    void EvictStaticLODData(int32 LODLevel) const;
+
+    mutable TMap<FStaticLODKey, TSharedPtr<FStaticLODData, ESPMode::ThreadSafe>> StaticLODDataCache;
+    mutable FCriticalSection StaticLODDataLock;
+
+    /** Background simulation worker and the frames it publishes. */
+    TUniquePtr<FTectonicSimulationWorker> SimulationWorker;
+    TSharedPtr<FTectonicSimulationFrame, ESPMode::ThreadSafe> LatestSimulationFrame;
+    TSharedPtr<FTectonicSimulationFrame, ESPMode::ThreadSafe> PendingSimulationFrame;
+    FTSTicker::FDelegateHandle SimulationWorkerTickerHandle;
+    bool bOverlaysDeferred = false;
+    bool bLoggedSimulationWorkerFallback = false;
 };
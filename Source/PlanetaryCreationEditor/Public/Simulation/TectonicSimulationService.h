@@ -7,6 +7,8 @@
 #include "Containers/BitArray.h"
 #include "VectorTypes.h"
 #include "RHIGPUReadback.h"
+#include "Utilities/SphericalKDTree.h"
+#include "Simulation/RenderVertexColumnStore.h"
 #include "TectonicSimulationService.generated.h"
 
 namespace PlanetaryCreation::GPU
@@ -129,6 +131,8 @@ struct FStageBProfile
     double HydraulicMs = 0.0;
     double GpuReadbackMs = 0.0;
     double CacheInvalidationMs = 0.0;
+    /** Boundary cache rebuilds during the step (nested inside Voronoi refresh, so excluded from TotalMs). */
+    double BoundaryCacheMs = 0.0;
     int32 RidgeDirtyVertices = 0;
     int32 RidgeUpdatedVertices = 0;
     int32 RidgeCacheHits = 0;
@@ -137,11 +141,15 @@ struct FStageBProfile
     int32 RidgeGradientFallbacks = 0;
     int32 RidgePlateFallbacks = 0;
     int32 RidgeMotionFallbacks = 0;
+    int32 RidgeSegmentIndexHits = 0;
     int32 VoronoiReassignedVertices = 0;
     bool bVoronoiForcedFullRidge = false;
     int32 OceanicBaselineReuseCount = 0;
     int32 OceanicMaskMismatchCount = 0;
     bool bForcedOceanicCpuFallback = false;
+    /** Terranes reattached during the step and the topology rebuilds that took (one per batch). */
+    int32 TerraneReattachments = 0;
+    int32 TerraneTopologyRebuilds = 0;
 
     double TotalMs() const
     {
@@ -176,6 +184,23 @@ struct FRenderVertexFloatSoA
     TArray<float> TangentX;
     TArray<float> TangentY;
     TArray<float> TangentZ;
+    /** Render vertex position column version the views were built from. */
+    uint64 CachedSourceVersion = 0;
+};
+
+/** Per-triangle quality for the re-tessellation cadence check (see RefreshTriangleQualityCache). */
+struct FTriangleQualityCache
+{
+    /** Smallest interior angle of each render triangle in degrees; negative for triangles with invalid corners. */
+    TArray<float> MinAngleDegrees;
+    /** Entries below BadThresholdDegrees; recounted from the cached angles when the threshold changes. */
+    int32 BadCount = 0;
+    double BadThresholdDegrees = -1.0;
+    /** Topology version and render position column version the entries were computed against. */
+    int32 CachedTopologyVersion = INDEX_NONE;
+    uint64 CachedPositionVersion = 0;
+    /** Entries recomputed by the last refresh or update (0 when the cache was already current). */
+    int32 LastUpdatedCount = 0;
 };
 
 struct FOceanicAmplificationFloatInputs
@@ -280,6 +305,204 @@ struct FRidgeDirectionFloatSoA
     int32 CachedVertexCount = 0;
 };
 
+/**
+ * Spatial index over divergent boundary seed vertices (distance zero in the boundary cache).
+ * One KD-tree per plate so nearest-ridge lookups never visit another plate's segments.
+ * Rebuilt only when the render vertex boundary cache changes.
+ */
+struct FRidgeBoundarySegmentIndex
+{
+    /** Indexed by plate ID; point IDs index into SegmentTangents. */
+    TArray<FSphericalKDTree> PlateTrees;
+    TArray<FVector3d> SegmentTangents;
+    /** Mean divergent tangent per plate (ZeroVector when the plate has no divergent boundary). */
+    TArray<FVector3d> PlateFallbackTangents;
+    uint64 CachedBoundaryCacheSerial = 0;
+    int32 CachedVertexCount = INDEX_NONE;
+    int32 CachedPlateCount = INDEX_NONE;
+};
+
+/**
+ * Convergent boundary segments with a continental side, bucketed by the plate on the other side (the terrane carrier)
+ * and bounded by caps. Rebuilt each step a terrane is in transport; terrane bounding caps query it for collisions.
+ */
+struct FTerraneCollisionIndex
+{
+    struct FSegment
+    {
+        FVector3d V0 = FVector3d::ZeroVector;
+        FVector3d V1 = FVector3d::ZeroVector;
+        FVector3d CapCenter = FVector3d::ZeroVector;
+        double CapRadiusRad = 0.0;
+        int32 TargetPlateID = INDEX_NONE;
+        /** Index of the target plate in Plates; the lowest one in range wins. */
+        int32 TargetPlateOrder = INDEX_NONE;
+    };
+
+    TArray<FSegment> Segments;
+    /** Carrier plate ID -> segment IDs ordered by target plate order. */
+    TMap<int32, TArray<int32>> CarrierSegments;
+    /** Segments whose cap overlapped a terrane query during the last detection pass, out of those visited. */
+    int32 LastCapHits = 0;
+    int32 LastSegmentsVisited = 0;
+};
+
+/**
+ * Thermal influence sources gathered once per ComputeThermalField call (hotspot plumes, then stressed convergent
+ * boundaries) and bucketed on an equal-angle cube-sphere grid, so each render vertex only visits the sources whose caps
+ * reach its cell. Vertex cells depend only on the render mesh and are reused until it changes.
+ */
+struct FThermalFieldIndex
+{
+    struct FSource
+    {
+        FVector3d Position = FVector3d::ZeroVector;
+        double RadiusRad = 0.0;
+        double CosRadius = 1.0;
+        /** Temperature increase (K) at the source position. */
+        double PeakK = 0.0;
+
+        bool operator==(const FSource& Other) const
+        {
+            return Position == Other.Position && RadiusRad == Other.RadiusRad && PeakK == Other.PeakK;
+        }
+    };
+
+    TArray<FSource> HotspotSources;
+    TArray<FSource> SubductionSources;
+
+    /** Cell centers and, per render vertex, its cell; CellVertices lists each cell's vertices (CSR). */
+    int32 CellsPerFaceEdge = 0;
+    TArray<FVector3d> CellCenters;
+    TArray<int32> VertexCells;
+    TArray<int32> CellVertexOffsets;
+    TArray<int32> CellVertices;
+
+    /** Per cell (CSR): IDs of the sources whose caps can reach it, ascending. */
+    TArray<int32> CellHotspotOffsets;
+    TArray<int32> CellHotspots;
+    TArray<int32> CellSubductionOffsets;
+    TArray<int32> CellSubductions;
+
+    /** Summed subduction heating per vertex (K), kept so a hotspot-only change skips the boundary sources. */
+    TArray<double> SubductionHeatK;
+
+    int32 CachedTopologyVersion = INDEX_NONE;
+    uint64 CachedPositionVersion = 0;
+    int32 CachedVertexCount = INDEX_NONE;
+    /** VertexTemperatureValues and SubductionHeatK were computed from the sources above on the stamped mesh. */
+    bool bFieldValid = false;
+
+    /** Vertices written by the last call, and whether it only revisited the cells of moved hotspots. */
+    int32 LastVerticesUpdated = 0;
+    bool bLastUpdateIncremental = false;
+};
+
+/**
+ * Persistent scratch for sediment diffusion, reused across steps.
+ * Sediment pools stay double; per-vertex flow terms are float.
+ */
+struct FSedimentTransportScratch
+{
+    TArray<double> CurrentSediment;
+    TArray<double> NextSediment;
+    /** Outgoing transfer per vertex for the iteration being read / written. */
+    TArray<float> Transfer[2];
+    /** Step constants: 1 / sum of downhill gradients (0 when no downhill neighbour) and slope factor. */
+    TArray<float> InvTotalGradient;
+    TArray<float> SlopeFactor;
+    /** Per-step constants set before seeding. */
+    double TransferScale = 0.0;
+    double ConvergentDeposit = 0.0;
+    int32 DiffusionIterations = 0;
+
+    /** Outgoing transfer for a vertex holding Available metres of sediment. */
+    float ComputeTransfer(int32 VertexIdx, double Available) const
+    {
+        if (Available <= 0.0 || InvTotalGradient[VertexIdx] <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        const double TransferAmount = Available * TransferScale * static_cast<double>(SlopeFactor[VertexIdx]);
+        return TransferAmount > 0.0 ? static_cast<float>(TransferAmount) : 0.0f;
+    }
+
+    void Resize(int32 VertexCount)
+    {
+        if (CurrentSediment.Num() != VertexCount)
+        {
+            CurrentSediment.SetNumUninitialized(VertexCount);
+            NextSediment.SetNumUninitialized(VertexCount);
+            Transfer[0].SetNumUninitialized(VertexCount);
+            Transfer[1].SetNumUninitialized(VertexCount);
+            InvTotalGradient.SetNumUninitialized(VertexCount);
+            SlopeFactor.SetNumUninitialized(VertexCount);
+        }
+    }
+
+    void Reset()
+    {
+        CurrentSediment.Reset();
+        NextSediment.Reset();
+        Transfer[0].Reset();
+        Transfer[1].Reset();
+        InvTotalGradient.Reset();
+        SlopeFactor.Reset();
+    }
+};
+
+/**
+ * Shared scratch for the Stage A surface processes (erosion, sediment, dampening).
+ * Dampening writes its next state here in both the sequential and fused paths; the fused path also
+ * keeps its erosion wavefront schedule here.
+ */
+struct FSurfaceProcessScratch
+{
+    TArray<double> NextElevation;
+    TArray<double> NextCrustAge;
+    /** Erosion-modifiable vertices bucketed by wavefront; vertices within one wavefront share no edge. */
+    TArray<int32> ErosionWavefrontLevel;
+    TArray<int32> ErosionWavefrontOrder;
+    TArray<int32> ErosionWavefrontOffsets;
+
+    void Resize(int32 VertexCount)
+    {
+        if (NextElevation.Num() != VertexCount)
+        {
+            NextElevation.SetNumUninitialized(VertexCount);
+            NextCrustAge.SetNumUninitialized(VertexCount);
+        }
+    }
+
+    void Reset()
+    {
+        NextElevation.Reset();
+        NextCrustAge.Reset();
+        ErosionWavefrontLevel.Reset();
+        ErosionWavefrontOrder.Reset();
+        ErosionWavefrontOffsets.Reset();
+    }
+};
+
+/** Sub-phase timing of the last fused surface-process pass (milliseconds). */
+struct FSurfaceProcessTimings
+{
+    /** Parallel max reduction over stress and temperature. */
+    double ReductionMs = 0.0;
+    /** Erosion wavefront scheduling plus the wavefront sweeps. */
+    double ErosionMs = 0.0;
+    /** Fused block sweep: sediment seeding and dampening evaluation. */
+    double SourceSweepMs = 0.0;
+    /** Sediment diffusion iterations. */
+    double SedimentMs = 0.0;
+    /** Write-back of sediment, seafloor elevation and crust age. */
+    double CommitMs = 0.0;
+    int32 ErosionWavefrontCount = 0;
+
+    double TotalMs() const { return ReductionMs + ErosionMs + SourceSweepMs + SedimentMs + CommitMs; }
+};
+
 /**
  * Paper-compliant elevation constants (Appendix A).
  * Reference: "Procedural Tectonic Planets" paper, Table in Appendix A.
@@ -431,6 +654,223 @@ struct FPlateBoundary
     double RiftFormationTimeMy = 0.0;
 };
 
+/**
+ * Per-plate data derived from the plate list: ID -> index, spherical area and crust type.
+ * Plate migration moves only centroids, so the table is rebuilt only when plates or their vertices change.
+ */
+struct FPlateMetadataTable
+{
+    TMap<int32, int32> IndexByPlateID;
+    /** By plate index: area in steradians (see ComputePlateArea) and crust type. */
+    TArray<double> AreaSteradians;
+    TArray<ECrustType> CrustTypes;
+    uint64 CachedSerial = 0;
+    int32 CachedPlateCount = INDEX_NONE;
+
+    int32 FindIndex(int32 PlateID) const
+    {
+        const int32* Index = IndexByPlateID.Find(PlateID);
+        return Index ? *Index : INDEX_NONE;
+    }
+};
+
+/** Split (PlateA splits) or merge (PlateA consumed by PlateB) candidate along a boundary. */
+struct FPlateTopologyCandidate
+{
+    int32 PlateA = INDEX_NONE;
+    int32 PlateB = INDEX_NONE;
+    TPair<int32, int32> BoundaryKey;
+    /** Rift width / divergent duration (split) or accumulated stress (merge). */
+    double PrimaryMetric = 0.0;
+    /** Relative velocity (split) or 1 - area ratio (merge). */
+    double SecondaryMetric = 0.0;
+    uint32 Generation = 0;
+
+    /** Deterministic ordering: larger metrics first, then lower IDs. */
+    static bool IsBetter(const FPlateTopologyCandidate& A, const FPlateTopologyCandidate& B)
+    {
+        if (!FMath::IsNearlyEqual(A.PrimaryMetric, B.PrimaryMetric))
+        {
+            return A.PrimaryMetric > B.PrimaryMetric;
+        }
+        if (!FMath::IsNearlyEqual(A.SecondaryMetric, B.SecondaryMetric))
+        {
+            return A.SecondaryMetric > B.SecondaryMetric;
+        }
+        if (A.PlateA != B.PlateA)
+        {
+            return A.PlateA < B.PlateA;
+        }
+        if (A.PlateB != B.PlateB)
+        {
+            return A.PlateB < B.PlateB;
+        }
+        if (A.BoundaryKey.Key != B.BoundaryKey.Key)
+        {
+            return A.BoundaryKey.Key < B.BoundaryKey.Key;
+        }
+        return A.BoundaryKey.Value < B.BoundaryKey.Value;
+    }
+};
+
+/**
+ * Max-heap of topology candidates keyed by boundary. Re-evaluating a boundary pushes a new generation; entries whose
+ * generation is no longer live are dropped lazily when they surface.
+ */
+struct FPlateTopologyCandidateQueue
+{
+    TArray<FPlateTopologyCandidate> Heap;
+    TMap<TPair<int32, int32>, uint32> LiveGenerations;
+
+    void Reset()
+    {
+        Heap.Reset();
+        LiveGenerations.Reset();
+    }
+
+    void Set(const FPlateTopologyCandidate& Candidate)
+    {
+        LiveGenerations.Add(Candidate.BoundaryKey, Candidate.Generation);
+        Heap.HeapPush(Candidate, &FPlateTopologyCandidate::IsBetter);
+    }
+
+    void Remove(const TPair<int32, int32>& BoundaryKey)
+    {
+        LiveGenerations.Remove(BoundaryKey);
+    }
+
+    bool IsLive(const FPlateTopologyCandidate& Candidate) const
+    {
+        const uint32* Generation = LiveGenerations.Find(Candidate.BoundaryKey);
+        return Generation && *Generation == Candidate.Generation;
+    }
+
+    /** Drop stale entries from the top (and compact when they dominate) so Peek sees the live best. */
+    void Prune()
+    {
+        if (Heap.Num() > 2 * LiveGenerations.Num() + 16)
+        {
+            Heap.RemoveAllSwap([this](const FPlateTopologyCandidate& Candidate) { return !IsLive(Candidate); });
+            Heap.Heapify(&FPlateTopologyCandidate::IsBetter);
+        }
+        while (Heap.Num() > 0 && !IsLive(Heap.HeapTop()))
+        {
+            FPlateTopologyCandidate Discarded;
+            Heap.HeapPop(Discarded, &FPlateTopologyCandidate::IsBetter);
+        }
+    }
+
+    const FPlateTopologyCandidate* Peek() const
+    {
+        return Heap.Num() > 0 ? &Heap.HeapTop() : nullptr;
+    }
+};
+
+/**
+ * Split/merge candidates carried across steps. Each boundary's inputs are remembered, and only boundaries whose
+ * classification, state or driving metrics changed are re-evaluated; everything resets when the plate set changes.
+ */
+struct FPlateTopologyCandidateTracker
+{
+    struct FBoundarySignature
+    {
+        EBoundaryType BoundaryType = EBoundaryType::Transform;
+        EBoundaryState BoundaryState = EBoundaryState::Nascent;
+        double RelativeVelocity = 0.0;
+        double AccumulatedStress = 0.0;
+        double DivergentDurationMy = 0.0;
+        double RiftWidthMeters = 0.0;
+
+        bool operator==(const FBoundarySignature& Other) const
+        {
+            return BoundaryType == Other.BoundaryType && BoundaryState == Other.BoundaryState &&
+                RelativeVelocity == Other.RelativeVelocity && AccumulatedStress == Other.AccumulatedStress &&
+                DivergentDurationMy == Other.DivergentDurationMy && RiftWidthMeters == Other.RiftWidthMeters;
+        }
+    };
+
+    TMap<TPair<int32, int32>, FBoundarySignature> Signatures;
+    FPlateTopologyCandidateQueue Splits;
+    FPlateTopologyCandidateQueue Merges;
+    uint32 NextGeneration = 1;
+    uint64 CachedPlateMetadataSerial = 0;
+    /** Threshold parameters the candidates were evaluated with (a change re-evaluates everything). */
+    TArray<double> CachedThresholds;
+    /** Boundaries re-evaluated by the last refresh, out of those tracked. */
+    int32 LastEvaluatedBoundaries = 0;
+    int32 LastTrackedBoundaries = 0;
+};
+
+/**
+ * Flat, key-sorted view of Boundaries driving the fused per-step boundary sweep (classification, stress, lifecycle
+ * state, rift progression). The FPlateBoundary entries stay authoritative; the table holds pointers into the map plus
+ * the per-boundary plate indices and classification inputs, and is rebuilt whenever the boundary or plate set changes.
+ */
+struct FPlateBoundaryTable
+{
+    enum EStage : uint8
+    {
+        StageClassify = 1 << 0,
+        StageStress = 1 << 1,
+        StageStates = 1 << 2,
+        StageRift = 1 << 3,
+        AllStages = StageClassify | StageStress | StageStates | StageRift
+    };
+
+    enum EEvent : uint8
+    {
+        EventReclassified = 1 << 0,
+        EventTypeChanged = 1 << 1,
+        EventStateChanged = 1 << 2,
+        EventRiftEntered = 1 << 3,
+        EventRiftWidened = 1 << 4,
+        EventRiftSplitReady = 1 << 5,
+        EventRiftDormant = 1 << 6
+    };
+
+    /** Plate motion a plate's boundaries were last classified with; drifting past epsilon reclassifies them. */
+    struct FPlateMotion
+    {
+        FVector3d EulerPoleAxis = FVector3d::ZeroVector;
+        FVector3d Centroid = FVector3d::ZeroVector;
+        double AngularVelocity = 0.0;
+        /** AngularVelocity * CurrentTimeMy: classification rotates the edge vertices by it. */
+        double RotationAngle = 0.0;
+        bool bValid = false;
+    };
+
+    /** Per-sweep events, logged serially in key order once the parallel sweep is done. */
+    struct FSweepResult
+    {
+        uint8 Events = 0;
+        EBoundaryState OldState = EBoundaryState::Nascent;
+        EBoundaryState NewState = EBoundaryState::Nascent;
+    };
+
+    TArray<TPair<int32, int32>> Keys;
+    TArray<FPlateBoundary*> Entries;
+    /** Plate indices into Plates (INDEX_NONE if a plate is missing). */
+    TArray<int32> PlateIndexA;
+    TArray<int32> PlateIndexB;
+    /** Type and velocity the last classification left behind; an outside write to either forces reclassification. */
+    TArray<EBoundaryType> ClassifiedTypes;
+    TArray<double> ClassifiedVelocities;
+    TArray<uint8> Classified;
+    /** Last classification reached a type (not skipped for missing plates or degenerate geometry). */
+    TArray<uint8> ClassifiedValid;
+    TArray<FSweepResult> SweepResults;
+
+    TArray<FPlateMotion> PlateMotion;
+    TArray<uint8> DirtyPlates;
+
+    uint64 CachedPlateMetadataSerial = 0;
+    int32 CachedBoundaryCount = INDEX_NONE;
+    int32 CachedPlateCount = INDEX_NONE;
+    /** Boundaries reclassified by the last classifying sweep, out of those swept. */
+    int32 LastReclassified = 0;
+    int32 LastSwept = 0;
+};
+
 struct FPlateBoundarySummaryEntry
 {
     FVector3d RepresentativePosition = FVector3d::ZeroVector;
@@ -603,6 +1043,12 @@ struct FContinentalTerrane
     /** Centroid position on unit sphere (for tracking/visualization). */
     FVector3d Centroid = FVector3d::ZeroVector;
 
+    /** Angular radius of the payload around Centroid; together they form the bounding cap used for collision queries. */
+    double BoundingRadiusRad = 0.0;
+
+    /** Carrier rotation accumulated since VertexPayload positions were last materialized (transport moves only the cap). */
+    FQuat4d PendingPayloadRotation = FQuat4d::Identity;
+
     /** Area in km² (for validation, prevents single-vertex terranes). */
     double AreaKm2 = 0.0;
 
@@ -982,6 +1428,13 @@ struct FTectonicSimulationParameters
     UPROPERTY()
     bool bEnableOceanicDampening = false;
 
+    /**
+     * Run continental erosion, sediment transport and oceanic dampening as one fused pass over shared scratch.
+     * Results match the sequential pipeline; each process still honours its own enable flag.
+     */
+    UPROPERTY()
+    bool bEnableFusedSurfaceProcesses = false;
+
     /**
      * Milestone 6 Task 2.1: Enable Stage B oceanic amplification (transform faults, fine detail).
      * Paper default: true. Disable when profiling CPU-only baselines.
@@ -1209,6 +1662,13 @@ public:
     /** Advance the simulation by the requested number of steps (each 2 My). */
     void AdvanceSteps(int32 StepCount);
 
+    /**
+     * Held for the whole of AdvanceSteps and by the entry points that replace state (reset, parameters, LOD,
+     * history), so a step running on the simulation worker thread never interleaves with editor edits.
+     * The worker steps this live service rather than a copy: while it is busy, any other reader must hold this lock.
+     */
+    FCriticalSection& GetSimulationStateLock() const { return SimulationStateLock; }
+
 
     /** Returns the accumulated tectonic time in mega-years. */
     double GetCurrentTimeMy() const { return CurrentTimeMy; }
@@ -1223,8 +1683,21 @@ public:
     /** Accessor for plates (Milestone 2). */
     const TArray<FTectonicPlate>& GetPlates() const { return Plates; }
 
-    /** Non-const accessor for plates (for test manipulation). */
-    TArray<FTectonicPlate>& GetPlatesForModification() { return Plates; }
+    /** Non-const accessor for plates (for test manipulation). Callers may edit membership or crust, so plate metadata is dropped. */
+    TArray<FTectonicPlate>& GetPlatesForModification() { InvalidatePlateMetadata(); return Plates; }
+
+    /** Plate ID -> index, area and crust type, rebuilt when the plate set changed since the last call. */
+    const FPlateMetadataTable& GetPlateMetadata() const;
+
+    /** Mark plate metadata, tracked split/merge candidates and the boundary table stale (plate list, vertices or boundary set replaced). */
+    void InvalidatePlateMetadata() { ++PlateMetadataSerial; }
+
+    /** Re-evaluate split/merge candidates for boundaries whose inputs changed since the last refresh. */
+    void RefreshPlateTopologyCandidates();
+    const FPlateTopologyCandidateTracker& GetPlateTopologyCandidates() const { return PlateTopologyCandidates; }
+
+    /** Flat boundary table behind the fused per-step boundary sweep (for tests and diagnostics). */
+    const FPlateBoundaryTable& GetBoundaryTable() const { return BoundaryTable; }
 
     /** Accessor for shared vertex pool (Milestone 2). */
     const TArray<FVector3d>& GetSharedVertices() const { return SharedVertices; }
@@ -1255,6 +1728,14 @@ public:
     /** Milestone 4 Task 2.3: Accessor for per-vertex temperature values (K). */
     const TArray<double>& GetVertexTemperatureValues() const { return VertexTemperatureValues; }
 
+    /**
+     * Milestone 4 Task 2.3: Compute thermal field from hotspots and subduction zones. Revisits only the cells of
+     * moved hotspots when the subduction sources and render mesh are unchanged since the last call.
+     */
+    void ComputeThermalField();
+
+    const FThermalFieldIndex& GetThermalFieldIndex() const { return ThermalFieldIndex; }
+
     /** Milestone 5 Task 2.1: Accessor for per-vertex elevation values (meters). */
     const TArray<double>& GetVertexElevationValues() const { return VertexElevationValues; }
 
@@ -1277,6 +1758,12 @@ public:
     double GetLastHydraulicTotalEroded() const { return LastHydraulicTotalEroded; }
     double GetLastHydraulicTotalDeposited() const { return LastHydraulicTotalDeposited; }
     double GetLastHydraulicLostToOcean() const { return LastHydraulicLostToOcean; }
+    int32 GetLastHydraulicFlowLevelCount() const { return LastHydraulicFlowLevelCount; }
+    const TArray<float>& GetHydraulicFlowAccumulation() const { return HydraulicFlowAccumulation; }
+    const TArray<int32>& GetHydraulicDownhillNeighbors() const { return HydraulicDownhillNeighbor; }
+
+    /** Sub-phase timing of the last fused surface-process pass (zeroed when the sequential path ran). */
+    const FSurfaceProcessTimings& GetLastSurfaceProcessTimings() const { return LastSurfaceProcessTimings; }
 
     EStageBAmplificationReadyReason GetStageBAmplificationNotReadyReason() const { return StageBReadyReason; }
     UFUNCTION(BlueprintPure, Category = "Tectonic Simulation")
@@ -1287,6 +1774,9 @@ public:
 
     const TArray<int32>& GetRenderVertexAdjacencyOffsets() const { return RenderVertexAdjacencyOffsets; }
     const TArray<int32>& GetRenderVertexAdjacency() const { return RenderVertexAdjacency; }
+    const TArray<float>& GetRenderVertexAdjacencyWeights() const { return RenderVertexAdjacencyWeights; }
+    const TArray<int32>& GetRenderVertexReverseAdjacency() const { return RenderVertexReverseAdjacency; }
+    const TArray<uint8>& GetConvergentNeighborFlags() const { return ConvergentNeighborFlags; }
 
     struct FRenderVertexBoundaryInfo
     {
@@ -1296,6 +1786,8 @@ public:
     int32 OpposingPlateID = INDEX_NONE;
     bool bHasBoundary = false;
     bool bIsDivergent = false;
+    /** On a plate with divergent seeds but past RidgeBoundaryInfluenceRadians, so no tangent was propagated. */
+    bool bBeyondInfluence = false;
 };
 
     /** Milestone 6 Task 2.1: Accessor for per-vertex ridge directions. */
@@ -1316,6 +1808,8 @@ public:
     int32 GetLastRidgeGradientFallbackCount() const { return LastRidgeGradientFallbackCount; }
     int32 GetLastRidgePlateFallbackCount() const { return LastRidgePlateFallbackCount; }
     int32 GetLastRidgeMotionFallbackCount() const { return LastRidgeMotionFallbackCount; }
+    int32 GetLastRidgeSegmentIndexHitCount() const { return LastRidgeSegmentIndexHitCount; }
+    double GetLastBoundaryCacheBuildMs() const { return LastBoundaryCacheBuildMs; }
     int32 GetLastRidgeOceanicVertexCount() const { return LastRidgeOceanicVertexCount; }
     int32 GetLastRidgeValidTangentCount() const { return LastRidgeValidTangentCount; }
     double GetLastRidgeTangentCoveragePercent() const { return LastRidgeTangentCoveragePercent; }
@@ -1431,6 +1925,58 @@ public:
         FRetessellationSnapshot() : TimestampMy(0.0) {}
     };
 
+    /**
+     * Undo journal for an incremental re-tessellation: the prior value of every triangle and vertex the pass rewrote,
+     * recorded before the first write so rollback touches only the affected region.
+     */
+    struct FRetessellationJournal
+    {
+        struct FTriangleEntry
+        {
+            int32 TriangleIndex = INDEX_NONE;
+            int32 Corners[3] = {INDEX_NONE, INDEX_NONE, INDEX_NONE};
+        };
+
+        struct FVertexEntry
+        {
+            int32 VertexIndex = INDEX_NONE;
+            int32 PlateAssignment = INDEX_NONE;
+            double Elevation = 0.0;
+            double AmplifiedElevation = 0.0;
+            double ErosionRate = 0.0;
+            double SedimentThickness = 0.0;
+            double CrustAge = 0.0;
+        };
+
+        TArray<FTriangleEntry> Triangles;
+        TArray<FVertexEntry> Vertices;
+        TSet<int32> JournaledTriangles;
+        TSet<int32> JournaledVertices;
+        double TimestampMy = 0.0;
+
+        /** Boundary triangles examined by the refinement pass (flipped or not). */
+        int32 TrianglesTouched = 0;
+        int32 EdgeFlips = 0;
+
+        void RecordTriangle(const TArray<int32>& RenderTriangles, int32 TriangleIndex);
+    };
+
+    /** Record a vertex's assignment and surface values in the journal before its first write. */
+    void JournalRetessellationVertex(FRetessellationJournal& Journal, int32 VertexIdx) const;
+
+    /** Restore every journaled triangle and vertex (reverse of an incremental re-tessellation). */
+    void RollbackRetessellationJournal(const FRetessellationJournal& Journal);
+
+    /** Local validation of an incremental re-tessellation: only journaled triangles and vertices are checked. */
+    bool ValidateRetessellationJournal(const FRetessellationJournal& Journal) const;
+
+    /**
+     * Edge-flip refinement along the boundaries of drifted plates: triangles below RetessellationMinTriangleAngleDegrees
+     * flip their shared edge when that raises the pair's minimum angle. Vertex and triangle counts are preserved.
+     * Returns the number of flips; every rewritten triangle is journaled.
+     */
+    int32 RefineDriftedPlateBoundaries(const TArray<int32>& DriftedPlateIDs, FRetessellationJournal& Journal);
+
     /** Captures current state for rollback. */
     FRetessellationSnapshot CaptureRetessellationSnapshot() const;
 
@@ -1468,6 +2014,10 @@ public:
         double LastTriggerTimeMy = 0.0;
         double LastTriggerMaxDriftDegrees = 0.0;
         double LastTriggerBadTriangleRatio = 0.0;
+        double LastRetessellationMs = 0.0;
+        double TotalRetessellationMs = 0.0;
+        int32 LastTrianglesTouched = 0;
+        int64 TotalTrianglesTouched = 0;
 
         void Reset()
         {
@@ -1483,12 +2033,27 @@ public:
             LastTriggerTimeMy = 0.0;
             LastTriggerMaxDriftDegrees = 0.0;
             LastTriggerBadTriangleRatio = 0.0;
+            LastRetessellationMs = 0.0;
+            TotalRetessellationMs = 0.0;
+            LastTrianglesTouched = 0;
+            TotalTrianglesTouched = 0;
         }
     };
 
     /** Compute drift/quality metrics for the currently cached render mesh. */
     FRetessellationAnalysis ComputeRetessellationAnalysis() const;
 
+    /**
+     * Bring the triangle quality cache up to date: a topology or position change recomputes every entry in one
+     * parallel pass, a threshold change only recounts, otherwise nothing is done.
+     */
+    void RefreshTriangleQualityCache() const;
+
+    /** Recompute the cached quality of triangles rewritten in place (no-op when the cache is already stale). */
+    void UpdateTriangleQualityCache(TConstArrayView<int32> TriangleIndices);
+
+    const FTriangleQualityCache& GetTriangleQualityCache() const { return TriangleQualityCache; }
+
     /** Apply cadence/hysteresis rules before invoking PerformRetessellation. */
     void MaybePerformRetessellation();
 
@@ -1503,6 +2068,20 @@ public:
     void CompactRenderVertexData(const TArray<int32>& VerticesToRemove, TArray<int32>& OutOldToNew);
     int32 AppendRenderVertexFromRecord(const FTerraneVertexRecord& Record, int32 OverridePlateID);
     void InvalidateRenderVertexCaches();
+    /** Everything InvalidateRenderVertexCaches drops except the CSR adjacency (for callers that patch it). */
+    void InvalidateRenderVertexDerivedCaches();
+    /** Follow a render vertex compaction in the cap/payload indices held by in-flight terranes. */
+    void RemapTerraneMeshIndices(const TArray<int32>& OldToNew);
+
+    /** Vertex -> triangle incidence (CSR over RenderTriangles / 3), rebuilt lazily when the topology changes. */
+    void BuildRenderVertexTriangleIncidence();
+
+    /**
+     * Replace the CSR adjacency after a localized surgery: lists of vertices in DirtyNeighbors (new indices, sorted
+     * neighbor lists) are installed as given, every other list is remapped from the pre-surgery CSR via OldToNew.
+     * Weights, reverse adjacency and convergent flags are recomputed only for the dirty vertices.
+     */
+    void PatchRenderVertexAdjacency(const TArray<int32>& OldToNew, const TMap<int32, TArray<int32>>& DirtyNeighbors);
 
     /** Milestone 4 Task 1.1: Re-tessellation performance tracking (public for tests). */
     double LastRetessellationTimeMs = 0.0;
@@ -1523,7 +2102,10 @@ public:
     void BuildRenderVertexAdjacency();
     void BuildRenderVertexReverseAdjacency();
     void UpdateConvergentNeighborFlags();
+    uint8 ComputeConvergentNeighborFlag(int32 VertexIdx) const;
     void BuildRenderVertexBoundaryCache();
+    /** Stage B oceanic ridge weight: exp(-d / 8 deg) from a divergent boundary, 0.35 with no boundary. */
+    double ComputeOceanicRidgeFactor(int32 VertexIdx) const;
     void InvalidatePlateBoundarySummaries();
     const FPlateBoundarySummary* GetPlateBoundarySummary(int32 PlateID) const;
     void RebuildPlateBoundarySummary(int32 PlateID, FPlateBoundarySummary& OutSummary) const;
@@ -1534,12 +2116,7 @@ public:
         double CurrentTimeMy;
         TArray<FTectonicPlate> Plates;
         TArray<FVector3d> SharedVertices;
-        TArray<FVector3d> RenderVertices;
         TArray<int32> RenderTriangles;
-        TArray<int32> VertexPlateAssignments;
-        TArray<FVector3d> VertexVelocities;
-        TArray<double> VertexStressValues;
-        TArray<double> VertexTemperatureValues;
         TMap<TPair<int32, int32>, FPlateBoundary> Boundaries;
         TArray<FPlateTopologyEvent> TopologyEvents;
         TArray<FMantleHotspot> Hotspots;
@@ -1547,19 +2124,12 @@ public:
         int32 TopologyVersion;
         int32 SurfaceDataVersion;
 
-        /** Milestone 5: Erosion state (for undo/redo). */
-        TArray<double> VertexElevationValues;
-        TArray<double> VertexErosionRates;
-        TArray<double> VertexSedimentThickness;
-        TArray<double> VertexCrustAge;
+        /** Every History-flagged render vertex column (positions, plate assignments, erosion, ridge/fold caches). */
+        FRenderVertexColumnSnapshot VertexColumns;
 
         /** Milestone 6 Task 1.1: Terrane state (for undo/redo). */
         TArray<FContinentalTerrane> Terranes;
         int32 NextTerraneID;
-        TArray<FVector3d> VertexRidgeDirections;
-        TArray<FVector3f> VertexFoldDirection;
-        TArray<EOrogenyClass> VertexOrogenyClass;
-        TArray<FRenderVertexBoundaryInfo> RenderVertexBoundaryCache;
 
         FSimulationHistorySnapshot() : CurrentTimeMy(0.0), TopologyVersion(0), SurfaceDataVersion(0), NextTerraneID(0) {}
     };
@@ -1595,9 +2165,13 @@ public:
     bool JumpToHistoryIndex(int32 Index);
     void RestoreRidgeCacheFromSnapshot(const FSimulationHistorySnapshot& Snapshot);
 
+    /** Per-render-vertex column registry (compact/permute/snapshot over every registered array). */
+    const FRenderVertexColumnStore& GetRenderVertexColumns() const { return RenderVertexColumns; }
+
     /**
      * Milestone 6 Task 1.1: Extract terrane from continental plate.
-     * Performs mesh surgery to remove specified vertices from plate.
+     * Performs mesh surgery to remove specified vertices from plate. The hole and its fill are found from the
+     * vertex -> triangle incidence index, but vertex compaction and the triangle/CSR index remaps stay O(planet).
      *
      * @param SourcePlateID Plate to extract terrane from (must be continental)
      * @param TerraneVertexIndices Render vertex indices to extract (must be contiguous region)
@@ -1616,6 +2190,16 @@ public:
      */
     bool ReattachTerrane(int32 TerraneID, int32 TargetPlateID);
 
+    /**
+     * Reattach several terranes in one splice: cap removal, payload append and vertex compaction run once for the
+     * batch, followed by a single topology validation and adjacency rebuild (TopologyVersion advances once).
+     * Requests that fail validation are skipped; a splice failure rolls back the whole batch.
+     *
+     * @param TerraneTargets (TerraneID, TargetPlateID) pairs
+     * @return Number of terranes reattached (0 if the splice was rolled back)
+     */
+    int32 ReattachTerranes(const TArray<TPair<int32, int32>>& TerraneTargets);
+
     /**
      * Milestone 6 Task 1.1: Validate mesh topology after terrane operation.
      * Checks Euler characteristic, manifold edges, and orphaned vertices.
@@ -1637,6 +2221,22 @@ public:
     /** Milestone 6 Task 1.1: Accessor for active terranes. */
     const TArray<FContinentalTerrane>& GetTerranes() const { return Terranes; }
 
+    /** Region retriangulated by the most recent successful ExtractTerrane (compaction cost not included in the counts). */
+    struct FTerraneSurgeryStats
+    {
+        int32 RemovedVertexCount = 0;
+        int32 AddedVertexCount = 0;
+        int32 RemovedTriangleCount = 0;
+        int32 RimTriangleCount = 0;
+        int32 PatchTriangleCount = 0;
+        /** Vertices whose CSR neighbor lists were recomputed; every other list was remapped. */
+        int32 PatchedAdjacencyVertexCount = 0;
+        bool bPatchedAdjacency = false;
+        double SurgeryMs = 0.0;
+    };
+
+    const FTerraneSurgeryStats& GetLastTerraneSurgeryStats() const { return LastTerraneSurgeryStats; }
+
     /** Milestone 6 Task 1.1: Get terrane by ID (nullptr if not found). */
     const FContinentalTerrane* GetTerraneByID(int32 TerraneID) const;
 
@@ -1707,12 +2307,17 @@ public:
      */
     void UpdateTerranePositions(double DeltaTimeMy);
 
+    /** Apply a terrane's pending carrier rotation to its payload positions (done lazily, e.g. at reattachment). */
+    void MaterializeTerranePayload(FContinentalTerrane& Terrane) const;
+
     /**
      * Milestone 6 Task 1.2: Detect terranes approaching continental convergent boundaries.
      * Marks terranes as Colliding when within 500 km of collision.
      */
     void DetectTerraneCollisions();
 
+    const FTerraneCollisionIndex& GetTerraneCollisionIndex() const { return TerraneCollisionIndex; }
+
     /**
      * Milestone 6 Task 1.3: Automatically reattach colliding terranes to target continental plates.
      * Called each step after collision detection to complete terrane lifecycle.
@@ -1763,11 +2368,14 @@ private:
     /** Milestone 3 Task 1.1: Generate high-density render mesh from base icosphere. */
     void GenerateRenderMesh(const TCHAR* RidgeInvalidateContext = TEXT("GenerateRenderMesh"));
 
+    /** Renumber the freshly generated render vertices along a cube-sphere Hilbert curve; reorders triangles to match. */
+    void ApplySpatialVertexOrder();
+
     /** Milestone 3 Task 1.1 helper: Subdivide a triangle by splitting edges. */
     int32 GetMidpointIndex(int32 V0, int32 V1, TMap<TPair<int32, int32>, int32>& MidpointCache, TArray<FVector3d>& Vertices);
 
-    /** Milestone 3 Task 2.1: Build Voronoi mapping from render vertices to plates. */
-    void BuildVoronoiMapping();
+    /** Milestone 3 Task 2.1: Build Voronoi mapping from render vertices to plates (journaling rewritten vertices if given). */
+    void BuildVoronoiMapping(FRetessellationJournal* Journal = nullptr);
 
     /** Milestone 3 Task 2.2: Compute per-vertex velocity field (v = ω × r). */
     void ComputeVelocityField();
@@ -1793,6 +2401,21 @@ private:
     /** Phase 2 Task 5: Update boundary classifications based on relative velocities. */
     void UpdateBoundaryClassifications();
 
+    /** Rebuild the flat boundary table if the boundary or plate set changed since it was built. */
+    void RefreshBoundaryTable();
+
+    /**
+     * Run the requested per-boundary stages (FPlateBoundaryTable::EStage) in one parallel sweep over the boundary table.
+     * Classification only revisits boundaries whose plates moved, or that were written from outside, since their last pass.
+     */
+    void SweepBoundaries(uint8 Stages, double DeltaTimeMy);
+
+    /** Classify one boundary from its plates' relative velocity; false if skipped (bad edge or degenerate geometry). */
+    bool ClassifyBoundary(const FTectonicPlate& PlateA, const FTectonicPlate& PlateB, FPlateBoundary& Boundary) const;
+
+    /** Milestone 3 Task 2.3: Stress update for a single boundary. */
+    void AccumulateBoundaryStress(FPlateBoundary& Boundary, double DeltaTimeMy) const;
+
     /** Milestone 4 Task 1.2: Detect and execute plate splits (rift-driven). */
     void DetectAndExecutePlateSplits();
 
@@ -1811,6 +2434,9 @@ private:
     /** Milestone 4 Task 1.3: Update boundary lifecycle states (Nascent/Active/Dormant). */
     void UpdateBoundaryStates(double DeltaTimeMy);
 
+    /** Milestone 4 Task 1.3: Advance one boundary's durations and lifecycle state; true if the state changed. */
+    bool AdvanceBoundaryState(FPlateBoundary& Boundary, double DeltaTimeMy) const;
+
     /** Milestone 4 Task 2.1: Generate hotspot seeds deterministically. */
     void GenerateHotspots();
 
@@ -1826,8 +2452,11 @@ private:
     /** Milestone 4 Task 2.2: Update rift progression for divergent boundaries. */
     void UpdateRiftProgression(double DeltaTimeMy);
 
-    /** Milestone 4 Task 2.3: Compute thermal field from hotspots and subduction zones. */
-    void ComputeThermalField();
+    /** Milestone 4 Task 2.2: Advance one boundary's rift; returns FPlateBoundaryTable::EEvent rift bits for logging. */
+    uint8 AdvanceRiftProgression(FPlateBoundary& Boundary, double DeltaTimeMy) const;
+
+    /** Milestone 4 Task 2.2: Emit the rift log lines for events returned by AdvanceRiftProgression. */
+    void LogRiftProgression(const TPair<int32, int32>& PlateIDs, const FPlateBoundary& Boundary, uint8 Events) const;
 
     /** Milestone 5 Task 2.1: Apply continental erosion to vertices above sea level. */
     void ApplyContinentalErosion(double DeltaTimeMy);
@@ -1844,6 +2473,23 @@ private:
     /** Milestone 5: Helper to compute surface slope at vertex (for erosion rate). */
     double ComputeVertexSlope(int32 VertexIdx) const;
 
+    /** Erosion, sediment and dampening in one pass over shared scratch (bEnableFusedSurfaceProcesses). */
+    void ApplyFusedSurfaceProcesses(double DeltaTimeMy);
+
+    /** Stress/temperature maxima used to normalize erosion factors (parallel reduction). */
+    void ComputeErosionNormalization(double& OutMaxStress, double& OutMaxTemperature) const;
+
+    /** Per-vertex erosion body shared by the sequential and fused paths. */
+    void ErodeContinentalVertex(int32 VertexIdx, double DeltaTimeMy, double MaxStress, double MaxTemperature);
+
+    /** Sediment transport stages shared by the sequential and fused paths. */
+    void BeginSedimentTransport(double DeltaTimeMy);
+    void SeedSedimentTransportVertex(int32 VertexIdx, double DeltaTimeMy);
+    void IterateSedimentTransport();
+
+    /** Writes the dampened elevation/age of one vertex into SurfaceProcessScratch. */
+    void ComputeOceanicDampeningVertex(int32 VertexIdx, double DeltaTimeMy, double DampFactor, double AgePullScale);
+
     /** Milestone 6 Task 2.1: Compute ridge directions for all oceanic vertices. */
     void ComputeRidgeDirections();
     /** STG-06: Compute fold directions and classify orogeny state for render vertices. */
@@ -1853,6 +2499,10 @@ private:
     void OnExemplarAtlasLoaded(uint64 AtlasFingerprint, const TCHAR* Context);
     /** Milestone 6 Task 2.1: Recompute ridge directions if dirty or topology changed. Returns true when recomputed. */
     bool RefreshRidgeDirectionsIfNeeded();
+    /** Rebuild the per-plate divergent segment index when the boundary cache changed. */
+    void RefreshRidgeBoundarySegmentIndex();
+    /** Rebuild the convergent segment index used by terrane collision detection from the current classification. */
+    void RefreshTerraneCollisionIndex();
 
     /** Milestone 6 Task 2.1: Apply Stage B oceanic amplification (transform faults, fine detail). */
     void ApplyOceanicAmplification();
@@ -1876,6 +2526,8 @@ private:
     /** Drops any pending Stage B GPU readbacks that no longer match the active render mesh. */
     void DiscardOutdatedStageBGPUJobs(int32 ExpectedVertexCount);
 
+    mutable FCriticalSection SimulationStateLock;
+
     double CurrentTimeMy = 0.0;
     double LastStepTimeMs = 0.0; // Milestone 3 Task 4.5: Performance tracking
     FStageBProfile LatestStageBProfile;
@@ -1907,6 +2559,9 @@ private:
 
     /** Milestone 5 Task 2.2: Per-vertex sediment thickness (meters) from erosion redistribution. */
     TArray<double> VertexSedimentThickness;
+    FSedimentTransportScratch SedimentTransportScratch;
+    FSurfaceProcessScratch SurfaceProcessScratch;
+    FSurfaceProcessTimings LastSurfaceProcessTimings;
 
     /** Milestone 5 Task 2.3: Per-vertex oceanic crust age (My) for age-subsidence calculations. */
     TArray<double> VertexCrustAge;
@@ -1931,6 +2586,11 @@ private:
     TArray<float> HydraulicDownstreamDepositBuffer;
     TArray<int32> HydraulicUpstreamCount;
     TArray<int32> HydraulicProcessingQueue;
+    /** Donor CSR of the downhill forest and level boundaries into HydraulicProcessingQueue. */
+    TArray<int32> HydraulicDonorOffsets;
+    TArray<int32> HydraulicDonors;
+    TArray<int32> HydraulicLevelOffsets;
+    int32 LastHydraulicFlowLevelCount = 0;
     double LastHydraulicTotalEroded = 0.0;
     double LastHydraulicTotalDeposited = 0.0;
     double LastHydraulicLostToOcean = 0.0;
@@ -1954,6 +2614,11 @@ private:
     TArray<int32> RenderVertexReverseAdjacency;
     TArray<uint8> ConvergentNeighborFlags;
 
+    /** Triangles incident to each render vertex (CSR: Offsets.Num == RenderVertices.Num + 1), see BuildRenderVertexTriangleIncidence. */
+    TArray<int32> RenderVertexTriangleOffsets;
+    TArray<int32> RenderVertexTriangles;
+    int32 RenderVertexTriangleIncidenceTopologyVersion = INDEX_NONE;
+
     /** Pending seeds for crust age reset near divergent boundaries. */
     TArray<int32> PendingCrustAgeResetSeeds;
     TBitArray<> PendingCrustAgeResetMask;
@@ -1962,8 +2627,17 @@ private:
     /** Metrics from the most recent Voronoi rebuild for ridge dirtying heuristics. */
     int32 LastVoronoiReassignedCount = 0;
     bool bLastVoronoiForcedFullRidgeUpdate = false;
+    /** Bumped whenever RenderVertexBoundaryCache is rebuilt or restored. */
+    uint64 RenderVertexBoundaryCacheSerial = 0;
+    double LastBoundaryCacheBuildMs = 0.0;
+    /** Accumulated BuildRenderVertexBoundaryCache time for the current AdvanceSteps step. */
+    double StepBoundaryCacheBuildMs = 0.0;
     /** Last Voronoi plate assignments captured for incremental ridge updates. */
     TArray<int32> CachedVoronoiAssignments;
+
+    /** Registered views over the per-render-vertex arrays above (see RegisterRenderVertexColumns). */
+    FRenderVertexColumnStore RenderVertexColumns;
+    FRenderVertexColumnStore::FColumnId RenderPositionColumn = INDEX_NONE;
     /** Skip flag to avoid immediately refreshing Voronoi the step after reset. */
     bool bSkipNextVoronoiRefresh = false;
 
@@ -1985,6 +2659,12 @@ private:
     /** Milestone 6 Task 1.1: Next terrane ID for deterministic generation. */
     int32 NextTerraneID = 0;
 
+    FTerraneSurgeryStats LastTerraneSurgeryStats;
+
+    /** Terrane reattachments and batched topology rebuilds for the current AdvanceSteps step. */
+    int32 StepTerraneReattachments = 0;
+    int32 StepTerraneTopologyRebuilds = 0;
+
     /** Milestone 4 Phase 4.2: Topology version (increments on re-tessellation/split/merge). */
     int32 TopologyVersion = 0;
 
@@ -2011,6 +2691,7 @@ public:
     void ForceRidgeRecomputeForTest() { ComputeRidgeDirections(); }
     void ForceRidgeRingDirtyForTest(const TArray<int32>& SeedVertices, int32 RingDepth);
     void SetVertexCrustAgeForTest(int32 VertexIdx, double Age);
+    bool ForceSplitPlateForTest(const TPair<int32, int32>& BoundaryKey);
     int32 GetPendingOceanicGPUJobCount() const;
     const TArray<FContinentalBlendCache>& GetContinentalAmplificationBlendCacheForTests() const { return ContinentalAmplificationBlendCache; }
 
@@ -2035,6 +2716,15 @@ private:
     bool bForceStageBGPUReplayForTests = false;
 #endif
     mutable FRidgeDirectionFloatSoA RidgeDirectionFloatSoA;
+    mutable FTriangleQualityCache TriangleQualityCache;
+    FRidgeBoundarySegmentIndex RidgeBoundarySegmentIndex;
+    FTerraneCollisionIndex TerraneCollisionIndex;
+    FThermalFieldIndex ThermalFieldIndex;
+    /** Bumped by InvalidatePlateMetadata; PlateMetadata, PlateTopologyCandidates and BoundaryTable rebuild when it moves. */
+    uint64 PlateMetadataSerial = 1;
+    mutable FPlateMetadataTable PlateMetadata;
+    FPlateTopologyCandidateTracker PlateTopologyCandidates;
+    FPlateBoundaryTable BoundaryTable;
     mutable TMap<int32, FPlateBoundarySummary> PlateBoundarySummaries;
     mutable int32 PlateBoundarySummaryTopologyVersion = INDEX_NONE;
 
@@ -2059,6 +2749,7 @@ private:
     mutable int32 LastRidgeGradientFallbackCount = 0;
     mutable int32 LastRidgePlateFallbackCount = 0;
     mutable int32 LastRidgeMotionFallbackCount = 0;
+    mutable int32 LastRidgeSegmentIndexHitCount = 0;
     mutable int32 LastRidgeOceanicVertexCount = 0;
     mutable int32 LastRidgeValidTangentCount = 0;
     mutable double LastRidgeTangentCoveragePercent = 0.0;
@@ -2163,6 +2854,8 @@ private:
     bool IsContinentalReadbackInFlight(const TSharedPtr<FRHIGPUBufferReadback, ESPMode::ThreadSafe>&) const { return false; }
 #endif
 
+    void RegisterRenderVertexColumns();
+    void RestoreHistorySnapshot(int32 Index);
     void RefreshRenderVertexFloatSoA() const;
     void RefreshOceanicAmplificationFloatInputs() const;
     void InvalidateOceanicAmplificationFloatInputs();
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/TripleBuffer.h"
+#include "HAL/Runnable.h"
+#include "Templates/Function.h"
+#include "Simulation/TectonicSimulationController.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+class UTectonicSimulationService;
+
+/** Service state shown by the tool panel; published with each frame so the UI never reads the live service mid-step. */
+struct FTectonicSimulationUIState
+{
+    FTectonicSimulationParameters Parameters;
+    EHeightmapPaletteMode HeightmapPaletteMode = EHeightmapPaletteMode::AbsoluteHypsometric;
+    EStageBAmplificationReadyReason StageBNotReadyReason = EStageBAmplificationReadyReason::None;
+    double CurrentTimeMy = 0.0;
+    int32 HistoryIndex = INDEX_NONE;
+    int32 HistorySize = 0;
+    bool bCanUndo = false;
+    bool bCanRedo = false;
+    bool bHighlightSeaLevel = false;
+    bool bStageBReady = false;
+
+    /** Copy from the service (caller guarantees the service is not mid-step). */
+    void Capture(const UTectonicSimulationService& Service);
+};
+
+/** Service edit run by the worker between batches; returns true when the edit needs a new frame meshed. */
+using FTectonicSimulationMutation = TUniqueFunction<bool(UTectonicSimulationService&)>;
+
+/** One queued worker request: either a step count or an edit. */
+struct FTectonicSimulationCommand
+{
+    int32 Steps = 0;
+    FTectonicSimulationMutation Mutation;
+};
+
+/**
+ * Simulation state published by the worker after each batch of steps.
+ * Versions match the service at capture time, so the controller's LOD cache can key off them directly.
+ */
+struct FTectonicSimulationFrame
+{
+    /** Monotonic publish counter (1 for the first frame). */
+    int32 FrameSerial = 0;
+    int32 TopologyVersion = 0;
+    int32 SurfaceDataVersion = 0;
+    int32 RenderLevel = 0;
+    double CurrentTimeMy = 0.0;
+    double LastStepTimeMs = 0.0;
+    int32 StepsAdvanced = 0;
+    int32 PlateCount = 0;
+    int32 RenderVertexCount = 0;
+    int32 RenderTriangleCount = 0;
+    UTectonicSimulationService::FRetessellationCadenceStats RetessellationCadenceStats;
+    FTectonicSimulationUIState UIState;
+
+    /** Render state for meshing; the controller moves it out when the frame is applied. */
+    FMeshBuildSnapshot Snapshot;
+};
+
+using FTectonicSimulationFramePtr = TSharedPtr<FTectonicSimulationFrame, ESPMode::ThreadSafe>;
+
+/**
+ * Runs UTectonicSimulationService::AdvanceSteps on a dedicated thread.
+ *
+ * There is no private copy of the simulation state: steps and edits run on the live service under its
+ * simulation state lock. While IsBusy() is true, any reader other than a published frame must either hold
+ * UTectonicSimulationService::GetSimulationStateLock() or stay off the service; the controller's
+ * IsSimulationWorkerBusy() is the gate for game-thread code. Frames are handed over through a lock-free
+ * triple buffer; the game thread is the only reader.
+ *
+ * Step requests and edits share one ordered queue, so they reach the service in the order they were made.
+ */
+class FTectonicSimulationWorker : public FRunnable
+{
+public:
+    explicit FTectonicSimulationWorker(UTectonicSimulationService& InService);
+    virtual ~FTectonicSimulationWorker() override;
+
+    /** Spawns the worker thread. Returns false if the thread could not be created. */
+    bool Start();
+
+    /** Queue steps (game thread). Consecutive step requests are merged into one AdvanceSteps call. */
+    void RequestSteps(int32 Steps, EElevationMode ElevationMode);
+
+    /**
+     * Queue a service edit (game thread). It runs under the state lock after every step and edit requested
+     * before it and before any requested after it; a frame is published if it asks for one.
+     */
+    void EnqueueMutation(FTectonicSimulationMutation&& Mutation, EElevationMode ElevationMode);
+
+    /** True while steps or edits are queued or being simulated. */
+    bool IsBusy() const;
+
+    /** True when steps are queued behind the batch in flight. */
+    bool HasPendingSteps() const { return PendingSteps.load(std::memory_order_acquire) > 0; }
+
+    /** Block until queued steps have been simulated and published (or the timeout elapses). */
+    bool WaitUntilIdle(double TimeoutSeconds = 30.0) const;
+
+    /** Game thread: take the newest published frame if one arrived since the last call. */
+    bool ConsumeLatestFrame(FTectonicSimulationFramePtr& OutFrame);
+
+    int32 GetPublishedFrameCount() const { return PublishedFrameCount.load(std::memory_order_acquire); }
+
+    //~ FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    /** Run up to CommandCount queued commands in order, then publish a frame when any changed the service. */
+    void SimulateBatch(int32 CommandCount);
+
+    UTectonicSimulationService* Service = nullptr;
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+
+    std::atomic<int32> PendingSteps{0};
+    std::atomic<int32> PendingCommands{0};
+    std::atomic<bool> bBatchInFlight{false};
+    std::atomic<bool> bStopRequested{false};
+    std::atomic<uint8> RequestedElevationMode{static_cast<uint8>(EElevationMode::Flat)};
+    std::atomic<int32> PublishedFrameCount{0};
+
+    /** Single producer (game thread), single consumer (worker). */
+    TQueue<FTectonicSimulationCommand, EQueueMode::Spsc> Commands;
+
+    TTripleBuffer<FTectonicSimulationFramePtr> Frames;
+};
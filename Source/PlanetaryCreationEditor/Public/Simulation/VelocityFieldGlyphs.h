@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// VelocityFieldGlyphs.h
+// Arrows for the velocity overlay, sampled on an equal-angle cube-sphere grid: each grid cell shows the velocity of the
+// render vertex nearest its center. Cells are fixed on the sphere, so arrows do not swim as the simulation advances.
+// The grid is refined with the camera LOD band and capped by an arrow budget, and the glyphs depend only on surface
+// data, topology and the band, so the controller rebuilds them only when one of those changes.
+
+struct FVelocityFieldArrow
+{
+    FVector3f Tail = FVector3f::ZeroVector;
+    FVector3f Tip = FVector3f::ZeroVector;
+    FVector3f HeadLeft = FVector3f::ZeroVector;
+    FVector3f HeadRight = FVector3f::ZeroVector;
+    FColor Color = FColor::White;
+};
+
+struct PLANETARYCREATIONEDITOR_API FVelocityFieldGlyphs
+{
+    int32 SurfaceDataVersion = INDEX_NONE;
+    int32 TopologyVersion = INDEX_NONE;
+    int32 LODBand = INDEX_NONE;
+    int32 CellsPerFaceEdge = 0;
+    int32 VertexCount = 0;
+    float RadiusUE = 0.0f;
+
+    /** One arrow per occupied cell with a non-zero velocity, in cell order. */
+    TArray<FVelocityFieldArrow> Arrows;
+
+    /** Render vertex shown by each arrow. */
+    TArray<int32> SampleVertices;
+
+    bool Matches(int32 InSurfaceDataVersion, int32 InTopologyVersion, int32 InCellsPerFaceEdge, int32 InVertexCount, float InRadiusUE) const
+    {
+        return SurfaceDataVersion == InSurfaceDataVersion && TopologyVersion == InTopologyVersion &&
+            CellsPerFaceEdge == InCellsPerFaceEdge && VertexCount == InVertexCount && RadiusUE == InRadiusUE;
+    }
+
+    void Reset();
+
+    /** Grid resolution for a camera LOD band: 2 + 2 * band cells per face edge, capped so 6 * N^2 <= MaxArrows (0 = no cap). */
+    static int32 GetCellsPerFaceEdge(int32 InLODBand, int32 MaxArrows);
+
+    /** Cell of a unit vector: face * N^2 + row * N + column. */
+    static int32 GetCubeSphereCell(const FVector3d& UnitPosition, int32 InCellsPerFaceEdge);
+    static FVector3d GetCubeSphereCellCenter(int32 Cell, int32 InCellsPerFaceEdge);
+
+    /** Sample RenderVertices/VertexVelocities on the grid and build arrows lifted OffsetUE above a sphere of InRadiusUE. */
+    void Build(int32 InSurfaceDataVersion, int32 InTopologyVersion, int32 InLODBand, int32 InCellsPerFaceEdge,
+        float InRadiusUE, float OffsetUE, const TArray<FVector3d>& RenderVertices, const TArray<FVector3d>& VertexVelocities);
+};
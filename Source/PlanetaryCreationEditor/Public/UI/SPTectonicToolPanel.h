@@ -4,9 +4,9 @@
 #include "Widgets/Input/SComboBox.h"
 #include "Simulation/TectonicSimulationService.h"
 #include "Simulation/TectonicPlaybackController.h"
+#include "Simulation/TectonicSimulationWorker.h"
 #include "Templates/Function.h"
 #include "StageB/StageBAmplificationTypes.h"
-#include "Delegates/Delegate.h"
 
 class FTectonicSimulationController;
 struct FTectonicSimulationParameters;
@@ -34,6 +34,7 @@ private:
     FText GetCurrentTimeLabel() const;
     FText GetPlateCountLabel() const;
     FText GetPerformanceStatsLabel() const; // Milestone 3 Task 4.5
+    FText GetLODCacheStatsLabel() const;
     FText GetRetessellationStatsLabel() const;
 
     // Milestone 5 Task 1.1: Playback controls
@@ -127,7 +128,7 @@ private:
     ECheckBoxState GetContinentalAmplificationState() const;
     void OnContinentalAmplificationChanged(ECheckBoxState NewState);
 
-    void ApplySurfaceProcessMutation(TFunctionRef<bool(FTectonicSimulationParameters&)> Mutator, const TCHAR* ChangeLabel) const;
+    void ApplySurfaceProcessMutation(TFunction<bool(FTectonicSimulationParameters&)> Mutator, const TCHAR* ChangeLabel) const;
     FReply HandlePaperReadyClicked();
     FReply HandleExportHeightmapClicked();
     FReply HandlePrimeGPUStageBClicked();
@@ -157,10 +158,9 @@ private:
     TSharedRef<SWidget> BuildStageBSection();
     TSharedRef<SWidget> BuildSurfaceProcessesSection();
     TSharedRef<SWidget> BuildCameraSection();
-    void RefreshStageBReadinessFromService();
+    /** Refresh SimulationUIState from the controller (published frame while the worker is busy). */
+    void RefreshSimulationUIState();
     void HandleStageBReadyChanged(bool bReady, EStageBAmplificationReadyReason Reason);
-    void RefreshCachedPaletteMode();
-    void BindStageBReadyDelegate();
     bool ApplyPaperReadyPreset();
 
     TWeakPtr<FTectonicSimulationController> ControllerWeak;
@@ -183,6 +183,9 @@ private:
     EStageBAmplificationReadyReason CachedStageBReason = EStageBAmplificationReadyReason::None;
     EHeightmapPaletteMode CachedPaletteMode = EHeightmapPaletteMode::AbsoluteHypsometric;
     FText CachedPaletteStatusText;
-    FDelegateHandle StageBReadyDelegateHandle;
+
+    // Service state read by the getters; never read the live service from Slate attributes.
+    FTectonicSimulationUIState SimulationUIState;
+    bool bHasSimulationUIState = false;
     bool bPaperReadyApplied = false;
 };